@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "mimir/algorithms/kpkc.hpp"
+
+#include <benchmark/benchmark.h>
+#include <random>
+
+namespace mimir::benchmarks
+{
+
+struct KPartiteGraphData
+{
+    std::vector<boost::dynamic_bitset<>> adjacency_matrix;
+    std::vector<std::vector<size_t>> partitions;
+};
+
+/// @brief Create a random k-partite graph with consecutive vertex indices per partition.
+static KPartiteGraphData create_random_k_partite_graph(size_t k, size_t partition_size, double edge_probability)
+{
+    auto rng = std::mt19937(42);
+    auto distribution = std::bernoulli_distribution(edge_probability);
+
+    auto data = KPartiteGraphData { std::vector<boost::dynamic_bitset<>>(k * partition_size, boost::dynamic_bitset<>(k * partition_size)),
+                                    std::vector<std::vector<size_t>>(k) };
+    for (size_t vertex = 0; vertex < k * partition_size; ++vertex)
+    {
+        data.partitions[vertex / partition_size].push_back(vertex);
+    }
+    for (size_t source = 0; source < k * partition_size; ++source)
+    {
+        for (size_t target = source + 1; target < k * partition_size; ++target)
+        {
+            if (source / partition_size != target / partition_size && distribution(rng))
+            {
+                data.adjacency_matrix[source][target] = 1;
+                data.adjacency_matrix[target][source] = 1;
+            }
+        }
+    }
+    return data;
+}
+
+/// @brief Arguments: k, partition size, edge probability in percent.
+static void BM_FindAllKCliquesBoost(benchmark::State& state)
+{
+    const auto data = create_random_k_partite_graph(state.range(0), state.range(1), state.range(2) / 100.0);
+
+    auto cliques = std::vector<std::vector<size_t>> {};
+    for (auto _ : state)
+    {
+        cliques.clear();
+        find_all_k_cliques_in_k_partite_graph(data.adjacency_matrix, data.partitions, cliques);
+        benchmark::DoNotOptimize(cliques.data());
+    }
+    state.counters["cliques"] = cliques.size();
+}
+
+/// @brief Arguments: k, partition size, edge probability in percent, instruction set.
+static void BM_FindAllKCliquesKPartiteGraph(benchmark::State& state)
+{
+    const auto instruction_set = static_cast<KPKCInstructionSet>(state.range(3));
+    if (!is_supported(instruction_set))
+    {
+        state.SkipWithError("instruction set is not supported");
+        return;
+    }
+
+    const auto data = create_random_k_partite_graph(state.range(0), state.range(1), state.range(2) / 100.0);
+
+    // Include building the adjacency matrix since the condition grounder rebuilds it for every state.
+    auto graph = KPartiteGraph(data.partitions, instruction_set);
+    auto cliques = std::vector<std::vector<size_t>> {};
+    for (auto _ : state)
+    {
+        graph.reset();
+        for (size_t source = 0; source < data.adjacency_matrix.size(); ++source)
+        {
+            const auto& row = data.adjacency_matrix[source];
+            for (auto target = row.find_next(source); target < row.size(); target = row.find_next(target))
+            {
+                graph.add_edge(source, target);
+            }
+        }
+        cliques.clear();
+        graph.find_all_k_cliques(cliques);
+        benchmark::DoNotOptimize(cliques.data());
+    }
+    state.counters["cliques"] = cliques.size();
+}
+
+static void KCliqueArguments(benchmark::internal::Benchmark* benchmark)
+{
+    benchmark->ArgNames({ "k", "n", "p" });
+    for (const auto& [k, partition_size, edge_probability] : { std::tuple(3, 50, 30), std::tuple(3, 200, 10), std::tuple(4, 100, 20), std::tuple(5, 40, 50) })
+    {
+        benchmark->Args({ k, partition_size, edge_probability });
+    }
+}
+
+static void KCliqueInstructionSetArguments(benchmark::internal::Benchmark* benchmark)
+{
+    benchmark->ArgNames({ "k", "n", "p", "isa" });
+    for (const auto& [k, partition_size, edge_probability] : { std::tuple(3, 50, 30), std::tuple(3, 200, 10), std::tuple(4, 100, 20), std::tuple(5, 40, 50) })
+    {
+        for (const auto instruction_set : { KPKCInstructionSet::SCALAR, KPKCInstructionSet::AVX2, KPKCInstructionSet::AVX512 })
+        {
+            benchmark->Args({ k, partition_size, edge_probability, static_cast<int64_t>(instruction_set) });
+        }
+    }
+}
+
+BENCHMARK(BM_FindAllKCliquesBoost)->Apply(KCliqueArguments);
+BENCHMARK(BM_FindAllKCliquesKPartiteGraph)->Apply(KCliqueInstructionSetArguments);
+
+}
@@ -93,7 +93,46 @@ int main(int argc, char** argv)
     {
         heuristic = std::make_shared<BlindHeuristic>();
     }
-    assert(heuristic);
+    else if (auto grounded_aag = std::dynamic_pointer_cast<GroundedApplicableActionGenerator>(applicable_action_generator))
+    {
+        if (heuristic_type == 1)
+        {
+            heuristic = std::make_shared<HMaxHeuristic>(grounded_aag);
+        }
+        else if (heuristic_type == 2)
+        {
+            heuristic = std::make_shared<HAddHeuristic>(grounded_aag);
+        }
+        else if (heuristic_type == 3)
+        {
+            heuristic = std::make_shared<HFFHeuristic>(grounded_aag);
+        }
+        else if (heuristic_type == 4)
+        {
+            heuristic = std::make_shared<LMCutHeuristic>(grounded_aag, std::make_shared<DefaultLMCutHeuristicEventHandler>(!debug));
+        }
+        else if (heuristic_type == 5)
+        {
+            heuristic = std::make_shared<CanonicalPDBHeuristic>(grounded_aag);
+        }
+    }
+    else if (auto lifted_aag = std::dynamic_pointer_cast<LiftedApplicableActionGenerator>(applicable_action_generator))
+    {
+        if (heuristic_type == 2)
+        {
+            heuristic = std::make_shared<LiftedHAddHeuristic>(lifted_aag);
+        }
+        else if (heuristic_type == 3)
+        {
+            heuristic = std::make_shared<LiftedHFFHeuristic>(lifted_aag);
+        }
+    }
+    if (!heuristic)
+    {
+        std::cerr << "Unsupported heuristic type: " << heuristic_type
+                  << " (0=blind, 1=hmax (grounded only), 2=hadd, 3=hff, 4=lmcut (grounded only), 5=cpdb (grounded only))" << std::endl;
+        return 1;
+    }
 
     auto astar = std::make_shared<AStarAlgorithm>(applicable_action_generator, successor_state_generator, heuristic, event_handler);
 
@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "mimir/mimir.hpp"
+
+#include <fstream>
+#include <iostream>
+
+using namespace mimir;
+
+int main(int argc, char** argv)
+{
+    if (argc != 10)
+    {
+        std::cout << "Usage: planner_gbfs <domain:str> <problem:str> <plan:str> <heuristic_type:int> <grounded:bool> <weight:double> <lazy:bool> "
+                     "<preferred:bool> <debug:bool>"
+                  << std::endl;
+        std::cout << "A weight of 0 runs greedy best-first search, any other weight runs weighted A* with the given weight." << std::endl;
+        return 1;
+    }
+
+    const auto domain_file_path = fs::path { argv[1] };
+    const auto problem_file_path = fs::path { argv[2] };
+    const auto plan_file_name = argv[3];
+    const auto heuristic_type = atoi(argv[4]);
+    const auto grounded = static_cast<bool>(std::atoi(argv[5]));
+    const auto weight = std::atof(argv[6]);
+    const auto lazy = static_cast<bool>(std::atoi(argv[7]));
+    const auto preferred = static_cast<bool>(std::atoi(argv[8]));
+    const auto debug = static_cast<bool>(std::atoi(argv[9]));
+
+    std::cout << "Parsing PDDL files..." << std::endl;
+
+    auto parser = PDDLParser(domain_file_path, problem_file_path);
+
+    auto applicable_action_generator = (grounded) ? std::shared_ptr<IApplicableActionGenerator> { std::make_shared<GroundedApplicableActionGenerator>(
+                                           parser.get_problem(),
+                                           parser.get_pddl_factories(),
+                                           std::make_shared<DebugGroundedApplicableActionGeneratorEventHandler>(false)) } :
+                                                    std::shared_ptr<IApplicableActionGenerator> { std::make_shared<LiftedApplicableActionGenerator>(
+                                                        parser.get_problem(),
+                                                        parser.get_pddl_factories(),
+                                                        std::make_shared<DebugLiftedApplicableActionGeneratorEventHandler>(false)) };
+
+    auto successor_state_generator = std::make_shared<StateRepository>(applicable_action_generator);
+
+    auto event_handler = (debug) ? std::shared_ptr<IGBFSAlgorithmEventHandler> { std::make_shared<DebugGBFSAlgorithmEventHandler>(false) } :
+                                   std::shared_ptr<IGBFSAlgorithmEventHandler> { std::make_shared<DefaultGBFSAlgorithmEventHandler>(false) };
+
+    auto heuristic = std::shared_ptr<IHeuristic>(nullptr);
+    if (heuristic_type == 0)
+    {
+        heuristic = std::make_shared<BlindHeuristic>();
+    }
+    else if (auto grounded_aag = std::dynamic_pointer_cast<GroundedApplicableActionGenerator>(applicable_action_generator))
+    {
+        if (heuristic_type == 1)
+        {
+            heuristic = std::make_shared<HMaxHeuristic>(grounded_aag);
+        }
+        else if (heuristic_type == 2)
+        {
+            heuristic = std::make_shared<HAddHeuristic>(grounded_aag);
+        }
+        else if (heuristic_type == 3)
+        {
+            heuristic = std::make_shared<HFFHeuristic>(grounded_aag);
+        }
+    }
+    else if (auto lifted_aag = std::dynamic_pointer_cast<LiftedApplicableActionGenerator>(applicable_action_generator))
+    {
+        if (heuristic_type == 2)
+        {
+            heuristic = std::make_shared<LiftedHAddHeuristic>(lifted_aag);
+        }
+        else if (heuristic_type == 3)
+        {
+            heuristic = std::make_shared<LiftedHFFHeuristic>(lifted_aag);
+        }
+    }
+    if (!heuristic)
+    {
+        std::cerr << "Unsupported heuristic type: " << heuristic_type << " (0=blind, 1=hmax (grounded only), 2=hadd, 3=hff)" << std::endl;
+        return 1;
+    }
+
+    auto options = GBFSAlgorithmOptions();
+    options.g_weight = (weight == 0.) ? 0. : 1.;
+    options.h_weight = (weight == 0.) ? 1. : weight;
+    options.evaluation = (lazy) ? HeuristicEvaluation::LAZY : HeuristicEvaluation::EAGER;
+    options.use_preferred_actions = preferred;
+
+    auto gbfs = std::make_shared<GBFSAlgorithm>(applicable_action_generator, successor_state_generator, heuristic, event_handler, options);
+
+    auto planner = std::make_shared<SinglePlanner>(std::move(gbfs));
+
+    auto [stats, plan] = planner->find_solution();
+
+    if (stats == SearchStatus::SOLVED)
+    {
+        std::ofstream plan_file;
+        plan_file.open(plan_file_name);
+        if (!plan_file.is_open())
+        {
+            std::cerr << "Error opening file!" << std::endl;
+            return 1;
+        }
+        plan_file << plan;
+        plan_file.close();
+    }
+
+    return 0;
+}
@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "mimir/mimir.hpp"
+
+#include <fstream>
+#include <iostream>
+
+using namespace mimir;
+
+int main(int argc, char** argv)
+{
+    if (argc != 7)
+    {
+        std::cout << "Usage: planner_hdastar <domain:str> <problem:str> <plan:str> <heuristic_type:int> <num_threads:int> <debug:bool>" << std::endl;
+        return 1;
+    }
+
+    const auto domain_file_path = fs::path { argv[1] };
+    const auto problem_file_path = fs::path { argv[2] };
+    const auto plan_file_name = argv[3];
+    const auto heuristic_type = atoi(argv[4]);
+    const auto num_threads = std::atoi(argv[5]);
+    const auto debug = static_cast<bool>(std::atoi(argv[6]));
+
+    std::cout << "Parsing PDDL files..." << std::endl;
+
+    auto parser = PDDLParser(domain_file_path, problem_file_path);
+
+    if (debug)
+    {
+        std::cout << "Domain:" << std::endl;
+        std::cout << *parser.get_domain() << std::endl;
+
+        std::cout << std::endl;
+        std::cout << "Problem:" << std::endl;
+        std::cout << *parser.get_problem() << std::endl;
+
+        std::cout << std::endl;
+        std::cout << "Static Predicates:" << std::endl;
+        std::cout << parser.get_domain()->get_predicates<Static>() << std::endl;
+
+        std::cout << std::endl;
+        std::cout << "Fluent Predicates:" << std::endl;
+        std::cout << parser.get_domain()->get_predicates<Fluent>() << std::endl;
+
+        std::cout << std::endl;
+        std::cout << "Derived Predicates:" << std::endl;
+        std::cout << parser.get_domain()->get_predicates<Derived>() << std::endl;
+        std::cout << std::endl;
+    }
+
+    // The workers share the applicable action generator, which requires grounding.
+    auto applicable_action_generator = std::make_shared<GroundedApplicableActionGenerator>(
+        parser.get_problem(),
+        parser.get_pddl_factories(),
+        std::make_shared<DebugGroundedApplicableActionGeneratorEventHandler>(false));
+
+    auto event_handler = (debug) ? std::shared_ptr<IHDAStarAlgorithmEventHandler> { std::make_shared<DebugHDAStarAlgorithmEventHandler>(false) } :
+                                   std::shared_ptr<IHDAStarAlgorithmEventHandler> { std::make_shared<DefaultHDAStarAlgorithmEventHandler>(false) };
+
+    auto heuristic_factory = HeuristicFactory(nullptr);
+    if (heuristic_type == 0)
+    {
+        heuristic_factory = [] { return std::make_shared<BlindHeuristic>(); };
+    }
+    else if (heuristic_type == 1)
+    {
+        heuristic_factory = [applicable_action_generator] { return std::make_shared<HMaxHeuristic>(applicable_action_generator); };
+    }
+    else if (heuristic_type == 4)
+    {
+        heuristic_factory = [applicable_action_generator] { return std::make_shared<LMCutHeuristic>(applicable_action_generator); };
+    }
+    else if (heuristic_type == 5)
+    {
+        heuristic_factory = [applicable_action_generator] { return std::make_shared<CanonicalPDBHeuristic>(applicable_action_generator); };
+    }
+    if (!heuristic_factory)
+    {
+        std::cerr << "Unsupported heuristic type: " << heuristic_type << " (0=blind, 1=hmax, 4=lmcut, 5=cpdb)" << std::endl;
+        return 1;
+    }
+
+    auto options = HDAStarAlgorithmOptions();
+    if (num_threads > 0)
+    {
+        options.num_threads = num_threads;
+    }
+
+    auto hdastar = std::make_shared<HDAStarAlgorithm>(applicable_action_generator, heuristic_factory, event_handler, options);
+
+    auto planner = std::make_shared<SinglePlanner>(std::move(hdastar));
+
+    auto [stats, plan] = planner->find_solution();
+
+    if (stats == SearchStatus::SOLVED)
+    {
+        std::ofstream plan_file;
+        plan_file.open(plan_file_name);
+        if (!plan_file.is_open())
+        {
+            std::cerr << "Error opening file!" << std::endl;
+            return 1;
+        }
+        plan_file << plan;
+        plan_file.close();
+    }
+
+    return 0;
+}
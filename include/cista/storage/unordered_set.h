@@ -86,6 +86,8 @@ public:
 
     bool empty() const { return m_elements.empty(); }
     size_t size() const { return m_elements.size(); }
+    /// @brief Return the number of bytes of the serialized elements, not accounting for the hash table.
+    size_t num_bytes() const { return m_storage.size(); }
 
     /**
      * Modifiers
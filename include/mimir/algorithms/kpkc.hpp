@@ -18,7 +18,10 @@
 #ifndef MIMIR_ALGORITHMS_KPKC_HPP_
 #define MIMIR_ALGORITHMS_KPKC_HPP_
 
+#include "mimir/common/aligned_allocator.hpp"
+
 #include <boost/dynamic_bitset.hpp>
+#include <cstdint>
 #include <vector>
 
 namespace mimir
@@ -27,6 +30,86 @@ namespace mimir
 void find_all_k_cliques_in_k_partite_graph(const std::vector<boost::dynamic_bitset<>>& adjacency_matrix,
                                            const std::vector<std::vector<size_t>>& partitions,
                                            std::vector<std::vector<std::size_t>>& out_cliques);
+
+/// @brief `KPKCInstructionSet` selects the kernels for the word-wise bitset operations of the `KPartiteGraph`.
+enum class KPKCInstructionSet
+{
+    SCALAR,
+    AVX2,
+    AVX512,
+};
+
+/// @brief Return the best instruction set that is supported by the CPU at runtime.
+extern KPKCInstructionSet get_best_kpkc_instruction_set();
+
+/// @brief Return true iff the CPU supports the given instruction set.
+extern bool is_supported(KPKCInstructionSet instruction_set);
+
+/// @brief `KPartiteGraph` enumerates all k-cliques in a k-partite graph.
+///
+/// The adjacency matrix is stored flat and word-packed with one 64-byte aligned row per vertex.
+/// Each row consists of one word-aligned segment per partition such that the compatible vertices of a partition
+/// can be restricted and counted with word-wise AND and popcount kernels.
+/// The compatible vertices of each recursion depth are stored in preallocated scratch buffers.
+/// The graph is meant to be reused: `reset` removes all edges but keeps the memory.
+class KPartiteGraph
+{
+public:
+    using Block = uint64_t;
+    using BlockList = std::vector<Block, AlignedAllocator<Block, 64>>;
+
+private:
+    std::vector<std::vector<size_t>> m_partitions;
+    size_t m_num_vertices;
+    size_t m_k;
+
+    /* Layout */
+    std::vector<size_t> m_partition_block_offsets;
+    std::vector<size_t> m_partition_num_blocks;
+    std::vector<size_t> m_vertex_partitions;
+    std::vector<size_t> m_vertex_positions;
+    size_t m_row_num_blocks;
+
+    /* Adjacency matrix */
+    BlockList m_adjacency_matrix;
+
+    /* Kernels */
+    void (*m_and_kernel)(Block* out, const Block* lhs, const Block* rhs, size_t num_blocks);
+    size_t (*m_popcount_kernel)(const Block* blocks, size_t num_blocks);
+
+    /* Preallocated buffers */
+    BlockList m_compatible_vertices;  ///< One row per recursion depth
+    std::vector<size_t> m_num_compatible_vertices;  ///< One entry per recursion depth and partition
+    std::vector<bool> m_partition_used;
+    std::vector<size_t> m_partial_solution;
+
+    void find_all_k_cliques_helper(size_t depth, std::vector<size_t>& out_cliques);
+
+public:
+    /// @brief Create a graph without edges.
+    /// @param partitions are the vertices of each partition. The vertices must be in the range 0, ..., n-1 where n is the total number of vertices.
+    /// @param instruction_set are the kernels that are used, defaults to the best instruction set supported at runtime.
+    explicit KPartiteGraph(std::vector<std::vector<size_t>> partitions, KPKCInstructionSet instruction_set = get_best_kpkc_instruction_set());
+
+    /// @brief Remove all edges.
+    void reset();
+
+    /// @brief Add an undirected edge between two vertices of different partitions.
+    void add_edge(size_t source, size_t target);
+
+    /// @brief Find all cliques of size k where k is the number of partitions.
+    /// Each clique lists one vertex for each partition in the order in which they were chosen.
+    void find_all_k_cliques(std::vector<std::vector<size_t>>& out_cliques);
+
+    /// @brief Find all cliques of size k where k is the number of partitions.
+    /// The cliques are appended to a flat buffer where each clique occupies k consecutive entries.
+    /// Reusing the buffer across calls avoids allocations once it reached its maximum size.
+    void find_all_k_cliques(std::vector<size_t>& out_cliques);
+
+    const std::vector<std::vector<size_t>>& get_partitions() const;
+    size_t get_num_vertices() const;
+};
+
 }
 
 #endif  // MIMIR_ALGORITHMS_KPKC_HPP_
@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIMIR_ALGORITHMS_MPSC_QUEUE_HPP_
+#define MIMIR_ALGORITHMS_MPSC_QUEUE_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+namespace mimir
+{
+
+/// @brief `MPSCQueue` is a lock-free unbounded queue for multiple producers and a single consumer.
+///
+/// Producers push onto an intrusive linked list with a compare-and-swap on the head.
+/// The consumer detaches the whole list with a single exchange, which avoids the ABA problem,
+/// and reverses it to process the elements in the order in which they were pushed.
+template<typename T>
+class MPSCQueue
+{
+private:
+    struct Node
+    {
+        T value;
+        Node* next;
+    };
+
+    std::atomic<Node*> m_head;
+
+public:
+    MPSCQueue() : m_head(nullptr) {}
+
+    // Uncopyable
+    MPSCQueue(const MPSCQueue& other) = delete;
+    MPSCQueue& operator=(const MPSCQueue& other) = delete;
+    // Unmovable
+    MPSCQueue(MPSCQueue&& other) = delete;
+    MPSCQueue& operator=(MPSCQueue&& other) = delete;
+
+    ~MPSCQueue()
+    {
+        consume_all([](T&&) {});
+    }
+
+    /// @brief Push a value. Can be called concurrently by any number of threads.
+    void push(T value)
+    {
+        auto node = new Node { std::move(value), m_head.load(std::memory_order_relaxed) };
+        while (!m_head.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed)) {}
+    }
+
+    /// @brief Remove all values and pass them to the callback in the order in which they were pushed.
+    /// Must only be called by the consumer thread.
+    /// @return the number of consumed values.
+    template<typename Callback>
+    size_t consume_all(Callback&& callback)
+    {
+        auto node = m_head.exchange(nullptr, std::memory_order_acquire);
+
+        // Reverse the list to restore the push order.
+        Node* reversed = nullptr;
+        while (node)
+        {
+            auto next = node->next;
+            node->next = reversed;
+            reversed = node;
+            node = next;
+        }
+
+        size_t count = 0;
+        while (reversed)
+        {
+            auto next = reversed->next;
+            callback(std::move(reversed->value));
+            delete reversed;
+            reversed = next;
+            ++count;
+        }
+        return count;
+    }
+
+    /// @brief Return true iff no value was pushed since the last call to `consume_all`.
+    bool empty() const { return m_head.load(std::memory_order_acquire) == nullptr; }
+};
+
+}
+
+#endif
@@ -67,8 +67,9 @@ public:
     /// @param target is the index of the target vertex.
     void add_edge(size_t source, size_t target);
 
-    /// @brief Compute a compressed string representation of the canonical graph of the graph.
-    std::string compute_certificate() const;
+    /// @brief Compute the canonical graph of the graph in compressed sparse row format.
+    /// The memory of the certificate is reused, hence, the reference is only valid until the next call.
+    const mimir::NautyCertificate& compute_certificate() const;
 
     /// @brief Clear the graph data structures by changing the number of vertices and removing all edges.
     /// @param num_vertices is the new number of vertices.
@@ -115,8 +116,9 @@ public:
     /// @param target is the index of the target vertex.
     void add_edge(size_t source, size_t target);
 
-    /// @brief Compute a compressed string representation of the canonical graph of the graph.
-    std::string compute_certificate();
+    /// @brief Compute the canonical graph of the graph in compressed sparse row format.
+    /// The memory of the certificate is reused, hence, the reference is only valid until the next call.
+    const mimir::NautyCertificate& compute_certificate();
 
     /// @brief Clear the graph data structures by changing the number of vertices and removing all edges.
     /// @param num_vertices is the new number of vertices.
@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIMIR_COMMON_ALIGNED_ALLOCATOR_HPP_
+#define MIMIR_COMMON_ALIGNED_ALLOCATOR_HPP_
+
+#include <cstddef>
+#include <new>
+
+namespace mimir
+{
+
+/// @brief `AlignedAllocator` allocates memory that is aligned to `Alignment` bytes, e.g., to a cache line for SIMD kernels.
+template<typename T, std::size_t Alignment>
+class AlignedAllocator
+{
+    static_assert(Alignment >= alignof(T) && (Alignment & (Alignment - 1)) == 0, "Alignment must be a power of two that is at least alignof(T).");
+
+public:
+    using value_type = T;
+
+    template<typename U>
+    struct rebind
+    {
+        using other = AlignedAllocator<U, Alignment>;
+    };
+
+    AlignedAllocator() noexcept = default;
+
+    template<typename U>
+    AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept
+    {
+    }
+
+    T* allocate(std::size_t n) { return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(Alignment))); }
+
+    void deallocate(T* ptr, std::size_t) noexcept { ::operator delete(ptr, std::align_val_t(Alignment)); }
+
+    template<typename U>
+    bool operator==(const AlignedAllocator<U, Alignment>&) const noexcept
+    {
+        return true;
+    }
+};
+
+}
+
+#endif
@@ -22,28 +22,32 @@
 #include "mimir/graphs/declarations.hpp"
 
 #include <memory>
-#include <string>
 #include <vector>
 
 namespace mimir
 {
+/// @brief `Certificate` identifies a graph up to isomorphism by its canonical graph and the colors of its vertices.
+/// The hash is computed once on construction, hence, lookups in hash tables only compare the binary data on hash collisions.
 class Certificate
 {
 private:
     size_t m_num_vertices;
     size_t m_num_edges;
-    std::string m_nauty_certificate;
+    NautyCertificate m_nauty_certificate;
     ColorList m_canonical_initial_coloring;
 
+    size_t m_hash;
+
 public:
-    Certificate(size_t num_vertices, size_t num_edges, std::string nauty_certificate, ColorList canonical_initial_coloring);
+    Certificate(size_t num_vertices, size_t num_edges, NautyCertificate nauty_certificate, ColorList canonical_initial_coloring);
 
     bool operator==(const Certificate& other) const;
 
     size_t get_num_vertices() const;
     size_t get_num_edges() const;
-    const std::string& get_nauty_certificate() const;
+    const NautyCertificate& get_nauty_certificate() const;
     const ColorList& get_canonical_initial_coloring() const;
+    size_t get_hash() const;
 };
 
 struct UniqueCertificateSharedPtrHash
@@ -45,6 +45,10 @@ using DegreeMap = std::unordered_map<VertexIndex, Degree>;
 using Color = uint32_t;
 using ColorList = std::vector<Color>;
 
+/// @brief `NautyCertificate` is the canonical graph computed by nauty in compressed sparse row format,
+/// i.e., the out-degrees of the vertices followed by their sorted adjacency lists.
+using NautyCertificate = std::vector<uint32_t>;
+
 }
 
 #endif
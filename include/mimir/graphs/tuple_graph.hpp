@@ -27,6 +27,8 @@
 #include "mimir/search/state.hpp"
 
 #include <ostream>
+#include <span>
+#include <thread>
 #include <vector>
 
 namespace mimir
@@ -42,15 +44,17 @@ class TupleGraphArityKComputation;
 using TupleVertexIndex = int;
 using TupleVertexIndexList = std::vector<TupleVertexIndex>;
 
+/// @brief `TupleGraphVertex` is a tuple together with the states in which the tuple becomes novel.
+/// The states are a view into the compact storage of the `TupleGraph` that owns the vertex.
 class TupleGraphVertex
 {
 private:
     TupleVertexIndex m_index;
     TupleIndex m_tuple_index;
-    StateList m_states;
+    std::span<const State> m_states;
 
 public:
-    TupleGraphVertex(TupleVertexIndex identifier, TupleIndex tuple_index, StateList states);
+    TupleGraphVertex(TupleVertexIndex identifier, TupleIndex tuple_index, std::span<const State> states);
 
     /**
      * Getters.
@@ -58,11 +62,13 @@ public:
 
     TupleVertexIndex get_index() const;
     TupleIndex get_tuple_index() const;
-    const StateList& get_states() const;
+    std::span<const State> get_states() const;
 };
 
 using TupleGraphVertexList = std::vector<TupleGraphVertex>;
 
+/// @brief `TupleGraph` stores the states of all vertices in a single compressed sparse row layout.
+/// The vertices refer into this storage, hence, a `TupleGraph` can be moved but not copied.
 class TupleGraph
 {
 private:
@@ -71,20 +77,29 @@ private:
     bool m_prune_dominated_tuples;
 
     StaticDigraph m_digraph;
+    IndexGroupedVector<const State> m_states_grouped_by_vertex;
     IndexGroupedVector<const TupleGraphVertex> m_vertices_grouped_by_distance;
     IndexGroupedVector<const State> m_states_grouped_by_distance;
 
+    /// @brief Create the tuple graph where the i-th vertex has the i-th tuple index and the states in the i-th group of `states_grouped_by_vertex`.
     TupleGraph(std::shared_ptr<StateSpace> state_space,
                std::shared_ptr<TupleIndexMapper> tuple_index_mapper,
                bool prune_dominated_tuples,
                StaticDigraph digraph,
-               IndexGroupedVector<const TupleGraphVertex> vertices_grouped_by_distance,
+               const TupleIndexList& vertex_tuple_indices,
+               IndexGroupedVector<const State> states_grouped_by_vertex,
+               const IndexGroupedVector<const TupleVertexIndex>& vertex_indices_grouped_by_distance,
                IndexGroupedVector<const State> states_grouped_by_distance);
 
     friend class TupleGraphArityZeroComputation;
     friend class TupleGraphArityKComputation;
 
 public:
+    TupleGraph(const TupleGraph& other) = delete;
+    TupleGraph& operator=(const TupleGraph& other) = delete;
+    TupleGraph(TupleGraph&& other) = default;
+    TupleGraph& operator=(TupleGraph&& other) = default;
+
     /// @brief Compute and return an admissible chain for a given tuple of ground atoms.
     /// Return std::nullopt if no such admissible chain exists.
     std::optional<TupleVertexIndexList> compute_admissible_chain(const GroundAtomList<Fluent>& fluent_atoms, const GroundAtomList<Derived>& derived_atoms);
@@ -103,6 +118,8 @@ public:
     const StaticDigraph& get_digraph() const;
     const IndexGroupedVector<const TupleGraphVertex>& get_vertices_grouped_by_distance() const;
     const IndexGroupedVector<const State>& get_states_grouped_by_distance() const;
+    /// @brief Return the states of the vertices where the i-th group are the states of the vertex with index i.
+    const IndexGroupedVector<const State>& get_states_grouped_by_vertex() const;
 };
 
 using TupleGraphList = std::vector<TupleGraph>;
@@ -119,13 +136,19 @@ private:
     TupleGraph create_for_arity_zero(State root_state);
 
     /// @brief Create a tuple graph for width k > 0.
-    TupleGraph create_for_arity_k(State root_state);
+    TupleGraph create_for_arity_k(State root_state, size_t num_threads);
 
 public:
     TupleGraphFactory(std::shared_ptr<StateSpace> state_space, int arity, bool prune_dominated_tuples = false);
 
     /// @brief Create and return the tuple graph.
-    TupleGraph create(State root_state);
+    /// The novel tuples and the extensions of the previous layer of each layer are computed with the given number of threads.
+    TupleGraph create(State root_state, size_t num_threads = 1);
+
+    /// @brief Create and return the tuple graphs for all given root states in the same order.
+    /// The root states are distributed over the given number of threads
+    /// and each thread reuses its novelty table and bookkeeping across its root states.
+    TupleGraphList create_all(const StateList& root_states, size_t num_threads = std::thread::hardware_concurrency());
 
     /**
      * Getters.
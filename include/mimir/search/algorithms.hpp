@@ -24,8 +24,14 @@
 
 #include "mimir/search/algorithms/astar.hpp"
 #include "mimir/search/algorithms/astar/event_handlers.hpp"
+#include "mimir/search/algorithms/bfws.hpp"
+#include "mimir/search/algorithms/bfws/event_handlers.hpp"
 #include "mimir/search/algorithms/brfs.hpp"
 #include "mimir/search/algorithms/brfs/event_handlers.hpp"
+#include "mimir/search/algorithms/gbfs.hpp"
+#include "mimir/search/algorithms/gbfs/event_handlers.hpp"
+#include "mimir/search/algorithms/hdastar.hpp"
+#include "mimir/search/algorithms/hdastar/event_handlers.hpp"
 #include "mimir/search/algorithms/iw.hpp"
 #include "mimir/search/algorithms/iw/event_handlers.hpp"
 #include "mimir/search/algorithms/siw.hpp"
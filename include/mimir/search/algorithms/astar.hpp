@@ -63,6 +63,14 @@ private:
     std::shared_ptr<StateRepository> m_ssg;
     std::shared_ptr<IHeuristic> m_heuristic;
     std::shared_ptr<IAStarAlgorithmEventHandler> m_event_handler;
+
+    template<typename OpenList>
+    SearchStatus find_solution(OpenList& openlist,
+                               State start_state,
+                               std::unique_ptr<IGoalStrategy>&& goal_strategy,
+                               std::unique_ptr<IPruningStrategy>&& pruning_strategy,
+                               GroundActionList& out_plan,
+                               std::optional<State>& out_goal_state);
 };
 
 }
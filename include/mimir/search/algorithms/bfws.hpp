@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIMIR_SEARCH_ALGORITHMS_BFWS_HPP_
+#define MIMIR_SEARCH_ALGORITHMS_BFWS_HPP_
+
+#include "mimir/formalism/declarations.hpp"
+#include "mimir/search/algorithms/interface.hpp"
+#include "mimir/search/algorithms/iw/novelty_table_backends.hpp"
+#include "mimir/search/declarations.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+
+namespace mimir
+{
+
+/// @brief `BFWSAlgorithmOptions` encapsulates the parameters of the best-first width search.
+struct BFWSAlgorithmOptions
+{
+    /// @brief The size of the largest tuples. States without a novel tuple of at most this size have novelty `max_arity + 1`.
+    size_t max_arity = 2;
+    /// @brief Prune the states without a novel tuple, which makes the search incomplete.
+    bool prune_non_novel_states = false;
+    /// @brief The bound on the total memory usage in bytes of the novelty tables.
+    /// The least recently used tables are evicted when the bound is exceeded, which makes the tuples of their partitions novel again.
+    size_t max_novelty_table_memory_usage = size_t(1) << 30;
+    NoveltyTableBackendType novelty_table_backend = NoveltyTableBackendType::AUTOMATIC;
+};
+
+/// @brief `BFWSAlgorithm` implements best-first width search.
+///
+/// The novelty of a state is computed with respect to the previously generated states in the same partition,
+/// where states are partitioned by their number of unsatisfied goals #g and, optionally, their number of achieved relaxed plan atoms #r.
+/// The open list orders states by novelty, breaks ties by #g, and remaining ties in FIFO order, which is BFWS(f5) if #r is used.
+/// The relaxed plan atoms of a goal count are the atoms added by a relaxed plan of the first state generated with that goal count.
+class BFWSAlgorithm : public IAlgorithm
+{
+public:
+    /// @brief Simplest construction, partitions states by their number of unsatisfied goals only.
+    explicit BFWSAlgorithm(std::shared_ptr<IApplicableActionGenerator> applicable_action_generator, BFWSAlgorithmOptions options = BFWSAlgorithmOptions());
+
+    /// @brief Complete construction.
+    /// If `relaxed_plan_heuristic` is not null, then the partitions are refined by the number of achieved relaxed plan atoms.
+    /// Its ground actions must coincide with the ground actions of the applicable action generator.
+    BFWSAlgorithm(std::shared_ptr<IApplicableActionGenerator> applicable_action_generator,
+                  std::shared_ptr<StateRepository> successor_state_generator,
+                  std::shared_ptr<HFFHeuristic> relaxed_plan_heuristic,
+                  std::shared_ptr<IBFWSAlgorithmEventHandler> event_handler,
+                  BFWSAlgorithmOptions options = BFWSAlgorithmOptions());
+
+    SearchStatus find_solution(GroundActionList& out_plan) override;
+
+    SearchStatus find_solution(State start_state, GroundActionList& out_plan) override;
+
+    SearchStatus find_solution(State start_state, GroundActionList& out_plan, std::optional<State>& out_goal_state) override;
+
+    SearchStatus find_solution(State start_state,
+                               std::unique_ptr<IGoalStrategy>&& goal_strategy,
+                               std::unique_ptr<IPruningStrategy>&& pruning_strategy,
+                               GroundActionList& out_plan,
+                               std::optional<State>& out_goal_state);
+
+    const std::shared_ptr<PDDLFactories>& get_pddl_factories() const override;
+
+    const BFWSAlgorithmOptions& get_options() const;
+
+private:
+    std::shared_ptr<IApplicableActionGenerator> m_aag;
+    std::shared_ptr<StateRepository> m_ssg;
+    std::shared_ptr<HFFHeuristic> m_relaxed_plan_heuristic;
+    std::shared_ptr<IBFWSAlgorithmEventHandler> m_event_handler;
+    BFWSAlgorithmOptions m_options;
+};
+
+}
+
+#endif
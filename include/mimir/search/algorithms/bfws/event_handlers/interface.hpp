@@ -0,0 +1,236 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIMIR_SEARCH_ALGORITHMS_BFWS_EVENT_HANDLERS_INTERFACE_HPP_
+#define MIMIR_SEARCH_ALGORITHMS_BFWS_EVENT_HANDLERS_INTERFACE_HPP_
+
+#include "mimir/formalism/declarations.hpp"
+#include "mimir/search/action.hpp"
+#include "mimir/search/algorithms/bfws/event_handlers/statistics.hpp"
+#include "mimir/search/state.hpp"
+
+#include <chrono>
+#include <concepts>
+
+namespace mimir
+{
+
+/**
+ * Interface class
+ */
+class IBFWSAlgorithmEventHandler
+{
+public:
+    virtual ~IBFWSAlgorithmEventHandler() = default;
+
+    /// @brief React on expanding a state.
+    /// This is happens immediately before on_generate_state for successors of `state`.
+    virtual void on_expand_state(State state, Problem problem, const PDDLFactories& pddl_factories) = 0;
+
+    /// @brief React on generating a successor `state` by applying an action.
+    virtual void on_generate_state(State state, GroundAction action, Problem problem, const PDDLFactories& pddl_factories) = 0;
+
+    /// @brief React on computing the novelty of a state in the partition of its number of unsatisfied goals.
+    virtual void on_evaluate_state(State state, size_t novelty, size_t num_unsatisfied_goals, Problem problem, const PDDLFactories& pddl_factories) = 0;
+
+    /// @brief React on generating a state with fewer unsatisfied goals than all previously generated states.
+    virtual void on_new_best_goal_count(size_t num_unsatisfied_goals) = 0;
+
+    /// @brief React on pruning a state.
+    virtual void on_prune_state(State state, Problem problem, const PDDLFactories& pddl_factories) = 0;
+
+    /// @brief React on creating the novelty table of a partition.
+    virtual void on_create_novelty_table(size_t num_unsatisfied_goals, size_t num_relaxed_plan_atoms) = 0;
+
+    /// @brief React on evicting the novelty table of a partition to stay within the memory limit.
+    virtual void on_evict_novelty_table(size_t num_unsatisfied_goals, size_t num_relaxed_plan_atoms) = 0;
+
+    /// @brief React on a change of the total memory usage in bytes of the novelty tables.
+    virtual void on_update_novelty_table_memory_usage(size_t memory_usage) = 0;
+
+    /// @brief React on starting a search.
+    virtual void on_start_search(State start_state, Problem problem, const PDDLFactories& pddl_factories) = 0;
+
+    /// @brief React on ending a search.
+    virtual void on_end_search() = 0;
+
+    /// @brief React on solving a search.
+    virtual void on_solved(const GroundActionList& ground_action_plan, const PDDLFactories& pddl_factories) = 0;
+
+    /// @brief React on proving unsolvability during a search.
+    virtual void on_unsolvable() = 0;
+
+    /// @brief React on exhausting a search.
+    virtual void on_exhausted() = 0;
+
+    virtual const BFWSAlgorithmStatistics& get_statistics() const = 0;
+    virtual bool is_quiet() const = 0;
+};
+
+/**
+ * Base class
+ *
+ * Collect statistics and call implementation of derived class.
+ */
+template<typename Derived_>
+class BFWSAlgorithmEventHandlerBase : public IBFWSAlgorithmEventHandler
+{
+protected:
+    BFWSAlgorithmStatistics m_statistics;
+    bool m_quiet;
+
+private:
+    BFWSAlgorithmEventHandlerBase() = default;
+    friend Derived_;
+
+    /// @brief Helper to cast to Derived.
+    constexpr const auto& self() const { return static_cast<const Derived_&>(*this); }
+    constexpr auto& self() { return static_cast<Derived_&>(*this); }
+
+public:
+    explicit BFWSAlgorithmEventHandlerBase(bool quiet = true) : m_statistics(), m_quiet(quiet) {}
+
+    void on_expand_state(State state, Problem problem, const PDDLFactories& pddl_factories) override
+    {
+        m_statistics.increment_num_expanded();
+
+        if (!m_quiet)
+        {
+            self().on_expand_state_impl(state, problem, pddl_factories);
+        }
+    }
+
+    void on_generate_state(State state, GroundAction action, Problem problem, const PDDLFactories& pddl_factories) override
+    {
+        m_statistics.increment_num_generated();
+
+        if (!m_quiet)
+        {
+            self().on_generate_state_impl(state, action, problem, pddl_factories);
+        }
+    }
+
+    void on_evaluate_state(State state, size_t novelty, size_t num_unsatisfied_goals, Problem problem, const PDDLFactories& pddl_factories) override
+    {
+        m_statistics.increment_num_evaluated(novelty);
+
+        if (!m_quiet)
+        {
+            self().on_evaluate_state_impl(state, novelty, num_unsatisfied_goals, problem, pddl_factories);
+        }
+    }
+
+    void on_new_best_goal_count(size_t num_unsatisfied_goals) override
+    {
+        m_statistics.on_new_best_goal_count(num_unsatisfied_goals);
+
+        if (!m_quiet)
+        {
+            self().on_new_best_goal_count_impl(num_unsatisfied_goals, m_statistics.get_num_expanded(), m_statistics.get_num_generated());
+        }
+    }
+
+    void on_prune_state(State state, Problem problem, const PDDLFactories& pddl_factories) override
+    {
+        m_statistics.increment_num_pruned();
+
+        if (!m_quiet)
+        {
+            self().on_prune_state_impl(state, problem, pddl_factories);
+        }
+    }
+
+    void on_create_novelty_table(size_t num_unsatisfied_goals, size_t num_relaxed_plan_atoms) override
+    {
+        m_statistics.increment_num_created_novelty_tables();
+
+        if (!m_quiet)
+        {
+            self().on_create_novelty_table_impl(num_unsatisfied_goals, num_relaxed_plan_atoms);
+        }
+    }
+
+    void on_evict_novelty_table(size_t num_unsatisfied_goals, size_t num_relaxed_plan_atoms) override
+    {
+        m_statistics.increment_num_evicted_novelty_tables();
+
+        if (!m_quiet)
+        {
+            self().on_evict_novelty_table_impl(num_unsatisfied_goals, num_relaxed_plan_atoms);
+        }
+    }
+
+    void on_update_novelty_table_memory_usage(size_t memory_usage) override
+    {
+        // Called after each evaluation, hence, we only collect statistics.
+        m_statistics.update_novelty_table_memory_usage(memory_usage);
+    }
+
+    void on_start_search(State start_state, Problem problem, const PDDLFactories& pddl_factories) override
+    {
+        m_statistics = BFWSAlgorithmStatistics();
+
+        m_statistics.set_search_start_time_point(std::chrono::high_resolution_clock::now());
+
+        if (!m_quiet)
+        {
+            self().on_start_search_impl(start_state, problem, pddl_factories);
+        }
+    }
+
+    void on_end_search() override
+    {
+        m_statistics.set_search_end_time_point(std::chrono::high_resolution_clock::now());
+
+        if (!m_quiet)
+        {
+            self().on_end_search_impl();
+        }
+    }
+
+    void on_solved(const GroundActionList& ground_action_plan, const PDDLFactories& pddl_factories) override
+    {
+        if (!m_quiet)
+        {
+            self().on_solved_impl(ground_action_plan, pddl_factories);
+        }
+    }
+
+    void on_unsolvable() override
+    {
+        if (!m_quiet)
+        {
+            self().on_unsolvable_impl();
+        }
+    }
+
+    void on_exhausted() override
+    {
+        if (!m_quiet)
+        {
+            self().on_exhausted_impl();
+        }
+    }
+
+    /// @brief Get the statistics.
+    const BFWSAlgorithmStatistics& get_statistics() const override { return m_statistics; }
+    bool is_quiet() const override { return m_quiet; }
+};
+
+}
+
+#endif
@@ -0,0 +1,145 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIMIR_SEARCH_ALGORITHMS_BFWS_EVENT_HANDLERS_STATISTICS_HPP_
+#define MIMIR_SEARCH_ALGORITHMS_BFWS_EVENT_HANDLERS_STATISTICS_HPP_
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+namespace mimir
+{
+
+class BFWSAlgorithmStatistics
+{
+private:
+    uint64_t m_num_generated;
+    uint64_t m_num_expanded;
+    uint64_t m_num_evaluated;
+    uint64_t m_num_pruned;
+    uint64_t m_num_created_novelty_tables;
+    uint64_t m_num_evicted_novelty_tables;
+    size_t m_peak_novelty_table_memory_usage;
+    std::chrono::time_point<std::chrono::high_resolution_clock> m_search_start_time_point;
+    std::chrono::time_point<std::chrono::high_resolution_clock> m_search_end_time_point;
+
+    std::vector<uint64_t> m_num_evaluated_by_novelty;
+
+    std::vector<uint64_t> m_goal_counts;
+    std::vector<uint64_t> m_num_generated_until_goal_count;
+    std::vector<uint64_t> m_num_expanded_until_goal_count;
+
+public:
+    BFWSAlgorithmStatistics() :
+        m_num_generated(0),
+        m_num_expanded(0),
+        m_num_evaluated(0),
+        m_num_pruned(0),
+        m_num_created_novelty_tables(0),
+        m_num_evicted_novelty_tables(0),
+        m_peak_novelty_table_memory_usage(0),
+        m_num_evaluated_by_novelty(),
+        m_goal_counts(),
+        m_num_generated_until_goal_count(),
+        m_num_expanded_until_goal_count()
+    {
+    }
+
+    /// @brief Store information for the progress
+    void on_new_best_goal_count(uint64_t goal_count)
+    {
+        m_goal_counts.push_back(goal_count);
+        m_num_generated_until_goal_count.push_back(m_num_generated);
+        m_num_expanded_until_goal_count.push_back(m_num_expanded);
+    }
+
+    void increment_num_generated() { ++m_num_generated; }
+    void increment_num_expanded() { ++m_num_expanded; }
+    void increment_num_evaluated(size_t novelty)
+    {
+        ++m_num_evaluated;
+        if (novelty >= m_num_evaluated_by_novelty.size())
+        {
+            m_num_evaluated_by_novelty.resize(novelty + 1, 0);
+        }
+        ++m_num_evaluated_by_novelty[novelty];
+    }
+    void increment_num_pruned() { ++m_num_pruned; }
+    void increment_num_created_novelty_tables() { ++m_num_created_novelty_tables; }
+    void increment_num_evicted_novelty_tables() { ++m_num_evicted_novelty_tables; }
+    void update_novelty_table_memory_usage(size_t memory_usage) { m_peak_novelty_table_memory_usage = std::max(m_peak_novelty_table_memory_usage, memory_usage); }
+    void set_search_start_time_point(std::chrono::time_point<std::chrono::high_resolution_clock> time_point) { m_search_start_time_point = time_point; }
+    void set_search_end_time_point(std::chrono::time_point<std::chrono::high_resolution_clock> time_point) { m_search_end_time_point = time_point; }
+
+    uint64_t get_num_generated() const { return m_num_generated; }
+    uint64_t get_num_expanded() const { return m_num_expanded; }
+    uint64_t get_num_evaluated() const { return m_num_evaluated; }
+    uint64_t get_num_pruned() const { return m_num_pruned; }
+    uint64_t get_num_created_novelty_tables() const { return m_num_created_novelty_tables; }
+    uint64_t get_num_evicted_novelty_tables() const { return m_num_evicted_novelty_tables; }
+    /// @brief Return the peak memory usage of all novelty tables in bytes.
+    size_t get_peak_novelty_table_memory_usage() const { return m_peak_novelty_table_memory_usage; }
+
+    std::chrono::milliseconds get_search_time_ms() const
+    {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(m_search_end_time_point - m_search_start_time_point);
+    }
+
+    /// @brief Return the number of evaluated states for each novelty value.
+    const std::vector<uint64_t>& get_num_evaluated_by_novelty() const { return m_num_evaluated_by_novelty; }
+
+    const std::vector<uint64_t>& get_goal_counts() const { return m_goal_counts; }
+    const std::vector<uint64_t>& get_num_generated_until_goal_count() const { return m_num_generated_until_goal_count; }
+    const std::vector<uint64_t>& get_num_expanded_until_goal_count() const { return m_num_expanded_until_goal_count; }
+};
+
+/**
+ * Types
+ */
+
+using BFWSAlgorithmStatisticsList = std::vector<BFWSAlgorithmStatistics>;
+
+/**
+ * Pretty printing
+ */
+
+inline std::ostream& operator<<(std::ostream& os, const BFWSAlgorithmStatistics& statistics)
+{
+    os << "[BFWS] Search time: " << statistics.get_search_time_ms().count() << "ms"
+       << "\n"
+       << "[BFWS] Number of generated states: " << statistics.get_num_generated() << "\n"
+       << "[BFWS] Number of expanded states: " << statistics.get_num_expanded() << "\n"
+       << "[BFWS] Number of evaluated states: " << statistics.get_num_evaluated() << "\n"
+       << "[BFWS] Number of pruned states: " << statistics.get_num_pruned() << "\n"
+       << "[BFWS] Number of created novelty tables: " << statistics.get_num_created_novelty_tables() << "\n"
+       << "[BFWS] Number of evicted novelty tables: " << statistics.get_num_evicted_novelty_tables() << "\n"
+       << "[BFWS] Peak novelty table memory usage: " << statistics.get_peak_novelty_table_memory_usage() << " bytes";
+    for (size_t novelty = 1; novelty < statistics.get_num_evaluated_by_novelty().size(); ++novelty)
+    {
+        os << "\n"
+           << "[BFWS] Number of evaluated states with novelty " << novelty << ": " << statistics.get_num_evaluated_by_novelty()[novelty];
+    }
+
+    return os;
+}
+
+}
+
+#endif
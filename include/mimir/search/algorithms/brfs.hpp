@@ -43,6 +43,19 @@ public:
                   std::shared_ptr<StateRepository> successor_state_generator,
                   std::shared_ptr<IBrFSAlgorithmEventHandler> event_handler);
 
+    /// @brief Construction with bit-packed state storage.
+    /// The states are stored in the `PackedStateRepository` and unpacked when they are expanded or generated,
+    /// which trades time for memory. Only the start and goal states are stored in an unpacked `StateRepository`.
+    BrFSAlgorithm(std::shared_ptr<GroundedApplicableActionGenerator> applicable_action_generator,
+                  std::shared_ptr<PackedStateRepository> packed_state_repository,
+                  std::shared_ptr<IBrFSAlgorithmEventHandler> event_handler);
+
+    /// @brief Construction with delta-encoded state storage.
+    /// As for the bit-packed state storage, the states are unpacked when they are expanded or generated.
+    BrFSAlgorithm(std::shared_ptr<IApplicableActionGenerator> applicable_action_generator,
+                  std::shared_ptr<DeltaStateRepository> delta_state_repository,
+                  std::shared_ptr<IBrFSAlgorithmEventHandler> event_handler);
+
     SearchStatus find_solution(GroundActionList& out_plan) override;
 
     SearchStatus find_solution(State start_state, GroundActionList& out_plan) override;
@@ -60,7 +73,18 @@ public:
 private:
     std::shared_ptr<IApplicableActionGenerator> m_aag;
     std::shared_ptr<StateRepository> m_ssg;
+    std::shared_ptr<PackedStateRepository> m_packed_ssg;
+    std::shared_ptr<DeltaStateRepository> m_delta_ssg;
     std::shared_ptr<IBrFSAlgorithmEventHandler> m_event_handler;
+
+    /// @brief Run BrFS on the indices of the states in a repository that stores them compressed, i.e., a `PackedStateRepository` or `DeltaStateRepository`.
+    template<typename CompressedStateRepository>
+    SearchStatus find_solution_compressed(CompressedStateRepository& compressed_ssg,
+                                          State start_state,
+                                          std::unique_ptr<IGoalStrategy>&& goal_strategy,
+                                          std::unique_ptr<IPruningStrategy>&& pruning_strategy,
+                                          GroundActionList& out_plan,
+                                          std::optional<State>& out_goal_state);
 };
 
 }
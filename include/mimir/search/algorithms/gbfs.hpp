@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIMIR_SEARCH_ALGORITHMS_GBFS_HPP_
+#define MIMIR_SEARCH_ALGORITHMS_GBFS_HPP_
+
+#include "mimir/formalism/declarations.hpp"
+#include "mimir/search/algorithms/interface.hpp"
+#include "mimir/search/declarations.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace mimir
+{
+
+/// @brief `HeuristicEvaluation` defines when the heuristic value of a state is computed.
+enum class HeuristicEvaluation
+{
+    /// @brief Evaluate a state when it is generated.
+    EAGER,
+    /// @brief Evaluate a state when it is removed from the open list.
+    /// Successors are inserted with the heuristic value of their parent.
+    LAZY,
+};
+
+/// @brief `GBFSAlgorithmOptions` encapsulates the parameters of the best-first search.
+///
+/// The priority of a state is `g_weight * g + h_weight * h`.
+/// The defaults define greedy best-first search, and `g_weight = 1` with `h_weight = w` defines weighted A*.
+struct GBFSAlgorithmOptions
+{
+    double g_weight = 0.;
+    double h_weight = 1.;
+    HeuristicEvaluation evaluation = HeuristicEvaluation::EAGER;
+    /// @brief Alternate between all states and the states that are reached with preferred actions of the heuristic.
+    bool use_preferred_actions = false;
+    /// @brief The number of pops from the preferred open list whenever the best heuristic value improves.
+    int64_t preferred_actions_boost = 1000;
+};
+
+/**
+ * Specialized implementation class.
+ */
+class GBFSAlgorithm : public IAlgorithm
+{
+public:
+    /// @brief Simplest construction
+    GBFSAlgorithm(std::shared_ptr<IApplicableActionGenerator> applicable_action_generator,
+                  std::shared_ptr<IHeuristic> heuristic,
+                  GBFSAlgorithmOptions options = GBFSAlgorithmOptions());
+
+    /// @brief Complete construction
+    GBFSAlgorithm(std::shared_ptr<IApplicableActionGenerator> applicable_action_generator,
+                  std::shared_ptr<StateRepository> successor_state_generator,
+                  std::shared_ptr<IHeuristic> heuristic,
+                  std::shared_ptr<IGBFSAlgorithmEventHandler> event_handler,
+                  GBFSAlgorithmOptions options = GBFSAlgorithmOptions());
+
+    SearchStatus find_solution(GroundActionList& out_plan) override;
+
+    SearchStatus find_solution(State start_state, GroundActionList& out_plan) override;
+
+    SearchStatus find_solution(State start_state, GroundActionList& out_plan, std::optional<State>& out_goal_state) override;
+
+    SearchStatus find_solution(State start_state,
+                               std::unique_ptr<IGoalStrategy>&& goal_strategy,
+                               std::unique_ptr<IPruningStrategy>&& pruning_strategy,
+                               GroundActionList& out_plan,
+                               std::optional<State>& out_goal_state);
+
+    const std::shared_ptr<PDDLFactories>& get_pddl_factories() const override;
+
+    const GBFSAlgorithmOptions& get_options() const;
+
+private:
+    std::shared_ptr<IApplicableActionGenerator> m_aag;
+    std::shared_ptr<StateRepository> m_ssg;
+    std::shared_ptr<IHeuristic> m_heuristic;
+    std::shared_ptr<IGBFSAlgorithmEventHandler> m_event_handler;
+    GBFSAlgorithmOptions m_options;
+
+    SearchStatus find_solution_eager(State start_state,
+                                     IGoalStrategy& goal_strategy,
+                                     IPruningStrategy& pruning_strategy,
+                                     GroundActionList& out_plan,
+                                     std::optional<State>& out_goal_state);
+
+    SearchStatus find_solution_lazy(State start_state,
+                                    IGoalStrategy& goal_strategy,
+                                    IPruningStrategy& pruning_strategy,
+                                    GroundActionList& out_plan,
+                                    std::optional<State>& out_goal_state);
+};
+
+}
+
+#endif
@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIMIR_SEARCH_ALGORITHMS_GBFS_EVENT_HANDLERS_DEFAULT_HPP_
+#define MIMIR_SEARCH_ALGORITHMS_GBFS_EVENT_HANDLERS_DEFAULT_HPP_
+
+#include "mimir/search/algorithms/gbfs/event_handlers/interface.hpp"
+
+#include <iostream>
+
+namespace mimir
+{
+
+/**
+ * Implementation class
+ */
+class DefaultGBFSAlgorithmEventHandler : public GBFSAlgorithmEventHandlerBase<DefaultGBFSAlgorithmEventHandler>
+{
+private:
+    /* Implement AlgorithmEventHandlerBase interface */
+    friend class GBFSAlgorithmEventHandlerBase<DefaultGBFSAlgorithmEventHandler>;
+
+    void on_expand_state_impl(State state, Problem problem, const PDDLFactories& pddl_factories) const;
+
+    void on_generate_state_impl(State state, GroundAction action, Problem problem, const PDDLFactories& pddl_factories) const;
+
+    void on_evaluate_state_impl(State state, double h_value, Problem problem, const PDDLFactories& pddl_factories) const;
+
+    void on_new_best_h_value_impl(double h_value, uint64_t num_expanded_states, uint64_t num_generated_states) const;
+
+    void on_prune_state_impl(State state, Problem problem, const PDDLFactories& pddl_factories) const;
+
+    void on_start_search_impl(State start_state, Problem problem, const PDDLFactories& pddl_factories) const;
+
+    void on_end_search_impl() const;
+
+    void on_solved_impl(const GroundActionList& ground_action_plan, const PDDLFactories& pddl_factories) const;
+
+    void on_unsolvable_impl() const;
+
+    void on_exhausted_impl() const;
+
+public:
+    explicit DefaultGBFSAlgorithmEventHandler(bool quiet = true) : GBFSAlgorithmEventHandlerBase<DefaultGBFSAlgorithmEventHandler>(quiet) {}
+};
+
+}
+
+#endif
@@ -0,0 +1,207 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIMIR_SEARCH_ALGORITHMS_GBFS_EVENT_HANDLERS_INTERFACE_HPP_
+#define MIMIR_SEARCH_ALGORITHMS_GBFS_EVENT_HANDLERS_INTERFACE_HPP_
+
+#include "mimir/formalism/declarations.hpp"
+#include "mimir/search/action.hpp"
+#include "mimir/search/algorithms/gbfs/event_handlers/statistics.hpp"
+#include "mimir/search/state.hpp"
+
+#include <chrono>
+#include <concepts>
+#include <limits>
+
+namespace mimir
+{
+
+/**
+ * Interface class
+ */
+class IGBFSAlgorithmEventHandler
+{
+public:
+    virtual ~IGBFSAlgorithmEventHandler() = default;
+
+    /// @brief React on expanding a state.
+    /// This is happens immediately before on_generate_state for successors of `state`.
+    virtual void on_expand_state(State state, Problem problem, const PDDLFactories& pddl_factories) = 0;
+
+    /// @brief React on generating a successor `state` by applying an action.
+    /// With lazy evaluation, this happens when the successor is removed from the open list.
+    virtual void on_generate_state(State state, GroundAction action, Problem problem, const PDDLFactories& pddl_factories) = 0;
+
+    /// @brief React on computing the heuristic value of a state.
+    virtual void on_evaluate_state(State state, double h_value, Problem problem, const PDDLFactories& pddl_factories) = 0;
+
+    /// @brief React on expanding a state with a smaller heuristic value than all previously expanded states.
+    virtual void on_new_best_h_value(double h_value) = 0;
+
+    /// @brief React on pruning a state.
+    virtual void on_prune_state(State state, Problem problem, const PDDLFactories& pddl_factories) = 0;
+
+    /// @brief React on starting a search.
+    virtual void on_start_search(State start_state, Problem problem, const PDDLFactories& pddl_factories) = 0;
+
+    /// @brief React on ending a search.
+    virtual void on_end_search() = 0;
+
+    /// @brief React on solving a search.
+    virtual void on_solved(const GroundActionList& ground_action_plan, const PDDLFactories& pddl_factories) = 0;
+
+    /// @brief React on proving unsolvability during a search.
+    virtual void on_unsolvable() = 0;
+
+    /// @brief React on exhausting a search.
+    virtual void on_exhausted() = 0;
+
+    virtual const GBFSAlgorithmStatistics& get_statistics() const = 0;
+    virtual bool is_quiet() const = 0;
+};
+
+/**
+ * Base class
+ *
+ * Collect statistics and call implementation of derived class.
+ */
+template<typename Derived_>
+class GBFSAlgorithmEventHandlerBase : public IGBFSAlgorithmEventHandler
+{
+protected:
+    GBFSAlgorithmStatistics m_statistics;
+    bool m_quiet;
+
+private:
+    GBFSAlgorithmEventHandlerBase() = default;
+    friend Derived_;
+
+    /// @brief Helper to cast to Derived.
+    constexpr const auto& self() const { return static_cast<const Derived_&>(*this); }
+    constexpr auto& self() { return static_cast<Derived_&>(*this); }
+
+public:
+    explicit GBFSAlgorithmEventHandlerBase(bool quiet = true) : m_statistics(), m_quiet(quiet) {}
+
+    void on_expand_state(State state, Problem problem, const PDDLFactories& pddl_factories) override
+    {
+        m_statistics.increment_num_expanded();
+
+        if (!m_quiet)
+        {
+            self().on_expand_state_impl(state, problem, pddl_factories);
+        }
+    }
+
+    void on_generate_state(State state, GroundAction action, Problem problem, const PDDLFactories& pddl_factories) override
+    {
+        m_statistics.increment_num_generated();
+
+        if (!m_quiet)
+        {
+            self().on_generate_state_impl(state, action, problem, pddl_factories);
+        }
+    }
+
+    void on_evaluate_state(State state, double h_value, Problem problem, const PDDLFactories& pddl_factories) override
+    {
+        m_statistics.increment_num_evaluated();
+        if (h_value == std::numeric_limits<double>::infinity())
+        {
+            m_statistics.increment_num_deadends();
+        }
+
+        if (!m_quiet)
+        {
+            self().on_evaluate_state_impl(state, h_value, problem, pddl_factories);
+        }
+    }
+
+    void on_new_best_h_value(double h_value) override
+    {
+        m_statistics.on_new_best_h_value(h_value);
+
+        if (!m_quiet)
+        {
+            self().on_new_best_h_value_impl(h_value, m_statistics.get_num_expanded(), m_statistics.get_num_generated());
+        }
+    }
+
+    void on_prune_state(State state, Problem problem, const PDDLFactories& pddl_factories) override
+    {
+        m_statistics.increment_num_pruned();
+
+        if (!m_quiet)
+        {
+            self().on_prune_state_impl(state, problem, pddl_factories);
+        }
+    }
+
+    void on_start_search(State start_state, Problem problem, const PDDLFactories& pddl_factories) override
+    {
+        m_statistics = GBFSAlgorithmStatistics();
+
+        m_statistics.set_search_start_time_point(std::chrono::high_resolution_clock::now());
+
+        if (!m_quiet)
+        {
+            self().on_start_search_impl(start_state, problem, pddl_factories);
+        }
+    }
+
+    void on_end_search() override
+    {
+        m_statistics.set_search_end_time_point(std::chrono::high_resolution_clock::now());
+
+        if (!m_quiet)
+        {
+            self().on_end_search_impl();
+        }
+    }
+
+    void on_solved(const GroundActionList& ground_action_plan, const PDDLFactories& pddl_factories) override
+    {
+        if (!m_quiet)
+        {
+            self().on_solved_impl(ground_action_plan, pddl_factories);
+        }
+    }
+
+    void on_unsolvable() override
+    {
+        if (!m_quiet)
+        {
+            self().on_unsolvable_impl();
+        }
+    }
+
+    void on_exhausted() override
+    {
+        if (!m_quiet)
+        {
+            self().on_exhausted_impl();
+        }
+    }
+
+    /// @brief Get the statistics.
+    const GBFSAlgorithmStatistics& get_statistics() const override { return m_statistics; }
+    bool is_quiet() const override { return m_quiet; }
+};
+
+}
+
+#endif
@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIMIR_SEARCH_ALGORITHMS_GBFS_EVENT_HANDLERS_STATISTICS_HPP_
+#define MIMIR_SEARCH_ALGORITHMS_GBFS_EVENT_HANDLERS_STATISTICS_HPP_
+
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+namespace mimir
+{
+
+class GBFSAlgorithmStatistics
+{
+private:
+    uint64_t m_num_generated;
+    uint64_t m_num_expanded;
+    uint64_t m_num_evaluated;
+    uint64_t m_num_deadends;
+    uint64_t m_num_pruned;
+    std::chrono::time_point<std::chrono::high_resolution_clock> m_search_start_time_point;
+    std::chrono::time_point<std::chrono::high_resolution_clock> m_search_end_time_point;
+
+    std::vector<double> m_h_values;
+    std::vector<uint64_t> m_num_generated_until_h_value;
+    std::vector<uint64_t> m_num_expanded_until_h_value;
+    std::vector<uint64_t> m_num_evaluated_until_h_value;
+
+public:
+    GBFSAlgorithmStatistics() :
+        m_num_generated(0),
+        m_num_expanded(0),
+        m_num_evaluated(0),
+        m_num_deadends(0),
+        m_num_pruned(0),
+        m_h_values(),
+        m_num_generated_until_h_value(),
+        m_num_expanded_until_h_value(),
+        m_num_evaluated_until_h_value()
+    {
+    }
+
+    /// @brief Store information for the progress
+    void on_new_best_h_value(double h_value)
+    {
+        m_h_values.push_back(h_value);
+        m_num_generated_until_h_value.push_back(m_num_generated);
+        m_num_expanded_until_h_value.push_back(m_num_expanded);
+        m_num_evaluated_until_h_value.push_back(m_num_evaluated);
+    }
+
+    void increment_num_generated() { ++m_num_generated; }
+    void increment_num_expanded() { ++m_num_expanded; }
+    void increment_num_evaluated() { ++m_num_evaluated; }
+    void increment_num_deadends() { ++m_num_deadends; }
+    void increment_num_pruned() { ++m_num_pruned; }
+    void set_search_start_time_point(std::chrono::time_point<std::chrono::high_resolution_clock> time_point) { m_search_start_time_point = time_point; }
+    void set_search_end_time_point(std::chrono::time_point<std::chrono::high_resolution_clock> time_point) { m_search_end_time_point = time_point; }
+
+    uint64_t get_num_generated() const { return m_num_generated; }
+    uint64_t get_num_expanded() const { return m_num_expanded; }
+    uint64_t get_num_evaluated() const { return m_num_evaluated; }
+    uint64_t get_num_deadends() const { return m_num_deadends; }
+    uint64_t get_num_pruned() const { return m_num_pruned; }
+
+    std::chrono::milliseconds get_search_time_ms() const
+    {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(m_search_end_time_point - m_search_start_time_point);
+    }
+
+    const std::vector<double>& get_h_values() const { return m_h_values; }
+    const std::vector<uint64_t>& get_num_generated_until_h_value() const { return m_num_generated_until_h_value; }
+    const std::vector<uint64_t>& get_num_expanded_until_h_value() const { return m_num_expanded_until_h_value; }
+    const std::vector<uint64_t>& get_num_evaluated_until_h_value() const { return m_num_evaluated_until_h_value; }
+};
+
+/**
+ * Types
+ */
+
+using GBFSAlgorithmStatisticsList = std::vector<GBFSAlgorithmStatistics>;
+
+/**
+ * Pretty printing
+ */
+
+inline std::ostream& operator<<(std::ostream& os, const GBFSAlgorithmStatistics& statistics)
+{
+    os << "[GBFS] Search time: " << statistics.get_search_time_ms().count() << "ms"
+       << "\n"
+       << "[GBFS] Number of generated states: " << statistics.get_num_generated() << "\n"
+       << "[GBFS] Number of expanded states: " << statistics.get_num_expanded() << "\n"
+       << "[GBFS] Number of evaluated states: " << statistics.get_num_evaluated() << "\n"
+       << "[GBFS] Number of deadend states: " << statistics.get_num_deadends() << "\n"
+       << "[GBFS] Number of pruned states: " << statistics.get_num_pruned();
+
+    return os;
+}
+
+}
+
+#endif
@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIMIR_SEARCH_ALGORITHMS_HDASTAR_HPP_
+#define MIMIR_SEARCH_ALGORITHMS_HDASTAR_HPP_
+
+#include "mimir/formalism/declarations.hpp"
+#include "mimir/search/algorithms/interface.hpp"
+#include "mimir/search/declarations.hpp"
+
+#include <functional>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace mimir
+{
+
+/// @brief `HDAStarAlgorithmOptions` encapsulates the parameters of the hash distributed A* search.
+struct HDAStarAlgorithmOptions
+{
+    size_t num_threads = std::thread::hardware_concurrency();
+    /// @brief The number of successors buffered per receiving worker before they are sent in one message.
+    /// Buffers are also flushed after each expansion, hence, larger values only reduce the contention on the message queues.
+    size_t message_batch_size = 64;
+};
+
+/// @brief `HeuristicFactory` creates a heuristic for each worker thread.
+/// The heuristics are evaluated concurrently and must not share mutable state.
+using HeuristicFactory = std::function<std::shared_ptr<IHeuristic>()>;
+
+/**
+ * Specialized implementation class.
+ *
+ * Hash distributed A* (Kishimoto, Fukunaga, and Botea 2009) partitions the states among the worker threads
+ * by the hash value of their fluent atoms. Each worker owns a `StateRepository`, search nodes and an open list
+ * for its states, so duplicate detection needs no synchronization. Successors of other workers are sent
+ * in batches through lock-free message queues. The search terminates once a plan was found
+ * and no worker has a state with a smaller f-value left, or when all workers are idle.
+ *
+ * The applicable action generator is shared by all workers. The grounded generator is required
+ * because its queries are reentrant, whereas the lifted generator creates ground actions on demand.
+ */
+class HDAStarAlgorithm : public IAlgorithm
+{
+public:
+    /// @brief Simplest construction
+    HDAStarAlgorithm(std::shared_ptr<GroundedApplicableActionGenerator> applicable_action_generator,
+                     HeuristicFactory heuristic_factory,
+                     HDAStarAlgorithmOptions options = HDAStarAlgorithmOptions());
+
+    /// @brief Complete construction
+    HDAStarAlgorithm(std::shared_ptr<GroundedApplicableActionGenerator> applicable_action_generator,
+                     HeuristicFactory heuristic_factory,
+                     std::shared_ptr<IHDAStarAlgorithmEventHandler> event_handler,
+                     HDAStarAlgorithmOptions options = HDAStarAlgorithmOptions());
+
+    SearchStatus find_solution(GroundActionList& out_plan) override;
+
+    SearchStatus find_solution(State start_state, GroundActionList& out_plan) override;
+
+    SearchStatus find_solution(State start_state, GroundActionList& out_plan, std::optional<State>& out_goal_state) override;
+
+    const std::shared_ptr<PDDLFactories>& get_pddl_factories() const override;
+
+    const HDAStarAlgorithmOptions& get_options() const;
+
+    /// @brief Return the state repository of each worker thread.
+    const std::vector<std::shared_ptr<StateRepository>>& get_state_repositories() const;
+
+private:
+    std::shared_ptr<GroundedApplicableActionGenerator> m_aag;
+    std::vector<std::shared_ptr<StateRepository>> m_ssgs;
+    std::vector<std::shared_ptr<IHeuristic>> m_heuristics;
+    std::shared_ptr<IHDAStarAlgorithmEventHandler> m_event_handler;
+    HDAStarAlgorithmOptions m_options;
+};
+
+}
+
+#endif
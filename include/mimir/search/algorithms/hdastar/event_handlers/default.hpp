@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIMIR_SEARCH_ALGORITHMS_HDASTAR_EVENT_HANDLERS_DEFAULT_HPP_
+#define MIMIR_SEARCH_ALGORITHMS_HDASTAR_EVENT_HANDLERS_DEFAULT_HPP_
+
+#include "mimir/search/algorithms/hdastar/event_handlers/interface.hpp"
+
+#include <iostream>
+
+namespace mimir
+{
+
+/**
+ * Implementation class
+ */
+class DefaultHDAStarAlgorithmEventHandler : public HDAStarAlgorithmEventHandlerBase<DefaultHDAStarAlgorithmEventHandler>
+{
+private:
+    /* Implement AlgorithmEventHandlerBase interface */
+    friend class HDAStarAlgorithmEventHandlerBase<DefaultHDAStarAlgorithmEventHandler>;
+
+    void on_start_search_impl(State start_state, Problem problem, const PDDLFactories& pddl_factories) const;
+
+    void on_finish_worker_impl(size_t worker_index, const HDAStarWorkerStatistics& worker_statistics) const;
+
+    void on_end_search_impl() const;
+
+    void on_solved_impl(const GroundActionList& ground_action_plan, const PDDLFactories& pddl_factories) const;
+
+    void on_unsolvable_impl() const;
+
+    void on_exhausted_impl() const;
+
+public:
+    explicit DefaultHDAStarAlgorithmEventHandler(bool quiet = true) : HDAStarAlgorithmEventHandlerBase<DefaultHDAStarAlgorithmEventHandler>(quiet) {}
+};
+
+}
+
+#endif
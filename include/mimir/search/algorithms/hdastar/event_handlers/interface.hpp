@@ -0,0 +1,151 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIMIR_SEARCH_ALGORITHMS_HDASTAR_EVENT_HANDLERS_INTERFACE_HPP_
+#define MIMIR_SEARCH_ALGORITHMS_HDASTAR_EVENT_HANDLERS_INTERFACE_HPP_
+
+#include "mimir/formalism/declarations.hpp"
+#include "mimir/search/action.hpp"
+#include "mimir/search/algorithms/hdastar/event_handlers/statistics.hpp"
+#include "mimir/search/state.hpp"
+
+#include <chrono>
+#include <concepts>
+
+namespace mimir
+{
+
+/**
+ * Interface class
+ *
+ * All events are triggered by the thread that calls `find_solution`, never by the worker threads.
+ * Hence, implementations do not need to be thread-safe.
+ */
+class IHDAStarAlgorithmEventHandler
+{
+public:
+    virtual ~IHDAStarAlgorithmEventHandler() = default;
+
+    /// @brief React on starting a search.
+    virtual void on_start_search(State start_state, Problem problem, const PDDLFactories& pddl_factories) = 0;
+
+    /// @brief React on a worker thread that finished its part of the search.
+    virtual void on_finish_worker(size_t worker_index, const HDAStarWorkerStatistics& worker_statistics) = 0;
+
+    /// @brief React on ending a search.
+    virtual void on_end_search() = 0;
+
+    /// @brief React on solving a search.
+    virtual void on_solved(const GroundActionList& ground_action_plan, const PDDLFactories& pddl_factories) = 0;
+
+    /// @brief React on proving unsolvability during a search.
+    virtual void on_unsolvable() = 0;
+
+    /// @brief React on exhausting a search.
+    virtual void on_exhausted() = 0;
+
+    virtual const HDAStarAlgorithmStatistics& get_statistics() const = 0;
+    virtual bool is_quiet() const = 0;
+};
+
+/**
+ * Base class
+ *
+ * Collect statistics and call implementation of derived class.
+ */
+template<typename Derived_>
+class HDAStarAlgorithmEventHandlerBase : public IHDAStarAlgorithmEventHandler
+{
+protected:
+    HDAStarAlgorithmStatistics m_statistics;
+    bool m_quiet;
+
+private:
+    HDAStarAlgorithmEventHandlerBase() = default;
+    friend Derived_;
+
+    /// @brief Helper to cast to Derived.
+    constexpr const auto& self() const { return static_cast<const Derived_&>(*this); }
+    constexpr auto& self() { return static_cast<Derived_&>(*this); }
+
+public:
+    explicit HDAStarAlgorithmEventHandlerBase(bool quiet = true) : m_statistics(), m_quiet(quiet) {}
+
+    void on_start_search(State start_state, Problem problem, const PDDLFactories& pddl_factories) override
+    {
+        m_statistics = HDAStarAlgorithmStatistics();
+
+        m_statistics.set_search_start_time_point(std::chrono::high_resolution_clock::now());
+
+        if (!m_quiet)
+        {
+            self().on_start_search_impl(start_state, problem, pddl_factories);
+        }
+    }
+
+    void on_finish_worker(size_t worker_index, const HDAStarWorkerStatistics& worker_statistics) override
+    {
+        m_statistics.add_worker_statistics(worker_statistics);
+
+        if (!m_quiet)
+        {
+            self().on_finish_worker_impl(worker_index, worker_statistics);
+        }
+    }
+
+    void on_end_search() override
+    {
+        m_statistics.set_search_end_time_point(std::chrono::high_resolution_clock::now());
+
+        if (!m_quiet)
+        {
+            self().on_end_search_impl();
+        }
+    }
+
+    void on_solved(const GroundActionList& ground_action_plan, const PDDLFactories& pddl_factories) override
+    {
+        if (!m_quiet)
+        {
+            self().on_solved_impl(ground_action_plan, pddl_factories);
+        }
+    }
+
+    void on_unsolvable() override
+    {
+        if (!m_quiet)
+        {
+            self().on_unsolvable_impl();
+        }
+    }
+
+    void on_exhausted() override
+    {
+        if (!m_quiet)
+        {
+            self().on_exhausted_impl();
+        }
+    }
+
+    /// @brief Get the statistics.
+    const HDAStarAlgorithmStatistics& get_statistics() const override { return m_statistics; }
+    bool is_quiet() const override { return m_quiet; }
+};
+
+}
+
+#endif
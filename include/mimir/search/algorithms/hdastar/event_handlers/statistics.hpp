@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIMIR_SEARCH_ALGORITHMS_HDASTAR_EVENT_HANDLERS_STATISTICS_HPP_
+#define MIMIR_SEARCH_ALGORITHMS_HDASTAR_EVENT_HANDLERS_STATISTICS_HPP_
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+namespace mimir
+{
+
+/// @brief `HDAStarWorkerStatistics` are collected by each worker thread without synchronization.
+struct HDAStarWorkerStatistics
+{
+    uint64_t num_generated = 0;
+    uint64_t num_expanded = 0;
+    uint64_t num_deadends = 0;
+    uint64_t num_sent_messages = 0;
+    uint64_t num_received_messages = 0;
+};
+
+class HDAStarAlgorithmStatistics
+{
+private:
+    std::vector<HDAStarWorkerStatistics> m_worker_statistics;
+    std::chrono::time_point<std::chrono::high_resolution_clock> m_search_start_time_point;
+    std::chrono::time_point<std::chrono::high_resolution_clock> m_search_end_time_point;
+
+    template<typename Getter>
+    uint64_t accumulate(Getter getter) const
+    {
+        uint64_t result = 0;
+        for (const auto& statistics : m_worker_statistics)
+        {
+            result += getter(statistics);
+        }
+        return result;
+    }
+
+public:
+    HDAStarAlgorithmStatistics() : m_worker_statistics() {}
+
+    void add_worker_statistics(const HDAStarWorkerStatistics& statistics) { m_worker_statistics.push_back(statistics); }
+    void set_search_start_time_point(std::chrono::time_point<std::chrono::high_resolution_clock> time_point) { m_search_start_time_point = time_point; }
+    void set_search_end_time_point(std::chrono::time_point<std::chrono::high_resolution_clock> time_point) { m_search_end_time_point = time_point; }
+
+    uint64_t get_num_generated() const { return accumulate([](const auto& statistics) { return statistics.num_generated; }); }
+    uint64_t get_num_expanded() const { return accumulate([](const auto& statistics) { return statistics.num_expanded; }); }
+    uint64_t get_num_deadends() const { return accumulate([](const auto& statistics) { return statistics.num_deadends; }); }
+    uint64_t get_num_sent_messages() const { return accumulate([](const auto& statistics) { return statistics.num_sent_messages; }); }
+
+    /// @brief Return the largest number of expansions of a worker divided by the average, i.e., 1 means perfect load balance.
+    double get_expansion_imbalance() const
+    {
+        if (m_worker_statistics.empty() || get_num_expanded() == 0)
+        {
+            return 1.;
+        }
+        const auto max_expanded =
+            std::max_element(m_worker_statistics.begin(),
+                             m_worker_statistics.end(),
+                             [](const auto& lhs, const auto& rhs) { return lhs.num_expanded < rhs.num_expanded; })
+                ->num_expanded;
+        return static_cast<double>(max_expanded) * m_worker_statistics.size() / get_num_expanded();
+    }
+
+    std::chrono::milliseconds get_search_time_ms() const
+    {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(m_search_end_time_point - m_search_start_time_point);
+    }
+
+    const std::vector<HDAStarWorkerStatistics>& get_worker_statistics() const { return m_worker_statistics; }
+};
+
+/**
+ * Pretty printing
+ */
+
+inline std::ostream& operator<<(std::ostream& os, const HDAStarAlgorithmStatistics& statistics)
+{
+    os << "[HDAStar] Search time: " << statistics.get_search_time_ms().count() << "ms"
+       << "\n"
+       << "[HDAStar] Number of workers: " << statistics.get_worker_statistics().size() << "\n"
+       << "[HDAStar] Number of generated states: " << statistics.get_num_generated() << "\n"
+       << "[HDAStar] Number of expanded states: " << statistics.get_num_expanded() << "\n"
+       << "[HDAStar] Number of deadend states: " << statistics.get_num_deadends() << "\n"
+       << "[HDAStar] Number of sent messages: " << statistics.get_num_sent_messages() << "\n"
+       << "[HDAStar] Expansion imbalance: " << statistics.get_expansion_imbalance();
+
+    return os;
+}
+
+}
+
+#endif
@@ -24,18 +24,31 @@
 namespace mimir
 {
 
+/// @brief `IWAlgorithmOptions` encapsulates the parameters of the iterated width search.
+struct IWAlgorithmOptions
+{
+    /// @brief Continue the search of arity k - 1 in the search of arity k instead of restarting from scratch.
+    /// The states in the search tree of arity k - 1 are kept without generating their successors again,
+    /// and only the states that were pruned in arity k - 1 are tested for novelty again.
+    /// The result can differ from the non-incremental search, since the states are tested in a different order.
+    bool incremental = false;
+};
+
 class IterativeWidthAlgorithm : public IAlgorithm
 {
 public:
     /// @brief Simplest construction
-    IterativeWidthAlgorithm(std::shared_ptr<IApplicableActionGenerator> applicable_action_generator, size_t max_arity);
+    IterativeWidthAlgorithm(std::shared_ptr<IApplicableActionGenerator> applicable_action_generator,
+                            size_t max_arity,
+                            IWAlgorithmOptions options = IWAlgorithmOptions());
 
     /// @brief Complete construction
     IterativeWidthAlgorithm(std::shared_ptr<IApplicableActionGenerator> applicable_action_generator,
                             size_t max_arity,
                             std::shared_ptr<StateRepository> successor_state_generator,
                             std::shared_ptr<IBrFSAlgorithmEventHandler> brfs_event_handler,
-                            std::shared_ptr<IIWAlgorithmEventHandler> iw_event_handler);
+                            std::shared_ptr<IIWAlgorithmEventHandler> iw_event_handler,
+                            IWAlgorithmOptions options = IWAlgorithmOptions());
 
     SearchStatus find_solution(GroundActionList& out_plan) override;
 
@@ -48,9 +61,12 @@ public:
 
     const std::shared_ptr<PDDLFactories>& get_pddl_factories() const override;
 
+    const IWAlgorithmOptions& get_options() const;
+
 private:
     std::shared_ptr<IApplicableActionGenerator> m_aag;
     size_t m_max_arity;
+    IWAlgorithmOptions m_options;
 
     std::shared_ptr<StateRepository> m_ssg;
     std::shared_ptr<IBrFSAlgorithmEventHandler> m_brfs_event_handler;
@@ -58,6 +74,8 @@ private:
 
     State m_initial_state;
     BrFSAlgorithm m_brfs;
+
+    SearchStatus find_solution_incremental(State start_state, IGoalStrategy& goal_strategy, GroundActionList& out_plan, std::optional<State>& out_goal_state);
 };
 
 using IWAlgorithm = IterativeWidthAlgorithm;
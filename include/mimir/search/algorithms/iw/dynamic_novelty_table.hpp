@@ -18,41 +18,82 @@
 #ifndef MIMIR_SEARCH_ALGORITHMS_IW_DYNAMIC_NOVELTY_TABLE_HPP_
 #define MIMIR_SEARCH_ALGORITHMS_IW_DYNAMIC_NOVELTY_TABLE_HPP_
 
+#include "mimir/search/algorithms/iw/novelty_table_backends.hpp"
+#include "mimir/search/algorithms/iw/novelty_table_statistics.hpp"
 #include "mimir/search/algorithms/iw/tuple_index_generators.hpp"
 #include "mimir/search/algorithms/iw/tuple_index_mapper.hpp"
 #include "mimir/search/algorithms/iw/types.hpp"
 #include "mimir/search/state.hpp"
 
+#include <variant>
+
 namespace mimir
 {
 
+using NoveltyTableBackend = std::variant<DenseNoveltyTableBackend, BlockedNoveltyTableBackend, HashedNoveltyTableBackend>;
+
 /// @brief DynamicNoveltyTable encapsulates a table to test novelty of tuples of atoms of size at most arity.
-/// It automatically resizes when the atoms do not fit into the table anymore.
+/// It automatically resizes when the atoms of a tested state do not fit into the table anymore.
+///
+/// The tuple indices are stored in a backend that is selected from the estimated table size unless specified otherwise.
+/// Tuple indices computed by compute_novel_tuple_indices refer to the given TupleIndexMapper,
+/// hence, the atoms of states passed to it must fit into the table.
 class DynamicNoveltyTable
 {
 private:
     std::shared_ptr<TupleIndexMapper> m_tuple_index_mapper;
 
-    std::vector<bool> m_table;
+    NoveltyTableBackendType m_backend_type;
+    NoveltyTableBackend m_backend;
+
+    NoveltyTableStatistics m_statistics;
 
     void resize_to_fit(AtomIndex atom_index);
+    void resize_to_fit(const State state);
+
+    template<typename Iterator>
+    size_t compute_novelty_and_update_table_impl(Iterator begin, Iterator end);
 
     // Preallocated memory that will be modified.
     StateTupleIndexGenerator m_state_tuple_index_generator;
     StatePairTupleIndexGenerator m_state_pair_tuple_index_generator;
 
 public:
-    explicit DynamicNoveltyTable(std::shared_ptr<TupleIndexMapper> tuple_index_mapper);
+    explicit DynamicNoveltyTable(std::shared_ptr<TupleIndexMapper> tuple_index_mapper,
+                                 NoveltyTableBackendType backend_type = NoveltyTableBackendType::AUTOMATIC);
 
     void compute_novel_tuple_indices(const State state, TupleIndexList& out_novel_tuple_indices);
 
+    /// @brief Same as above but generates the tuples with the given generator, hence, it can be called concurrently
+    /// as long as each thread uses its own generator and the table is not modified.
+    void compute_novel_tuple_indices(const State state, StateTupleIndexGenerator& tuple_index_generator, TupleIndexList& out_novel_tuple_indices) const;
+
     void insert_tuple_indices(const TupleIndexList& tuple_indices);
 
     bool test_novelty_and_update_table(const State state);
 
     bool test_novelty_and_update_table(const State state, const State succ_state);
 
+    /// @brief Return the novelty of the state, i.e., the size of its smallest novel tuple or arity + 1 if no tuple is novel,
+    /// and mark all tuples of the state as seen.
+    size_t compute_novelty_and_update_table(const State state);
+
+    /// @brief Same as above but only considers the tuples with an atom that was added in the transition from state to succ_state.
+    /// This is correct if the tuples of state were marked as seen before.
+    size_t compute_novelty_and_update_table(const State state, const State succ_state);
+
     void reset();
+
+    /**
+     * Getters
+     */
+
+    const std::shared_ptr<TupleIndexMapper>& get_tuple_index_mapper() const;
+    /// @brief Return the type of the backend in use, which is never AUTOMATIC.
+    NoveltyTableBackendType get_backend_type() const;
+    /// @brief Return the current memory usage of the backend in bytes.
+    size_t get_memory_usage() const;
+    const NoveltyTableStatistics& get_statistics() const;
 };
 
 }
@@ -38,7 +38,7 @@ private:
 
     void on_start_arity_search_impl(const Problem problem, const State initial_state, const PDDLFactories& pddl_factories, int arity) const;
 
-    void on_end_arity_search_impl(const BrFSAlgorithmStatistics& brfs_statistics) const;
+    void on_end_arity_search_impl(const BrFSAlgorithmStatistics& brfs_statistics, const NoveltyTableStatistics& novelty_table_statistics) const;
 
     void on_end_search_impl() const;
 
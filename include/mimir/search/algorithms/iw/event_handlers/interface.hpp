@@ -43,8 +43,8 @@ public:
     /// @brief React on starting a search.
     virtual void on_start_arity_search(const Problem problem, const State initial_state, const PDDLFactories& pddl_factories, int arity) = 0;
 
-    /// @brief React on starting a search.
-    virtual void on_end_arity_search(const BrFSAlgorithmStatistics& brfs_statistics) = 0;
+    /// @brief React on ending the search of an arity.
+    virtual void on_end_arity_search(const BrFSAlgorithmStatistics& brfs_statistics, const NoveltyTableStatistics& novelty_table_statistics) = 0;
 
     /// @brief React on ending a search.
     virtual void on_end_search() = 0;
@@ -105,13 +105,14 @@ public:
         }
     }
 
-    void on_end_arity_search(const BrFSAlgorithmStatistics& brfs_statistics) override
+    void on_end_arity_search(const BrFSAlgorithmStatistics& brfs_statistics, const NoveltyTableStatistics& novelty_table_statistics) override
     {
         m_statistics.push_back_algorithm_statistics(brfs_statistics);
+        m_statistics.push_back_novelty_table_statistics(novelty_table_statistics);
 
         if (!m_quiet)
         {
-            self().on_end_arity_search_impl(brfs_statistics);
+            self().on_end_arity_search_impl(brfs_statistics, novelty_table_statistics);
         }
     }
 
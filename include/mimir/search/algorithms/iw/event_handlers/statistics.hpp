@@ -19,6 +19,7 @@
 #define MIMIR_SEARCH_ALGORITHMS_IW_EVENT_HANDLERS_STATISTICS_HPP_
 
 #include "mimir/search/algorithms/brfs/event_handlers/statistics.hpp"
+#include "mimir/search/algorithms/iw/novelty_table_statistics.hpp"
 
 #include <chrono>
 #include <cstdint>
@@ -32,14 +33,19 @@ class IWAlgorithmStatistics
 {
 private:
     BrFSAlgorithmStatisticsList m_brfs_statistics_by_arity;
+    NoveltyTableStatisticsList m_novelty_table_statistics_by_arity;
 
     std::chrono::time_point<std::chrono::high_resolution_clock> m_search_start_time_point;
     std::chrono::time_point<std::chrono::high_resolution_clock> m_search_end_time_point;
 
 public:
-    IWAlgorithmStatistics() : m_brfs_statistics_by_arity() {}
+    IWAlgorithmStatistics() : m_brfs_statistics_by_arity(), m_novelty_table_statistics_by_arity() {}
 
     void push_back_algorithm_statistics(BrFSAlgorithmStatistics algorithm_statistics) { m_brfs_statistics_by_arity.push_back(std::move(algorithm_statistics)); }
+    void push_back_novelty_table_statistics(NoveltyTableStatistics novelty_table_statistics)
+    {
+        m_novelty_table_statistics_by_arity.push_back(std::move(novelty_table_statistics));
+    }
 
     void set_search_start_time_point(std::chrono::time_point<std::chrono::high_resolution_clock> time_point) { m_search_start_time_point = time_point; }
     void set_search_end_time_point(std::chrono::time_point<std::chrono::high_resolution_clock> time_point) { m_search_end_time_point = time_point; }
@@ -52,6 +58,8 @@ public:
     }
 
     const BrFSAlgorithmStatisticsList& get_brfs_statistics_by_arity() const { return m_brfs_statistics_by_arity; }
+    /// @brief Get the statistics of the novelty table of each arity. The table of arity 0 is empty.
+    const NoveltyTableStatisticsList& get_novelty_table_statistics_by_arity() const { return m_novelty_table_statistics_by_arity; }
 };
 
 /**
@@ -85,7 +93,13 @@ inline std::ostream& operator<<(std::ostream& os, const IWAlgorithmStatistics& s
        << "[IW] Number of pruned states until last g-layer: "
        << (statistics.get_brfs_statistics_by_arity().back().get_num_pruned_until_g_value().empty() ?
                0 :
-               statistics.get_brfs_statistics_by_arity().back().get_num_pruned_until_g_value().back());
+               statistics.get_brfs_statistics_by_arity().back().get_num_pruned_until_g_value().back())
+       << "\n"
+       << "[IW] Novelty table backend: " << statistics.get_novelty_table_statistics_by_arity().back().get_backend_type() << "\n"
+       << "[IW] Novelty table peak memory usage: " << statistics.get_novelty_table_statistics_by_arity().back().get_peak_memory_usage() << " bytes"
+       << "\n"
+       << "[IW] Novelty table throughput: " << static_cast<uint64_t>(statistics.get_novelty_table_statistics_by_arity().back().get_throughput())
+       << " tuples/s";
 
     return os;
 }
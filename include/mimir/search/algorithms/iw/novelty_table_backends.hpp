@@ -0,0 +1,373 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIMIR_SEARCH_ALGORITHMS_IW_NOVELTY_TABLE_BACKENDS_HPP_
+#define MIMIR_SEARCH_ALGORITHMS_IW_NOVELTY_TABLE_BACKENDS_HPP_
+
+#include "mimir/search/algorithms/iw/types.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <ostream>
+#include <vector>
+
+namespace mimir
+{
+
+/// @brief `NoveltyTableBackendType` selects the data structure that stores the tuple indices that are not novel anymore.
+enum class NoveltyTableBackendType
+{
+    /// @brief Select the backend from the estimated table size, see `select_novelty_table_backend`.
+    AUTOMATIC,
+    DENSE,
+    BLOCKED,
+    HASHED,
+};
+
+inline std::ostream& operator<<(std::ostream& os, NoveltyTableBackendType type)
+{
+    switch (type)
+    {
+        case NoveltyTableBackendType::AUTOMATIC:
+            return os << "automatic";
+        case NoveltyTableBackendType::DENSE:
+            return os << "dense";
+        case NoveltyTableBackendType::BLOCKED:
+            return os << "blocked";
+        case NoveltyTableBackendType::HASHED:
+            return os << "hashed";
+    }
+    return os;
+}
+
+/// @brief Select a backend for a table over tuple indices 0,...,num_tuple_indices-1.
+///
+/// Small tables are dense.
+/// Larger tables of arity at most 2 are blocked because the tuples of a state share their largest atoms,
+/// which keeps the number of touched blocks small.
+/// For larger arities, the touched tuples scatter over the whole index space and we hash them.
+/// We also hash if the blocked table would need too many block pointers.
+inline NoveltyTableBackendType select_novelty_table_backend(size_t arity, size_t num_tuple_indices)
+{
+    if (num_tuple_indices <= MAX_DENSE_NOVELTY_TABLE_SIZE)
+    {
+        return NoveltyTableBackendType::DENSE;
+    }
+    return (arity <= 2 && num_tuple_indices <= MAX_BLOCKED_NOVELTY_TABLE_SIZE) ? NoveltyTableBackendType::BLOCKED : NoveltyTableBackendType::HASHED;
+}
+
+/// @brief `DenseNoveltyTableBackend` stores one bit for each tuple index.
+class DenseNoveltyTableBackend
+{
+private:
+    std::vector<bool> m_table;
+
+public:
+    explicit DenseNoveltyTableBackend(size_t num_tuple_indices) : m_table(num_tuple_indices, false) {}
+
+    bool test(TupleIndex tuple_index) const
+    {
+        assert(tuple_index < m_table.size());
+        return m_table[tuple_index];
+    }
+
+    /// @brief Insert the tuple index and return true iff it was not contained before.
+    bool insert(TupleIndex tuple_index)
+    {
+        assert(tuple_index < m_table.size());
+        if (m_table[tuple_index])
+        {
+            return false;
+        }
+        m_table[tuple_index] = true;
+        return true;
+    }
+
+    void reset() { std::fill(m_table.begin(), m_table.end(), false); }
+
+    template<typename Callback>
+    void for_each(Callback&& callback) const
+    {
+        for (size_t tuple_index = 0; tuple_index < m_table.size(); ++tuple_index)
+        {
+            if (m_table[tuple_index])
+            {
+                callback(static_cast<TupleIndex>(tuple_index));
+            }
+        }
+    }
+
+    size_t get_memory_usage() const { return (m_table.capacity() + 7) / 8; }
+};
+
+/// @brief `BlockedNoveltyTableBackend` partitions the bits of the dense table into fixed size blocks
+/// that are allocated on the first insertion of a tuple index into the block.
+class BlockedNoveltyTableBackend
+{
+private:
+    static constexpr size_t BLOCK_SIZE_LOG2 = 16;
+    static constexpr size_t BLOCK_SIZE = size_t(1) << BLOCK_SIZE_LOG2;
+    static constexpr size_t WORDS_PER_BLOCK = BLOCK_SIZE / 64;
+
+    std::vector<std::unique_ptr<uint64_t[]>> m_blocks;
+    size_t m_num_allocated_blocks;
+
+public:
+    explicit BlockedNoveltyTableBackend(size_t num_tuple_indices) : m_blocks((num_tuple_indices + BLOCK_SIZE - 1) / BLOCK_SIZE), m_num_allocated_blocks(0) {}
+
+    bool test(TupleIndex tuple_index) const
+    {
+        assert((tuple_index >> BLOCK_SIZE_LOG2) < m_blocks.size());
+        const auto& block = m_blocks[tuple_index >> BLOCK_SIZE_LOG2];
+        return block && ((block[(tuple_index & (BLOCK_SIZE - 1)) >> 6] >> (tuple_index & 63)) & 1);
+    }
+
+    /// @brief Insert the tuple index and return true iff it was not contained before.
+    bool insert(TupleIndex tuple_index)
+    {
+        assert((tuple_index >> BLOCK_SIZE_LOG2) < m_blocks.size());
+        auto& block = m_blocks[tuple_index >> BLOCK_SIZE_LOG2];
+        if (!block)
+        {
+            block = std::make_unique<uint64_t[]>(WORDS_PER_BLOCK);
+            ++m_num_allocated_blocks;
+        }
+        auto& word = block[(tuple_index & (BLOCK_SIZE - 1)) >> 6];
+        const auto mask = uint64_t(1) << (tuple_index & 63);
+        if (word & mask)
+        {
+            return false;
+        }
+        word |= mask;
+        return true;
+    }
+
+    /// @brief Clear all bits but keep the allocated blocks for reuse.
+    void reset()
+    {
+        for (auto& block : m_blocks)
+        {
+            if (block)
+            {
+                std::fill(block.get(), block.get() + WORDS_PER_BLOCK, uint64_t(0));
+            }
+        }
+    }
+
+    template<typename Callback>
+    void for_each(Callback&& callback) const
+    {
+        for (size_t block_index = 0; block_index < m_blocks.size(); ++block_index)
+        {
+            const auto& block = m_blocks[block_index];
+            if (!block)
+            {
+                continue;
+            }
+            for (size_t word_index = 0; word_index < WORDS_PER_BLOCK; ++word_index)
+            {
+                for (auto word = block[word_index]; word != 0; word &= word - 1)
+                {
+                    callback(static_cast<TupleIndex>((block_index << BLOCK_SIZE_LOG2) + (word_index << 6) + std::countr_zero(word)));
+                }
+            }
+        }
+    }
+
+    size_t get_memory_usage() const
+    {
+        return m_blocks.capacity() * sizeof(std::unique_ptr<uint64_t[]>) + m_num_allocated_blocks * WORDS_PER_BLOCK * sizeof(uint64_t);
+    }
+};
+
+/// @brief `HashedNoveltyTableBackend` is an open addressing hash set of tuple indices with linear probing.
+///
+/// Insertions claim slots with a compare-and-swap, hence, `insert_concurrent` can be called from several threads.
+/// Growing the table is not thread-safe: concurrent callers must `reserve` the expected number of tuple indices beforehand.
+class HashedNoveltyTableBackend
+{
+private:
+    static constexpr TupleIndex EMPTY_SLOT = std::numeric_limits<TupleIndex>::max();
+    static constexpr size_t INITIAL_CAPACITY = 1024;
+
+    std::unique_ptr<std::atomic<TupleIndex>[]> m_slots;
+    size_t m_capacity;
+    std::atomic<size_t> m_size;
+
+    static size_t get_slot(TupleIndex tuple_index, size_t capacity)
+    {
+        // Fibonacci hashing spreads the consecutive tuple indices of a state over the table.
+        auto hash = static_cast<uint64_t>(tuple_index) * uint64_t(0x9E3779B97F4A7C15);
+        hash ^= hash >> 32;
+        return hash & (capacity - 1);
+    }
+
+    static std::unique_ptr<std::atomic<TupleIndex>[]> create_slots(size_t capacity)
+    {
+        auto slots = std::make_unique<std::atomic<TupleIndex>[]>(capacity);
+        for (size_t i = 0; i < capacity; ++i)
+        {
+            slots[i].store(EMPTY_SLOT, std::memory_order_relaxed);
+        }
+        return slots;
+    }
+
+    void grow(size_t capacity)
+    {
+        auto slots = create_slots(capacity);
+        for (size_t i = 0; i < m_capacity; ++i)
+        {
+            const auto tuple_index = m_slots[i].load(std::memory_order_relaxed);
+            if (tuple_index != EMPTY_SLOT)
+            {
+                auto slot = get_slot(tuple_index, capacity);
+                while (slots[slot].load(std::memory_order_relaxed) != EMPTY_SLOT)
+                {
+                    slot = (slot + 1) & (capacity - 1);
+                }
+                slots[slot].store(tuple_index, std::memory_order_relaxed);
+            }
+        }
+        m_slots = std::move(slots);
+        m_capacity = capacity;
+    }
+
+public:
+    explicit HashedNoveltyTableBackend(size_t num_tuple_indices) : m_slots(create_slots(INITIAL_CAPACITY)), m_capacity(INITIAL_CAPACITY), m_size(0)
+    {
+        assert(num_tuple_indices <= EMPTY_SLOT);
+    }
+
+    HashedNoveltyTableBackend(HashedNoveltyTableBackend&& other) noexcept :
+        m_slots(std::move(other.m_slots)),
+        m_capacity(other.m_capacity),
+        m_size(other.m_size.load(std::memory_order_relaxed))
+    {
+    }
+
+    HashedNoveltyTableBackend& operator=(HashedNoveltyTableBackend&& other) noexcept
+    {
+        m_slots = std::move(other.m_slots);
+        m_capacity = other.m_capacity;
+        m_size.store(other.m_size.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        return *this;
+    }
+
+    bool test(TupleIndex tuple_index) const
+    {
+        assert(tuple_index != EMPTY_SLOT);
+        for (auto slot = get_slot(tuple_index, m_capacity);; slot = (slot + 1) & (m_capacity - 1))
+        {
+            const auto value = m_slots[slot].load(std::memory_order_acquire);
+            if (value == tuple_index)
+            {
+                return true;
+            }
+            if (value == EMPTY_SLOT)
+            {
+                return false;
+            }
+        }
+    }
+
+    /// @brief Insert the tuple index and return true iff it was not contained before.
+    /// Grows the table to keep the load factor at most 1/2.
+    bool insert(TupleIndex tuple_index)
+    {
+        // Only grow for tuple indices that are actually inserted.
+        if (test(tuple_index))
+        {
+            return false;
+        }
+        if (2 * (m_size.load(std::memory_order_relaxed) + 1) > m_capacity)
+        {
+            grow(2 * m_capacity);
+        }
+        return insert_concurrent(tuple_index);
+    }
+
+    /// @brief Insert the tuple index without growing the table and return true iff it was not contained before.
+    bool insert_concurrent(TupleIndex tuple_index)
+    {
+        assert(tuple_index != EMPTY_SLOT);
+        assert(m_size.load(std::memory_order_relaxed) < m_capacity);
+        for (auto slot = get_slot(tuple_index, m_capacity);; slot = (slot + 1) & (m_capacity - 1))
+        {
+            auto value = m_slots[slot].load(std::memory_order_acquire);
+            if (value == EMPTY_SLOT && m_slots[slot].compare_exchange_strong(value, tuple_index, std::memory_order_acq_rel))
+            {
+                m_size.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+            // Either the slot was occupied or another thread claimed it in between.
+            if (value == tuple_index)
+            {
+                return false;
+            }
+        }
+    }
+
+    /// @brief Grow the table such that the given number of tuple indices fit without exceeding a load factor of 1/2.
+    void reserve(size_t num_tuple_indices)
+    {
+        auto capacity = m_capacity;
+        while (capacity < 2 * num_tuple_indices)
+        {
+            capacity *= 2;
+        }
+        if (capacity != m_capacity)
+        {
+            grow(capacity);
+        }
+    }
+
+    /// @brief Clear all slots but keep the capacity for reuse.
+    void reset()
+    {
+        for (size_t i = 0; i < m_capacity; ++i)
+        {
+            m_slots[i].store(EMPTY_SLOT, std::memory_order_relaxed);
+        }
+        m_size.store(0, std::memory_order_relaxed);
+    }
+
+    template<typename Callback>
+    void for_each(Callback&& callback) const
+    {
+        for (size_t i = 0; i < m_capacity; ++i)
+        {
+            const auto tuple_index = m_slots[i].load(std::memory_order_relaxed);
+            if (tuple_index != EMPTY_SLOT)
+            {
+                callback(tuple_index);
+            }
+        }
+    }
+
+    size_t size() const { return m_size.load(std::memory_order_relaxed); }
+
+    size_t get_memory_usage() const { return m_capacity * sizeof(std::atomic<TupleIndex>); }
+};
+
+}
+
+#endif
@@ -0,0 +1,147 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIMIR_SEARCH_ALGORITHMS_IW_NOVELTY_TABLE_STATISTICS_HPP_
+#define MIMIR_SEARCH_ALGORITHMS_IW_NOVELTY_TABLE_STATISTICS_HPP_
+
+#include "mimir/search/algorithms/iw/novelty_table_backends.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+namespace mimir
+{
+
+/// @brief `NoveltyTableStatistics` collects the memory usage and throughput of a `DynamicNoveltyTable`.
+///
+/// Reading the clock costs about as much as testing a small state, hence, only every TIMING_SAMPLE_RATE-th test is timed.
+/// The throughput is measured on the timed tests and the test time is extrapolated from them.
+class NoveltyTableStatistics
+{
+public:
+    static constexpr uint64_t TIMING_SAMPLE_RATE = 64;
+
+private:
+    NoveltyTableBackendType m_backend_type;
+
+    uint64_t m_num_tested_states;
+    uint64_t m_num_tested_tuple_indices;
+    uint64_t m_num_novel_tuple_indices;
+    uint64_t m_num_resizes;
+
+    size_t m_peak_memory_usage;
+
+    uint64_t m_num_timed_states;
+    uint64_t m_num_timed_tuple_indices;
+    std::chrono::nanoseconds m_timed_test_time;
+
+public:
+    NoveltyTableStatistics() :
+        m_backend_type(NoveltyTableBackendType::AUTOMATIC),
+        m_num_tested_states(0),
+        m_num_tested_tuple_indices(0),
+        m_num_novel_tuple_indices(0),
+        m_num_resizes(0),
+        m_peak_memory_usage(0),
+        m_num_timed_states(0),
+        m_num_timed_tuple_indices(0),
+        m_timed_test_time(0)
+    {
+    }
+
+    /// @brief Return true iff the next novelty test should be timed.
+    bool is_next_test_timed() const { return m_num_tested_states % TIMING_SAMPLE_RATE == 0; }
+
+    /// @brief Record a novelty test of a state that generated the given number of tuple indices.
+    void on_test_state(uint64_t num_tested_tuple_indices, uint64_t num_novel_tuple_indices)
+    {
+        ++m_num_tested_states;
+        m_num_tested_tuple_indices += num_tested_tuple_indices;
+        m_num_novel_tuple_indices += num_novel_tuple_indices;
+    }
+
+    /// @brief Record the time of a novelty test for which `is_next_test_timed` returned true.
+    void on_time_test_state(uint64_t num_tested_tuple_indices, std::chrono::nanoseconds test_time)
+    {
+        ++m_num_timed_states;
+        m_num_timed_tuple_indices += num_tested_tuple_indices;
+        m_timed_test_time += test_time;
+    }
+
+    void on_resize() { ++m_num_resizes; }
+
+    void set_backend_type(NoveltyTableBackendType backend_type) { m_backend_type = backend_type; }
+    void update_memory_usage(size_t memory_usage) { m_peak_memory_usage = std::max(m_peak_memory_usage, memory_usage); }
+
+    NoveltyTableBackendType get_backend_type() const { return m_backend_type; }
+    uint64_t get_num_tested_states() const { return m_num_tested_states; }
+    uint64_t get_num_tested_tuple_indices() const { return m_num_tested_tuple_indices; }
+    uint64_t get_num_novel_tuple_indices() const { return m_num_novel_tuple_indices; }
+    uint64_t get_num_resizes() const { return m_num_resizes; }
+    /// @brief Return the peak memory usage of the table in bytes.
+    size_t get_peak_memory_usage() const { return m_peak_memory_usage; }
+    /// @brief Return the test time extrapolated from the timed tests.
+    std::chrono::milliseconds get_test_time_ms() const
+    {
+        if (m_num_timed_tuple_indices == 0)
+        {
+            return std::chrono::milliseconds(0);
+        }
+        const auto test_time = static_cast<double>(m_timed_test_time.count()) * static_cast<double>(m_num_tested_tuple_indices)
+                               / static_cast<double>(m_num_timed_tuple_indices);
+        return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::duration<double, std::nano>(test_time));
+    }
+
+    /// @brief Return the number of tested tuple indices per second in the timed tests.
+    double get_throughput() const
+    {
+        return (m_timed_test_time.count() > 0) ? static_cast<double>(m_num_timed_tuple_indices) * 1e9 / static_cast<double>(m_timed_test_time.count()) : 0.;
+    }
+};
+
+/**
+ * Types
+ */
+
+using NoveltyTableStatisticsList = std::vector<NoveltyTableStatistics>;
+
+/**
+ * Pretty printing
+ */
+
+inline std::ostream& operator<<(std::ostream& os, const NoveltyTableStatistics& statistics)
+{
+    os << "[NoveltyTable] Backend: " << statistics.get_backend_type() << "\n"
+       << "[NoveltyTable] Peak memory usage: " << statistics.get_peak_memory_usage() << " bytes"
+       << "\n"
+       << "[NoveltyTable] Number of resizes: " << statistics.get_num_resizes() << "\n"
+       << "[NoveltyTable] Number of tested states: " << statistics.get_num_tested_states() << "\n"
+       << "[NoveltyTable] Number of tested tuples: " << statistics.get_num_tested_tuple_indices() << "\n"
+       << "[NoveltyTable] Number of novel tuples: " << statistics.get_num_novel_tuple_indices() << "\n"
+       << "[NoveltyTable] Test time: " << statistics.get_test_time_ms().count() << "ms"
+       << "\n"
+       << "[NoveltyTable] Throughput: " << static_cast<uint64_t>(statistics.get_throughput()) << " tuples/s";
+
+    return os;
+}
+
+}
+
+#endif
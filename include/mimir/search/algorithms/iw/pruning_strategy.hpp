@@ -43,12 +43,14 @@ public:
 class ArityKNoveltyPruning : public IPruningStrategy
 {
 private:
-    DynamicNoveltyTable m_novelty_table;
+    std::shared_ptr<DynamicNoveltyTable> m_novelty_table;
 
     std::unordered_set<Index> m_generated_states;
 
 public:
     ArityKNoveltyPruning(size_t arity, size_t num_atoms);
+    /// @brief Prune with the given novelty table, which allows the caller to inspect the table after the search.
+    explicit ArityKNoveltyPruning(std::shared_ptr<DynamicNoveltyTable> novelty_table);
 
     bool test_prune_initial_state(const State state) override;
     bool test_prune_successor_state(const State state, const State succ_state, bool is_new_succ) override;
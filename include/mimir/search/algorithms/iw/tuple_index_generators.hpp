@@ -56,7 +56,7 @@ public:
         /* Internal data */
         std::array<size_t, MAX_ARITY> m_indices;
         bool m_end;
-        int m_cur;
+        TupleIndex m_cur;
 
         std::optional<size_t> find_rightmost_incrementable_index();
 
@@ -123,7 +123,7 @@ public:
         std::array<size_t, MAX_ARITY> m_indices;
         std::array<bool, MAX_ARITY> m_a;
         int m_cur_outter;
-        int m_cur_inner;
+        TupleIndex m_cur_inner;
         bool m_end_outter;
         bool m_end_inner;
 
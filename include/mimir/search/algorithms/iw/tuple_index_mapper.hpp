@@ -48,6 +48,9 @@ public:
 
     std::string tuple_index_to_string(TupleIndex tuple_index) const;
 
+    /// @brief Return the number of atoms in the tuple, i.e., the number of non-placeholder atoms.
+    size_t get_tuple_size(TupleIndex tuple_index) const;
+
     /**
      * Getters
      */
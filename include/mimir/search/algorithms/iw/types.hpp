@@ -18,6 +18,7 @@
 #ifndef MIMIR_SEARCH_ALGORITHMS_IW_TYPES_HPP_
 #define MIMIR_SEARCH_ALGORITHMS_IW_TYPES_HPP_
 
+#include <cstdint>
 #include <unordered_set>
 #include <vector>
 
@@ -37,6 +38,19 @@ const size_t MAX_ARITY = 6;
 
 const size_t INITIAL_TABLE_ATOMS = 64;
 
+/**
+ * Maximum number of tuple indices for which the DynamicNoveltyTable automatically selects a dense table, i.e., 8 MiB.
+ */
+
+const size_t MAX_DENSE_NOVELTY_TABLE_SIZE = size_t(1) << 26;
+
+/**
+ * Maximum number of tuple indices for which the DynamicNoveltyTable automatically selects a blocked table,
+ * i.e., 2^20 blocks whose pointers need 8 MiB.
+ */
+
+const size_t MAX_BLOCKED_NOVELTY_TABLE_SIZE = size_t(1) << 36;
+
 /**
  * Type aliases for readability
  */
@@ -44,7 +58,8 @@ const size_t INITIAL_TABLE_ATOMS = 64;
 using AtomIndex = Index;
 using AtomIndexList = std::vector<AtomIndex>;
 
-using TupleIndex = Index;
+// Tuple indices grow with num_atoms^arity and exceed 32 bits already for IW(2) with 2^16 atoms.
+using TupleIndex = uint64_t;
 using TupleIndexList = std::vector<TupleIndex>;
 using TupleIndexSet = std::unordered_set<TupleIndex>;
 
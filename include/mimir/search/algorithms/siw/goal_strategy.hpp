@@ -30,11 +30,12 @@ private:
 
     int m_initial_num_unsatisfied_goals;
 
-    int count_unsatisfied_goals(const State state) const;
-
 public:
     explicit ProblemGoalCounter(Problem problem, State state);
 
+    /// @brief Return the number of goal literals of the problem that do not hold in the state.
+    int count_unsatisfied_goals(const State state) const;
+
     bool test_static_goal() override;
     bool test_dynamic_goal(const State state) override;
 };
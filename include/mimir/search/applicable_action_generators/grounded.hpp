@@ -19,11 +19,14 @@
 #define MIMIR_SEARCH_APPLICABLE_ACTION_GENERATORS_GROUNDED_HPP_
 
 #include "mimir/formalism/declarations.hpp"
+#include "mimir/search/applicable_action_generators/grounded/axiom_evaluator.hpp"
+#include "mimir/search/applicable_action_generators/grounded/compact_match_tree.hpp"
 #include "mimir/search/applicable_action_generators/grounded/event_handlers.hpp"
 #include "mimir/search/applicable_action_generators/grounded/match_tree.hpp"
 #include "mimir/search/applicable_action_generators/interface.hpp"
 #include "mimir/search/applicable_action_generators/lifted.hpp"
 
+#include <span>
 #include <variant>
 
 namespace mimir
@@ -33,6 +36,9 @@ namespace mimir
 /// using the `LiftedApplicableActionGenerator` and `AxiomEvaluator` to create an overapproximation
 /// of applicable ground actions and ground actions and storing them in a match tree
 /// as described by Helmert
+///
+/// After construction, `generate_applicable_actions` and `generate_and_apply_axioms` are safe to call concurrently from multiple threads
+/// because the match trees and the axiom evaluator are immutable and use thread-local scratch buffers.
 class GroundedApplicableActionGenerator : public IApplicableActionGenerator
 {
 private:
@@ -43,17 +49,24 @@ private:
     std::shared_ptr<IGroundedApplicableActionGeneratorEventHandler> m_event_handler;
     LiftedApplicableActionGenerator m_lifted_aag;
 
+    bool m_use_compact_match_tree;
     MatchTree<GroundAction> m_action_match_tree;
-    MatchTree<GroundAxiom> m_axiom_match_tree;
+    CompactMatchTree<GroundAction> m_compact_action_match_tree;
+    GroundedAxiomEvaluator m_axiom_evaluator;
 
 public:
     /// @brief Simplest construction
     GroundedApplicableActionGenerator(Problem problem, std::shared_ptr<PDDLFactories> pddl_factories);
 
     /// @brief Complete construction
+    /// @param num_threads is the number of threads that compute the bindings of the action schemas in parallel during grounding.
+    /// @param use_compact_match_tree stores the ground actions in a `CompactMatchTree` instead of a `MatchTree`,
+    /// which needs less memory and chooses the split atoms dynamically.
     GroundedApplicableActionGenerator(Problem problem,
                                       std::shared_ptr<PDDLFactories> pddl_factories,
-                                      std::shared_ptr<IGroundedApplicableActionGeneratorEventHandler> event_handler);
+                                      std::shared_ptr<IGroundedApplicableActionGeneratorEventHandler> event_handler,
+                                      size_t num_threads = 1,
+                                      bool use_compact_match_tree = false);
 
     // Uncopyable
     GroundedApplicableActionGenerator(const GroundedApplicableActionGenerator& other) = delete;
@@ -64,6 +77,10 @@ public:
 
     void generate_applicable_actions(State state, GroundActionList& out_applicable_actions) override;
 
+    /// @brief Generate the applicable actions of a batch of states, e.g., a search layer, in a single match tree traversal.
+    /// The applicable actions of states[i] are stored in the range [out_offsets[i], out_offsets[i+1]) of out_applicable_actions.
+    void generate_applicable_actions(std::span<const State> states, std::vector<size_t>& out_offsets, GroundActionList& out_applicable_actions);
+
     void generate_and_apply_axioms(const FlatBitset& fluent_state_atoms, FlatBitset& ref_derived_state_atoms) override;
 
     void on_finish_search_layer() const override;
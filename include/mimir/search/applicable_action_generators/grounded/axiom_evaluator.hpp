@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIMIR_SEARCH_APPLICABLE_ACTION_GENERATORS_GROUNDED_AXIOM_EVALUATOR_HPP_
+#define MIMIR_SEARCH_APPLICABLE_ACTION_GENERATORS_GROUNDED_AXIOM_EVALUATOR_HPP_
+
+#include "mimir/common/types.hpp"
+#include "mimir/common/types_cista.hpp"
+#include "mimir/formalism/declarations.hpp"
+#include "mimir/search/applicable_action_generators/lifted/axiom_stratification.hpp"
+#include "mimir/search/axiom.hpp"
+
+#include <span>
+#include <vector>
+
+namespace mimir
+{
+
+/// @brief `GroundedAxiomEvaluator` evaluates a fixed set of ground axioms by counter-based propagation.
+///
+/// Each ground axiom keeps a counter of its unsatisfied positive preconditions.
+/// Trigger lists in compressed sparse row format map fluent and derived atoms to the axioms that have them as positive precondition.
+/// The fluent atoms of a state are processed once, afterwards each stratum is evaluated with a single worklist
+/// that only touches axioms whose counter drops to zero, i.e., the work is linear in the triggered axioms.
+/// Negative derived preconditions refer to lower strata and are checked when an axiom fires.
+/// The evaluator is immutable after construction and keeps the counters and worklists in thread-local scratch buffers,
+/// hence, `generate_and_apply_axioms` is safe to call concurrently.
+/// After an evaluation, only the counters of the touched axioms are reset, i.e., the work stays linear in the triggered axioms.
+class GroundedAxiomEvaluator
+{
+private:
+    /// @brief Identifies the evaluator whose counters are stored in the thread-local scratch buffers.
+    size_t m_id;
+
+    /* Axioms */
+    GroundAxiomList m_axioms;
+    IndexList m_strata;
+    IndexList m_heads;
+    IndexList m_initial_counters;
+    IndexList m_negative_derived_precondition_offsets;
+    IndexList m_negative_derived_preconditions;
+    /// @brief The axioms without positive preconditions for each stratum.
+    std::vector<IndexList> m_unconditional_axioms;
+
+    /* Trigger lists */
+    IndexList m_fluent_trigger_offsets;
+    IndexList m_fluent_triggers;
+    IndexList m_negative_fluent_trigger_offsets;
+    IndexList m_negative_fluent_triggers;
+    IndexList m_derived_trigger_offsets;
+    IndexList m_derived_triggers;
+
+    /// @brief Preallocated buffers of an evaluation that are reused by all evaluations of the same thread.
+    struct Workspace
+    {
+        size_t evaluator_id = 0;  ///< The evaluator whose initial counters are stored
+        IndexList counters;
+        std::vector<bool> is_blocked;  ///< True iff a negative fluent precondition is violated
+        std::vector<IndexList> ready_axioms;
+        IndexList touched_axioms;  ///< The axioms whose counter or blocked flag differs from the initial one
+    };
+
+    static Workspace& get_workspace();
+
+    void on_new_derived_atom(Index atom_index, Workspace& workspace) const;
+
+public:
+    GroundedAxiomEvaluator();
+
+    /// @brief Compile the ground axioms, which must be statically applicable.
+    GroundedAxiomEvaluator(const GroundAxiomList& ground_axioms, const std::vector<AxiomPartition>& partitioning, const PDDLFactories& pddl_factories);
+
+    /// @brief Extend the derived atoms with all atoms that can be derived from the fluent and derived atoms.
+    void generate_and_apply_axioms(const FlatBitset& fluent_state_atoms, FlatBitset& ref_derived_state_atoms) const;
+
+    const GroundAxiomList& get_axioms() const;
+    size_t get_num_strata() const;
+
+    /// @brief Return the axioms that have the given derived atom as positive precondition.
+    std::span<const Index> get_derived_triggers(Index atom_index) const;
+};
+
+}
+
+#endif
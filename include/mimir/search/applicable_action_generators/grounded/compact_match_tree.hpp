@@ -0,0 +1,331 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIMIR_SEARCH_APPLICABLE_ACTION_GENERATORS_GROUNDED_COMPACT_MATCH_TREE_HPP_
+#define MIMIR_SEARCH_APPLICABLE_ACTION_GENERATORS_GROUNDED_COMPACT_MATCH_TREE_HPP_
+
+#include "mimir/common/types.hpp"
+#include "mimir/common/types_cista.hpp"
+#include "mimir/search/action.hpp"
+
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace mimir
+{
+
+/**
+ * Variant of the `MatchTree` with a compact node layout and a dynamic choice of split atoms.
+ *
+ * Nodes consist of four 32-bit integers (16 bytes instead of 40 bytes) and are laid out in DFS preorder
+ * where the dontcare successor, which is visited for every state, directly follows its parent.
+ * Instead of a static atom order, each selector node splits on the atom with the highest information gain,
+ * i.e., the highest entropy of the partition of the remaining elements into positive, negative, and dontcare.
+ * Elements that can only reach a single leaf are never duplicated,
+ * hence, identical subtrees cannot occur and no hash-consing of nodes is necessary.
+ * As for the `MatchTree`, queries are safe to call concurrently.
+ */
+template<typename T>
+class CompactMatchTree
+{
+private:
+    using NodeID = uint32_t;
+
+    static constexpr uint32_t MAX_VALUE = std::numeric_limits<uint32_t>::max();
+
+    /// @brief A selector tests the atom with the given key = (atom_index << 1) | is_derived.
+    /// A generator stores the range [begin, end) of its elements and has key MAX_VALUE.
+    struct Node
+    {
+        uint32_t key;
+        uint32_t true_succ_or_begin;
+        uint32_t false_succ_or_end;
+        uint32_t dontcare_succ;
+
+        bool is_generator_node() const noexcept { return key == MAX_VALUE; }
+        bool is_derived() const noexcept { return key & 1; }
+        Index get_ground_atom_id() const noexcept { return key >> 1; }
+
+        NodeID get_true_succ() const noexcept { return true_succ_or_begin; }
+        NodeID get_false_succ() const noexcept { return false_succ_or_end; }
+        NodeID get_dontcare_succ() const noexcept { return dontcare_succ; }
+
+        uint32_t get_begin() const noexcept { return true_succ_or_begin; }
+        uint32_t get_end() const noexcept { return false_succ_or_end; }
+    };
+    static_assert(sizeof(Node) == 16);
+
+    std::vector<Node> m_nodes;
+    std::vector<T> m_elements;
+
+    /* Construction */
+    std::vector<T> m_input_elements;
+    IndexList m_condition_offsets;
+    std::vector<std::pair<uint32_t, bool>> m_conditions;  ///< (key, is_positive) for each element
+    std::vector<bool> m_is_tested;
+    IndexList m_num_positive;
+    IndexList m_num_negative;
+    IndexList m_touched_keys;
+
+    NodeID build_recursively(const IndexList& element_ids);
+
+    /// @brief Preallocated buffer of a traversal that is reused by all queries of the same thread.
+    static std::vector<NodeID>& get_stack()
+    {
+        static thread_local std::vector<NodeID> stack;
+        return stack;
+    }
+
+public:
+    CompactMatchTree();
+    explicit CompactMatchTree(const std::vector<T>& elements);
+
+    void get_applicable_elements(const FlatBitset& fluent_ground_atoms, const FlatBitset& derived_ground_atoms, std::vector<T>& out_applicable_elements) const;
+
+    size_t get_num_nodes() const;
+};
+
+template<typename T>
+CompactMatchTree<T>::CompactMatchTree() : m_nodes({ Node { MAX_VALUE, 0, 0, MAX_VALUE } }), m_elements()
+{
+}
+
+template<typename T>
+CompactMatchTree<T>::CompactMatchTree(const std::vector<T>& elements) : m_condition_offsets({ 0 })
+{
+    /* 1. Collect the conditions of each element and discard elements with contradicting conditions. */
+
+    auto num_keys = size_t(0);
+    const auto add_conditions = [this, &num_keys](const FlatBitset& atoms, bool is_derived, bool is_positive)
+    {
+        for (const auto atom_index : atoms)
+        {
+            assert(atom_index < (MAX_VALUE >> 1));
+            const auto key = static_cast<uint32_t>((atom_index << 1) | is_derived);
+            m_conditions.emplace_back(key, is_positive);
+            num_keys = std::max(num_keys, static_cast<size_t>(key) + 1);
+        }
+    };
+
+    const auto are_contradicting = [](const FlatBitset& positive_atoms, const FlatBitset& negative_atoms)
+    {
+        for (const auto atom_index : positive_atoms)
+        {
+            if (negative_atoms.get(atom_index))
+            {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    for (const auto& element : elements)
+    {
+        const auto strips_precondition = StripsActionPrecondition(element.get_strips_precondition());
+
+        const auto& positive_fluent = strips_precondition.template get_positive_precondition<Fluent>();
+        const auto& negative_fluent = strips_precondition.template get_negative_precondition<Fluent>();
+        const auto& positive_derived = strips_precondition.template get_positive_precondition<Derived>();
+        const auto& negative_derived = strips_precondition.template get_negative_precondition<Derived>();
+
+        if (!are_contradicting(positive_fluent, negative_fluent) && !are_contradicting(positive_derived, negative_derived))
+        {
+            add_conditions(positive_fluent, false, true);
+            add_conditions(negative_fluent, false, false);
+            add_conditions(positive_derived, true, true);
+            add_conditions(negative_derived, true, false);
+            m_condition_offsets.push_back(m_conditions.size());
+            m_input_elements.push_back(element);
+        }
+    }
+
+    m_is_tested.assign(num_keys, false);
+    m_num_positive.assign(num_keys, 0);
+    m_num_negative.assign(num_keys, 0);
+
+    /* 2. Build the tree top-down in DFS preorder. */
+
+    auto element_ids = IndexList(m_input_elements.size());
+    for (size_t i = 0; i < element_ids.size(); ++i)
+    {
+        element_ids[i] = i;
+    }
+    const auto root_node_id = build_recursively(element_ids);
+
+    assert(root_node_id == 0);
+    // Prevent unused variable warning when not in debug mode
+    (void) root_node_id;
+
+    /* 3. Release the construction data. */
+
+    m_input_elements = std::vector<T> {};
+    m_condition_offsets = IndexList {};
+    m_conditions = std::vector<std::pair<uint32_t, bool>> {};
+    m_is_tested = std::vector<bool> {};
+    m_num_positive = IndexList {};
+    m_num_negative = IndexList {};
+    m_touched_keys = IndexList {};
+}
+
+template<typename T>
+CompactMatchTree<T>::NodeID CompactMatchTree<T>::build_recursively(const IndexList& element_ids)
+{
+    /* 1. Count the untested conditions. */
+
+    for (const auto element_id : element_ids)
+    {
+        for (auto i = m_condition_offsets[element_id]; i < m_condition_offsets[element_id + 1]; ++i)
+        {
+            const auto [key, is_positive] = m_conditions[i];
+            if (m_is_tested[key])
+            {
+                continue;
+            }
+            if (m_num_positive[key] == 0 && m_num_negative[key] == 0)
+            {
+                m_touched_keys.push_back(key);
+            }
+            ++(is_positive ? m_num_positive[key] : m_num_negative[key]);
+        }
+    }
+
+    // Base case: all conditions of the elements are tested.
+    if (m_touched_keys.empty())
+    {
+        assert(m_elements.size() + element_ids.size() < MAX_VALUE);
+
+        const auto node_id = static_cast<NodeID>(m_nodes.size());
+        const auto begin = static_cast<uint32_t>(m_elements.size());
+        for (const auto element_id : element_ids)
+        {
+            m_elements.push_back(m_input_elements[element_id]);
+        }
+        m_nodes.push_back(Node { MAX_VALUE, begin, static_cast<uint32_t>(m_elements.size()), MAX_VALUE });
+        return node_id;
+    }
+
+    /* 2. Select the split atom with the highest information gain and reset the counts. */
+
+    const auto num_elements = static_cast<double>(element_ids.size());
+    const auto entropy = [num_elements](size_t count) { return (count == 0) ? 0. : -(count / num_elements) * std::log2(count / num_elements); };
+
+    auto best_key = MAX_VALUE;
+    auto best_gain = -1.;
+    for (const auto key : m_touched_keys)
+    {
+        const auto num_positive = m_num_positive[key];
+        const auto num_negative = m_num_negative[key];
+        const auto gain = entropy(num_positive) + entropy(num_negative) + entropy(element_ids.size() - num_positive - num_negative);
+        if (gain > best_gain || (gain == best_gain && key < best_key))
+        {
+            best_key = key;
+            best_gain = gain;
+        }
+        m_num_positive[key] = 0;
+        m_num_negative[key] = 0;
+    }
+    m_touched_keys.clear();
+
+    /* 3. Partition the elements and recurse. */
+
+    auto positive_element_ids = IndexList {};
+    auto negative_element_ids = IndexList {};
+    auto dontcare_element_ids = IndexList {};
+    for (const auto element_id : element_ids)
+    {
+        auto* partition = &dontcare_element_ids;
+        for (auto i = m_condition_offsets[element_id]; i < m_condition_offsets[element_id + 1]; ++i)
+        {
+            if (m_conditions[i].first == best_key)
+            {
+                partition = m_conditions[i].second ? &positive_element_ids : &negative_element_ids;
+                break;
+            }
+        }
+        partition->push_back(element_id);
+    }
+
+    // Top-down creation of nodes to ensure DFS preorder, update information after recursion.
+    const auto node_id = static_cast<NodeID>(m_nodes.size());
+    m_nodes.push_back(Node { best_key, MAX_VALUE, MAX_VALUE, MAX_VALUE });
+
+    m_is_tested[best_key] = true;
+    const auto dontcare_succ = (!dontcare_element_ids.empty()) ? build_recursively(dontcare_element_ids) : MAX_VALUE;
+    const auto true_succ = (!positive_element_ids.empty()) ? build_recursively(positive_element_ids) : MAX_VALUE;
+    const auto false_succ = (!negative_element_ids.empty()) ? build_recursively(negative_element_ids) : MAX_VALUE;
+    m_is_tested[best_key] = false;
+
+    auto& node = m_nodes[node_id];
+    node.true_succ_or_begin = true_succ;
+    node.false_succ_or_end = false_succ;
+    node.dontcare_succ = dontcare_succ;
+
+    return node_id;
+}
+
+template<typename T>
+void CompactMatchTree<T>::get_applicable_elements(const FlatBitset& fluent_ground_atoms,
+                                                  const FlatBitset& derived_ground_atoms,
+                                                  std::vector<T>& out_applicable_elements) const
+{
+    out_applicable_elements.clear();
+
+    assert(!m_nodes.empty());
+
+    auto& stack = get_stack();
+    stack.clear();
+    stack.push_back(0);
+
+    while (!stack.empty())
+    {
+        const auto& node = m_nodes[stack.back()];
+        stack.pop_back();
+
+        if (node.is_generator_node())
+        {
+            out_applicable_elements.insert(out_applicable_elements.end(), m_elements.begin() + node.get_begin(), m_elements.begin() + node.get_end());
+            continue;
+        }
+
+        const auto& atoms = node.is_derived() ? derived_ground_atoms : fluent_ground_atoms;
+        const auto succ = atoms.get(node.get_ground_atom_id()) ? node.get_true_succ() : node.get_false_succ();
+
+        // Push the dontcare successor last such that it is visited first.
+        if (succ != MAX_VALUE)
+        {
+            stack.push_back(succ);
+        }
+        if (node.get_dontcare_succ() != MAX_VALUE)
+        {
+            stack.push_back(node.get_dontcare_succ());
+        }
+    }
+}
+
+template<typename T>
+size_t CompactMatchTree<T>::get_num_nodes() const
+{
+    return m_nodes.size();
+}
+
+}
+
+#endif
@@ -32,16 +32,17 @@ private:
 
     void on_finish_delete_free_exploration_impl(const GroundAtomList<Fluent>& reached_fluent_atoms,
                                                 const GroundAtomList<Derived>& reached_derived_atoms,
-                                                const GroundActionList& instantiated_actions,
+                                                size_t num_instantiated_actions,
                                                 const GroundAxiomList& instantiated_axioms);
 
     void on_finish_grounding_unrelaxed_actions_impl(const GroundActionList& unrelaxed_actions);
 
     void on_finish_build_action_match_tree_impl(const MatchTree<GroundAction>& action_match_tree);
 
+    void on_finish_build_action_match_tree_impl(const CompactMatchTree<GroundAction>& action_match_tree);
+
     void on_finish_grounding_unrelaxed_axioms_impl(const GroundAxiomList& unrelaxed_axioms);
 
-    void on_finish_build_axiom_match_tree_impl(const MatchTree<GroundAxiom>& axiom_match_tree);
 
     void on_finish_search_layer_impl() const;
 
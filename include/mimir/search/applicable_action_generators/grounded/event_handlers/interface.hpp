@@ -29,6 +29,8 @@ namespace mimir
 {
 template<typename T>
 class MatchTree;
+template<typename T>
+class CompactMatchTree;
 
 /**
  * Interface class
@@ -41,16 +43,16 @@ public:
     /// @brief React on finishing delete-free exploration
     virtual void on_finish_delete_free_exploration(const GroundAtomList<Fluent>& reached_fluent_atoms,
                                                    const GroundAtomList<Derived>& reached_derived_atoms,
-                                                   const GroundActionList& instantiated_actions,
+                                                   size_t num_instantiated_actions,
                                                    const GroundAxiomList& instantiated_axioms) = 0;
 
     virtual void on_finish_grounding_unrelaxed_actions(const GroundActionList& unrelaxed_actions) = 0;
 
     virtual void on_finish_build_action_match_tree(const MatchTree<GroundAction>& action_match_tree) = 0;
 
-    virtual void on_finish_grounding_unrelaxed_axioms(const GroundAxiomList& unrelaxed_axioms) = 0;
+    virtual void on_finish_build_action_match_tree(const CompactMatchTree<GroundAction>& action_match_tree) = 0;
 
-    virtual void on_finish_build_axiom_match_tree(const MatchTree<GroundAxiom>& axiom_match_tree) = 0;
+    virtual void on_finish_grounding_unrelaxed_axioms(const GroundAxiomList& unrelaxed_axioms) = 0;
 
     virtual void on_finish_search_layer() = 0;
 
@@ -84,17 +86,17 @@ public:
 
     void on_finish_delete_free_exploration(const GroundAtomList<Fluent>& reached_fluent_atoms,
                                            const GroundAtomList<Derived>& reached_derived_atoms,
-                                           const GroundActionList& instantiated_actions,
+                                           size_t num_instantiated_actions,
                                            const GroundAxiomList& instantiated_axioms) override
     {  //
         m_statistics.set_num_delete_free_reachable_fluent_ground_atoms(reached_fluent_atoms.size());
         m_statistics.set_num_delete_free_reachable_derived_ground_atoms(reached_derived_atoms.size());
-        m_statistics.set_num_delete_free_actions(instantiated_actions.size());
+        m_statistics.set_num_delete_free_actions(num_instantiated_actions);
         m_statistics.set_num_delete_free_axioms(instantiated_axioms.size());
 
         if (!m_quiet)
         {
-            self().on_finish_delete_free_exploration_impl(reached_fluent_atoms, reached_derived_atoms, instantiated_actions, instantiated_axioms);
+            self().on_finish_delete_free_exploration_impl(reached_fluent_atoms, reached_derived_atoms, num_instantiated_actions, instantiated_axioms);
         }
     }
 
@@ -118,23 +120,23 @@ public:
         }
     }
 
-    void on_finish_grounding_unrelaxed_axioms(const GroundAxiomList& unrelaxed_axioms) override
+    void on_finish_build_action_match_tree(const CompactMatchTree<GroundAction>& action_match_tree) override
     {  //
-        m_statistics.set_num_ground_axioms(unrelaxed_axioms.size());
+        m_statistics.set_num_nodes_in_action_match_tree(action_match_tree.get_num_nodes());
 
         if (!m_quiet)
         {
-            self().on_finish_grounding_unrelaxed_axioms_impl(unrelaxed_axioms);
+            self().on_finish_build_action_match_tree_impl(action_match_tree);
         }
     }
 
-    void on_finish_build_axiom_match_tree(const MatchTree<GroundAxiom>& axiom_match_tree) override
+    void on_finish_grounding_unrelaxed_axioms(const GroundAxiomList& unrelaxed_axioms) override
     {  //
-        m_statistics.set_num_nodes_in_axiom_match_tree(axiom_match_tree.get_num_nodes());
+        m_statistics.set_num_ground_axioms(unrelaxed_axioms.size());
 
         if (!m_quiet)
         {
-            self().on_finish_build_axiom_match_tree_impl(axiom_match_tree);
+            self().on_finish_grounding_unrelaxed_axioms_impl(unrelaxed_axioms);
         }
     }
 
@@ -37,7 +37,6 @@ private:
     uint64_t m_num_nodes_in_action_match_tree;
 
     uint64_t m_num_ground_axioms;
-    uint64_t m_num_nodes_in_axiom_match_tree;
 
 public:
     GroundedApplicableActionGeneratorStatistics() :
@@ -47,8 +46,7 @@ public:
         m_num_delete_free_axioms(0),
         m_num_ground_actions(0),
         m_num_nodes_in_action_match_tree(0),
-        m_num_ground_axioms(0),
-        m_num_nodes_in_axiom_match_tree(0)
+        m_num_ground_axioms(0)
     {
     }
 
@@ -61,7 +59,6 @@ public:
     void set_num_nodes_in_action_match_tree(uint64_t value) { m_num_nodes_in_action_match_tree = value; }
 
     void set_num_ground_axioms(uint64_t value) { m_num_ground_axioms = value; }
-    void set_num_nodes_in_axiom_match_tree(uint64_t value) { m_num_nodes_in_axiom_match_tree = value; }
 
     uint64_t get_num_delete_free_reachable_fluent_ground_atoms() const { return m_num_delete_free_reachable_fluent_ground_atoms; }
     uint64_t get_num_delete_free_reachable_derived_ground_atoms() const { return m_num_delete_free_reachable_derived_ground_atoms; }
@@ -72,7 +69,6 @@ public:
     uint64_t get_num_nodes_in_action_match_tree() const { return m_num_nodes_in_action_match_tree; }
 
     uint64_t get_num_ground_axioms() const { return m_num_ground_axioms; }
-    uint64_t get_num_nodes_in_axiom_match_tree() const { return m_num_nodes_in_axiom_match_tree; }
 };
 
 }
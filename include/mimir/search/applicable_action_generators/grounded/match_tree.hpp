@@ -21,6 +21,9 @@
 #include "mimir/common/types_cista.hpp"
 
 #include <cstdint>
+#include <span>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 namespace mimir
@@ -34,6 +37,9 @@ namespace mimir
  * Since iterator offsets, atom ids, and node ids are all integers,
  * we can merge selector nodes and generator
  * nodes in a single data type consisting of four integers.
+ *
+ * The match tree is immutable after construction, hence, queries are safe to call concurrently.
+ * Each thread traverses the tree with its own thread-local scratch buffers.
  */
 template<typename T>
 class MatchTree
@@ -123,16 +129,36 @@ private:
                              const std::vector<size_t>& fluent_ground_atoms_order,
                              const std::vector<size_t>& derived_ground_atoms_order);
 
-    void get_applicable_elements_recursively(size_t node_id,
-                                             const FlatBitset& fluent_ground_atoms,
-                                             const FlatBitset& derived_ground_atoms,
-                                             std::vector<T>& out_applicable_elements);
+    /// @brief Preallocated buffers of a traversal that are reused by all queries of the same thread.
+    struct Workspace
+    {
+        std::vector<NodeID> stack;
+        std::vector<std::tuple<NodeID, size_t, size_t>> batch_stack;  ///< (node, begin, end) of the states in batch_states
+        std::vector<size_t> batch_states;
+        std::vector<std::pair<size_t, NodeID>> batch_generators;  ///< (state, generator) in visiting order
+        std::vector<size_t> batch_positions;
+    };
+
+    static Workspace& get_workspace()
+    {
+        static thread_local Workspace workspace;
+        return workspace;
+    }
 
 public:
     MatchTree();
     MatchTree(const std::vector<T>& elements, const std::vector<size_t>& fluent_ground_atoms_order, const std::vector<size_t>& derived_ground_atoms_order);
 
-    void get_applicable_elements(const FlatBitset& fluent_ground_atoms, const FlatBitset& derived_ground_atoms, std::vector<T>& out_applicable_elements);
+    void get_applicable_elements(const FlatBitset& fluent_ground_atoms, const FlatBitset& derived_ground_atoms, std::vector<T>& out_applicable_elements) const;
+
+    /// @brief Compute the applicable elements of a batch of states in a single traversal.
+    /// Each node is visited once for all states that reach it.
+    /// The applicable elements of the i-th state are stored in the range
+    /// [out_offsets[i], out_offsets[i+1]) of out_applicable_elements in the same order as for a single state.
+    void get_applicable_elements(std::span<const FlatBitset* const> fluent_ground_atoms,
+                                 std::span<const FlatBitset* const> derived_ground_atoms,
+                                 std::vector<size_t>& out_offsets,
+                                 std::vector<T>& out_applicable_elements) const;
 
     size_t get_num_nodes() const;
 
@@ -272,54 +298,163 @@ MatchTree<T>::MatchTree(const std::vector<T>& elements,
 }
 
 template<typename T>
-void MatchTree<T>::get_applicable_elements_recursively(size_t node_id,
-                                                       const FlatBitset& fluent_ground_atoms,
-                                                       const FlatBitset& derived_ground_atoms,
-                                                       std::vector<T>& out_applicable_elements)
+void MatchTree<T>::get_applicable_elements(const FlatBitset& fluent_ground_atoms,
+                                           const FlatBitset& derived_ground_atoms,
+                                           std::vector<T>& out_applicable_elements) const
 {
-    auto& node = m_nodes[node_id];
+    out_applicable_elements.clear();
 
-    if (node.is_selector_node())
+    assert(!m_nodes.empty());
+
+    auto& stack = get_workspace().stack;
+    stack.clear();
+    stack.push_back(0);
+
+    while (!stack.empty())
     {
-        if (node.has_dontcare_succ())
+        const auto& node = m_nodes[stack.back()];
+        stack.pop_back();
+
+        if (node.is_generator_node())
         {
-            get_applicable_elements_recursively(node.get_dontcare_succ(), fluent_ground_atoms, derived_ground_atoms, out_applicable_elements);
+            out_applicable_elements.insert(out_applicable_elements.end(), m_elements.begin() + node.get_begin(), m_elements.begin() + node.get_end());
+            continue;
         }
 
         const bool is_atom_true = (node.get_node_type() == NodeType::FLUENT_SELECTOR) ? fluent_ground_atoms.get(node.get_ground_atom_id()) :
                                                                                         derived_ground_atoms.get(node.get_ground_atom_id());
 
-        if (is_atom_true)
+        // Push the dontcare successor last such that it is visited first.
+        const auto succ = (is_atom_true) ? node.get_true_succ() : node.get_false_succ();
+        if (succ != GeneratorOrSelectorNode::MAX_VALUE)
         {
-            if (node.has_true_succ())
+            stack.push_back(succ);
+        }
+        if (node.has_dontcare_succ())
+        {
+            stack.push_back(node.get_dontcare_succ());
+        }
+    }
+}
+
+template<typename T>
+void MatchTree<T>::get_applicable_elements(std::span<const FlatBitset* const> fluent_ground_atoms,
+                                           std::span<const FlatBitset* const> derived_ground_atoms,
+                                           std::vector<size_t>& out_offsets,
+                                           std::vector<T>& out_applicable_elements) const
+{
+    assert(fluent_ground_atoms.size() == derived_ground_atoms.size());
+    assert(!m_nodes.empty());
+
+    auto& [stack, batch_stack, batch_states, batch_generators, batch_positions] = get_workspace();
+
+    const auto num_states = fluent_ground_atoms.size();
+
+    out_offsets.assign(num_states + 1, 0);
+    out_applicable_elements.clear();
+
+    /* 1. Traverse the tree once, splitting the states at each selector node. */
+
+    batch_states.resize(num_states);
+    for (size_t state = 0; state < num_states; ++state)
+    {
+        batch_states[state] = state;
+    }
+    batch_generators.clear();
+    batch_stack.clear();
+    if (num_states > 0)
+    {
+        batch_stack.emplace_back(0, 0, num_states);
+    }
+
+    while (!batch_stack.empty())
+    {
+        const auto [node_id, begin, end] = batch_stack.back();
+        batch_stack.pop_back();
+        const auto& node = m_nodes[node_id];
+
+        if (node.is_generator_node())
+        {
+            for (size_t i = begin; i < end; ++i)
             {
-                get_applicable_elements_recursively(node.get_true_succ(), fluent_ground_atoms, derived_ground_atoms, out_applicable_elements);
+                const auto state = batch_states[i];
+                batch_generators.emplace_back(state, node_id);
+                out_offsets[state + 1] += node.get_end() - node.get_begin();
             }
+            continue;
         }
-        else
+
+        const bool is_fluent = (node.get_node_type() == NodeType::FLUENT_SELECTOR);
+        const auto atom_id = node.get_ground_atom_id();
+
+        // Append the states in which the atom is true and false as new ranges, the dontcare successor shares the range.
+        const auto true_begin = batch_states.size();
+        if (node.has_true_succ())
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                const auto state = batch_states[i];
+                if ((is_fluent) ? fluent_ground_atoms[state]->get(atom_id) : derived_ground_atoms[state]->get(atom_id))
+                {
+                    batch_states.push_back(state);
+                }
+            }
+        }
+        const auto false_begin = batch_states.size();
+        if (node.has_false_succ())
         {
-            if (node.has_false_succ())
+            for (size_t i = begin; i < end; ++i)
             {
-                get_applicable_elements_recursively(node.get_false_succ(), fluent_ground_atoms, derived_ground_atoms, out_applicable_elements);
+                const auto state = batch_states[i];
+                if (!((is_fluent) ? fluent_ground_atoms[state]->get(atom_id) : derived_ground_atoms[state]->get(atom_id)))
+                {
+                    batch_states.push_back(state);
+                }
             }
         }
+        const auto false_end = batch_states.size();
+
+        // Push in reverse visiting order: dontcare, true, false.
+        if (false_begin != false_end)
+        {
+            batch_stack.emplace_back(node.get_false_succ(), false_begin, false_end);
+        }
+        if (true_begin != false_begin)
+        {
+            batch_stack.emplace_back(node.get_true_succ(), true_begin, false_begin);
+        }
+        if (node.has_dontcare_succ())
+        {
+            batch_stack.emplace_back(node.get_dontcare_succ(), begin, end);
+        }
     }
-    else
+
+    /* 2. Group the generators by state using counting sort, which preserves the visiting order. */
+
+    batch_positions.assign(num_states + 1, 0);
+    for (const auto& [state, node_id] : batch_generators)
     {
-        out_applicable_elements.insert(out_applicable_elements.end(), m_elements.begin() + node.get_begin(), m_elements.begin() + node.get_end());
+        ++batch_positions[state + 1];
+    }
+    for (size_t state = 0; state < num_states; ++state)
+    {
+        batch_positions[state + 1] += batch_positions[state];
+        out_offsets[state + 1] += out_offsets[state];
+    }
+    stack.resize(batch_generators.size());
+    for (const auto& [state, node_id] : batch_generators)
+    {
+        stack[batch_positions[state]++] = node_id;
     }
-}
-
-template<typename T>
-void MatchTree<T>::get_applicable_elements(const FlatBitset& fluent_ground_atoms,
-                                           const FlatBitset& derived_ground_atoms,
-                                           std::vector<T>& out_applicable_elements)
-{
-    out_applicable_elements.clear();
 
-    assert(!m_nodes.empty());
+    /* 3. Collect the elements of each state. */
 
-    get_applicable_elements_recursively(0, fluent_ground_atoms, derived_ground_atoms, out_applicable_elements);
+    out_applicable_elements.reserve(out_offsets.back());
+    for (const auto node_id : stack)
+    {
+        const auto& node = m_nodes[node_id];
+        out_applicable_elements.insert(out_applicable_elements.end(), m_elements.begin() + node.get_begin(), m_elements.begin() + node.get_end());
+    }
 }
 }
 
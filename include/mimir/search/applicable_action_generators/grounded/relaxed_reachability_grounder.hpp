@@ -0,0 +1,123 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIMIR_SEARCH_APPLICABLE_ACTION_GENERATORS_GROUNDED_RELAXED_REACHABILITY_GROUNDER_HPP_
+#define MIMIR_SEARCH_APPLICABLE_ACTION_GENERATORS_GROUNDED_RELAXED_REACHABILITY_GROUNDER_HPP_
+
+#include "mimir/algorithms/BS_thread_pool.hpp"
+#include "mimir/common/hash.hpp"
+#include "mimir/common/types_cista.hpp"
+#include "mimir/formalism/declarations.hpp"
+#include "mimir/formalism/transformers/delete_relax.hpp"
+#include "mimir/search/action.hpp"
+#include "mimir/search/applicable_action_generators/lifted.hpp"
+#include "mimir/search/applicable_action_generators/lifted/axiom_evaluator.hpp"
+#include "mimir/search/axiom.hpp"
+#include "mimir/search/condition_grounders.hpp"
+
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace mimir
+{
+
+/// @brief `RelaxedReachabilityGrounder` computes the ground actions and ground axioms that are reachable in the delete relaxation.
+///
+/// The action schemas of the delete-free problem are evaluated semi-naively: after the first round,
+/// only bindings in which some condition is grounded to an atom reached in the previous round are enumerated.
+/// Each reachable binding is grounded exactly once as the corresponding unrelaxed actions,
+/// whose add effects and conditional add effects extend the reached atoms.
+/// The bindings of the action schemas in a round can be computed in parallel.
+class RelaxedReachabilityGrounder
+{
+private:
+    Problem m_problem;
+    std::shared_ptr<PDDLFactories> m_pddl_factories;
+
+    DeleteRelaxTransformer m_delete_relax_transformer;
+    Problem m_delete_free_problem;
+    AxiomEvaluator m_delete_free_axiom_evaluator;
+
+    std::shared_ptr<GroundAtomIndexTables> m_ground_atom_index_tables;
+    /// @brief The delete-free action schemas and their grounders.
+    std::vector<std::pair<Action, ConditionGrounder<PartiallyExtendedState>>> m_condition_grounders;
+    /// @brief The bindings of each delete-free action schema that were already grounded.
+    std::vector<std::unordered_set<ObjectList, Hash<ObjectList>>> m_reached_bindings;
+
+    std::unique_ptr<BS::thread_pool> m_thread_pool;
+
+    /* Results */
+    FlatBitset m_reached_fluent_atoms;
+    FlatBitset m_reached_derived_atoms;
+    size_t m_num_delete_free_actions;
+    GroundActionList m_ground_actions;
+    GroundAxiomList m_ground_axioms;
+
+    /* Preallocated buffers */
+    FlatBitset m_new_fluent_atoms;
+    FlatBitset m_new_derived_atoms;
+    std::unordered_map<Predicate<Fluent>, GroundAtomList<Fluent>> m_new_fluent_atoms_by_predicate;
+    std::unordered_map<Predicate<Derived>, GroundAtomList<Derived>> m_new_derived_atoms_by_predicate;
+    std::vector<ObjectList> m_schema_bindings;  ///< Flat bindings of each action schema, each binding occupies |parameters| consecutive entries
+    std::vector<size_t> m_schema_num_bindings;
+    ObjectList m_binding;
+    std::vector<std::pair<GroundAction, size_t>> m_pending_conditional_effects;  ///< (action, index) of conditional effects that did not fire yet
+
+    /// @brief Compute the bindings of a delete-free action schema in the current round.
+    void compute_schema_bindings(size_t schema_index, bool is_first_round);
+
+    /// @brief Return true iff the positive conditions of the conditional effect hold in the reached atoms.
+    bool is_relaxed_applicable(const ConditionalEffect& conditional_effect) const;
+
+    /// @brief Add the positive effects of a ground action, conditional effects that cannot fire yet become pending.
+    void apply_relaxed(GroundAction action);
+
+public:
+    /// @param num_threads is the number of threads that compute the bindings of the action schemas in parallel.
+    RelaxedReachabilityGrounder(Problem problem, std::shared_ptr<PDDLFactories> pddl_factories, size_t num_threads = 1);
+
+    // Uncopyable
+    RelaxedReachabilityGrounder(const RelaxedReachabilityGrounder& other) = delete;
+    RelaxedReachabilityGrounder& operator=(const RelaxedReachabilityGrounder& other) = delete;
+    // Unmovable
+    RelaxedReachabilityGrounder(RelaxedReachabilityGrounder&& other) = delete;
+    RelaxedReachabilityGrounder& operator=(RelaxedReachabilityGrounder&& other) = delete;
+
+    /// @brief Explore the delete relaxation until a fixed point is reached and ground the reachable unrelaxed actions and axioms.
+    /// The unrelaxed actions and axioms are grounded by the given lifted applicable action generator.
+    void ground(LiftedApplicableActionGenerator& ref_lifted_aag);
+
+    const FlatBitset& get_reached_fluent_atoms() const;
+    const FlatBitset& get_reached_derived_atoms() const;
+
+    /// @brief Return the number of reachable ground actions of the delete-free problem.
+    size_t get_num_delete_free_actions() const;
+    /// @brief Return the reachable ground axioms of the delete-free problem.
+    const GroundAxiomList& get_delete_free_axioms() const;
+
+    /// @brief Return the reachable unrelaxed ground actions that are statically applicable.
+    const GroundActionList& get_ground_actions() const;
+    /// @brief Return the reachable unrelaxed ground axioms that are statically applicable.
+    const GroundAxiomList& get_ground_axioms() const;
+};
+
+}
+
+#endif
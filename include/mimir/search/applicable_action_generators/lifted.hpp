@@ -18,16 +18,20 @@
 #ifndef MIMIR_SEARCH_APPLICABLE_ACTION_GENERATORS_LIFTED_HPP_
 #define MIMIR_SEARCH_APPLICABLE_ACTION_GENERATORS_LIFTED_HPP_
 
+#include "mimir/algorithms/BS_thread_pool.hpp"
 #include "mimir/formalism/action.hpp"
 #include "mimir/search/action.hpp"
 #include "mimir/search/applicable_action_generators/interface.hpp"
+#include "mimir/search/applicable_action_generators/lifted/assignment_set.hpp"
 #include "mimir/search/applicable_action_generators/lifted/axiom_evaluator.hpp"
 #include "mimir/search/applicable_action_generators/lifted/consistency_graph.hpp"
 #include "mimir/search/applicable_action_generators/lifted/event_handlers.hpp"
+#include "mimir/search/applicable_action_generators/lifted/ground_atom_index_table.hpp"
 #include "mimir/search/axiom.hpp"
 #include "mimir/search/condition_grounders.hpp"
 #include "mimir/search/state.hpp"
 
+#include <memory>
 #include <unordered_map>
 #include <vector>
 
@@ -49,7 +53,10 @@ private:
 
     AxiomEvaluator m_axiom_evaluator;
 
+    std::shared_ptr<GroundAtomIndexTables> m_ground_atom_index_tables;
     std::unordered_map<Action, ConditionGrounder<State>> m_action_precondition_grounders;
+    /// @brief The action schemas and their grounders in the order in which applicable actions are generated.
+    std::vector<std::pair<Action, ConditionGrounder<State>*>> m_action_precondition_grounder_list;
     std::unordered_map<Action, std::vector<consistency_graph::StaticConsistencyGraph>> m_action_universal_effects;
 
     FlatActionSet m_flat_actions;
@@ -59,6 +66,12 @@ private:
 
     GroundFunctionToValue m_ground_function_value_costs;
 
+    /* Intra-state parallelization over the action schemas */
+    std::unique_ptr<BS::thread_pool> m_thread_pool;
+    std::vector<ObjectList> m_schema_bindings;  ///< Flat bindings of each action schema, each binding occupies |parameters| consecutive entries
+    std::vector<size_t> m_schema_num_bindings;
+    ObjectList m_binding;
+
     /// @brief Ground the precondition of an action and return a view onto it.
     GroundAction ground_action_precondition(Action action, const ObjectList& binding);
 
@@ -67,9 +80,12 @@ public:
     LiftedApplicableActionGenerator(Problem problem, std::shared_ptr<PDDLFactories> ref_pddl_factories);
 
     /// @brief Complete construction
+    /// @param num_threads is the number of threads that compute the bindings of the action schemas in parallel.
+    /// With a single thread, no thread pool is created. The generated actions are independent of the number of threads.
     LiftedApplicableActionGenerator(Problem problem,
                                     std::shared_ptr<PDDLFactories> ref_pddl_factories,
-                                    std::shared_ptr<ILiftedApplicableActionGeneratorEventHandler> event_handler);
+                                    std::shared_ptr<ILiftedApplicableActionGeneratorEventHandler> event_handler,
+                                    size_t num_threads = 1);
 
     // Uncopyable
     LiftedApplicableActionGenerator(const LiftedApplicableActionGenerator& other) = delete;
@@ -94,10 +110,10 @@ public:
     const std::vector<AxiomPartition>& get_axiom_partitioning() const;
 
     /// @brief Ground an axiom and return a view onto it.
-    GroundAxiom ground_axiom(Axiom axiom, ObjectList&& binding);
+    GroundAxiom ground_axiom(Axiom axiom, const ObjectList& binding);
 
     /// @brief Ground an action and return a view onto it.
-    GroundAction ground_action(Action action, ObjectList&& binding);
+    GroundAction ground_action(Action action, const ObjectList& binding);
 
     const GroundActionList& get_ground_actions() const override;
 
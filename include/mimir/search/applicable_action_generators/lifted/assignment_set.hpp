@@ -18,14 +18,19 @@
 #ifndef MIMIR_SEARCH_APPLICABLE_ACTION_GENERATORS_LIFTED_ASSIGNMENT_SET_HPP_
 #define MIMIR_SEARCH_APPLICABLE_ACTION_GENERATORS_LIFTED_ASSIGNMENT_SET_HPP_
 
+#include "mimir/common/types_cista.hpp"
 #include "mimir/formalism/declarations.hpp"
+#include "mimir/formalism/factories.hpp"
 #include "mimir/formalism/literal.hpp"
 #include "mimir/formalism/problem.hpp"
 #include "mimir/search/applicable_action_generators/lifted/consistency_graph.hpp"
 
 #include <cassert>
+#include <cstdint>
 #include <limits>
 #include <tuple>
+#include <type_traits>
+#include <unordered_map>
 #include <vector>
 
 namespace mimir
@@ -134,6 +139,11 @@ inline size_t num_assignments(size_t arity, size_t num_objects)
 ///   2. the assignment [i/o] is consistent
 ///
 /// We say that an assignment set is static if all atoms it considers are static.
+///
+/// Assignment sets of fluent and derived atoms additionally count the atoms of each assignment.
+/// This allows to update them incrementally with the atoms that differ between successive states
+/// instead of rebuilding them from scratch.
+/// The counts are stored in 8 bits per assignment, and the rare counts that do not fit are kept in a sparse overflow table.
 template<PredicateCategory P>
 class AssignmentSet
 {
@@ -143,13 +153,38 @@ private:
     // The underlying function
     std::vector<std::vector<bool>> m_f;
 
+    // The number of atoms per assignment, only used for non-static atoms.
+    // A saturated count is continued in the overflow counts.
+    std::vector<std::vector<uint8_t>> m_counts;
+    std::vector<std::unordered_map<size_t, Index>> m_overflow_counts;
+    // The atoms in the assignment set, only used for non-static atoms.
+    FlatBitset m_atoms;
+
+    /* Preallocated buffers */
+    FlatBitset m_atoms_buffer;
+
+    template<bool Insert>
+    void update_ground_atom(GroundAtom<P> ground_atom);
+
 public:
+    /// @brief Construct an empty assignment set.
+    AssignmentSet(Problem problem, const PredicateList<P>& predicates);
+
     /// @brief Construct from a given set of ground atoms.
     AssignmentSet(Problem problem, const PredicateList<P>& predicates, const GroundAtomList<P>& ground_atoms);
 
     /// @brief Insert ground atoms into the assignment set.
     void insert_ground_atom(GroundAtom<P> ground_atom);
 
+    /// @brief Erase a ground atom from the assignment set.
+    void erase_ground_atom(GroundAtom<P> ground_atom)
+        requires(!std::is_same_v<P, Static>);
+
+    /// @brief Update the assignment set such that it contains exactly the given atoms.
+    /// Only the atoms that are inserted or erased compared to the previous update are processed.
+    void update_ground_atoms(const FlatBitset& atoms, const PDDLFactories& pddl_factories)
+        requires(!std::is_same_v<P, Static>);
+
     /// @brief Return true iff all literals are consistent with
     /// 1. the assignment set, and 2. the edge of the consistency graph.
     ///
@@ -168,7 +203,13 @@ public:
 };
 
 template<PredicateCategory P>
-AssignmentSet<P>::AssignmentSet(Problem problem, const PredicateList<P>& predicates, const GroundAtomList<P>& ground_atoms) : m_problem(problem)
+AssignmentSet<P>::AssignmentSet(Problem problem, const PredicateList<P>& predicates) :
+    m_problem(problem),
+    m_f(),
+    m_counts(),
+    m_overflow_counts(),
+    m_atoms(),
+    m_atoms_buffer()
 {
     const auto num_objects = problem->get_objects().size();
 
@@ -178,38 +219,37 @@ AssignmentSet<P>::AssignmentSet(Problem problem, const PredicateList<P>& predica
         max_predicate_index = std::max(max_predicate_index, predicate->get_index());
     }
     m_f.resize(max_predicate_index + 1);
+    if constexpr (!std::is_same_v<P, Static>)
+    {
+        m_counts.resize(max_predicate_index + 1);
+        m_overflow_counts.resize(max_predicate_index + 1);
+    }
 
     for (const auto& predicate : predicates)
     {
         auto& assignment_set = m_f.at(predicate->get_index());
         assignment_set.resize(num_assignments(predicate->get_arity(), num_objects));
+
+        if constexpr (!std::is_same_v<P, Static>)
+        {
+            m_counts.at(predicate->get_index()).resize(assignment_set.size(), 0);
+        }
     }
+}
 
+template<PredicateCategory P>
+AssignmentSet<P>::AssignmentSet(Problem problem, const PredicateList<P>& predicates, const GroundAtomList<P>& ground_atoms) :
+    AssignmentSet(problem, predicates)
+{
     for (const auto& ground_atom : ground_atoms)
     {
-        const auto& arity = ground_atom->get_arity();
-        const auto& predicate = ground_atom->get_predicate();
-        const auto& arguments = ground_atom->get_objects();
-        auto& assignment_set = m_f.at(predicate->get_index());
-
-        for (size_t first_index = 0; first_index < arity; ++first_index)
-        {
-            const auto& first_object = arguments[first_index];
-            assignment_set[get_assignment_rank(Assignment(first_index, first_object->get_index()), arity, num_objects)] = true;
-
-            for (size_t second_index = first_index + 1; second_index < arity; ++second_index)
-            {
-                const auto& second_object = arguments[second_index];
-                assignment_set[get_assignment_rank(Assignment(first_index, first_object->get_index(), second_index, second_object->get_index()),
-                                                   arity,
-                                                   num_objects)] = true;
-            }
-        }
+        insert_ground_atom(ground_atom);
     }
 }
 
 template<PredicateCategory P>
-void AssignmentSet<P>::insert_ground_atom(GroundAtom<P> ground_atom)
+template<bool Insert>
+void AssignmentSet<P>::update_ground_atom(GroundAtom<P> ground_atom)
 {
     const auto num_objects = m_problem->get_objects().size();
 
@@ -218,21 +258,111 @@ void AssignmentSet<P>::insert_ground_atom(GroundAtom<P> ground_atom)
     const auto& arguments = ground_atom->get_objects();
     auto& assignment_set = m_f.at(predicate->get_index());
 
+    const auto update_rank = [&](size_t rank)
+    {
+        if constexpr (std::is_same_v<P, Static>)
+        {
+            assignment_set[rank] = true;
+        }
+        else
+        {
+            constexpr auto MAX_COUNT = std::numeric_limits<uint8_t>::max();
+
+            auto& count = m_counts[predicate->get_index()][rank];
+            if constexpr (Insert)
+            {
+                if (count < MAX_COUNT)
+                {
+                    ++count;
+                }
+                else
+                {
+                    ++m_overflow_counts[predicate->get_index()][rank];
+                }
+            }
+            else
+            {
+                assert(count > 0);
+                auto& overflow_counts = m_overflow_counts[predicate->get_index()];
+                const auto it = (count == MAX_COUNT) ? overflow_counts.find(rank) : overflow_counts.end();
+                if (it != overflow_counts.end())
+                {
+                    if (--it->second == 0)
+                    {
+                        overflow_counts.erase(it);
+                    }
+                }
+                else
+                {
+                    --count;
+                }
+            }
+            assignment_set[rank] = (count > 0);
+        }
+    };
+
     for (size_t first_index = 0; first_index < arity; ++first_index)
     {
         const auto& first_object = arguments[first_index];
-        assignment_set[get_assignment_rank(Assignment(first_index, first_object->get_index()), arity, num_objects)] = true;
+        update_rank(get_assignment_rank(Assignment(first_index, first_object->get_index()), arity, num_objects));
 
         for (size_t second_index = first_index + 1; second_index < arity; ++second_index)
         {
             const auto& second_object = arguments[second_index];
-            assignment_set[get_assignment_rank(Assignment(first_index, first_object->get_index(), second_index, second_object->get_index()),
-                                               arity,
-                                               num_objects)] = true;
+            update_rank(get_assignment_rank(Assignment(first_index, first_object->get_index(), second_index, second_object->get_index()),
+                                            arity,
+                                            num_objects));
         }
     }
 }
 
+template<PredicateCategory P>
+void AssignmentSet<P>::insert_ground_atom(GroundAtom<P> ground_atom)
+{
+    if constexpr (!std::is_same_v<P, Static>)
+    {
+        if (m_atoms.get(ground_atom->get_index()))
+        {
+            return;
+        }
+        m_atoms.set(ground_atom->get_index());
+    }
+
+    update_ground_atom<true>(ground_atom);
+}
+
+template<PredicateCategory P>
+void AssignmentSet<P>::erase_ground_atom(GroundAtom<P> ground_atom)
+    requires(!std::is_same_v<P, Static>)
+{
+    if (!m_atoms.get(ground_atom->get_index()))
+    {
+        return;
+    }
+    m_atoms.unset(ground_atom->get_index());
+
+    update_ground_atom<false>(ground_atom);
+}
+
+template<PredicateCategory P>
+void AssignmentSet<P>::update_ground_atoms(const FlatBitset& atoms, const PDDLFactories& pddl_factories)
+    requires(!std::is_same_v<P, Static>)
+{
+    m_atoms_buffer = m_atoms;
+    m_atoms_buffer -= atoms;
+    for (const auto atom_index : m_atoms_buffer)
+    {
+        erase_ground_atom(pddl_factories.get_ground_atom<P>(atom_index));
+    }
+
+    m_atoms_buffer = atoms;
+    m_atoms_buffer -= m_atoms;
+    for (const auto atom_index : m_atoms_buffer)
+    {
+        insert_ground_atom(pddl_factories.get_ground_atom<P>(atom_index));
+    }
+}
+
 template<PredicateCategory P, typename AssignmentIterator>
 bool consistent_literals_helper(const Problem& problem,
                                 const std::vector<std::vector<bool>>& assignment_sets,
@@ -18,6 +18,7 @@
 #ifndef MIMIR_SEARCH_APPLICABLE_ACTION_GENERATORS_LIFTED_AXIOM_EVALUATOR_HPP_
 #define MIMIR_SEARCH_APPLICABLE_ACTION_GENERATORS_LIFTED_AXIOM_EVALUATOR_HPP_
 
+#include "mimir/common/concepts.hpp"
 #include "mimir/common/printers.hpp"
 #include "mimir/common/types_cista.hpp"
 #include "mimir/formalism/declarations.hpp"
@@ -27,11 +28,14 @@
 #include "mimir/search/applicable_action_generators/lifted/axiom_stratification.hpp"
 #include "mimir/search/applicable_action_generators/lifted/consistency_graph.hpp"
 #include "mimir/search/applicable_action_generators/lifted/event_handlers.hpp"
+#include "mimir/search/applicable_action_generators/lifted/ground_atom_index_table.hpp"
 #include "mimir/search/axiom.hpp"
 #include "mimir/search/condition_grounders.hpp"
 #include "mimir/search/state.hpp"
 
+#include <memory>
 #include <stdexcept>
+#include <type_traits>
 #include <unordered_map>
 #include <vector>
 
@@ -60,6 +64,23 @@ public:
     {
         return m_ref_derived_state_atoms.get(derived_literal->get_atom()->get_index()) != derived_literal->is_negated();
     }
+
+    template<DynamicPredicateCategory P>
+    const FlatBitset& get_atoms() const
+    {
+        if constexpr (std::is_same_v<P, Fluent>)
+        {
+            return m_fluent_state_atoms;
+        }
+        else if constexpr (std::is_same_v<P, Derived>)
+        {
+            return m_ref_derived_state_atoms;
+        }
+        else
+        {
+            static_assert(dependent_false<P>::value, "Missing implementation for DynamicPredicateCategory.");
+        }
+    }
 };
 
 class AxiomEvaluator
@@ -76,8 +97,17 @@ private:
     GroundAxiomBuilder m_axiom_builder;
     std::unordered_map<Axiom, GroundingTable<GroundAxiom>> m_axiom_groundings;
 
+    std::shared_ptr<GroundAtomIndexTables> m_ground_atom_index_tables;
     std::unordered_map<Axiom, ConditionGrounder<PartiallyExtendedState>> m_condition_grounders;
 
+    /* Assignment sets of the last evaluation that are updated incrementally */
+    AssignmentSet<Fluent> m_fluent_assignment_set;
+    AssignmentSet<Derived> m_derived_assignment_set;
+
+    /* Preallocated buffers */
+    GroundAxiomList m_applicable_axioms;
+    GroundAtomList<Derived> m_new_ground_atoms;
+
 public:
     /// @brief Simplest construction, expects the event handler from the lifted aag.
     AxiomEvaluator(Problem problem, std::shared_ptr<PDDLFactories> pddl_factories, std::shared_ptr<ILiftedApplicableActionGeneratorEventHandler> event_handler);
@@ -95,8 +125,14 @@ public:
     /// @brief Return the axiom partitioning.
     const std::vector<AxiomPartition>& get_axiom_partitioning() const;
 
+    /// @brief Return the assignment sets of the last evaluation.
+    /// They are shared with the lifted applicable action generator, which updates them to its state,
+    /// such that consecutive evaluations and action generations for the same state do not update them twice.
+    AssignmentSet<Fluent>& get_fluent_assignment_set();
+    AssignmentSet<Derived>& get_derived_assignment_set();
+
     /// @brief Ground an axiom and return a view onto it.
-    GroundAxiom ground_axiom(Axiom axiom, ObjectList&& binding);
+    GroundAxiom ground_axiom(Axiom axiom, const ObjectList& binding);
 
     /// @brief Return all axioms.
     const GroundAxiomList& get_ground_axioms() const;
@@ -36,11 +36,10 @@ private:
 public:
     explicit AxiomPartition(AxiomSet axioms, const PredicateSet<Derived>& derived_predicates, const PredicateSet<Derived>& affected_derived_predicates);
 
-    /// @brief Retrieve all axioms that have an atom with the same predicate in the body.
-    void retrieve_axioms_with_same_body_predicate(GroundAtom<Derived> derived_atom, AxiomSet& ref_axioms) const;
-
     const AxiomSet& get_axioms() const;
     const AxiomSet& get_initially_relevant_axioms() const;
+    /// @brief Return all axioms that have an atom with the given predicate in the body.
+    const AxiomSet& get_axioms_with_body_predicate(Predicate<Derived> predicate) const;
 };
 
 /// @brief Compute axiom partitioning using stratification.
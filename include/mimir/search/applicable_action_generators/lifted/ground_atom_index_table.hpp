@@ -0,0 +1,278 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIMIR_SEARCH_APPLICABLE_ACTION_GENERATORS_LIFTED_GROUND_ATOM_INDEX_TABLE_HPP_
+#define MIMIR_SEARCH_APPLICABLE_ACTION_GENERATORS_LIFTED_GROUND_ATOM_INDEX_TABLE_HPP_
+
+#include "mimir/common/types.hpp"
+#include "mimir/formalism/atom.hpp"
+#include "mimir/formalism/factories.hpp"
+#include "mimir/formalism/literal.hpp"
+#include "mimir/formalism/object.hpp"
+#include "mimir/formalism/predicate.hpp"
+#include "mimir/formalism/predicate_category.hpp"
+#include "mimir/formalism/problem.hpp"
+#include "mimir/formalism/term.hpp"
+#include "mimir/formalism/variable.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace mimir
+{
+
+/// @brief `GroundAtomIndexTable` maps the objects of ground atoms to their indices using arithmetic only.
+///
+/// The ground atoms of a predicate with arity k over n objects are addressed by the mixed radix number
+/// o_1 + o_2 * n + ... + o_k * n^(k-1) of their object indices.
+/// Entries are stored in pages that are reached through a two-level directory.
+/// The pages and the second-level directories are allocated on first write and the first level has at most
+/// `MAX_NUM_ENTRIES / (PAGE_SIZE * DIRECTORY_SIZE)` slots, hence,
+/// the memory is proportional to the ground atoms that were looked up and not to n^k.
+/// Predicates whose address space exceeds `MAX_NUM_ENTRIES` have no table.
+///
+/// Lookups are lock-free and may run concurrently with `set`, which must be serialized by the caller.
+template<PredicateCategory P>
+class GroundAtomIndexTable
+{
+public:
+    /// @brief Special value for ground atoms that were not looked up yet.
+    static constexpr Index NO_ATOM = std::numeric_limits<Index>::max();
+    static constexpr size_t PAGE_SIZE = 1024;
+    static constexpr size_t DIRECTORY_SIZE = 1024;
+    static constexpr size_t MAX_NUM_ENTRIES = size_t(1) << 32;
+
+private:
+    using Page = std::atomic<Index>;
+    using Directory = std::atomic<Page*>;
+
+    size_t m_num_objects;
+
+    /// @brief First level of the directory for each predicate index, empty if the predicate has no table.
+    std::vector<std::vector<std::atomic<Directory*>>> m_directories;
+    std::vector<bool> m_has_table;
+    std::vector<std::unique_ptr<Directory[]>> m_directory_storage;
+    std::vector<std::unique_ptr<Page[]>> m_page_storage;
+
+    template<typename T, typename Value>
+    static T* allocate(std::vector<std::unique_ptr<T[]>>& storage, size_t size, Value value)
+    {
+        storage.push_back(std::make_unique<T[]>(size));
+        auto* result = storage.back().get();
+        for (size_t i = 0; i < size; ++i)
+        {
+            result[i].store(value, std::memory_order_relaxed);
+        }
+        return result;
+    }
+
+public:
+    explicit GroundAtomIndexTable(size_t num_objects) :
+        m_num_objects(num_objects),
+        m_directories(),
+        m_has_table(),
+        m_directory_storage(),
+        m_page_storage()
+    {
+    }
+
+    /// @brief Allocate the first level of the directory of the predicate.
+    /// @return true iff the address space of the predicate does not exceed `MAX_NUM_ENTRIES`.
+    bool create_table(Predicate<P> predicate)
+    {
+        const auto predicate_index = predicate->get_index();
+        if (predicate_index >= m_directories.size())
+        {
+            m_directories.resize(predicate_index + 1);
+            m_has_table.resize(predicate_index + 1, false);
+        }
+
+        if (!m_has_table[predicate_index])
+        {
+            auto num_entries = size_t(1);
+            for (size_t i = 0; i < predicate->get_arity(); ++i)
+            {
+                num_entries *= std::max(m_num_objects, size_t(1));
+                if (num_entries > MAX_NUM_ENTRIES)
+                {
+                    return false;
+                }
+            }
+            const auto num_directories = (num_entries + PAGE_SIZE * DIRECTORY_SIZE - 1) / (PAGE_SIZE * DIRECTORY_SIZE);
+            m_directories[predicate_index] = std::vector<std::atomic<Directory*>>(num_directories);
+            m_has_table[predicate_index] = true;
+        }
+        return true;
+    }
+
+    /// @brief Return the index of the ground atom with the given address or `NO_ATOM` if it was not looked up yet.
+    Index get(Index predicate_index, size_t key) const
+    {
+        assert(m_has_table[predicate_index]);
+        const auto* directory = m_directories[predicate_index][key / (PAGE_SIZE * DIRECTORY_SIZE)].load(std::memory_order_acquire);
+        if (!directory)
+        {
+            return NO_ATOM;
+        }
+        const auto* page = directory[(key / PAGE_SIZE) % DIRECTORY_SIZE].load(std::memory_order_acquire);
+        return (page) ? page[key % PAGE_SIZE].load(std::memory_order_relaxed) : NO_ATOM;
+    }
+
+    void set(Index predicate_index, size_t key, Index atom_index)
+    {
+        assert(m_has_table[predicate_index]);
+        auto& directory_ptr = m_directories[predicate_index][key / (PAGE_SIZE * DIRECTORY_SIZE)];
+        auto* directory = directory_ptr.load(std::memory_order_relaxed);
+        if (!directory)
+        {
+            directory = allocate(m_directory_storage, DIRECTORY_SIZE, static_cast<Page*>(nullptr));
+            directory_ptr.store(directory, std::memory_order_release);
+        }
+        auto& page_ptr = directory[(key / PAGE_SIZE) % DIRECTORY_SIZE];
+        auto* page = page_ptr.load(std::memory_order_relaxed);
+        if (!page)
+        {
+            page = allocate(m_page_storage, PAGE_SIZE, NO_ATOM);
+            page_ptr.store(page, std::memory_order_release);
+        }
+        page[key % PAGE_SIZE].store(atom_index, std::memory_order_relaxed);
+    }
+
+    size_t get_num_objects() const { return m_num_objects; }
+};
+
+/// @brief `GroundAtomIndexTables` bundles the tables of all predicate categories.
+/// It is shared by the condition grounders of an applicable action generator.
+/// The mutex serializes all accesses of the grounders to the `PDDLFactories`.
+class GroundAtomIndexTables
+{
+private:
+    std::tuple<GroundAtomIndexTable<Static>, GroundAtomIndexTable<Fluent>, GroundAtomIndexTable<Derived>> m_tables;
+    std::mutex m_mutex;
+
+public:
+    explicit GroundAtomIndexTables(Problem problem) :
+        m_tables(GroundAtomIndexTable<Static>(problem->get_objects().size()),
+                 GroundAtomIndexTable<Fluent>(problem->get_objects().size()),
+                 GroundAtomIndexTable<Derived>(problem->get_objects().size())),
+        m_mutex()
+    {
+    }
+
+    template<PredicateCategory P>
+    GroundAtomIndexTable<P>& get()
+    {
+        return std::get<GroundAtomIndexTable<P>>(m_tables);
+    }
+
+    std::mutex& get_mutex() { return m_mutex; }
+};
+
+/// @brief `CompiledLiteral` computes the index of the ground atom of a lifted literal under a binding.
+///
+/// The address of the ground atom is an affine function of the object indices in the binding.
+/// Only ground atoms that are not in the table yet are grounded through the `PDDLFactories`,
+/// literals whose predicate has no table are always grounded through the `PDDLFactories`.
+template<PredicateCategory P>
+class CompiledLiteral
+{
+private:
+    Literal<P> m_literal;
+    Index m_predicate_index;
+    bool m_has_table;
+
+    size_t m_constant_offset;                                ///< Address contribution of the constants in the atom
+    std::vector<std::pair<size_t, size_t>> m_parameter_strides;  ///< Pairs of parameter index and stride
+
+public:
+    CompiledLiteral(Literal<P> literal, GroundAtomIndexTable<P>& table) :
+        m_literal(literal),
+        m_predicate_index(literal->get_atom()->get_predicate()->get_index()),
+        m_has_table(table.create_table(literal->get_atom()->get_predicate())),
+        m_constant_offset(0),
+        m_parameter_strides()
+    {
+        auto stride = size_t(1);
+        for (const auto& term : literal->get_atom()->get_terms())
+        {
+            std::visit(
+                [&](const auto& arg)
+                {
+                    using T = std::decay_t<decltype(arg)>;
+                    if constexpr (std::is_same_v<T, TermObjectImpl>)
+                    {
+                        m_constant_offset += stride * arg.get_object()->get_index();
+                    }
+                    else if constexpr (std::is_same_v<T, TermVariableImpl>)
+                    {
+                        m_parameter_strides.emplace_back(arg.get_variable()->get_parameter_index(), stride);
+                    }
+                },
+                *term);
+            stride *= table.get_num_objects();
+        }
+    }
+
+    /// @brief Return the index of the ground atom of the literal under the binding.
+    /// Safe to call concurrently for the same tables.
+    Index ground_atom_index(const ObjectList& binding, GroundAtomIndexTables& tables, PDDLFactories& pddl_factories) const
+    {
+        if (!m_has_table)
+        {
+            std::lock_guard<std::mutex> lock(tables.get_mutex());
+            return pddl_factories.ground_literal(m_literal, binding)->get_atom()->get_index();
+        }
+
+        auto& table = tables.get<P>();
+
+        auto key = m_constant_offset;
+        for (const auto& [parameter_index, stride] : m_parameter_strides)
+        {
+            assert(binding[parameter_index]->get_index() < table.get_num_objects());
+            key += stride * binding[parameter_index]->get_index();
+        }
+
+        auto atom_index = table.get(m_predicate_index, key);
+        if (atom_index == GroundAtomIndexTable<P>::NO_ATOM)
+        {
+            std::lock_guard<std::mutex> lock(tables.get_mutex());
+            atom_index = pddl_factories.ground_literal(m_literal, binding)->get_atom()->get_index();
+            table.set(m_predicate_index, key, atom_index);
+        }
+        return atom_index;
+    }
+
+    bool is_negated() const { return m_literal->is_negated(); }
+
+    const Literal<P>& get_literal() const { return m_literal; }
+};
+
+template<PredicateCategory P>
+using CompiledLiteralList = std::vector<CompiledLiteral<P>>;
+
+}
+
+#endif
@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIMIR_SEARCH_CONCURRENT_STATE_REPOSITORY_HPP_
+#define MIMIR_SEARCH_CONCURRENT_STATE_REPOSITORY_HPP_
+
+#include "mimir/common/types_cista.hpp"
+#include "mimir/formalism/declarations.hpp"
+#include "mimir/search/action.hpp"
+#include "mimir/search/applicable_action_generators/interface.hpp"
+#include "mimir/search/declarations.hpp"
+#include "mimir/search/state.hpp"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace mimir
+{
+
+/**
+ * Implementation class
+ *
+ * `ConcurrentStateRepository` is a thread-safe variant of the `StateRepository`.
+ * The unique table is split into shards that are selected by the hash value of the fluent atoms,
+ * such that threads only contend when they insert states into the same shard.
+ * Each thread uses its own `StateBuilder`, and state indices are assigned with an atomic counter.
+ * Axioms are evaluated without holding a lock, which requires that the applicable action generator
+ * supports concurrent calls to `generate_and_apply_axioms`, e.g., the `GroundedApplicableActionGenerator`.
+ *
+ * States are never moved, hence, a returned `State` remains valid while other threads insert states.
+ */
+class ConcurrentStateRepository
+{
+private:
+    struct Shard
+    {
+        std::mutex mutex;
+        FlatStateSet states;
+        FlatBitset reached_fluent_atoms;
+        FlatBitset reached_derived_atoms;
+    };
+
+    std::shared_ptr<IApplicableActionGenerator> m_aag;
+    bool m_problem_or_domain_has_axioms;
+
+    std::vector<std::unique_ptr<Shard>> m_shards;
+    std::atomic<Index> m_next_state_index;
+
+    /// @brief Find or insert the state whose fluent atoms are stored in the state builder of the calling thread.
+    State get_or_create_state_from_builder(StateBuilder& state_builder);
+
+public:
+    explicit ConcurrentStateRepository(std::shared_ptr<IApplicableActionGenerator> aag, size_t num_shards = 64);
+
+    ConcurrentStateRepository(const ConcurrentStateRepository& other) = delete;
+    ConcurrentStateRepository& operator=(const ConcurrentStateRepository& other) = delete;
+    ConcurrentStateRepository(ConcurrentStateRepository&& other) = delete;
+    ConcurrentStateRepository& operator=(ConcurrentStateRepository&& other) = delete;
+
+    State get_or_create_initial_state();
+
+    State get_or_create_state(const GroundAtomList<Fluent>& atoms);
+
+    State get_or_create_state(const FlatBitset& fluent_atoms);
+
+    State get_or_create_successor_state(State state, GroundAction action);
+
+    size_t get_state_count() const;
+
+    /// @brief Return the union of the fluent atoms of all states.
+    /// Unlike the `StateRepository`, the result is computed on demand from the shards.
+    FlatBitset get_reached_fluent_ground_atoms() const;
+
+    /// @brief Return the union of the derived atoms of all states.
+    FlatBitset get_reached_derived_ground_atoms() const;
+
+    size_t get_num_shards() const;
+
+    std::shared_ptr<IApplicableActionGenerator> get_aag() const;
+};
+
+}
+
+#endif
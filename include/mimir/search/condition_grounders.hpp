@@ -19,23 +19,31 @@
 #define MIMIR_SEARCH_CONDITION_GROUNDERS_HPP_
 
 #include "mimir/algorithms/kpkc.hpp"
+#include "mimir/common/types_cista.hpp"
 #include "mimir/formalism/factories.hpp"
+#include "mimir/formalism/ground_atom.hpp"
 #include "mimir/formalism/literal.hpp"
 #include "mimir/formalism/object.hpp"
 #include "mimir/formalism/predicate_category.hpp"
 #include "mimir/formalism/problem.hpp"
+#include "mimir/formalism/term.hpp"
 #include "mimir/formalism/variable.hpp"
 #include "mimir/search/applicable_action_generators/lifted/assignment_set.hpp"
 #include "mimir/search/applicable_action_generators/lifted/consistency_graph.hpp"
+#include "mimir/search/applicable_action_generators/lifted/ground_atom_index_table.hpp"
 #include "mimir/search/condition_grounders/event_handlers/default.hpp"
 #include "mimir/search/condition_grounders/event_handlers/interface.hpp"
 
-#include <boost/dynamic_bitset/dynamic_bitset.hpp>
+#include <algorithm>
+#include <cassert>
+#include <concepts>
 #include <memory>
 #include <ostream>
 #include <stdexcept>
 #include <tuple>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace mimir
 {
@@ -51,8 +59,19 @@ concept HasLiteralHolds = requires(S state, GroundLiteral<Fluent> fluent_literal
         } -> std::convertible_to<bool>;
 };
 
+template<typename S>
+concept HasDynamicAtoms = requires(S state)
+{
+    {
+        state.template get_atoms<Fluent>()
+        } -> std::same_as<const FlatBitset&>;
+    {
+        state.template get_atoms<Derived>()
+        } -> std::same_as<const FlatBitset&>;
+};
+
 template<typename State>
-requires HasLiteralHolds<State>
+requires HasLiteralHolds<State> && HasDynamicAtoms<State>
 class ConditionGrounder
 {
 private:
@@ -65,16 +84,28 @@ private:
     std::shared_ptr<PDDLFactories> m_pddl_factories;
     std::shared_ptr<IConditionGrounderEventHandler> m_event_handler;
 
+    std::shared_ptr<GroundAtomIndexTables> m_ground_atom_index_tables;
+    CompiledLiteralList<Static> m_compiled_static_conditions;
+    CompiledLiteralList<Fluent> m_compiled_fluent_conditions;
+    CompiledLiteralList<Derived> m_compiled_derived_conditions;
+
     consistency_graph::StaticConsistencyGraph m_static_consistency_graph;
+    KPartiteGraph m_consistency_graph;
+    /// @brief The object of each vertex in the static consistency graph.
+    /// Resolved once during construction such that computing bindings does not access the `PDDLFactories`.
+    ObjectList m_objects_by_vertex_id;
 
-    template<DynamicPredicateCategory P>
-    bool is_valid_dynamic_binding(const LiteralList<P>& literals, const State state, const ObjectList& binding)
+    /* Preallocated buffers */
+    std::vector<std::size_t> m_cliques;  ///< Flat clique arena, each clique occupies |variables| consecutive entries
+    ObjectList m_binding;
+    ObjectList m_fixed_binding;  ///< Objects of the variables that are fixed by unification, nullptr for free variables
+
+    template<PredicateCategory P>
+    bool is_valid_binding(const CompiledLiteralList<P>& literals, const FlatBitset& atoms, const ObjectList& binding)
     {
         for (const auto& literal : literals)
         {
-            auto ground_literal = m_pddl_factories->ground_literal(literal, binding);
-
-            if (!state.literal_holds(ground_literal))
+            if (literal.is_negated() == atoms.get(literal.ground_atom_index(binding, *m_ground_atom_index_tables, *m_pddl_factories)))
             {
                 return false;
             }
@@ -83,36 +114,32 @@ private:
         return true;
     }
 
-    bool is_valid_static_binding(const Problem problem, const LiteralList<Static>& literals, const ObjectList& binding)
+    template<PredicateCategory P>
+    CompiledLiteralList<P> compile_literals(const LiteralList<P>& literals)
     {
+        auto compiled_literals = CompiledLiteralList<P> {};
         for (const auto& literal : literals)
         {
-            auto ground_literal = m_pddl_factories->ground_literal(literal, binding);
-
-            if (ground_literal->is_negated() == problem->get_static_initial_positive_atoms().get(ground_literal->get_atom()->get_index()))
-            {
-                return false;
-            }
+            compiled_literals.emplace_back(literal, m_ground_atom_index_tables->get<P>());
         }
-
-        return true;
+        return compiled_literals;
     }
 
     bool is_valid_binding(const Problem problem, const State state, const ObjectList& binding)
     {
-        return is_valid_static_binding(problem, m_static_conditions, binding)      // We need to test all
-               && is_valid_dynamic_binding(m_fluent_conditions, state, binding)    // types of conditions
-               && is_valid_dynamic_binding(m_derived_conditions, state, binding);  // due to over-approx.
+        return is_valid_binding(m_compiled_static_conditions, problem->get_static_initial_positive_atoms(), binding)  // We need to test all
+               && is_valid_binding(m_compiled_fluent_conditions, state.template get_atoms<Fluent>(), binding)         // types of conditions
+               && is_valid_binding(m_compiled_derived_conditions, state.template get_atoms<Derived>(), binding);      // due to over-approx.
     }
 
-    template<PredicateCategory P>
-    bool nullary_literals_hold(const LiteralList<P>& literals, const Problem problem, const State state, PDDLFactories& pddl_factories)
+    template<DynamicPredicateCategory P>
+    bool nullary_literals_hold(const CompiledLiteralList<P>& literals, const FlatBitset& atoms)
     {
         for (const auto& literal : literals)
         {
-            if (literal->get_atom()->get_predicate()->get_arity() == 0)
+            if (literal.get_literal()->get_atom()->get_predicate()->get_arity() == 0)
             {
-                if (!state.literal_holds(pddl_factories.ground_literal(literal, {})))
+                if (literal.is_negated() == atoms.get(literal.ground_atom_index(m_binding, *m_ground_atom_index_tables, *m_pddl_factories)))
                 {
                     return false;
                 }
@@ -125,53 +152,56 @@ private:
     /// @brief Returns true if all nullary literals in the precondition hold, false otherwise.
     bool nullary_conditions_hold(const Problem problem, const State state)
     {
-        return nullary_literals_hold(m_fluent_conditions, problem, state, *m_pddl_factories)
-               && nullary_literals_hold(m_derived_conditions, problem, state, *m_pddl_factories);
+        return nullary_literals_hold(m_compiled_fluent_conditions, state.template get_atoms<Fluent>())
+               && nullary_literals_hold(m_compiled_derived_conditions, state.template get_atoms<Derived>());
     }
 
-    void nullary_case(const State state, std::vector<ObjectList>& ref_bindings)
+    template<typename Callback>
+    void nullary_case(const State state, Callback& on_binding)
     {
         // There are no parameters, meaning that the preconditions are already fully ground. Simply check if the single ground action is applicable.
-        auto binding = ObjectList {};
-
-        if (is_valid_binding(m_problem, state, binding))
+        if (is_valid_binding(m_problem, state, m_binding))
         {
-            ref_bindings.emplace_back(std::move(binding));
+            on_binding(m_binding);
         }
         else
         {
-            m_event_handler->on_invalid_binding(binding, *m_pddl_factories);
+            m_event_handler->on_invalid_binding(m_binding, *m_pddl_factories);
         }
     }
 
+    template<typename VertexFilter, typename Callback>
     void unary_case(const AssignmentSet<Fluent>& fluent_assignment_sets,
                     const AssignmentSet<Derived>& derived_assignment_sets,
                     const State state,
-                    std::vector<ObjectList>& ref_bindings)
+                    const VertexFilter& is_allowed_vertex,
+                    Callback& on_binding)
     {
         for (const auto& vertex : m_static_consistency_graph.get_vertices())
         {
-            if (fluent_assignment_sets.consistent_literals(m_fluent_conditions, vertex)
+            if (is_allowed_vertex(vertex) && fluent_assignment_sets.consistent_literals(m_fluent_conditions, vertex)
                 && derived_assignment_sets.consistent_literals(m_derived_conditions, vertex))
             {
-                auto binding = ObjectList { m_pddl_factories->get_object(vertex.get_object_id()) };
+                m_binding[0] = m_objects_by_vertex_id[vertex.get_id()];
 
-                if (is_valid_binding(m_problem, state, binding))
+                if (is_valid_binding(m_problem, state, m_binding))
                 {
-                    ref_bindings.emplace_back(std::move(binding));
+                    on_binding(m_binding);
                 }
                 else
                 {
-                    m_event_handler->on_invalid_binding(binding, *m_pddl_factories);
+                    m_event_handler->on_invalid_binding(m_binding, *m_pddl_factories);
                 }
             }
         }
     }
 
+    template<typename VertexFilter, typename Callback>
     void general_case(const AssignmentSet<Fluent>& fluent_assignment_sets,
                       const AssignmentSet<Derived>& derived_assignment_sets,
                       const State state,
-                      std::vector<ObjectList>& ref_bindings)
+                      const VertexFilter& is_allowed_vertex,
+                      Callback& on_binding)
     {
         if (m_static_consistency_graph.get_edges().size() == 0)
         {
@@ -180,21 +210,17 @@ private:
 
         const auto& vertices = m_static_consistency_graph.get_vertices();
 
-        std::vector<boost::dynamic_bitset<>> full_consistency_graph(vertices.size(), boost::dynamic_bitset<>(vertices.size()));
+        m_consistency_graph.reset();
 
         // D: Restrict statically consistent assignments based on the assignments in the current state
         //    and build the consistency graph as an adjacency matrix
         for (const auto& edge : m_static_consistency_graph.get_edges())
         {
-            if (fluent_assignment_sets.consistent_literals(m_fluent_conditions, edge)
+            if (is_allowed_vertex(edge.get_src()) && is_allowed_vertex(edge.get_dst())
+                && fluent_assignment_sets.consistent_literals(m_fluent_conditions, edge)
                 && derived_assignment_sets.consistent_literals(m_derived_conditions, edge))
             {
-                const auto first_id = edge.get_src().get_id();
-                const auto second_id = edge.get_dst().get_id();
-                auto& first_row = full_consistency_graph[first_id];
-                auto& second_row = full_consistency_graph[second_id];
-                first_row[second_id] = 1;
-                second_row[first_id] = 1;
+                m_consistency_graph.add_edge(edge.get_src().get_id(), edge.get_dst().get_id());
             }
         }
 
@@ -202,29 +228,49 @@ private:
         // atoms in the state (compared to the number of possible atoms) lead to very sparse graphs, so the number of maximal cliques of maximum size (#
         // parameters) tends to be very small.
 
-        const auto& partitions = m_static_consistency_graph.get_vertices_by_parameter_index();
-        std::vector<std::vector<std::size_t>> cliques;
-        find_all_k_cliques_in_k_partite_graph(full_consistency_graph, partitions, cliques);
+        m_cliques.clear();
+        m_consistency_graph.find_all_k_cliques(m_cliques);
 
-        for (const auto& clique : cliques)
+        const auto num_parameters = m_variables.size();
+        for (std::size_t offset = 0; offset < m_cliques.size(); offset += num_parameters)
         {
-            auto binding = ObjectList(clique.size());
+            for (std::size_t index = 0; index < num_parameters; ++index)
+            {
+                const auto& vertex = vertices[m_cliques[offset + index]];
+                m_binding[vertex.get_parameter_index()] = m_objects_by_vertex_id[vertex.get_id()];
+            }
 
-            for (std::size_t index = 0; index < clique.size(); ++index)
+            if (is_valid_binding(m_problem, state, m_binding))
             {
-                const auto& vertex = vertices[clique[index]];
-                const auto param_index = vertex.get_parameter_index();
-                const auto object_id = vertex.get_object_id();
-                binding[param_index] = m_pddl_factories->get_object(object_id);
+                on_binding(m_binding);
             }
+            else
+            {
+                m_event_handler->on_invalid_binding(m_binding, *m_pddl_factories);
+            }
+        }
+    }
 
-            if (is_valid_binding(m_problem, state, binding))
+    template<typename VertexFilter, typename Callback>
+    void compute_bindings_helper(const State state,
+                                 const AssignmentSet<Fluent>& fluent_assignment_set,
+                                 const AssignmentSet<Derived>& derived_assignment_set,
+                                 const VertexFilter& is_allowed_vertex,
+                                 Callback& on_binding)
+    {
+        if (nullary_conditions_hold(m_problem, state))
+        {
+            if (m_variables.size() == 0)
+            {
+                nullary_case(state, on_binding);
+            }
+            else if (m_variables.size() == 1)
             {
-                ref_bindings.emplace_back(std::move(binding));
+                unary_case(fluent_assignment_set, derived_assignment_set, state, is_allowed_vertex, on_binding);
             }
             else
             {
-                m_event_handler->on_invalid_binding(binding, *m_pddl_factories);
+                general_case(fluent_assignment_set, derived_assignment_set, state, is_allowed_vertex, on_binding);
             }
         }
     }
@@ -236,7 +282,8 @@ public:
                       LiteralList<Fluent> fluent_conditions,
                       LiteralList<Derived> derived_conditions,
                       AssignmentSet<Static> static_assignment_set,
-                      std::shared_ptr<PDDLFactories> pddl_factories) :
+                      std::shared_ptr<PDDLFactories> pddl_factories,
+                      std::shared_ptr<GroundAtomIndexTables> ground_atom_index_tables) :
         ConditionGrounder(std::move(problem),
                           std::move(variables),
                           std::move(static_conditions),
@@ -244,6 +291,7 @@ public:
                           std::move(derived_conditions),
                           std::move(static_assignment_set),
                           std::move(pddl_factories),
+                          std::move(ground_atom_index_tables),
                           std::make_shared<DefaultConditionGrounderEventHandler>())
     {
     }
@@ -255,6 +303,7 @@ public:
                       LiteralList<Derived> derived_conditions,
                       AssignmentSet<Static> static_assignment_set,
                       std::shared_ptr<PDDLFactories> pddl_factories,
+                      std::shared_ptr<GroundAtomIndexTables> ground_atom_index_tables,
                       std::shared_ptr<IConditionGrounderEventHandler> event_handler) :
         m_problem(std::move(problem)),
         m_variables(std::move(variables)),
@@ -264,8 +313,23 @@ public:
         m_static_assignment_set(std::move(static_assignment_set)),
         m_pddl_factories(std::move(pddl_factories)),
         m_event_handler(std::move(event_handler)),
-        m_static_consistency_graph(m_problem, 0, m_variables.size(), m_static_conditions, m_static_assignment_set)
+        m_ground_atom_index_tables(std::move(ground_atom_index_tables)),
+        m_compiled_static_conditions(compile_literals(m_static_conditions)),
+        m_compiled_fluent_conditions(compile_literals(m_fluent_conditions)),
+        m_compiled_derived_conditions(compile_literals(m_derived_conditions)),
+        m_static_consistency_graph(m_problem, 0, m_variables.size(), m_static_conditions, m_static_assignment_set),
+        m_consistency_graph(m_static_consistency_graph.get_vertices_by_parameter_index()),
+        m_objects_by_vertex_id(),
+        m_cliques(),
+        m_binding(m_variables.size()),
+        m_fixed_binding(m_variables.size(), nullptr)
     {
+        for (const auto& vertex : m_static_consistency_graph.get_vertices())
+        {
+            assert(vertex.get_id() == m_objects_by_vertex_id.size());
+            m_objects_by_vertex_id.push_back(m_pddl_factories->get_object(vertex.get_object_id()));
+        }
+
         /* Error checking. */
 
         for (const auto& literal : problem->get_static_initial_literals())
@@ -285,28 +349,83 @@ public:
         }
     }
 
+    /// @brief Call `on_binding` with each binding of the variables that satisfies the conditions in the given state.
+    /// The binding passed to the callback is a reused buffer that is only valid during the call.
+    /// Different condition grounders that share the `GroundAtomIndexTables` can compute bindings concurrently.
+    template<typename Callback>
     void compute_bindings(const State state,
                           const AssignmentSet<Fluent>& fluent_assignment_set,
                           const AssignmentSet<Derived>& derived_assignment_set,
-                          std::vector<ObjectList>& out_bindings)
+                          Callback&& on_binding)
     {
-        out_bindings.clear();
+        compute_bindings_helper(
+            state,
+            fluent_assignment_set,
+            derived_assignment_set,
+            [](const consistency_graph::Vertex&) { return true; },
+            on_binding);
+    }
 
-        if (nullary_conditions_hold(m_problem, state))
+    /// @brief Call `on_binding` with each binding of the variables that satisfies the conditions in the given state
+    /// and that grounds the given condition literal to the given ground atom.
+    ///
+    /// This is the delta step of semi-naive evaluation: the bindings that use a newly reached ground atom
+    /// are found by unifying a literal with the atom first, which restricts the consistency graph of the remaining variables.
+    template<DynamicPredicateCategory P, typename Callback>
+    void compute_bindings(const State state,
+                          const AssignmentSet<Fluent>& fluent_assignment_set,
+                          const AssignmentSet<Derived>& derived_assignment_set,
+                          Literal<P> literal,
+                          GroundAtom<P> ground_atom,
+                          Callback&& on_binding)
+    {
+        /* Unify the terms of the literal with the objects of the ground atom */
+
+        std::fill(m_fixed_binding.begin(), m_fixed_binding.end(), nullptr);
+
+        const auto& terms = literal->get_atom()->get_terms();
+        const auto& objects = ground_atom->get_objects();
+        assert(terms.size() == objects.size());
+
+        for (size_t position = 0; position < terms.size(); ++position)
         {
-            if (m_variables.size() == 0)
-            {
-                nullary_case(state, out_bindings);
-            }
-            else if (m_variables.size() == 1)
-            {
-                unary_case(fluent_assignment_set, derived_assignment_set, state, out_bindings);
-            }
-            else
+            const auto is_unifiable = std::visit(
+                [this, object = objects[position]](const auto& arg)
+                {
+                    using T = std::decay_t<decltype(arg)>;
+                    if constexpr (std::is_same_v<T, TermObjectImpl>)
+                    {
+                        return arg.get_object() == object;
+                    }
+                    else if constexpr (std::is_same_v<T, TermVariableImpl>)
+                    {
+                        auto& fixed_object = m_fixed_binding[arg.get_variable()->get_parameter_index()];
+                        if (fixed_object && fixed_object != object)
+                        {
+                            return false;
+                        }
+                        fixed_object = object;
+                        return true;
+                    }
+                },
+                *terms[position]);
+
+            if (!is_unifiable)
             {
-                general_case(fluent_assignment_set, derived_assignment_set, state, out_bindings);
+                return;
             }
         }
+
+        compute_bindings_helper(
+            state,
+            fluent_assignment_set,
+            derived_assignment_set,
+            [this](const consistency_graph::Vertex& vertex)
+            {
+                const auto fixed_object = m_fixed_binding[vertex.get_parameter_index()];
+                return !fixed_object || fixed_object->get_index() == vertex.get_object_id();
+            },
+            on_binding);
     }
 
     friend std::ostream& operator<<(std::ostream& out, const ConditionGrounder<State>& condition_grounder)
@@ -29,6 +29,8 @@ class IConditionGrounderEventHandler
 public:
     virtual ~IConditionGrounderEventHandler() = default;
 
+    /// @brief Condition grounders that compute their bindings in parallel call their handlers from different threads,
+    /// hence, implementations must lock the mutex of the shared `GroundAtomIndexTables` before they access the `PDDLFactories`.
     virtual void on_invalid_binding(const ObjectList& binding, PDDLFactories& ref_pddl_factories) = 0;
 };
 
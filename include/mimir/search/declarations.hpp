@@ -30,6 +30,8 @@ namespace mimir
 
 // StateRepository
 class StateRepository;
+class PackedStateRepository;
+class DeltaStateRepository;
 
 // GroundACtion
 class GroundAction;
@@ -47,6 +49,8 @@ class LiftedApplicableActionGenerator;
 
 /* Heuristics */
 class IHeuristic;
+class HFFHeuristic;
+class RelaxedOperatorGraph;
 
 /* Algorithms */
 class IAlgorithm;
@@ -57,9 +61,18 @@ class IGoalStrategy;
 // AStar
 class IAStarAlgorithmEventHandler;
 
+// Best-first width search
+class IBFWSAlgorithmEventHandler;
+
 // Breadth-first search
 class IBrFSAlgorithmEventHandler;
 
+// Greedy best-first search
+class IGBFSAlgorithmEventHandler;
+
+// Hash distributed AStar
+class IHDAStarAlgorithmEventHandler;
+
 // Iterative width search
 class IIWAlgorithmEventHandler;
 
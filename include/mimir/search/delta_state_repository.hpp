@@ -0,0 +1,144 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIMIR_SEARCH_DELTA_STATE_REPOSITORY_HPP_
+#define MIMIR_SEARCH_DELTA_STATE_REPOSITORY_HPP_
+
+#include "mimir/common/types.hpp"
+#include "mimir/common/types_cista.hpp"
+#include "mimir/formalism/declarations.hpp"
+#include "mimir/search/action.hpp"
+#include "mimir/search/applicable_action_generators/interface.hpp"
+#include "mimir/search/declarations.hpp"
+#include "mimir/search/state.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace mimir
+{
+
+struct DeltaStateRepositoryOptions
+{
+    /// @brief Store a state with all its atoms if its chain of deltas to the last such state reaches this length.
+    size_t checkpoint_interval = 16;
+    /// @brief The number of decoded states that are kept in the LRU cache.
+    size_t cache_size = 1024;
+};
+
+/**
+ * Implementation class
+ *
+ * `DeltaStateRepository` stores each successor state as the index of its parent state together with
+ * the fluent atoms that the action adds or deletes. States are identified by a Zobrist hash,
+ * i.e., the XOR over random keys of their fluent atoms, which is updated with the delta in O(|effects|).
+ * Hash hits are verified by decoding the stored state, which walks the chain of deltas up to the
+ * last checkpoint or the last recently decoded state in the LRU cache.
+ * Derived atoms are not stored but recomputed when a state is unpacked.
+ */
+class DeltaStateRepository
+{
+private:
+    /// @brief Special value for the parent of states that store all their atoms.
+    static constexpr Index NO_STATE = std::numeric_limits<Index>::max();
+    /// @brief Special value for empty slots in the hash table.
+    static constexpr Index EMPTY_SLOT = std::numeric_limits<Index>::max();
+
+    std::shared_ptr<IApplicableActionGenerator> m_aag;
+    DeltaStateRepositoryOptions m_options;
+    bool m_problem_or_domain_has_axioms;
+
+    /* Stored states */
+    IndexList m_parents;
+    IndexList m_chain_lengths;
+    std::vector<uint64_t> m_hashes;
+    /// @brief Each delta entry encodes an atom index shifted left by one bit, the lowest bit is set for added atoms.
+    IndexList m_delta_offsets;
+    IndexList m_deltas;
+    /// @brief Open addressing hash table with linear probing that maps Zobrist hashes to state indices.
+    IndexList m_slots;
+
+    /* LRU cache of decoded fluent atoms */
+    std::list<Index> m_cache_order;
+    std::unordered_map<Index, std::pair<FlatBitset, std::list<Index>::iterator>> m_cache;
+
+    FlatBitset m_reached_fluent_atoms;
+
+    /* Preallocated buffers */
+    std::vector<std::pair<Index, bool>> m_effects_buffer;
+    FlatBitset m_touched_buffer;
+    IndexList m_delta_buffer;
+    IndexList m_chain_buffer;
+    FlatBitset m_successor_buffer;
+    FlatBitset m_candidate_buffer;
+
+    void resize_slots(size_t num_slots);
+
+    /// @brief Return the state with the given hash whose fluent atoms are returned by `materialize` or `NO_STATE`, and its slot.
+    template<typename MaterializeFunction>
+    std::pair<Index, size_t> find_state(uint64_t hash, MaterializeFunction&& materialize);
+
+    Index create_state(size_t slot, uint64_t hash, Index parent, const IndexList& delta);
+
+    void decode(Index state_index, FlatBitset& out_fluent_atoms);
+
+public:
+    explicit DeltaStateRepository(std::shared_ptr<IApplicableActionGenerator> aag, DeltaStateRepositoryOptions options = DeltaStateRepositoryOptions());
+
+    DeltaStateRepository(const DeltaStateRepository& other) = delete;
+    DeltaStateRepository& operator=(const DeltaStateRepository& other) = delete;
+    DeltaStateRepository(DeltaStateRepository&& other) = delete;
+    DeltaStateRepository& operator=(DeltaStateRepository&& other) = delete;
+
+    /// @brief Return the index of the initial state.
+    Index get_or_create_initial_state();
+
+    /// @brief Return the index of the state with the given fluent atoms.
+    Index get_or_create_state(const FlatBitset& fluent_atoms);
+
+    /// @brief Return the index of the successor state that results from applying the action in the state.
+    /// The state must have been unpacked from this repository.
+    Index get_or_create_successor_state(State state, GroundAction action);
+
+    /// @brief Decode the state with the given index and evaluate its axioms.
+    /// @return a view on the state that remains valid until `out_state_builder` is modified.
+    State unpack_state(Index state_index, StateBuilder& out_state_builder);
+
+    /// @brief Return the Zobrist hash of the fluent atoms of the state with the given index.
+    uint64_t get_hash(Index state_index) const;
+
+    /// @brief Return the Zobrist key of the fluent atom with the given index.
+    static uint64_t get_zobrist_key(Index atom_index);
+
+    size_t get_state_count() const;
+
+    /// @brief Return the total number of delta entries, including the atoms of checkpoint states.
+    size_t get_num_delta_entries() const;
+
+    const FlatBitset& get_reached_fluent_ground_atoms() const;
+
+    std::shared_ptr<IApplicableActionGenerator> get_aag() const;
+};
+
+}
+
+#endif
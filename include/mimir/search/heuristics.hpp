@@ -19,6 +19,19 @@
 #define MIMIR_SEARCH_HEURISTICS_HPP_
 
 #include "mimir/search/heuristics/blind.hpp"
+#include "mimir/search/heuristics/canonical_pdb.hpp"
+#include "mimir/search/heuristics/hadd.hpp"
+#include "mimir/search/heuristics/hff.hpp"
+#include "mimir/search/heuristics/hmax.hpp"
 #include "mimir/search/heuristics/hstar.hpp"
+#include "mimir/search/heuristics/lifted_hadd.hpp"
+#include "mimir/search/heuristics/lifted_hff.hpp"
+#include "mimir/search/heuristics/lifted_relaxed_exploration.hpp"
+#include "mimir/search/heuristics/lmcut.hpp"
+#include "mimir/search/heuristics/pdb.hpp"
+#include "mimir/search/heuristics/pdb/pattern_database.hpp"
+#include "mimir/search/heuristics/pdb/pattern_selection.hpp"
+#include "mimir/search/heuristics/relaxed_exploration.hpp"
+#include "mimir/search/heuristics/relaxed_operator_graph.hpp"
 
 #endif
@@ -0,0 +1,60 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIMIR_SEARCH_HEURISTICS_CANONICAL_PDB_HPP_
+#define MIMIR_SEARCH_HEURISTICS_CANONICAL_PDB_HPP_
+
+#include "mimir/search/heuristics/interface.hpp"
+#include "mimir/search/heuristics/pdb/pattern_database.hpp"
+
+#include <optional>
+
+namespace mimir
+{
+
+/// @brief `CanonicalPDBHeuristic` returns the canonical heuristic of a collection of pattern databases,
+/// i.e., the maximum over all maximal additive subsets of the sum of their abstract goal distances.
+/// Two patterns are additive if no ground action changes atoms of both patterns.
+class CanonicalPDBHeuristic : public IHeuristic
+{
+private:
+    PatternDatabaseList m_pattern_databases;
+    /// @brief The maximal additive subsets of the pattern databases.
+    std::vector<IndexList> m_additive_subsets;
+
+    /* Preallocated buffers */
+    ContinuousCostList m_distances;
+
+public:
+    /// @brief Use the patterns of the `GreedyPatternSelector` with its default parameters.
+    explicit CanonicalPDBHeuristic(std::shared_ptr<GroundedApplicableActionGenerator> applicable_action_generator);
+
+    /// @brief Compute the pattern databases of the given patterns.
+    /// If a cache directory is given, then the pattern databases are memory mapped from there and new ones are stored there.
+    CanonicalPDBHeuristic(std::shared_ptr<GroundedApplicableActionGenerator> applicable_action_generator,
+                          PatternList patterns,
+                          std::optional<fs::path> cache_directory = std::nullopt);
+
+    double compute_heuristic(State state) override;
+
+    const PatternDatabaseList& get_pattern_databases() const;
+    const std::vector<IndexList>& get_additive_subsets() const;
+};
+
+}
+
+#endif
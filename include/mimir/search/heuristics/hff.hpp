@@ -0,0 +1,48 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIMIR_SEARCH_HEURISTICS_HFF_HPP_
+#define MIMIR_SEARCH_HEURISTICS_HFF_HPP_
+
+#include "mimir/search/heuristics/relaxed_exploration.hpp"
+
+namespace mimir
+{
+
+/// @brief `HFFHeuristic` returns the cost of a relaxed plan that is extracted
+/// from the best supporters found during the h_add exploration.
+class HFFHeuristic : public RelaxedExplorationHeuristic
+{
+private:
+    std::vector<bool> m_is_in_relaxed_plan;
+
+public:
+    explicit HFFHeuristic(std::shared_ptr<GroundedApplicableActionGenerator> applicable_action_generator);
+    explicit HFFHeuristic(std::shared_ptr<RelaxedOperatorGraph> graph);
+
+    double compute_heuristic(State state) override;
+
+    /// @brief Return true iff the action is in the relaxed plan of the last call to `compute_heuristic`.
+    bool is_preferred_action(GroundAction action) const override;
+
+    /// @brief Return the indices of the ground actions in the relaxed plan of the last call to `compute_heuristic`.
+    const IndexList& get_relaxed_plan() const;
+};
+
+}
+
+#endif
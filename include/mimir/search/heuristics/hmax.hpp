@@ -0,0 +1,38 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIMIR_SEARCH_HEURISTICS_HMAX_HPP_
+#define MIMIR_SEARCH_HEURISTICS_HMAX_HPP_
+
+#include "mimir/search/heuristics/relaxed_exploration.hpp"
+
+namespace mimir
+{
+
+/// @brief `HMaxHeuristic` returns the maximum of the relaxed costs of the goal atoms.
+class HMaxHeuristic : public RelaxedExplorationHeuristic
+{
+public:
+    explicit HMaxHeuristic(std::shared_ptr<GroundedApplicableActionGenerator> applicable_action_generator);
+    explicit HMaxHeuristic(std::shared_ptr<RelaxedOperatorGraph> graph);
+
+    double compute_heuristic(State state) override;
+};
+
+}
+
+#endif
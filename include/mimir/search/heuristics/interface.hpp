@@ -18,6 +18,7 @@
 #ifndef MIMIR_SEARCH_HEURISTICS_INTERFACE_HPP_
 #define MIMIR_SEARCH_HEURISTICS_INTERFACE_HPP_
 
+#include "mimir/search/action.hpp"
 #include "mimir/search/state.hpp"
 
 namespace mimir
@@ -33,6 +34,10 @@ public:
     virtual ~IHeuristic() = default;
 
     virtual double compute_heuristic(State state) = 0;
+
+    /// @brief Return true iff the action is preferred in the state of the last call to `compute_heuristic`.
+    /// Heuristics that do not compute preferred actions prefer no action.
+    virtual bool is_preferred_action(GroundAction action) const { return false; }
 };
 
 }
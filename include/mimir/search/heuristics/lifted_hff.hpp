@@ -0,0 +1,40 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIMIR_SEARCH_HEURISTICS_LIFTED_HFF_HPP_
+#define MIMIR_SEARCH_HEURISTICS_LIFTED_HFF_HPP_
+
+#include "mimir/search/heuristics/lifted_relaxed_exploration.hpp"
+
+namespace mimir
+{
+
+/// @brief `LiftedHFFHeuristic` returns the cost of a relaxed plan without grounding the task upfront.
+class LiftedHFFHeuristic : public LiftedRelaxedExplorationHeuristic
+{
+public:
+    explicit LiftedHFFHeuristic(std::shared_ptr<LiftedApplicableActionGenerator> applicable_action_generator);
+
+    double compute_heuristic(State state) override;
+
+    /// @brief Return the indices of the relaxed ground actions in the relaxed plan of the last call to `compute_heuristic`.
+    const IndexList& get_relaxed_plan() const;
+};
+
+}
+
+#endif
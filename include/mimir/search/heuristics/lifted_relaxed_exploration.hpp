@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIMIR_SEARCH_HEURISTICS_LIFTED_RELAXED_EXPLORATION_HPP_
+#define MIMIR_SEARCH_HEURISTICS_LIFTED_RELAXED_EXPLORATION_HPP_
+
+#include "mimir/formalism/declarations.hpp"
+#include "mimir/search/action.hpp"
+#include "mimir/search/heuristics/relaxed_exploration.hpp"
+#include "mimir/search/state.hpp"
+
+#include <memory>
+
+namespace mimir
+{
+
+/// @brief `LiftedRelaxedExplorationHeuristic` is the common base of delete relaxation heuristics
+/// that do not require grounding the task upfront.
+///
+/// The delete relaxed task is explored with a `LiftedApplicableActionGenerator`.
+/// The relaxed ground actions and ground axioms found on the way are added to a `RelaxedOperatorGraph`
+/// that grows over the course of the search, such that the graph only contains groundings that were
+/// relaxed reachable from some evaluated state. In each call, the exploration alternates between
+/// the generalized Dijkstra exploration on the graph and the lifted generation of applicable actions
+/// in the set of reached atoms until no new grounding is found.
+class LiftedRelaxedExplorationHeuristic : public RelaxedExplorationHeuristic
+{
+protected:
+    std::shared_ptr<LiftedApplicableActionGenerator> m_delete_free_applicable_action_generator;
+
+    size_t m_num_known_actions;
+    size_t m_num_known_axioms;
+
+    /* Preallocated buffers */
+    StateBuilder m_reached_atoms_builder;
+    GroundActionList m_applicable_actions;
+
+    /// @brief Add the ground actions and ground axioms that were newly grounded in the delete free task to the graph.
+    /// @return true iff the graph changed.
+    bool update_relaxed_operator_graph();
+
+    /// @brief Run the relaxed exploration from the given state until no new grounding is found.
+    /// @return the cost of the goal propositions combined as specified or infinity if some goal proposition is unreachable.
+    ContinuousCost explore_lifted(State state, RelaxedCostCombination combination);
+
+public:
+    /// @brief Create the delete free task of the problem of the given applicable action generator.
+    explicit LiftedRelaxedExplorationHeuristic(std::shared_ptr<LiftedApplicableActionGenerator> applicable_action_generator);
+};
+
+}
+
+#endif
@@ -0,0 +1,120 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIMIR_SEARCH_HEURISTICS_LMCUT_HPP_
+#define MIMIR_SEARCH_HEURISTICS_LMCUT_HPP_
+
+#include "mimir/search/heuristics/interface.hpp"
+#include "mimir/search/heuristics/lmcut/event_handlers.hpp"
+#include "mimir/search/heuristics/relaxed_operator_graph.hpp"
+
+#include <memory>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace mimir
+{
+
+/// @brief `LMCutHeuristic` implements the landmark-cut heuristic by Helmert and Domshlak (ICAPS2009).
+/// Source: https://ai.dmi.unibas.ch/papers/helmert-domshlak-icaps2009.pdf
+///
+/// The relaxed task is extended by an artificial initial proposition that is the precondition of operators without preconditions,
+/// and by an artificial goal operator that achieves an artificial goal proposition.
+/// After each cut, the h_max values are updated incrementally instead of recomputing them from scratch,
+/// and the goal zone is tracked with round stamps such that no per-round reinitialization is needed.
+/// All buffers are allocated once and reused across calls.
+///
+/// Operators that stem from conditional effects of the same ground action are assigned cost 0,
+/// except for the first one, which keeps the heuristic admissible.
+class LMCutHeuristic : public IHeuristic
+{
+private:
+    std::shared_ptr<RelaxedOperatorGraph> m_graph;
+    std::shared_ptr<ILMCutHeuristicEventHandler> m_event_handler;
+
+    /* Relaxed task with artificial propositions and goal operator */
+    Index m_init_proposition;
+    Index m_goal_proposition;
+    Index m_goal_operator;
+    size_t m_num_propositions;
+    size_t m_num_operators;
+
+    IndexList m_precondition_offsets;
+    IndexList m_preconditions;
+    IndexList m_effect_offsets;
+    IndexList m_effects;
+    ContinuousCostList m_costs;
+    IndexList m_precondition_of_offsets;
+    IndexList m_precondition_of;
+    IndexList m_achiever_offsets;
+    IndexList m_achievers;
+
+    /* Preallocated buffers */
+    ContinuousCostList m_proposition_costs;
+    ContinuousCostList m_operator_costs;
+    IndexList m_operator_supporters;
+    ContinuousCostList m_operator_supporter_costs;
+    IndexList m_operator_num_unsatisfied;
+    IndexList m_goal_zone_rounds;
+    IndexList m_before_goal_zone_rounds;
+    Index m_round;
+    std::vector<std::pair<ContinuousCost, Index>> m_queue;
+    IndexList m_stack;
+    IndexList m_cut;
+
+    std::span<const Index> get_preconditions(Index op) const;
+    std::span<const Index> get_effects(Index op) const;
+    std::span<const Index> get_precondition_of(Index proposition) const;
+    std::span<const Index> get_achievers(Index proposition) const;
+
+    void enqueue(Index proposition, ContinuousCost cost);
+
+    /// @brief Compute the h_max values and supporters from scratch.
+    void first_exploration(State state);
+
+    /// @brief Update the h_max values and supporters after reducing the costs of the operators in the cut.
+    void first_exploration_incremental();
+
+    /// @brief Set the supporter of the operator to a precondition with maximum h_max value.
+    void update_supporter(Index op);
+
+    /// @brief Mark the propositions that reach the goal via zero cost operators.
+    void mark_goal_plateau();
+
+    /// @brief Collect the operators that cross from the propositions reachable from the state into the goal zone.
+    void second_exploration(State state);
+
+    void next_round();
+
+public:
+    /// @brief Simplest construction
+    explicit LMCutHeuristic(std::shared_ptr<GroundedApplicableActionGenerator> applicable_action_generator);
+
+    LMCutHeuristic(std::shared_ptr<GroundedApplicableActionGenerator> applicable_action_generator, std::shared_ptr<ILMCutHeuristicEventHandler> event_handler);
+
+    /// @brief Complete construction
+    LMCutHeuristic(std::shared_ptr<RelaxedOperatorGraph> graph, std::shared_ptr<ILMCutHeuristicEventHandler> event_handler);
+
+    double compute_heuristic(State state) override;
+
+    const std::shared_ptr<ILMCutHeuristicEventHandler>& get_event_handler() const;
+};
+
+}
+
+#endif
@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIMIR_SEARCH_HEURISTICS_LMCUT_EVENT_HANDLERS_INTERFACE_HPP_
+#define MIMIR_SEARCH_HEURISTICS_LMCUT_EVENT_HANDLERS_INTERFACE_HPP_
+
+#include "mimir/search/heuristics/lmcut/event_handlers/statistics.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+
+namespace mimir
+{
+
+/**
+ * Interface class
+ */
+class ILMCutHeuristicEventHandler
+{
+public:
+    virtual ~ILMCutHeuristicEventHandler() = default;
+
+    /// @brief React on starting the computation of the heuristic value of a state.
+    virtual void on_start_compute_heuristic() = 0;
+
+    /// @brief React on finishing the computation of the heuristic value of a state.
+    virtual void on_end_compute_heuristic(double h_value, uint64_t num_landmarks) = 0;
+
+    virtual const LMCutHeuristicStatistics& get_statistics() const = 0;
+};
+
+/**
+ * Base class
+ *
+ * Collect statistics and call implementation of derived class.
+ */
+template<typename Derived_>
+class LMCutHeuristicEventHandlerBase : public ILMCutHeuristicEventHandler
+{
+protected:
+    LMCutHeuristicStatistics m_statistics;
+    bool m_quiet;
+
+    std::chrono::time_point<std::chrono::high_resolution_clock> m_start_time_point;
+
+private:
+    LMCutHeuristicEventHandlerBase() = default;
+    friend Derived_;
+
+    /// @brief Helper to cast to Derived.
+    constexpr const auto& self() const { return static_cast<const Derived_&>(*this); }
+    constexpr auto& self() { return static_cast<Derived_&>(*this); }
+
+public:
+    explicit LMCutHeuristicEventHandlerBase(bool quiet = true) : m_statistics(), m_quiet(quiet), m_start_time_point() {}
+
+    void on_start_compute_heuristic() override
+    {  //
+        m_start_time_point = std::chrono::high_resolution_clock::now();
+    }
+
+    void on_end_compute_heuristic(double h_value, uint64_t num_landmarks) override
+    {
+        const auto time = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - m_start_time_point);
+        m_statistics.on_evaluation(time, num_landmarks, std::isinf(h_value));
+
+        if (!m_quiet)
+        {
+            self().on_end_compute_heuristic_impl(h_value, num_landmarks, time);
+        }
+    }
+
+    const LMCutHeuristicStatistics& get_statistics() const override { return m_statistics; }
+};
+
+}
+
+#endif
@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIMIR_SEARCH_HEURISTICS_LMCUT_EVENT_HANDLERS_STATISTICS_HPP_
+#define MIMIR_SEARCH_HEURISTICS_LMCUT_EVENT_HANDLERS_STATISTICS_HPP_
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+
+namespace mimir
+{
+
+class LMCutHeuristicStatistics
+{
+private:
+    uint64_t m_num_evaluations;
+    uint64_t m_num_deadends;
+    uint64_t m_num_landmarks;
+    std::chrono::nanoseconds m_total_time;
+    std::chrono::nanoseconds m_max_time;
+
+public:
+    LMCutHeuristicStatistics() : m_num_evaluations(0), m_num_deadends(0), m_num_landmarks(0), m_total_time(0), m_max_time(0) {}
+
+    /// @brief Store information of a single call to `compute_heuristic`.
+    void on_evaluation(std::chrono::nanoseconds time, uint64_t num_landmarks, bool is_deadend)
+    {
+        ++m_num_evaluations;
+        m_num_landmarks += num_landmarks;
+        m_num_deadends += is_deadend;
+        m_total_time += time;
+        m_max_time = std::max(m_max_time, time);
+    }
+
+    uint64_t get_num_evaluations() const { return m_num_evaluations; }
+    uint64_t get_num_deadends() const { return m_num_deadends; }
+    uint64_t get_num_landmarks() const { return m_num_landmarks; }
+
+    std::chrono::nanoseconds get_total_time_ns() const { return m_total_time; }
+    std::chrono::nanoseconds get_max_time_ns() const { return m_max_time; }
+    std::chrono::nanoseconds get_average_time_ns() const
+    {
+        return (m_num_evaluations == 0) ? std::chrono::nanoseconds(0) : std::chrono::nanoseconds(m_total_time.count() / m_num_evaluations);
+    }
+};
+
+/**
+ * Pretty printing
+ */
+
+inline std::ostream& operator<<(std::ostream& os, const LMCutHeuristicStatistics& statistics)
+{
+    os << "[LMCut] Number of evaluations: " << statistics.get_num_evaluations() << "\n"
+       << "[LMCut] Number of dead ends: " << statistics.get_num_deadends() << "\n"
+       << "[LMCut] Number of landmarks: " << statistics.get_num_landmarks() << "\n"
+       << "[LMCut] Total evaluation time: " << std::chrono::duration_cast<std::chrono::milliseconds>(statistics.get_total_time_ns()).count() << "ms\n"
+       << "[LMCut] Average evaluation time: " << statistics.get_average_time_ns().count() << "ns\n"
+       << "[LMCut] Maximum evaluation time: " << statistics.get_max_time_ns().count() << "ns";
+
+    return os;
+}
+
+}
+
+#endif
@@ -0,0 +1,44 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIMIR_SEARCH_HEURISTICS_PDB_HPP_
+#define MIMIR_SEARCH_HEURISTICS_PDB_HPP_
+
+#include "mimir/search/heuristics/interface.hpp"
+#include "mimir/search/heuristics/pdb/pattern_database.hpp"
+
+namespace mimir
+{
+
+/// @brief `PDBHeuristic` returns the abstract goal distance of a single pattern database.
+class PDBHeuristic : public IHeuristic
+{
+private:
+    PatternDatabase m_pattern_database;
+
+public:
+    PDBHeuristic(std::shared_ptr<GroundedApplicableActionGenerator> applicable_action_generator, Pattern pattern);
+    explicit PDBHeuristic(PatternDatabase pattern_database);
+
+    double compute_heuristic(State state) override;
+
+    const PatternDatabase& get_pattern_database() const;
+};
+
+}
+
+#endif
@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIMIR_SEARCH_HEURISTICS_PDB_PATTERN_DATABASE_HPP_
+#define MIMIR_SEARCH_HEURISTICS_PDB_PATTERN_DATABASE_HPP_
+
+#include "cista/containers/vector.h"
+#include "cista/mmap.h"
+#include "mimir/common/types.hpp"
+#include "mimir/formalism/declarations.hpp"
+#include "mimir/search/declarations.hpp"
+#include "mimir/search/state.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <loki/details/utils/filesystem.hpp>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace mimir
+{
+
+/// @brief `Pattern` is a sorted list of fluent ground atom indices.
+using Pattern = IndexList;
+using PatternList = std::vector<Pattern>;
+
+/// @brief `FlatPatternDatabase` is the serializable part of a `PatternDatabase`.
+struct FlatPatternDatabase
+{
+    /// @brief Identifies the task and pattern to detect stale files.
+    uint64_t fingerprint;
+    cista::offset::vector<Index> pattern;
+    cista::offset::vector<uint8_t> distances;
+};
+
+/// @brief `PatternDatabase` stores the goal distances of the projection of the grounded task onto a pattern.
+///
+/// Abstract states are the subsets of the pattern and are ranked by a perfect hash function
+/// that assigns the i-th atom of the pattern the factor 2^i, similar to the `TupleIndexMapper`.
+/// The distances are computed by a backward Dijkstra search in the abstract state space
+/// and stored as packed 8-bit values, rounded down and saturated at `MAX_DISTANCE`, which keeps them admissible.
+///
+/// Conditional effects whose conditions cannot be decided in the projection may or may not trigger in the abstract transition.
+/// Derived preconditions are ignored in the projection.
+class PatternDatabase
+{
+public:
+    static constexpr size_t MAX_PATTERN_SIZE = 20;
+    /// @brief Special value for abstract dead ends.
+    static constexpr uint8_t DEADEND_DISTANCE = std::numeric_limits<uint8_t>::max();
+    static constexpr uint8_t MAX_DISTANCE = DEADEND_DISTANCE - 1;
+
+private:
+    std::unique_ptr<FlatPatternDatabase> m_owned_data;
+    std::unique_ptr<cista::mmap> m_mmap;
+    const FlatPatternDatabase* m_data;
+
+    PatternDatabase(std::unique_ptr<FlatPatternDatabase> owned_data, std::unique_ptr<cista::mmap> mmap, const FlatPatternDatabase* data);
+
+public:
+    /// @brief Compute the pattern database of the given pattern.
+    PatternDatabase(std::shared_ptr<GroundedApplicableActionGenerator> applicable_action_generator, Pattern pattern);
+
+    /// @brief Memory map the pattern database from the file if it exists and belongs to the same task and pattern.
+    /// Otherwise, compute the pattern database and store it in the file for later runs.
+    static PatternDatabase
+    load_or_create(std::shared_ptr<GroundedApplicableActionGenerator> applicable_action_generator, Pattern pattern, const fs::path& file_path);
+
+    /// @brief Store the pattern database in the given file.
+    void save(const fs::path& file_path) const;
+
+    /// @brief Return the perfect hash of the abstract state of the given state.
+    size_t get_abstract_state_index(State state) const;
+
+    /// @brief Return the abstract goal distance of the given state or infinity if it is an abstract dead end.
+    ContinuousCost get_distance(State state) const;
+
+    std::span<const Index> get_pattern() const;
+    size_t get_num_abstract_states() const;
+    uint64_t get_fingerprint() const;
+    /// @brief Return true iff the data is memory mapped from a file.
+    bool is_memory_mapped() const;
+};
+
+using PatternDatabaseList = std::vector<PatternDatabase>;
+
+/// @brief Compute the fingerprint of a pattern database for the given problem and pattern.
+/// The pattern atoms are identified by name because their indices are not stable across runs.
+extern uint64_t compute_pattern_database_fingerprint(const PDDLFactories& pddl_factories, Problem problem, const Pattern& pattern);
+
+}
+
+#endif
@@ -0,0 +1,53 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIMIR_SEARCH_HEURISTICS_PDB_PATTERN_SELECTION_HPP_
+#define MIMIR_SEARCH_HEURISTICS_PDB_PATTERN_SELECTION_HPP_
+
+#include "mimir/search/declarations.hpp"
+#include "mimir/search/heuristics/pdb/pattern_database.hpp"
+
+#include <memory>
+
+namespace mimir
+{
+
+/// @brief `GreedyPatternSelector` computes one pattern for each fluent goal atom.
+///
+/// Starting from the goal atom, the pattern is greedily extended by the fluent atom outside of the pattern
+/// that occurs most often in the preconditions of the ground actions that change an atom in the pattern.
+/// Ties are broken in favor of the smaller atom index, which makes the selection deterministic.
+class GreedyPatternSelector
+{
+private:
+    std::shared_ptr<GroundedApplicableActionGenerator> m_applicable_action_generator;
+    size_t m_max_pattern_size;
+    size_t m_max_num_abstract_states;
+
+public:
+    /// @param max_pattern_size is the maximum number of atoms in a single pattern.
+    /// @param max_num_abstract_states is the maximum number of abstract states summed over all patterns.
+    GreedyPatternSelector(std::shared_ptr<GroundedApplicableActionGenerator> applicable_action_generator,
+                          size_t max_pattern_size = 8,
+                          size_t max_num_abstract_states = 1'000'000);
+
+    PatternList compute_patterns() const;
+};
+
+}
+
+#endif
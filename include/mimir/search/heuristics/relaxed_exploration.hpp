@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIMIR_SEARCH_HEURISTICS_RELAXED_EXPLORATION_HPP_
+#define MIMIR_SEARCH_HEURISTICS_RELAXED_EXPLORATION_HPP_
+
+#include "mimir/search/heuristics/interface.hpp"
+#include "mimir/search/heuristics/relaxed_operator_graph.hpp"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace mimir
+{
+
+/// @brief `RelaxedCostCombination` defines how the costs of the preconditions of an operator are combined.
+enum class RelaxedCostCombination
+{
+    MAX,
+    ADD,
+};
+
+/// @brief `RelaxedExplorationHeuristic` is the common base of heuristics that explore the `RelaxedOperatorGraph`
+/// with a generalized Dijkstra algorithm. All buffers are allocated once and reused across calls.
+class RelaxedExplorationHeuristic : public IHeuristic
+{
+protected:
+    std::shared_ptr<RelaxedOperatorGraph> m_graph;
+
+    ContinuousCostList m_proposition_costs;
+    IndexList m_proposition_supporters;
+    IndexList m_operator_num_unsatisfied;
+    ContinuousCostList m_operator_costs;
+    std::vector<std::pair<ContinuousCost, Index>> m_queue;
+
+    /* Relaxed plan extraction */
+    std::vector<bool> m_marked_propositions;
+    std::vector<bool> m_marked_operators;
+    std::vector<bool> m_marked_actions;
+    IndexList m_open_propositions;
+    IndexList m_reached_propositions;
+    IndexList m_reached_operators;
+    IndexList m_relaxed_plan;
+
+    /// @brief Run the relaxed exploration from the given state.
+    /// If `stop_at_goals` is true, then the exploration stops once all goal propositions have their final cost.
+    /// @return the cost of the goal propositions combined as specified or infinity if some goal proposition is unreachable.
+    ContinuousCost explore(State state, RelaxedCostCombination combination, bool stop_at_goals = true);
+
+    /// @brief Extract a relaxed plan by backchaining the best supporters of the last exploration from the goal propositions.
+    /// Each ground action is counted once, even if several of its operators are in the relaxed plan.
+    /// @return the cost of the relaxed plan.
+    ContinuousCost extract_relaxed_plan();
+
+public:
+    explicit RelaxedExplorationHeuristic(std::shared_ptr<RelaxedOperatorGraph> graph);
+
+    const std::shared_ptr<RelaxedOperatorGraph>& get_relaxed_operator_graph() const;
+};
+
+}
+
+#endif
@@ -0,0 +1,135 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIMIR_SEARCH_HEURISTICS_RELAXED_OPERATOR_GRAPH_HPP_
+#define MIMIR_SEARCH_HEURISTICS_RELAXED_OPERATOR_GRAPH_HPP_
+
+#include "mimir/common/types.hpp"
+#include "mimir/formalism/declarations.hpp"
+#include "mimir/search/declarations.hpp"
+#include "mimir/search/state.hpp"
+
+#include <limits>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace mimir
+{
+
+/// @brief `RelaxedOperatorGraph` is a flat representation of the delete relaxation of a ground task.
+///
+/// Each ground action and ground axiom contributes one relaxed operator for its unconditional effects
+/// and one relaxed operator for each of its conditional effects.
+/// Negative conditions and delete effects are dropped as done by the `DeleteRelaxTransformer`.
+/// Propositions are created on demand for the fluent and derived ground atoms that occur in the operators.
+/// All adjacency information is stored in compressed sparse row format to keep the exploration cache friendly.
+/// Operators can be added incrementally, e.g., while exploring the task in a lifted way,
+/// after which `finalize` must be called before the graph is explored again.
+class RelaxedOperatorGraph
+{
+public:
+    /// @brief Special value for operators that originate from a ground axiom.
+    static constexpr Index NO_ACTION = std::numeric_limits<Index>::max();
+    /// @brief Special value for atoms that do not occur in the graph.
+    static constexpr Index NO_PROPOSITION = std::numeric_limits<Index>::max();
+
+private:
+    Problem m_problem;
+
+    IndexList m_fluent_atom_to_proposition;
+    IndexList m_derived_atom_to_proposition;
+    IndexList m_proposition_to_atom;
+    std::vector<bool> m_proposition_is_derived;
+
+    /* Operators */
+    IndexList m_precondition_offsets;
+    IndexList m_preconditions;
+    IndexList m_num_preconditions;
+    IndexList m_effect_offsets;
+    IndexList m_effects;
+    ContinuousCostList m_costs;
+    IndexList m_action_indices;
+    size_t m_num_actions;
+
+    /* Propositions */
+    IndexList m_precondition_of_offsets;
+    IndexList m_precondition_of;
+
+    IndexList m_operators_without_preconditions;
+    IndexList m_goal_propositions;
+
+    template<DynamicPredicateCategory P>
+    Index get_or_create_proposition(Index atom_index);
+
+    void add_operator(const IndexList& preconditions, const IndexList& effects, ContinuousCost cost, Index action_index);
+
+    /* Preallocated buffers */
+    IndexList m_preconditions_buffer;
+    IndexList m_conditional_preconditions_buffer;
+    IndexList m_effects_buffer;
+
+public:
+    /// @brief Create an empty relaxed operator graph that only contains the goal propositions of the problem.
+    explicit RelaxedOperatorGraph(Problem problem);
+
+    /// @brief Create the relaxed operator graph from the ground actions and ground axioms of the grounded task.
+    explicit RelaxedOperatorGraph(std::shared_ptr<GroundedApplicableActionGenerator> applicable_action_generator);
+
+    /// @brief Add the relaxed operators of a ground action.
+    void add_ground_action(GroundAction action);
+
+    /// @brief Add the relaxed operator of a ground axiom.
+    void add_ground_axiom(GroundAxiom axiom);
+
+    /// @brief Compute the operators that have a proposition in their precondition.
+    /// Must be called after adding operators.
+    void finalize();
+
+    /// @brief Return the proposition of the given atom or `NO_PROPOSITION` if it does not occur in the graph.
+    template<DynamicPredicateCategory P>
+    Index get_proposition(Index atom_index) const;
+
+    /// @brief Return the index of the ground atom of the given proposition.
+    Index get_atom_index(Index proposition) const;
+    /// @brief Return true iff the ground atom of the given proposition is a derived atom.
+    bool is_derived(Index proposition) const;
+
+    Problem get_problem() const;
+    size_t get_num_propositions() const;
+    size_t get_num_operators() const;
+    /// @brief Return an upper bound on the ground action indices that occur in the graph.
+    size_t get_num_actions() const;
+
+    std::span<const Index> get_preconditions(Index op) const;
+    std::span<const Index> get_effects(Index op) const;
+    /// @brief Return the number of preconditions for each operator.
+    const IndexList& get_num_preconditions() const;
+    ContinuousCost get_cost(Index op) const;
+    /// @brief Return the index of the ground action that induces the operator or `NO_ACTION` for axioms.
+    Index get_action_index(Index op) const;
+
+    /// @brief Return the operators that have the given proposition in their precondition.
+    std::span<const Index> get_precondition_of(Index proposition) const;
+
+    const IndexList& get_operators_without_preconditions() const;
+    const IndexList& get_goal_propositions() const;
+};
+
+}
+
+#endif
@@ -0,0 +1,50 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIMIR_SEARCH_MUTEX_GROUPS_HPP_
+#define MIMIR_SEARCH_MUTEX_GROUPS_HPP_
+
+#include "mimir/common/types.hpp"
+#include "mimir/formalism/declarations.hpp"
+#include "mimir/search/action.hpp"
+
+#include <vector>
+
+namespace mimir
+{
+
+using MutexGroup = IndexList;
+using MutexGroupList = std::vector<MutexGroup>;
+
+/// @brief Compute a partition of the fluent ground atoms into mutex groups,
+/// i.e., sets of fluent ground atoms of which at most one is true in every reachable state.
+///
+/// Candidate groups are obtained from the ground actions:
+/// whenever an action deletes a precondition atom p and adds an atom q,
+/// the argument positions of p and q with a common object are linked, e.g., at(ball, room) and carry(ball, gripper) on the ball.
+/// The linked predicate positions are grouped by the object at the position and each group is verified against the initial state
+/// and the ground actions. Verified groups are chosen greedily by decreasing size.
+/// The remaining atoms that occur in the task form singleton groups.
+/// @param problem is the problem that defines the initial state.
+/// @param ground_actions are the ground actions of the task, e.g., obtained from the `GroundedApplicableActionGenerator`.
+/// @param pddl_factories are the factories that created the ground atoms.
+/// @return the mutex groups where each group is sorted by atom index.
+extern MutexGroupList compute_mutex_groups(Problem problem, const GroundActionList& ground_actions, const PDDLFactories& pddl_factories);
+
+}
+
+#endif
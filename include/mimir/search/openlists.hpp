@@ -21,6 +21,8 @@
 /**
  * Include all specializations here
  */
+#include "mimir/search/openlists/alternating.hpp"
+#include "mimir/search/openlists/bucket.hpp"
 #include "mimir/search/openlists/priority_queue.hpp"
 
 #endif
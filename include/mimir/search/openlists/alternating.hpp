@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIMIR_SEARCH_OPENLISTS_ALTERNATING_HPP_
+#define MIMIR_SEARCH_OPENLISTS_ALTERNATING_HPP_
+
+#include "mimir/search/openlists/interface.hpp"
+#include "mimir/search/openlists/priority_queue.hpp"
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+
+namespace mimir
+{
+
+/**
+ * Implementation class
+ *
+ * Alternates between a regular priority queue that contains all items
+ * and a preferred priority queue that only contains items inserted with `insert_preferred`.
+ * Each queue has a counter that is incremented when an item is popped from it.
+ * The non-empty queue with the smaller counter is selected, where ties are broken in favor of the preferred queue.
+ * Boosting decreases the counter of the preferred queue, which then is selected for the next pops.
+ */
+template<typename T>
+class AlternatingOpenList : public IOpenList<AlternatingOpenList<T>>
+{
+private:
+    static constexpr size_t REGULAR = 0;
+    static constexpr size_t PREFERRED = 1;
+
+    std::array<PriorityQueue<T>, 2> m_queues;
+    std::array<int64_t, 2> m_counters;
+
+    /// @brief Return the index of the queue that is popped next.
+    size_t select() const
+    {
+        assert(!empty_impl());
+
+        if (m_queues[PREFERRED].empty())
+        {
+            return REGULAR;
+        }
+        if (m_queues[REGULAR].empty())
+        {
+            return PREFERRED;
+        }
+        return (m_counters[PREFERRED] <= m_counters[REGULAR]) ? PREFERRED : REGULAR;
+    }
+
+    /* Implement IOpenList interface */
+    friend class IOpenList<AlternatingOpenList>;
+
+    void insert_impl(double priority, const T& item) { m_queues[REGULAR].insert(priority, item); }
+
+    const T& top_impl() const { return m_queues[select()].top(); }
+
+    void pop_impl()
+    {
+        const auto index = select();
+        m_queues[index].pop();
+        ++m_counters[index];
+    }
+
+    void clear_impl()
+    {
+        for (auto& queue : m_queues)
+        {
+            queue.clear();
+        }
+        m_counters = { 0, 0 };
+    }
+
+    bool empty_impl() const { return m_queues[REGULAR].empty() && m_queues[PREFERRED].empty(); }
+
+    std::size_t size_impl() const { return m_queues[REGULAR].size() + m_queues[PREFERRED].size(); }
+
+public:
+    AlternatingOpenList() : m_queues(), m_counters({ 0, 0 }) {}
+
+    /// @brief Insert an item into the regular and the preferred queue.
+    void insert_preferred(double priority, const T& item)
+    {
+        m_queues[REGULAR].insert(priority, item);
+        m_queues[PREFERRED].insert(priority, item);
+    }
+
+    /// @brief Prefer the preferred queue for the next `amount` pops.
+    void boost_preferred(int64_t amount) { m_counters[PREFERRED] -= amount; }
+};
+
+}
+
+#endif
@@ -0,0 +1,326 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIMIR_SEARCH_OPENLISTS_BUCKET_HPP_
+#define MIMIR_SEARCH_OPENLISTS_BUCKET_HPP_
+
+#include "mimir/search/openlists/interface.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+namespace mimir
+{
+
+/// @brief `BucketTieBreaking` defines the order in which items with the same priority are popped.
+enum class BucketTieBreaking
+{
+    FIFO,
+    LIFO,
+    /// @brief Items with smaller secondary priority first, e.g., the h-value in A*, and FIFO among equal secondary priorities.
+    MIN_SECONDARY,
+};
+
+/**
+ * Implementation class
+ *
+ * Stores items in buckets indexed by the floor of their non-negative priority.
+ * The buckets form a window of at most `max_num_buckets` consecutive keys that starts at the smallest key seen since the open list was last empty,
+ * such that large priorities do not allocate buckets for all smaller keys.
+ * Keys beyond the window are kept in sparse buckets that are moved into the window once it runs empty.
+ * Insertion and removal take constant amortized time with FIFO and LIFO tie-breaking,
+ * which makes the open list a better fit than a binary heap when there are only few distinct priorities, e.g., for integral action costs.
+ * With MIN_SECONDARY tie-breaking, each bucket orders its items in a binary heap on the secondary priority,
+ * such that the memory stays linear in the number of items regardless of the range of secondary priorities.
+ * The index of the smallest non-empty bucket is cached and only advances during pops.
+ * Clearing the open list keeps the allocated buckets to be reused by the next search.
+ */
+template<typename T>
+class BucketOpenList : public IOpenList<BucketOpenList<T>>
+{
+private:
+    /// @brief A queue that pops at the front for FIFO and at the back for LIFO.
+    /// We avoid std::deque because it allocates memory even when it is empty.
+    struct Queue
+    {
+        std::vector<T> items;
+        size_t head = 0;
+
+        bool empty() const { return head == items.size(); }
+    };
+
+    struct HeapEntry
+    {
+        double secondary_priority;
+        /// @brief The insertion order to break ties among equal secondary priorities in FIFO order.
+        uint64_t timestamp;
+        T item;
+    };
+
+    struct HeapEntryComparator
+    {
+        bool operator()(const HeapEntry& lhs, const HeapEntry& rhs) const
+        {
+            return lhs.secondary_priority > rhs.secondary_priority || (lhs.secondary_priority == rhs.secondary_priority && lhs.timestamp > rhs.timestamp);
+        }
+    };
+
+    struct Bucket
+    {
+        /// @brief Only used without MIN_SECONDARY.
+        Queue queue;
+        /// @brief Only used with MIN_SECONDARY.
+        std::vector<HeapEntry> heap;
+    };
+
+    BucketTieBreaking m_tie_breaking;
+    size_t m_max_num_buckets;
+
+    /// @brief The bucket at position i stores the items with key m_base_key + i.
+    std::vector<Bucket> m_buckets;
+    /// @brief The buckets with keys of at least m_base_key + m_max_num_buckets.
+    std::map<size_t, Bucket> m_far_buckets;
+    size_t m_base_key;
+    size_t m_min_bucket;
+    /// @brief The number of items in m_buckets, the remaining items are in m_far_buckets.
+    size_t m_window_size;
+    size_t m_size;
+    uint64_t m_timestamp;
+
+    static size_t to_key(double priority)
+    {
+        assert(priority >= 0 && std::isfinite(priority));
+        return static_cast<size_t>(std::floor(priority));
+    }
+
+    bool is_bucket_empty(const Bucket& bucket) const
+    {
+        return (m_tie_breaking == BucketTieBreaking::MIN_SECONDARY) ? bucket.heap.empty() : bucket.queue.empty();
+    }
+
+    size_t get_bucket_size(const Bucket& bucket) const
+    {
+        return (m_tie_breaking == BucketTieBreaking::MIN_SECONDARY) ? bucket.heap.size() : bucket.queue.items.size() - bucket.queue.head;
+    }
+
+    /// @brief Move the window down such that it starts at the given key.
+    /// The buckets that fall out of the window are moved to the far buckets.
+    void shift_window(size_t base_key)
+    {
+        assert(base_key < m_base_key);
+
+        const auto shift = m_base_key - base_key;
+        for (size_t i = (shift < m_max_num_buckets) ? m_max_num_buckets - shift : 0; i < m_buckets.size(); ++i)
+        {
+            auto& bucket = m_buckets[i];
+            if (!is_bucket_empty(bucket))
+            {
+                m_window_size -= get_bucket_size(bucket);
+                std::swap(m_far_buckets[m_base_key + i], bucket);
+            }
+        }
+
+        // All buckets at the back are empty now, rotate them to the front.
+        const auto num_buckets = std::min(m_max_num_buckets, m_buckets.size() + shift);
+        m_buckets.resize(num_buckets);
+        if (shift < num_buckets)
+        {
+            std::rotate(m_buckets.rbegin(), m_buckets.rbegin() + shift, m_buckets.rend());
+        }
+        m_min_bucket += shift;
+        m_base_key = base_key;
+    }
+
+    /// @brief Move the window to the smallest far bucket after it ran empty.
+    void refill_window()
+    {
+        assert(m_window_size == 0 && !m_far_buckets.empty());
+
+        m_base_key = m_far_buckets.begin()->first;
+        m_min_bucket = 0;
+        auto it = m_far_buckets.begin();
+        while (it != m_far_buckets.end() && it->first - m_base_key < m_max_num_buckets)
+        {
+            const auto index = it->first - m_base_key;
+            if (index >= m_buckets.size())
+            {
+                m_buckets.resize(index + 1);
+            }
+            m_window_size += get_bucket_size(it->second);
+            // Swapping hands the capacity of the empty bucket over to the erased node.
+            std::swap(m_buckets[index], it->second);
+            it = m_far_buckets.erase(it);
+        }
+    }
+
+    /* Implement IOpenList interface */
+    friend class IOpenList<BucketOpenList>;
+
+    void insert_impl(double priority, const T& item) { insert(priority, 0, item); }
+
+    const T& top_impl() const
+    {
+        assert(!empty_impl());
+
+        const auto& bucket = m_buckets[m_min_bucket];
+        switch (m_tie_breaking)
+        {
+            case BucketTieBreaking::MIN_SECONDARY:
+                return bucket.heap.front().item;
+            case BucketTieBreaking::LIFO:
+                return bucket.queue.items.back();
+            default:
+                return bucket.queue.items[bucket.queue.head];
+        }
+    }
+
+    void pop_impl()
+    {
+        assert(!empty_impl());
+
+        auto& bucket = m_buckets[m_min_bucket];
+        if (m_tie_breaking == BucketTieBreaking::MIN_SECONDARY)
+        {
+            std::pop_heap(bucket.heap.begin(), bucket.heap.end(), HeapEntryComparator());
+            bucket.heap.pop_back();
+        }
+        else
+        {
+            auto& queue = bucket.queue;
+            if (m_tie_breaking == BucketTieBreaking::LIFO)
+            {
+                queue.items.pop_back();
+            }
+            else
+            {
+                ++queue.head;
+            }
+            if (queue.empty())
+            {
+                // Keep the capacity for later insertions into the same queue.
+                queue.items.clear();
+                queue.head = 0;
+            }
+        }
+
+        --m_size;
+        if (--m_window_size > 0)
+        {
+            while (is_bucket_empty(m_buckets[m_min_bucket]))
+            {
+                ++m_min_bucket;
+            }
+        }
+        else if (m_size > 0)
+        {
+            refill_window();
+        }
+    }
+
+    void clear_impl()
+    {
+        for (auto& bucket : m_buckets)
+        {
+            bucket.queue.items.clear();
+            bucket.queue.head = 0;
+            bucket.heap.clear();
+        }
+        m_far_buckets.clear();
+        m_base_key = 0;
+        m_min_bucket = 0;
+        m_window_size = 0;
+        m_size = 0;
+        m_timestamp = 0;
+    }
+
+    bool empty_impl() const { return m_size == 0; }
+
+    std::size_t size_impl() const { return m_size; }
+
+public:
+    explicit BucketOpenList(BucketTieBreaking tie_breaking = BucketTieBreaking::FIFO, size_t max_num_buckets = 1 << 16) :
+        m_tie_breaking(tie_breaking),
+        m_max_num_buckets(max_num_buckets),
+        m_buckets(),
+        m_far_buckets(),
+        m_base_key(0),
+        m_min_bucket(0),
+        m_window_size(0),
+        m_size(0),
+        m_timestamp(0)
+    {
+        assert(max_num_buckets > 0);
+    }
+
+    using IOpenList<BucketOpenList<T>>::insert;
+
+    /// @brief Insert an item with a secondary priority that is used for tie-breaking with MIN_SECONDARY and ignored otherwise.
+    void insert(double priority, double secondary_priority, const T& item)
+    {
+        const auto key = to_key(priority);
+
+        if (m_size == 0)
+        {
+            m_base_key = key;
+        }
+        else if (key < m_base_key)
+        {
+            shift_window(key);
+        }
+
+        const auto index = key - m_base_key;
+        const auto is_in_window = (index < m_max_num_buckets);
+        if (is_in_window && index >= m_buckets.size())
+        {
+            m_buckets.resize(index + 1);
+        }
+        auto& bucket = is_in_window ? m_buckets[index] : m_far_buckets[key];
+        if (m_tie_breaking == BucketTieBreaking::MIN_SECONDARY)
+        {
+            bucket.heap.push_back(HeapEntry { secondary_priority, m_timestamp++, item });
+            std::push_heap(bucket.heap.begin(), bucket.heap.end(), HeapEntryComparator());
+        }
+        else
+        {
+            bucket.queue.items.push_back(item);
+        }
+
+        if (is_in_window)
+        {
+            if (m_window_size == 0 || index < m_min_bucket)
+            {
+                m_min_bucket = index;
+            }
+            ++m_window_size;
+        }
+        ++m_size;
+    }
+
+    BucketTieBreaking get_tie_breaking() const { return m_tie_breaking; }
+
+    /// @brief Return the number of allocated buckets in the window.
+    size_t get_num_buckets() const { return m_buckets.size(); }
+};
+
+}
+
+#endif
@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIMIR_SEARCH_PACKED_STATE_HPP_
+#define MIMIR_SEARCH_PACKED_STATE_HPP_
+
+#include "mimir/common/types.hpp"
+#include "mimir/common/types_cista.hpp"
+#include "mimir/search/mutex_groups.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace mimir
+{
+
+using PackedBlock = uint64_t;
+using PackedBlockList = std::vector<PackedBlock>;
+
+/// @brief `PackedStateEncoder` encodes the fluent atoms of a state with one finite-domain variable per mutex group.
+///
+/// The variable of a group G takes values in {0, ..., |G|} where 0 means that no atom of G is true
+/// and i > 0 means that the i-th atom of G is true. Each variable uses ceil(log2(|G|+1)) bits
+/// and never crosses a block boundary such that values can be read with a single shift and mask.
+class PackedStateEncoder
+{
+public:
+    /// @brief Special value for atoms that do not belong to any mutex group.
+    static constexpr Index NO_VARIABLE = std::numeric_limits<Index>::max();
+
+private:
+    MutexGroupList m_mutex_groups;
+
+    IndexList m_variable_blocks;
+    IndexList m_variable_offsets;
+    std::vector<PackedBlock> m_variable_masks;
+    size_t m_num_blocks;
+
+    IndexList m_atom_to_variable;
+    IndexList m_atom_to_value;
+
+public:
+    /// @brief Create an encoder where each mutex group yields one variable.
+    /// @param mutex_groups are disjoint sets of fluent ground atoms of which at most one is true in every state.
+    explicit PackedStateEncoder(MutexGroupList mutex_groups);
+
+    /// @brief Encode the fluent atoms into `get_num_blocks` blocks.
+    /// Throws an exception if some atom is not covered by the mutex groups or two atoms of the same group are true.
+    void encode(const FlatBitset& fluent_atoms, std::span<PackedBlock> out_blocks) const;
+
+    /// @brief Decode the blocks into the fluent atoms.
+    void decode(std::span<const PackedBlock> blocks, FlatBitset& out_fluent_atoms) const;
+
+    /// @brief Return the value of the variable in the encoded state.
+    Index get_value(std::span<const PackedBlock> blocks, Index variable) const
+    {
+        return static_cast<Index>((blocks[m_variable_blocks[variable]] >> m_variable_offsets[variable]) & m_variable_masks[variable]);
+    }
+
+    const MutexGroupList& get_mutex_groups() const;
+    size_t get_num_variables() const;
+    /// @brief Return the number of blocks of an encoded state.
+    size_t get_num_blocks() const;
+    /// @brief Return the variable of the atom or `NO_VARIABLE`.
+    Index get_variable(Index atom_index) const;
+};
+
+}
+
+#endif
@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIMIR_SEARCH_PACKED_STATE_REPOSITORY_HPP_
+#define MIMIR_SEARCH_PACKED_STATE_REPOSITORY_HPP_
+
+#include "mimir/common/types_cista.hpp"
+#include "mimir/formalism/declarations.hpp"
+#include "mimir/search/action.hpp"
+#include "mimir/search/declarations.hpp"
+#include "mimir/search/packed_state.hpp"
+#include "mimir/search/state.hpp"
+
+#include <limits>
+#include <memory>
+#include <span>
+
+namespace mimir
+{
+
+/**
+ * Implementation class
+ *
+ * `PackedStateRepository` stores the unique states bit-packed with a `PackedStateEncoder`
+ * whose mutex groups are computed from the ground actions of the `GroundedApplicableActionGenerator`.
+ * All states are stored contiguously with a fixed number of blocks per state and are identified by their index.
+ * Derived atoms are not stored but recomputed when a state is unpacked.
+ *
+ * A state is unpacked into a `StateBuilder`, which yields the usual `State` view on it.
+ * The view remains valid until the builder is modified.
+ */
+class PackedStateRepository
+{
+private:
+    /// @brief Special value for empty slots in the hash table.
+    static constexpr Index EMPTY_SLOT = std::numeric_limits<Index>::max();
+
+    std::shared_ptr<GroundedApplicableActionGenerator> m_aag;
+    bool m_problem_or_domain_has_axioms;
+    PackedStateEncoder m_encoder;
+
+    PackedBlockList m_blocks;
+    size_t m_num_states;
+    /// @brief Open addressing hash table with linear probing that maps packed states to their index.
+    IndexList m_slots;
+
+    PackedBlockList m_blocks_buffer;
+    FlatBitset m_fluent_atoms_buffer;
+    FlatBitset m_reached_fluent_atoms;
+
+    size_t get_slot(std::span<const PackedBlock> blocks) const;
+
+    void resize_slots(size_t num_slots);
+
+public:
+    explicit PackedStateRepository(std::shared_ptr<GroundedApplicableActionGenerator> aag);
+
+    PackedStateRepository(const PackedStateRepository& other) = delete;
+    PackedStateRepository& operator=(const PackedStateRepository& other) = delete;
+    PackedStateRepository(PackedStateRepository&& other) = delete;
+    PackedStateRepository& operator=(PackedStateRepository&& other) = delete;
+
+    /// @brief Return the index of the initial state.
+    Index get_or_create_initial_state();
+
+    /// @brief Return the index of the state with the given fluent atoms.
+    Index get_or_create_state(const FlatBitset& fluent_atoms);
+
+    /// @brief Return the index of the successor state that results from applying the action in the state.
+    Index get_or_create_successor_state(State state, GroundAction action);
+
+    /// @brief Decode the state with the given index and evaluate its axioms.
+    /// @return a view on the state that remains valid until `out_state_builder` is modified.
+    State unpack_state(Index state_index, StateBuilder& out_state_builder) const;
+
+    /// @brief Return the packed blocks of the state with the given index.
+    std::span<const PackedBlock> get_packed_state(Index state_index) const;
+
+    size_t get_state_count() const;
+
+    /// @brief Return the number of bytes per stored state, not accounting for the hash table.
+    size_t get_num_bytes_per_state() const;
+
+    /// @brief Return the number of bytes of the stored states, not accounting for the hash table.
+    size_t get_num_bytes() const;
+
+    const FlatBitset& get_reached_fluent_ground_atoms() const;
+
+    const PackedStateEncoder& get_encoder() const;
+
+    std::shared_ptr<GroundedApplicableActionGenerator> get_aag() const;
+};
+
+}
+
+#endif
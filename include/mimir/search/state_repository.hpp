@@ -28,6 +28,9 @@
 namespace mimir
 {
 
+/// @brief Compute the fluent atoms of the successor state that results from applying the action in the state.
+extern void apply_action_effects(Problem problem, State state, GroundAction action, FlatBitset& out_fluent_atoms);
+
 /**
  * Implementation class
  */
@@ -43,6 +46,9 @@ private:
     FlatBitset m_reached_fluent_atoms;
     FlatBitset m_reached_derived_atoms;
 
+    /// @brief Find or insert the state whose fluent atoms are stored in the state builder.
+    State get_or_create_state_from_builder();
+
 public:
     explicit StateRepository(std::shared_ptr<IApplicableActionGenerator> aag);
 
@@ -55,10 +61,19 @@ public:
 
     State get_or_create_state(const GroundAtomList<Fluent>& atoms);
 
+    /// @brief Find or insert the state with the given fluent atoms, e.g., a state that was created by another `StateRepository`.
+    State get_or_create_state(const FlatBitset& fluent_atoms);
+
     State get_or_create_successor_state(State state, GroundAction action);
 
+    /// @brief Compute the fluent atoms of the successor state without inserting it.
+    void compute_successor_fluent_atoms(State state, GroundAction action, FlatBitset& out_fluent_atoms) const;
+
     size_t get_state_count() const;
 
+    /// @brief Return the number of bytes of the stored states, not accounting for the hash table.
+    size_t get_num_bytes() const;
+
     const FlatBitset& get_reached_fluent_ground_atoms() const;
 
     const FlatBitset& get_reached_derived_ground_atoms() const;
@@ -92,37 +92,74 @@ from _pymimir import (
     AStarAlgorithm,
     AStarAlgorithmEventHandlerBase,
     AStarAlgorithmStatistics,
+    BFWSAlgorithm,
+    BFWSAlgorithmOptions,
+    BFWSAlgorithmStatistics,
     BlindHeuristic,
     BrFSAlgorithm,
     BrFSAlgorithmStatistics,
+    CanonicalPDBHeuristic,
     ConditionalEffect,
     DebugAStarAlgorithmEventHandler,
+    DebugBFWSAlgorithmEventHandler,
     DebugBrFSAlgorithmEventHandler,
+    DebugGBFSAlgorithmEventHandler,
+    DebugHDAStarAlgorithmEventHandler,
     DebugGroundedApplicableActionGeneratorEventHandler,
     DebugLiftedApplicableActionGeneratorEventHandler,
+    DebugLMCutHeuristicEventHandler,
+    DefaultBFWSAlgorithmEventHandler,
     DefaultBrFSAlgorithmEventHandler,
+    DefaultGBFSAlgorithmEventHandler,
+    DefaultHDAStarAlgorithmEventHandler,
     DefaultAStarAlgorithmEventHandler,
     DefaultGroundedApplicableActionGeneratorEventHandler,
     DefaultIWAlgorithmEventHandler,
     DefaultLiftedApplicableActionGeneratorEventHandler,
+    DefaultLMCutHeuristicEventHandler,
     DefaultSIWAlgorithmEventHandler,
     FlatSimpleEffect,
+    GBFSAlgorithm,
+    GBFSAlgorithmOptions,
+    GBFSAlgorithmStatistics,
+    HDAStarAlgorithm,
+    HDAStarAlgorithmOptions,
+    HDAStarAlgorithmStatistics,
+    GreedyPatternSelector,
     GroundAction,
     GroundActionList,
     GroundActionSpan,
     GroundedApplicableActionGenerator,
+    HAddHeuristic,
+    HeuristicEvaluation,
+    HFFHeuristic,
+    HMaxHeuristic,
     IApplicableActionGenerator,
     IAlgorithm,
     IAStarAlgorithmEventHandler,
+    IBFWSAlgorithmEventHandler,
     IBrFSAlgorithmEventHandler,
+    IGBFSAlgorithmEventHandler,
+    IHDAStarAlgorithmEventHandler,
     IIWAlgorithmEventHandler,
     IGroundedApplicableActionGeneratorEventHandler,
     IHeuristic,
     ILiftedApplicableActionGeneratorEventHandler,
+    ILMCutHeuristicEventHandler,
     ISIWAlgorithmEventHandler,
     IWAlgorithm,
+    IWAlgorithmOptions,
     IWAlgorithmStatistics,
     LiftedApplicableActionGenerator,
+    LiftedHAddHeuristic,
+    LiftedHFFHeuristic,
+    LMCutHeuristic,
+    LMCutHeuristicStatistics,
+    NoveltyTableBackendType,
+    NoveltyTableStatistics,
+    PatternDatabase,
+    PDBHeuristic,
+    RelaxedOperatorGraph,
     SearchNodeStatus,
     SearchStatus,
     SIWAlgorithm,
@@ -11,6 +11,7 @@
 #include "mimir/formalism/variable.hpp"
 
 #include <pybind11/detail/common.h>
+#include <pybind11/functional.h>  // Necessary for automatic conversion of e.g. std::function
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>  // Necessary for automatic conversion of e.g. std::vectors
 #include <pybind11/stl_bind.h>
@@ -1160,7 +1161,12 @@ void init_pymimir(py::module_& m)
         m,
         "LiftedApplicableActionGenerator")  //
         .def(py::init<Problem, std::shared_ptr<PDDLFactories>>())
-        .def(py::init<Problem, std::shared_ptr<PDDLFactories>, std::shared_ptr<ILiftedApplicableActionGeneratorEventHandler>>());
+        .def(py::init<Problem, std::shared_ptr<PDDLFactories>, std::shared_ptr<ILiftedApplicableActionGeneratorEventHandler>>())
+        .def(py::init<Problem, std::shared_ptr<PDDLFactories>, std::shared_ptr<ILiftedApplicableActionGeneratorEventHandler>, size_t>(),
+             py::arg("problem"),
+             py::arg("pddl_factories"),
+             py::arg("event_handler"),
+             py::arg("num_threads"));
 
     // Grounded
     py::class_<IGroundedApplicableActionGeneratorEventHandler, std::shared_ptr<IGroundedApplicableActionGeneratorEventHandler>>(
@@ -1179,7 +1185,18 @@ void init_pymimir(py::module_& m)
         m,
         "GroundedApplicableActionGenerator")  //
         .def(py::init<Problem, std::shared_ptr<PDDLFactories>>())
-        .def(py::init<Problem, std::shared_ptr<PDDLFactories>, std::shared_ptr<IGroundedApplicableActionGeneratorEventHandler>>());
+        .def(py::init<Problem, std::shared_ptr<PDDLFactories>, std::shared_ptr<IGroundedApplicableActionGeneratorEventHandler>>())
+        .def(py::init<Problem, std::shared_ptr<PDDLFactories>, std::shared_ptr<IGroundedApplicableActionGeneratorEventHandler>, size_t>(),
+             py::arg("problem"),
+             py::arg("pddl_factories"),
+             py::arg("event_handler"),
+             py::arg("num_threads"))
+        .def(py::init<Problem, std::shared_ptr<PDDLFactories>, std::shared_ptr<IGroundedApplicableActionGeneratorEventHandler>, size_t, bool>(),
+             py::arg("problem"),
+             py::arg("pddl_factories"),
+             py::arg("event_handler"),
+             py::arg("num_threads"),
+             py::arg("use_compact_match_tree"));
 
     /* StateRepository */
     py::class_<StateRepository, std::shared_ptr<StateRepository>>(m, "StateRepository")  //
@@ -1208,6 +1225,83 @@ void init_pymimir(py::module_& m)
     /* Heuristics */
     py::class_<IHeuristic, IPyHeuristic, std::shared_ptr<IHeuristic>>(m, "IHeuristic").def(py::init<>());
     py::class_<BlindHeuristic, IHeuristic, std::shared_ptr<BlindHeuristic>>(m, "BlindHeuristic").def(py::init<>());
+    py::class_<RelaxedOperatorGraph, std::shared_ptr<RelaxedOperatorGraph>>(m, "RelaxedOperatorGraph")
+        .def(py::init<std::shared_ptr<GroundedApplicableActionGenerator>>())
+        .def("get_num_propositions", &RelaxedOperatorGraph::get_num_propositions)
+        .def("get_num_operators", &RelaxedOperatorGraph::get_num_operators);
+    py::class_<HMaxHeuristic, IHeuristic, std::shared_ptr<HMaxHeuristic>>(m, "HMaxHeuristic")
+        .def(py::init<std::shared_ptr<GroundedApplicableActionGenerator>>())
+        .def(py::init<std::shared_ptr<RelaxedOperatorGraph>>());
+    py::class_<HAddHeuristic, IHeuristic, std::shared_ptr<HAddHeuristic>>(m, "HAddHeuristic")
+        .def(py::init<std::shared_ptr<GroundedApplicableActionGenerator>>())
+        .def(py::init<std::shared_ptr<RelaxedOperatorGraph>>());
+    py::class_<HFFHeuristic, IHeuristic, std::shared_ptr<HFFHeuristic>>(m, "HFFHeuristic")
+        .def(py::init<std::shared_ptr<GroundedApplicableActionGenerator>>())
+        .def(py::init<std::shared_ptr<RelaxedOperatorGraph>>())
+        .def("get_relaxed_plan", &HFFHeuristic::get_relaxed_plan, py::return_value_policy::copy);
+    py::class_<LMCutHeuristicStatistics>(m, "LMCutHeuristicStatistics")  //
+        .def("get_num_evaluations", &LMCutHeuristicStatistics::get_num_evaluations)
+        .def("get_num_deadends", &LMCutHeuristicStatistics::get_num_deadends)
+        .def("get_num_landmarks", &LMCutHeuristicStatistics::get_num_landmarks)
+        .def("get_total_time_ns", [](const LMCutHeuristicStatistics& self) { return self.get_total_time_ns().count(); })
+        .def("get_average_time_ns", [](const LMCutHeuristicStatistics& self) { return self.get_average_time_ns().count(); })
+        .def("get_max_time_ns", [](const LMCutHeuristicStatistics& self) { return self.get_max_time_ns().count(); });
+    py::class_<ILMCutHeuristicEventHandler, std::shared_ptr<ILMCutHeuristicEventHandler>>(m, "ILMCutHeuristicEventHandler")  //
+        .def("get_statistics", &ILMCutHeuristicEventHandler::get_statistics, py::return_value_policy::reference_internal);
+    py::class_<DefaultLMCutHeuristicEventHandler, ILMCutHeuristicEventHandler, std::shared_ptr<DefaultLMCutHeuristicEventHandler>>(
+        m,
+        "DefaultLMCutHeuristicEventHandler")  //
+        .def(py::init<>());
+    py::class_<DebugLMCutHeuristicEventHandler, ILMCutHeuristicEventHandler, std::shared_ptr<DebugLMCutHeuristicEventHandler>>(
+        m,
+        "DebugLMCutHeuristicEventHandler")  //
+        .def(py::init<>());
+    py::class_<LMCutHeuristic, IHeuristic, std::shared_ptr<LMCutHeuristic>>(m, "LMCutHeuristic")
+        .def(py::init<std::shared_ptr<GroundedApplicableActionGenerator>>())
+        .def(py::init<std::shared_ptr<GroundedApplicableActionGenerator>, std::shared_ptr<ILMCutHeuristicEventHandler>>())
+        .def("get_event_handler", &LMCutHeuristic::get_event_handler);
+    py::class_<LiftedHAddHeuristic, IHeuristic, std::shared_ptr<LiftedHAddHeuristic>>(m, "LiftedHAddHeuristic")
+        .def(py::init<std::shared_ptr<LiftedApplicableActionGenerator>>());
+    py::class_<LiftedHFFHeuristic, IHeuristic, std::shared_ptr<LiftedHFFHeuristic>>(m, "LiftedHFFHeuristic")
+        .def(py::init<std::shared_ptr<LiftedApplicableActionGenerator>>())
+        .def("get_relaxed_plan", &LiftedHFFHeuristic::get_relaxed_plan, py::return_value_policy::copy);
+    py::class_<PatternDatabase>(m, "PatternDatabase")
+        .def(py::init<std::shared_ptr<GroundedApplicableActionGenerator>, Pattern>())
+        .def_static("load_or_create",
+                    [](std::shared_ptr<GroundedApplicableActionGenerator> applicable_action_generator, Pattern pattern, const std::string& file_path)
+                    { return PatternDatabase::load_or_create(std::move(applicable_action_generator), std::move(pattern), fs::path(file_path)); })
+        .def("save", [](const PatternDatabase& self, const std::string& file_path) { self.save(fs::path(file_path)); })
+        .def("get_abstract_state_index", &PatternDatabase::get_abstract_state_index)
+        .def("get_distance", &PatternDatabase::get_distance)
+        .def("get_pattern", [](const PatternDatabase& self) { return Pattern(self.get_pattern().begin(), self.get_pattern().end()); })
+        .def("get_num_abstract_states", &PatternDatabase::get_num_abstract_states)
+        .def("is_memory_mapped", &PatternDatabase::is_memory_mapped);
+    py::class_<GreedyPatternSelector>(m, "GreedyPatternSelector")
+        .def(py::init<std::shared_ptr<GroundedApplicableActionGenerator>, size_t, size_t>(),
+             py::arg("applicable_action_generator"),
+             py::arg("max_pattern_size") = 8,
+             py::arg("max_num_abstract_states") = 1'000'000)
+        .def("compute_patterns", &GreedyPatternSelector::compute_patterns);
+    py::class_<PDBHeuristic, IHeuristic, std::shared_ptr<PDBHeuristic>>(m, "PDBHeuristic")
+        .def(py::init<std::shared_ptr<GroundedApplicableActionGenerator>, Pattern>())
+        .def("get_pattern_database", &PDBHeuristic::get_pattern_database, py::return_value_policy::reference_internal);
+    py::class_<CanonicalPDBHeuristic, IHeuristic, std::shared_ptr<CanonicalPDBHeuristic>>(m, "CanonicalPDBHeuristic")
+        .def(py::init<std::shared_ptr<GroundedApplicableActionGenerator>>())
+        .def(py::init(
+                 [](std::shared_ptr<GroundedApplicableActionGenerator> applicable_action_generator,
+                    PatternList patterns,
+                    std::optional<std::string> cache_directory)
+                 {
+                     return std::make_shared<CanonicalPDBHeuristic>(
+                         std::move(applicable_action_generator),
+                         std::move(patterns),
+                         cache_directory.has_value() ? std::optional<fs::path>(fs::path(cache_directory.value())) : std::nullopt);
+                 }),
+             py::arg("applicable_action_generator"),
+             py::arg("patterns"),
+             py::arg("cache_directory") = std::nullopt)
+        .def("get_pattern_databases", &CanonicalPDBHeuristic::get_pattern_databases, py::return_value_policy::reference_internal)
+        .def("get_additive_subsets", &CanonicalPDBHeuristic::get_additive_subsets, py::return_value_policy::copy);
 
     /* Algorithms */
     py::class_<IAlgorithm, std::shared_ptr<IAlgorithm>>(m, "IAlgorithm")  //
@@ -1276,6 +1370,146 @@ void init_pymimir(py::module_& m)
         .def(py::init<std::shared_ptr<IApplicableActionGenerator>>())
         .def(py::init<std::shared_ptr<IApplicableActionGenerator>, std::shared_ptr<StateRepository>, std::shared_ptr<IBrFSAlgorithmEventHandler>>());
 
+    // GBFS
+    py::enum_<HeuristicEvaluation>(m, "HeuristicEvaluation")
+        .value("EAGER", HeuristicEvaluation::EAGER)
+        .value("LAZY", HeuristicEvaluation::LAZY)
+        .export_values();
+    py::class_<GBFSAlgorithmOptions>(m, "GBFSAlgorithmOptions")
+        .def(py::init<double, double, HeuristicEvaluation, bool, int64_t>(),
+             py::arg("g_weight") = 0.,
+             py::arg("h_weight") = 1.,
+             py::arg("evaluation") = HeuristicEvaluation::EAGER,
+             py::arg("use_preferred_actions") = false,
+             py::arg("preferred_actions_boost") = 1000)
+        .def_readwrite("g_weight", &GBFSAlgorithmOptions::g_weight)
+        .def_readwrite("h_weight", &GBFSAlgorithmOptions::h_weight)
+        .def_readwrite("evaluation", &GBFSAlgorithmOptions::evaluation)
+        .def_readwrite("use_preferred_actions", &GBFSAlgorithmOptions::use_preferred_actions)
+        .def_readwrite("preferred_actions_boost", &GBFSAlgorithmOptions::preferred_actions_boost);
+    py::class_<GBFSAlgorithmStatistics>(m, "GBFSAlgorithmStatistics")  //
+        .def("get_num_generated", &GBFSAlgorithmStatistics::get_num_generated)
+        .def("get_num_expanded", &GBFSAlgorithmStatistics::get_num_expanded)
+        .def("get_num_evaluated", &GBFSAlgorithmStatistics::get_num_evaluated)
+        .def("get_num_deadends", &GBFSAlgorithmStatistics::get_num_deadends)
+        .def("get_num_pruned", &GBFSAlgorithmStatistics::get_num_pruned)
+        .def("get_h_values", &GBFSAlgorithmStatistics::get_h_values)
+        .def("get_num_generated_until_h_value", &GBFSAlgorithmStatistics::get_num_generated_until_h_value)
+        .def("get_num_expanded_until_h_value", &GBFSAlgorithmStatistics::get_num_expanded_until_h_value)
+        .def("get_num_evaluated_until_h_value", &GBFSAlgorithmStatistics::get_num_evaluated_until_h_value);
+    py::class_<IGBFSAlgorithmEventHandler, std::shared_ptr<IGBFSAlgorithmEventHandler>>(m, "IGBFSAlgorithmEventHandler")
+        .def("get_statistics", &IGBFSAlgorithmEventHandler::get_statistics);
+    py::class_<DefaultGBFSAlgorithmEventHandler, IGBFSAlgorithmEventHandler, std::shared_ptr<DefaultGBFSAlgorithmEventHandler>>(
+        m,
+        "DefaultGBFSAlgorithmEventHandler")  //
+        .def(py::init<>());
+    py::class_<DebugGBFSAlgorithmEventHandler, IGBFSAlgorithmEventHandler, std::shared_ptr<DebugGBFSAlgorithmEventHandler>>(
+        m,
+        "DebugGBFSAlgorithmEventHandler")  //
+        .def(py::init<>());
+    py::class_<GBFSAlgorithm, IAlgorithm, std::shared_ptr<GBFSAlgorithm>>(m, "GBFSAlgorithm")
+        .def(py::init<std::shared_ptr<IApplicableActionGenerator>, std::shared_ptr<IHeuristic>, GBFSAlgorithmOptions>(),
+             py::arg("applicable_action_generator"),
+             py::arg("heuristic"),
+             py::arg("options") = GBFSAlgorithmOptions())
+        .def(py::init<std::shared_ptr<IApplicableActionGenerator>,
+                      std::shared_ptr<StateRepository>,
+                      std::shared_ptr<IHeuristic>,
+                      std::shared_ptr<IGBFSAlgorithmEventHandler>,
+                      GBFSAlgorithmOptions>(),
+             py::arg("applicable_action_generator"),
+             py::arg("successor_state_generator"),
+             py::arg("heuristic"),
+             py::arg("event_handler"),
+             py::arg("options") = GBFSAlgorithmOptions())
+        .def("get_options", &GBFSAlgorithm::get_options, py::return_value_policy::copy);
+
+    // BFWS
+    py::class_<BFWSAlgorithmOptions>(m, "BFWSAlgorithmOptions")
+        .def(py::init<size_t, bool, size_t, NoveltyTableBackendType>(),
+             py::arg("max_arity") = 2,
+             py::arg("prune_non_novel_states") = false,
+             py::arg("max_novelty_table_memory_usage") = size_t(1) << 30,
+             py::arg("novelty_table_backend") = NoveltyTableBackendType::AUTOMATIC)
+        .def_readwrite("max_arity", &BFWSAlgorithmOptions::max_arity)
+        .def_readwrite("prune_non_novel_states", &BFWSAlgorithmOptions::prune_non_novel_states)
+        .def_readwrite("max_novelty_table_memory_usage", &BFWSAlgorithmOptions::max_novelty_table_memory_usage)
+        .def_readwrite("novelty_table_backend", &BFWSAlgorithmOptions::novelty_table_backend);
+    py::class_<BFWSAlgorithmStatistics>(m, "BFWSAlgorithmStatistics")  //
+        .def("get_num_generated", &BFWSAlgorithmStatistics::get_num_generated)
+        .def("get_num_expanded", &BFWSAlgorithmStatistics::get_num_expanded)
+        .def("get_num_evaluated", &BFWSAlgorithmStatistics::get_num_evaluated)
+        .def("get_num_pruned", &BFWSAlgorithmStatistics::get_num_pruned)
+        .def("get_num_created_novelty_tables", &BFWSAlgorithmStatistics::get_num_created_novelty_tables)
+        .def("get_num_evicted_novelty_tables", &BFWSAlgorithmStatistics::get_num_evicted_novelty_tables)
+        .def("get_peak_novelty_table_memory_usage", &BFWSAlgorithmStatistics::get_peak_novelty_table_memory_usage)
+        .def("get_num_evaluated_by_novelty", &BFWSAlgorithmStatistics::get_num_evaluated_by_novelty)
+        .def("get_goal_counts", &BFWSAlgorithmStatistics::get_goal_counts)
+        .def("get_num_generated_until_goal_count", &BFWSAlgorithmStatistics::get_num_generated_until_goal_count)
+        .def("get_num_expanded_until_goal_count", &BFWSAlgorithmStatistics::get_num_expanded_until_goal_count);
+    py::class_<IBFWSAlgorithmEventHandler, std::shared_ptr<IBFWSAlgorithmEventHandler>>(m, "IBFWSAlgorithmEventHandler")
+        .def("get_statistics", &IBFWSAlgorithmEventHandler::get_statistics);
+    py::class_<DefaultBFWSAlgorithmEventHandler, IBFWSAlgorithmEventHandler, std::shared_ptr<DefaultBFWSAlgorithmEventHandler>>(
+        m,
+        "DefaultBFWSAlgorithmEventHandler")  //
+        .def(py::init<>());
+    py::class_<DebugBFWSAlgorithmEventHandler, IBFWSAlgorithmEventHandler, std::shared_ptr<DebugBFWSAlgorithmEventHandler>>(
+        m,
+        "DebugBFWSAlgorithmEventHandler")  //
+        .def(py::init<>());
+    py::class_<BFWSAlgorithm, IAlgorithm, std::shared_ptr<BFWSAlgorithm>>(m, "BFWSAlgorithm")
+        .def(py::init<std::shared_ptr<IApplicableActionGenerator>, BFWSAlgorithmOptions>(),
+             py::arg("applicable_action_generator"),
+             py::arg("options") = BFWSAlgorithmOptions())
+        .def(py::init<std::shared_ptr<IApplicableActionGenerator>,
+                      std::shared_ptr<StateRepository>,
+                      std::shared_ptr<HFFHeuristic>,
+                      std::shared_ptr<IBFWSAlgorithmEventHandler>,
+                      BFWSAlgorithmOptions>(),
+             py::arg("applicable_action_generator"),
+             py::arg("successor_state_generator"),
+             py::arg("relaxed_plan_heuristic"),
+             py::arg("event_handler"),
+             py::arg("options") = BFWSAlgorithmOptions())
+        .def("get_options", &BFWSAlgorithm::get_options, py::return_value_policy::copy);
+
+    // HDAStar
+    py::class_<HDAStarAlgorithmOptions>(m, "HDAStarAlgorithmOptions")
+        .def(py::init<size_t, size_t>(), py::arg("num_threads") = std::thread::hardware_concurrency(), py::arg("message_batch_size") = 64)
+        .def_readwrite("num_threads", &HDAStarAlgorithmOptions::num_threads)
+        .def_readwrite("message_batch_size", &HDAStarAlgorithmOptions::message_batch_size);
+    py::class_<HDAStarAlgorithmStatistics>(m, "HDAStarAlgorithmStatistics")  //
+        .def("get_num_generated", &HDAStarAlgorithmStatistics::get_num_generated)
+        .def("get_num_expanded", &HDAStarAlgorithmStatistics::get_num_expanded)
+        .def("get_num_deadends", &HDAStarAlgorithmStatistics::get_num_deadends)
+        .def("get_num_sent_messages", &HDAStarAlgorithmStatistics::get_num_sent_messages)
+        .def("get_expansion_imbalance", &HDAStarAlgorithmStatistics::get_expansion_imbalance);
+    py::class_<IHDAStarAlgorithmEventHandler, std::shared_ptr<IHDAStarAlgorithmEventHandler>>(m, "IHDAStarAlgorithmEventHandler")
+        .def("get_statistics", &IHDAStarAlgorithmEventHandler::get_statistics);
+    py::class_<DefaultHDAStarAlgorithmEventHandler, IHDAStarAlgorithmEventHandler, std::shared_ptr<DefaultHDAStarAlgorithmEventHandler>>(
+        m,
+        "DefaultHDAStarAlgorithmEventHandler")  //
+        .def(py::init<>());
+    py::class_<DebugHDAStarAlgorithmEventHandler, IHDAStarAlgorithmEventHandler, std::shared_ptr<DebugHDAStarAlgorithmEventHandler>>(
+        m,
+        "DebugHDAStarAlgorithmEventHandler")  //
+        .def(py::init<>());
+    // The heuristics are evaluated by the worker threads without holding the GIL, hence, they must be implemented in C++.
+    py::class_<HDAStarAlgorithm, IAlgorithm, std::shared_ptr<HDAStarAlgorithm>>(m, "HDAStarAlgorithm")
+        .def(py::init<std::shared_ptr<GroundedApplicableActionGenerator>, HeuristicFactory, HDAStarAlgorithmOptions>(),
+             py::arg("applicable_action_generator"),
+             py::arg("heuristic_factory"),
+             py::arg("options") = HDAStarAlgorithmOptions())
+        .def(py::init<std::shared_ptr<GroundedApplicableActionGenerator>,
+                      HeuristicFactory,
+                      std::shared_ptr<IHDAStarAlgorithmEventHandler>,
+                      HDAStarAlgorithmOptions>(),
+             py::arg("applicable_action_generator"),
+             py::arg("heuristic_factory"),
+             py::arg("event_handler"),
+             py::arg("options") = HDAStarAlgorithmOptions())
+        .def("get_options", &HDAStarAlgorithm::get_options, py::return_value_policy::copy);
+
     // IW
     py::class_<TupleIndexMapper, std::shared_ptr<TupleIndexMapper>>(m, "TupleIndexMapper")  //
         .def("to_tuple_index", &TupleIndexMapper::to_tuple_index, py::arg("atom_indices"))
@@ -1295,20 +1529,51 @@ void init_pymimir(py::module_& m)
         .def("get_max_tuple_index", &TupleIndexMapper::get_max_tuple_index)
         .def("get_empty_tuple_index", &TupleIndexMapper::get_empty_tuple_index);
 
+    py::enum_<NoveltyTableBackendType>(m, "NoveltyTableBackendType")
+        .value("AUTOMATIC", NoveltyTableBackendType::AUTOMATIC)
+        .value("DENSE", NoveltyTableBackendType::DENSE)
+        .value("BLOCKED", NoveltyTableBackendType::BLOCKED)
+        .value("HASHED", NoveltyTableBackendType::HASHED)
+        .export_values();
+
+    py::class_<NoveltyTableStatistics>(m, "NoveltyTableStatistics")  //
+        .def("get_backend_type", &NoveltyTableStatistics::get_backend_type)
+        .def("get_num_tested_states", &NoveltyTableStatistics::get_num_tested_states)
+        .def("get_num_tested_tuple_indices", &NoveltyTableStatistics::get_num_tested_tuple_indices)
+        .def("get_num_novel_tuple_indices", &NoveltyTableStatistics::get_num_novel_tuple_indices)
+        .def("get_num_resizes", &NoveltyTableStatistics::get_num_resizes)
+        .def("get_peak_memory_usage", &NoveltyTableStatistics::get_peak_memory_usage)
+        .def("get_throughput", &NoveltyTableStatistics::get_throughput);
+
     py::class_<IWAlgorithmStatistics>(m, "IWAlgorithmStatistics")  //
         .def("get_effective_width", &IWAlgorithmStatistics::get_effective_width)
-        .def("get_brfs_statistics_by_arity", &IWAlgorithmStatistics::get_brfs_statistics_by_arity);
+        .def("get_brfs_statistics_by_arity", &IWAlgorithmStatistics::get_brfs_statistics_by_arity)
+        .def("get_novelty_table_statistics_by_arity", &IWAlgorithmStatistics::get_novelty_table_statistics_by_arity);
     py::class_<IIWAlgorithmEventHandler, std::shared_ptr<IIWAlgorithmEventHandler>>(m, "IIWAlgorithmEventHandler")
         .def("get_statistics", &IIWAlgorithmEventHandler::get_statistics);
     py::class_<DefaultIWAlgorithmEventHandler, IIWAlgorithmEventHandler, std::shared_ptr<DefaultIWAlgorithmEventHandler>>(m, "DefaultIWAlgorithmEventHandler")
         .def(py::init<>());
+    py::class_<IWAlgorithmOptions>(m, "IWAlgorithmOptions")
+        .def(py::init<bool>(), py::arg("incremental") = false)
+        .def_readwrite("incremental", &IWAlgorithmOptions::incremental);
     py::class_<IWAlgorithm, IAlgorithm, std::shared_ptr<IWAlgorithm>>(m, "IWAlgorithm")
-        .def(py::init<std::shared_ptr<IApplicableActionGenerator>, size_t>())
+        .def(py::init<std::shared_ptr<IApplicableActionGenerator>, size_t, IWAlgorithmOptions>(),
+             py::arg("applicable_action_generator"),
+             py::arg("max_arity"),
+             py::arg("options") = IWAlgorithmOptions())
         .def(py::init<std::shared_ptr<IApplicableActionGenerator>,
                       size_t,
                       std::shared_ptr<StateRepository>,
                       std::shared_ptr<IBrFSAlgorithmEventHandler>,
-                      std::shared_ptr<IIWAlgorithmEventHandler>>());
+                      std::shared_ptr<IIWAlgorithmEventHandler>,
+                      IWAlgorithmOptions>(),
+             py::arg("applicable_action_generator"),
+             py::arg("max_arity"),
+             py::arg("successor_state_generator"),
+             py::arg("brfs_event_handler"),
+             py::arg("iw_event_handler"),
+             py::arg("options") = IWAlgorithmOptions())
+        .def("get_options", &IWAlgorithm::get_options, py::return_value_policy::copy);
 
     // SIW
     py::class_<SIWAlgorithmStatistics>(m, "SIWAlgorithmStatistics")  //
@@ -1545,7 +1810,7 @@ void init_pymimir(py::module_& m)
 
     // Certificate
     py::class_<Certificate, std::shared_ptr<Certificate>>(m, "Certificate")
-        .def(py::init<size_t, size_t, std::string, ColorList>())
+        .def(py::init<size_t, size_t, NautyCertificate, ColorList>())
         .def("__eq__", &Certificate::operator==)
         .def("__hash__", [](const Certificate& self) { return std::hash<Certificate>()(self); })
         .def("get_num_vertices", &Certificate::get_num_vertices)
@@ -1979,7 +2244,7 @@ void init_pymimir(py::module_& m)
         .def("get_tuple_index", &TupleGraphVertex::get_tuple_index)
         .def(
             "get_states",
-            [](const TupleGraphVertex& self) { return StateList(self.get_states()); },
+            [](const TupleGraphVertex& self) { return StateList(self.get_states().begin(), self.get_states().end()); },
             py::keep_alive<0, 1>());
     bind_const_span<std::span<const TupleGraphVertex>>(m, "TupleGraphVertexSpan");
     bind_const_index_grouped_vector<IndexGroupedVector<const TupleGraphVertex>>(m, "TupleGraphVertexIndexGroupedVector");
@@ -2001,12 +2266,14 @@ void init_pymimir(py::module_& m)
         .def("get_root_state", &TupleGraph::get_root_state, py::keep_alive<0, 1>())
         .def("get_vertices_grouped_by_distance", &TupleGraph::get_vertices_grouped_by_distance, py::return_value_policy::reference_internal)
         .def("get_digraph", &TupleGraph::get_digraph, py::return_value_policy::reference_internal)
-        .def("get_states_grouped_by_distance", &TupleGraph::get_states_grouped_by_distance, py::return_value_policy::reference_internal);
+        .def("get_states_grouped_by_distance", &TupleGraph::get_states_grouped_by_distance, py::return_value_policy::reference_internal)
+        .def("get_states_grouped_by_vertex", &TupleGraph::get_states_grouped_by_vertex, py::return_value_policy::reference_internal);
 
     // TupleGraphFactory
     py::class_<TupleGraphFactory>(m, "TupleGraphFactory")  //
         .def(py::init<std::shared_ptr<StateSpace>, int, bool>(), py::arg("state_space"), py::arg("arity"), py::arg("prune_dominated_tuples") = false)
-        .def("create", &TupleGraphFactory::create)
+        .def("create", &TupleGraphFactory::create, py::arg("root_state"), py::arg("num_threads") = 1)
+        .def("create_all", &TupleGraphFactory::create_all, py::arg("root_states"), py::arg("num_threads") = std::thread::hardware_concurrency())
         .def("get_state_space", &TupleGraphFactory::get_state_space)
         .def("get_tuple_index_mapper", &TupleGraphFactory::get_tuple_index_mapper);
 
@@ -70,7 +70,7 @@ void DenseGraph::add_vertex_coloring(const mimir::ColorList& vertex_coloring) {
 
 void DenseGraph::add_edge(size_t source, size_t target) { m_impl->add_edge(source, target); }
 
-std::string DenseGraph::compute_certificate() const { return m_impl->compute_certificate(); }
+const mimir::NautyCertificate& DenseGraph::compute_certificate() const { return m_impl->compute_certificate(); }
 
 void DenseGraph::clear(size_t num_vertices) { m_impl->clear(num_vertices); }
 
@@ -120,7 +120,7 @@ void SparseGraph::add_vertex_coloring(const mimir::ColorList& vertex_coloring) {
 
 void SparseGraph::add_edge(size_t source, size_t target) { m_impl->add_edge(source, target); }
 
-std::string SparseGraph::compute_certificate() { return m_impl->compute_certificate(); }
+const mimir::NautyCertificate& SparseGraph::compute_certificate() { return m_impl->compute_certificate(); }
 
 void SparseGraph::clear(size_t num_vertices) { m_impl->clear(num_vertices); }
 
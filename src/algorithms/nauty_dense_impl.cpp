@@ -19,12 +19,8 @@
 
 #include "nauty_utils.hpp"
 
-#include <boost/iostreams/copy.hpp>
-#include <boost/iostreams/filter/gzip.hpp>
-#include <boost/iostreams/filtering_stream.hpp>
 #include <cassert>
 #include <iostream>
-#include <sstream>
 #include <stdexcept>
 
 namespace nauty_wrapper
@@ -56,7 +52,9 @@ DenseGraphImpl::DenseGraphImpl(size_t num_vertices) :
     use_default_ptn_(true),
     lab_(n_),
     ptn_(n_),
-    canon_graph_(nullptr)
+    orbits_(n_),
+    canon_graph_(nullptr),
+    certificate_()
 {
     allocate_graph(&graph_);
     allocate_graph(&canon_graph_);
@@ -70,13 +68,10 @@ DenseGraphImpl::DenseGraphImpl(const DenseGraphImpl& other) :
     use_default_ptn_(other.use_default_ptn_),
     lab_(other.lab_),
     ptn_(other.ptn_),
+    orbits_(other.orbits_),
     canon_graph_(nullptr),
-    canon_graph_repr_(),
-    canon_graph_compressed_repr_()
+    certificate_(other.certificate_)
 {
-    canon_graph_repr_.str(other.canon_graph_repr_.str());
-    canon_graph_compressed_repr_.str(other.canon_graph_compressed_repr_.str());
-
     allocate_graph(&graph_);
     allocate_graph(&canon_graph_);
     std::copy(other.graph_, other.graph_ + m_ * n_, graph_);
@@ -96,8 +91,8 @@ DenseGraphImpl& DenseGraphImpl::operator=(const DenseGraphImpl& other)
         use_default_ptn_ = other.use_default_ptn_;
         lab_ = other.lab_;
         ptn_ = other.ptn_;
-        canon_graph_repr_.str(other.canon_graph_repr_.str());
-        canon_graph_compressed_repr_.str(other.canon_graph_compressed_repr_.str());
+        orbits_ = other.orbits_;
+        certificate_ = other.certificate_;
 
         allocate_graph(&graph_);
         allocate_graph(&canon_graph_);
@@ -116,9 +111,9 @@ DenseGraphImpl::DenseGraphImpl(DenseGraphImpl&& other) noexcept :
     use_default_ptn_(other.use_default_ptn_),
     lab_(std::move(other.lab_)),
     ptn_(std::move(other.ptn_)),
+    orbits_(std::move(other.orbits_)),
     canon_graph_(other.canon_graph_),
-    canon_graph_repr_(std::move(other.canon_graph_repr_)),
-    canon_graph_compressed_repr_(std::move(other.canon_graph_compressed_repr_))
+    certificate_(std::move(other.certificate_))
 {
     other.graph_ = nullptr;
     other.canon_graph_ = nullptr;
@@ -138,9 +133,9 @@ DenseGraphImpl& DenseGraphImpl::operator=(DenseGraphImpl&& other) noexcept
         use_default_ptn_ = other.use_default_ptn_;
         lab_ = std::move(other.lab_);
         ptn_ = std::move(other.ptn_);
+        orbits_ = std::move(other.orbits_);
         canon_graph_ = other.canon_graph_;
-        canon_graph_repr_ = std::move(other.canon_graph_repr_);
-        canon_graph_compressed_repr_ = std::move(other.canon_graph_compressed_repr_);
+        certificate_ = std::move(other.certificate_);
 
         other.graph_ = nullptr;
         other.canon_graph_ = nullptr;
@@ -173,8 +168,16 @@ void DenseGraphImpl::add_edge(size_t source, size_t target)
     ADDONEARC0(graph_, source, target, m_);
 }
 
-std::string DenseGraphImpl::compute_certificate()
+const mimir::NautyCertificate& DenseGraphImpl::compute_certificate()
 {
+    certificate_.clear();
+
+    if (n_ == 0)
+    {
+        // The canonical graph of the empty graph is empty.
+        return certificate_;
+    }
+
     const auto is_directed_ = is_directed();
     const auto has_loop_ = has_loop();
 
@@ -189,34 +192,23 @@ std::string DenseGraphImpl::compute_certificate()
     options.digraph = is_directed_;
     options.writeautoms = FALSE;
 
-    int orbits[n_];
-
     statsblk stats;
 
-    densenauty(graph_, lab_.data(), ptn_.data(), orbits, &options, &stats, m_, n_, canon_graph_);
-
-    // Clear streams
-    canon_graph_repr_.str(std::string());
-    canon_graph_repr_.clear();
-    canon_graph_compressed_repr_.str(std::string());
-    canon_graph_compressed_repr_.clear();
+    densenauty(graph_, lab_.data(), ptn_.data(), orbits_.data(), &options, &stats, m_, n_, canon_graph_);
 
-    // Compute conon graph repr.
-    for (size_t i = 0; i < n_ * m_; ++i)
+    // Write the degrees followed by the sorted adjacency lists in the order of the vertices.
+    certificate_.resize(n_, 0);
+    for (size_t source = 0; source < n_; ++source)
     {
-        canon_graph_repr_ << canon_graph_[i] << " ";
+        set* source_row = GRAPHROW(canon_graph_, source, m_);
+        for (int target = nextelement(source_row, m_, -1); target >= 0; target = nextelement(source_row, m_, target))
+        {
+            certificate_.push_back(target);
+            ++certificate_[source];
+        }
     }
 
-    // Compress canon graph repr.
-    boost::iostreams::filtering_ostream boost_filtering_ostream;
-    boost_filtering_ostream.push(boost::iostreams::gzip_compressor());
-    boost_filtering_ostream.push(canon_graph_compressed_repr_);
-    boost::iostreams::copy(canon_graph_repr_, boost_filtering_ostream);
-    boost::iostreams::close(boost_filtering_ostream);
-    // We usually see compression ratio ~ 2
-    // std::cout << "Compression ratio: " << (double) canon_graph_repr_.str().size() / canon_graph_compressed_repr_.str().size() << std::endl;
-
-    return canon_graph_compressed_repr_.str();
+    return certificate_;
 }
 
 void DenseGraphImpl::clear(size_t num_vertices)
@@ -234,6 +226,7 @@ void DenseGraphImpl::clear(size_t num_vertices)
         c_ = num_vertices;
         lab_ = std::vector<int>(c_);
         ptn_ = std::vector<int>(c_);
+        orbits_ = std::vector<int>(c_);
 
         allocate_graph(&graph_);
         allocate_graph(&canon_graph_);
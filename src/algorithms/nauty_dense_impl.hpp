@@ -22,8 +22,6 @@
 #include "mimir/graphs/declarations.hpp"
 
 #include <nauty.h>
-#include <sstream>
-#include <string>
 #include <vector>
 
 namespace nauty_wrapper
@@ -42,12 +40,12 @@ private:
     bool use_default_ptn_;
     std::vector<int> lab_;
     std::vector<int> ptn_;
+    std::vector<int> orbits_;
     // The canonical graph
     graph* canon_graph_;
 
-    // Output streams
-    std::stringstream canon_graph_repr_;
-    std::stringstream canon_graph_compressed_repr_;
+    // The certificate, its memory is reused.
+    mimir::NautyCertificate certificate_;
 
     void allocate_graph(graph** out_graph);
     void deallocate_graph(graph* out_graph);
@@ -64,7 +62,7 @@ public:
 
     void add_vertex_coloring(const mimir::ColorList& vertex_coloring);
 
-    std::string compute_certificate();
+    const mimir::NautyCertificate& compute_certificate();
 
     void clear(size_t num_vertices);
 
@@ -20,155 +20,124 @@
 #include "nauty_utils.hpp"
 
 #include <algorithm>
-#include <boost/iostreams/copy.hpp>
-#include <boost/iostreams/filter/gzip.hpp>
-#include <boost/iostreams/filtering_stream.hpp>
 #include <iostream>
-#include <sstream>
 #include <stdexcept>
 
 namespace nauty_wrapper
 {
 
-void SparseGraphImpl::copy_graph_data(const sparsegraph& in_graph, sparsegraph& out_graph) const
+void SparseGraphImpl::initialize_graph_data()
 {
-    std::copy(in_graph.v, in_graph.v + n_, out_graph.v);
-    std::copy(in_graph.d, in_graph.d + n_, out_graph.d);
-    std::copy(in_graph.e, in_graph.e + in_graph.nde, out_graph.e);
-    out_graph.nde = in_graph.nde;
-}
-
-void SparseGraphImpl::initialize_graph_data(sparsegraph& out_graph) const
-{
-    out_graph.nv = n_;
-    out_graph.nde = 0;  // No edges yet
-    std::fill(out_graph.d, out_graph.d + n_, 0);
+    std::sort(edges_.begin(), edges_.end());
+    edges_.erase(std::unique(edges_.begin(), edges_.end()), edges_.end());
+
+    // Grow the graphs to the number of edges, at least one to never pass null pointers to nauty.
+    const auto num_allocated_edges = std::max(edges_.size(), size_t(1));
+    SG_ALLOC(graph_, n_, num_allocated_edges, "SparseGraphImpl::initialize_graph_data");
+    SG_ALLOC(canon_graph_, n_, num_allocated_edges, "SparseGraphImpl::initialize_graph_data");
+
+    // The edges are sorted by source, hence, the adjacency lists are contiguous and sorted.
+    graph_.nv = n_;
+    graph_.nde = edges_.size();
+    std::fill(graph_.d, graph_.d + n_, 0);
+    for (size_t i = 0; i < edges_.size(); ++i)
+    {
+        graph_.e[i] = edges_[i].second;
+        ++graph_.d[edges_[i].first];
+    }
+    size_t offset = 0;
     for (size_t i = 0; i < n_; ++i)
     {
-        out_graph.v[i] = i * n_;
+        graph_.v[i] = offset;
+        offset += graph_.d[i];
     }
-    std::fill(out_graph.e, out_graph.e + n_ * n_, 0);
 }
 
-void SparseGraphImpl::allocate_graph(sparsegraph& out_graph) const
+bool SparseGraphImpl::is_directed(const std::vector<Edge>& sorted_edges)
 {
-    if (n_ > 0)
-    {
-        // Allocate the sparse graph structure, assuming a complete graph
-        SG_INIT(out_graph);
-        SG_ALLOC(out_graph, n_, n_ * n_, "malloc");
-    }
-    else
-    {
-        // Initialize lengths to zero when n is zero
-        out_graph.vlen = 0;
-        out_graph.dlen = 0;
-        out_graph.elen = 0;
-    }
-
-    initialize_graph_data(out_graph);
+    return std::any_of(sorted_edges.begin(),
+                       sorted_edges.end(),
+                       [&sorted_edges](const Edge& edge)
+                       { return !std::binary_search(sorted_edges.begin(), sorted_edges.end(), Edge(edge.second, edge.first)); });
 }
 
-void SparseGraphImpl::deallocate_graph(sparsegraph& the_graph) const
+bool SparseGraphImpl::has_loop(const std::vector<Edge>& edges)
 {
-    if (c_ > 0)
-    {
-        // Deallocate the sparse graph structure
-        SG_FREE(the_graph);
-    }
+    return std::any_of(edges.begin(), edges.end(), [](const Edge& edge) { return edge.first == edge.second; });
 }
 
 SparseGraphImpl::SparseGraphImpl(size_t num_vertices) :
     n_(num_vertices),
-    c_(n_),
-    adj_matrix_(c_ * c_, false),
+    edges_(),
     use_default_ptn_(true),
-    lab_(c_),
-    ptn_(c_),
-    canon_graph_repr_(),
-    canon_graph_compressed_repr_()
+    lab_(n_),
+    ptn_(n_),
+    orbits_(n_),
+    certificate_()
 {
-    allocate_graph(graph_);
-    allocate_graph(canon_graph_);
+    SG_INIT(graph_);
+    SG_INIT(canon_graph_);
 }
 
+// The nauty graphs are recomputed from the edges in each call to compute_certificate, hence, they are not copied.
+
 SparseGraphImpl::SparseGraphImpl(const SparseGraphImpl& other) :
     n_(other.n_),
-    c_(other.c_),
-    adj_matrix_(other.adj_matrix_),
+    edges_(other.edges_),
     use_default_ptn_(other.use_default_ptn_),
     lab_(other.lab_),
     ptn_(other.ptn_),
-    canon_graph_repr_(),
-    canon_graph_compressed_repr_()
+    orbits_(other.orbits_),
+    certificate_(other.certificate_)
 {
-    canon_graph_repr_.str(other.canon_graph_repr_.str());
-    canon_graph_compressed_repr_.str(other.canon_graph_compressed_repr_.str());
-
-    allocate_graph(graph_);
-    allocate_graph(canon_graph_);
-
-    copy_graph_data(other.graph_, graph_);
-    copy_graph_data(other.canon_graph_, canon_graph_);
+    SG_INIT(graph_);
+    SG_INIT(canon_graph_);
 }
 
 SparseGraphImpl& SparseGraphImpl::operator=(const SparseGraphImpl& other)
 {
     if (this != &other)
     {
-        deallocate_graph(graph_);
-        deallocate_graph(canon_graph_);
-
         n_ = other.n_;
-        c_ = other.c_;
-        adj_matrix_ = other.adj_matrix_;
+        edges_ = other.edges_;
         use_default_ptn_ = other.use_default_ptn_;
         lab_ = other.lab_;
         ptn_ = other.ptn_;
-        canon_graph_repr_.str(other.canon_graph_repr_.str());
-        canon_graph_compressed_repr_.str(other.canon_graph_compressed_repr_.str());
-
-        allocate_graph(graph_);
-        allocate_graph(canon_graph_);
-
-        copy_graph_data(other.graph_, graph_);
-        copy_graph_data(other.canon_graph_, canon_graph_);
+        orbits_ = other.orbits_;
+        certificate_ = other.certificate_;
     }
     return *this;
 }
 
 SparseGraphImpl::SparseGraphImpl(SparseGraphImpl&& other) noexcept :
     n_(other.n_),
-    c_(other.c_),
-    adj_matrix_(other.adj_matrix_),
+    edges_(std::move(other.edges_)),
     graph_(other.graph_),
     use_default_ptn_(other.use_default_ptn_),
     lab_(std::move(other.lab_)),
     ptn_(std::move(other.ptn_)),
+    orbits_(std::move(other.orbits_)),
     canon_graph_(other.canon_graph_),
-    canon_graph_repr_(std::move(other.canon_graph_repr_)),
-    canon_graph_compressed_repr_(std::move(other.canon_graph_compressed_repr_))
+    certificate_(std::move(other.certificate_))
 {
     SG_INIT(other.graph_);
     SG_INIT(other.canon_graph_);
 }
 
 SparseGraphImpl& SparseGraphImpl::operator=(SparseGraphImpl&& other) noexcept
-
 {
     if (this != &other)
     {
-        deallocate_graph(graph_);
-        deallocate_graph(canon_graph_);
+        SG_FREE(graph_);
+        SG_FREE(canon_graph_);
 
         n_ = other.n_;
-        c_ = other.c_;
-        adj_matrix_ = other.adj_matrix_;
+        edges_ = std::move(other.edges_);
         use_default_ptn_ = other.use_default_ptn_;
         lab_ = std::move(other.lab_);
         ptn_ = std::move(other.ptn_);
-        canon_graph_repr_ = std::move(other.canon_graph_repr_);
-        canon_graph_compressed_repr_ = std::move(other.canon_graph_compressed_repr_);
+        orbits_ = std::move(other.orbits_);
+        certificate_ = std::move(other.certificate_);
 
         graph_ = other.graph_;
         SG_INIT(other.graph_);
@@ -181,8 +150,8 @@ SparseGraphImpl& SparseGraphImpl::operator=(SparseGraphImpl&& other) noexcept
 
 SparseGraphImpl::~SparseGraphImpl()
 {
-    deallocate_graph(graph_);
-    deallocate_graph(canon_graph_);
+    SG_FREE(graph_);
+    SG_FREE(canon_graph_);
 }
 
 void SparseGraphImpl::add_vertex_coloring(const mimir::ColorList& vertex_coloring)
@@ -202,20 +171,23 @@ void SparseGraphImpl::add_edge(size_t source, size_t target)
         throw std::out_of_range("SparseGraphImpl::add_edge: Source or target vertex out of range.");
     }
 
-    if (!adj_matrix_.at(source * n_ + target))
-    {
-        adj_matrix_.at(source * n_ + target) = true;
-
-        graph_.e[source * n_ + graph_.d[source]] = target;
-        ++graph_.d[source];
-        ++graph_.nde;
-    }
+    edges_.emplace_back(source, target);
 }
 
-std::string SparseGraphImpl::compute_certificate()
+const mimir::NautyCertificate& SparseGraphImpl::compute_certificate()
 {
-    bool is_directed_ = is_directed();
-    bool has_loop_ = has_loop();
+    certificate_.clear();
+
+    if (n_ == 0)
+    {
+        // The canonical graph of the empty graph is empty.
+        return certificate_;
+    }
+
+    initialize_graph_data();
+
+    bool is_directed_ = is_directed(edges_);
+    bool has_loop_ = has_loop(edges_);
 
     if (!is_directed_ && has_loop_)
     {
@@ -228,97 +200,46 @@ std::string SparseGraphImpl::compute_certificate()
     options.digraph = is_directed_;
     options.writeautoms = FALSE;
 
-    int orbits[n_];
-
     statsblk stats;
 
-    std::fill(canon_graph_.d, canon_graph_.d + n_, 0);
-    std::fill(canon_graph_.v, canon_graph_.v + n_, 0);
-    std::fill(canon_graph_.e, canon_graph_.e + n_ * n_, 0);
-
-    sparsenauty(&graph_, lab_.data(), ptn_.data(), orbits, &options, &stats, &canon_graph_);
+    sparsenauty(&graph_, lab_.data(), ptn_.data(), orbits_.data(), &options, &stats, &canon_graph_);
 
     // According to documentation:
     //   canon_graph has contiguous adjacency lists that are not necessarily sorted
     sortlists_sg(&canon_graph_);
 
-    // Clear streams
-    canon_graph_repr_.str(std::string());
-    canon_graph_repr_.clear();
-    canon_graph_compressed_repr_.str(std::string());
-    canon_graph_compressed_repr_.clear();
-
-    // Compute conon graph repr.
-    canon_graph_repr_ << canon_graph_;
-
-    // Compress canon graph repr.
-    boost::iostreams::filtering_ostream boost_filtering_ostream;
-    boost_filtering_ostream.push(boost::iostreams::gzip_compressor());
-    boost_filtering_ostream.push(canon_graph_compressed_repr_);
-    boost::iostreams::copy(canon_graph_repr_, boost_filtering_ostream);
-    boost::iostreams::close(boost_filtering_ostream);
-    // We usually see compression ratio ~ 2
-    // std::cout << "Compression ratio: " << (double) canon_graph_repr_.str().size() / canon_graph_compressed_repr_.str().size() << std::endl;
-
-    return canon_graph_compressed_repr_.str();
+    // Write the degrees followed by the adjacency lists in the order of the vertices.
+    certificate_.reserve(n_ + canon_graph_.nde);
+    certificate_.insert(certificate_.end(), canon_graph_.d, canon_graph_.d + n_);
+    for (size_t i = 0; i < n_; ++i)
+    {
+        const auto adjacency_list_begin = canon_graph_.e + canon_graph_.v[i];
+        certificate_.insert(certificate_.end(), adjacency_list_begin, adjacency_list_begin + canon_graph_.d[i]);
+    }
+
+    return certificate_;
 }
 
 void SparseGraphImpl::clear(size_t num_vertices)
 {
     use_default_ptn_ = true;
 
-    if (num_vertices > c_)
-    {
-        /* Reallocate memory. */
-        deallocate_graph(graph_);
-        deallocate_graph(canon_graph_);
-
-        n_ = num_vertices;
-        c_ = num_vertices;
-        lab_ = std::vector<int>(c_);
-        ptn_ = std::vector<int>(c_);
-        adj_matrix_ = std::vector<bool>(c_ * c_, false);
-
-        allocate_graph(graph_);
-        allocate_graph(canon_graph_);
-    }
-    else
-    {
-        /* Reuse memory. */
-        n_ = num_vertices;
-        std::fill(adj_matrix_.begin(), adj_matrix_.begin() + n_ * n_, false);
-
-        initialize_graph_data(graph_);
-        initialize_graph_data(canon_graph_);
-    }
+    // The memory of the vectors and the nauty graphs is reused.
+    n_ = num_vertices;
+    edges_.clear();
+    lab_.resize(n_);
+    ptn_.resize(n_);
+    orbits_.resize(n_);
 }
 
 bool SparseGraphImpl::is_directed() const
 {
-    for (size_t source = 0; source < n_; ++source)
-    {
-        for (size_t target = source + 1; target < n_; ++target)
-        {
-            if (adj_matrix_.at(source * n_ + target) != adj_matrix_.at(target * n_ + source))
-            {
-                return true;
-            }
-        }
-    }
-    return false;
+    auto sorted_edges = edges_;
+    std::sort(sorted_edges.begin(), sorted_edges.end());
+    return is_directed(sorted_edges);
 }
 
-bool SparseGraphImpl::has_loop() const
-{
-    for (size_t source = 0; source < n_; ++source)
-    {
-        if (adj_matrix_.at(source * n_ + source))
-        {
-            return true;
-        }
-    }
-    return false;
-}
+bool SparseGraphImpl::has_loop() const { return has_loop(edges_); }
 
 std::ostream& operator<<(std::ostream& out, const sparsegraph& graph)
 {
@@ -23,8 +23,8 @@
 
 #include <nausparse.h>
 #include <nauty.h>
-#include <sstream>
-#include <string>
+#include <ostream>
+#include <utility>
 #include <vector>
 
 namespace nauty_wrapper
@@ -32,31 +32,30 @@ namespace nauty_wrapper
 class SparseGraphImpl
 {
 private:
+    using Edge = std::pair<int, int>;
+
     // num_vertices
     size_t n_;
-    // vertex capacity
-    size_t c_;
-    // Track existing edges to avoid duplicates
-    std::vector<bool> adj_matrix_;
+    // The edges of the input graph, duplicates are removed when computing the certificate.
+    std::vector<Edge> edges_;
 
-    // The input graph
+    // The input graph, its memory is sized by the number of edges and reused.
     sparsegraph graph_;
     bool use_default_ptn_;
     std::vector<int> lab_;
     std::vector<int> ptn_;
-    // The canonical graph
+    std::vector<int> orbits_;
+    // The canonical graph, its memory is sized by the number of edges and reused.
     sparsegraph canon_graph_;
 
-    // Output streams
-    std::stringstream canon_graph_repr_;
-    std::stringstream canon_graph_compressed_repr_;
-
-    void copy_graph_data(const sparsegraph& in_graph, sparsegraph& out_graph) const;
+    // The certificate, its memory is reused.
+    mimir::NautyCertificate certificate_;
 
-    void initialize_graph_data(sparsegraph& out_graph) const;
+    /// @brief Sort the edges, remove duplicates, and store them in the input graph.
+    void initialize_graph_data();
 
-    void allocate_graph(sparsegraph& out_graph) const;
-    void deallocate_graph(sparsegraph& the_graph) const;
+    static bool is_directed(const std::vector<Edge>& sorted_edges);
+    static bool has_loop(const std::vector<Edge>& edges);
 
 public:
     explicit SparseGraphImpl(size_t num_vertices);
@@ -70,7 +69,7 @@ public:
 
     void add_vertex_coloring(const mimir::ColorList& vertex_coloring);
 
-    std::string compute_certificate();
+    const mimir::NautyCertificate& compute_certificate();
 
     void clear(size_t num_vertices);
 
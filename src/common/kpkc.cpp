@@ -17,7 +17,15 @@
 
 #include "mimir/algorithms/kpkc.hpp"
 
+#include <algorithm>
+#include <bit>
 #include <limits>
+#include <stdexcept>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define MIMIR_KPKC_X86_KERNELS
+#include <immintrin.h>
+#endif
 
 namespace mimir
 {
@@ -138,4 +146,370 @@ void find_all_k_cliques_in_k_partite_graph(const std::vector<boost::dynamic_bits
                                                  out_cliques);
 }
 
+/**
+ * Kernels
+ */
+
+using Block = KPartiteGraph::Block;
+
+static void and_blocks_scalar(Block* out, const Block* lhs, const Block* rhs, size_t num_blocks)
+{
+    for (size_t i = 0; i < num_blocks; ++i)
+    {
+        out[i] = lhs[i] & rhs[i];
+    }
+}
+
+static size_t popcount_blocks_scalar(const Block* blocks, size_t num_blocks)
+{
+    size_t count = 0;
+    for (size_t i = 0; i < num_blocks; ++i)
+    {
+        count += std::popcount(blocks[i]);
+    }
+    return count;
+}
+
+#ifdef MIMIR_KPKC_X86_KERNELS
+
+__attribute__((target("avx2"))) static void and_blocks_avx2(Block* out, const Block* lhs, const Block* rhs, size_t num_blocks)
+{
+    size_t i = 0;
+    for (; i + 4 <= num_blocks; i += 4)
+    {
+        const auto lhs_vector = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lhs + i));
+        const auto rhs_vector = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rhs + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_and_si256(lhs_vector, rhs_vector));
+    }
+    for (; i < num_blocks; ++i)
+    {
+        out[i] = lhs[i] & rhs[i];
+    }
+}
+
+/// @brief Count the bits with a nibble lookup table and sum the bytes with SAD (Mula et al.).
+__attribute__((target("avx2,popcnt"))) static size_t popcount_blocks_avx2(const Block* blocks, size_t num_blocks)
+{
+    const auto lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const auto low_mask = _mm256_set1_epi8(0x0f);
+
+    auto accumulator = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 4 <= num_blocks; i += 4)
+    {
+        const auto vector = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(blocks + i));
+        const auto low = _mm256_and_si256(vector, low_mask);
+        const auto high = _mm256_and_si256(_mm256_srli_epi16(vector, 4), low_mask);
+        const auto counts = _mm256_add_epi8(_mm256_shuffle_epi8(lookup, low), _mm256_shuffle_epi8(lookup, high));
+        accumulator = _mm256_add_epi64(accumulator, _mm256_sad_epu8(counts, _mm256_setzero_si256()));
+    }
+
+    size_t count = static_cast<size_t>(_mm256_extract_epi64(accumulator, 0)) + static_cast<size_t>(_mm256_extract_epi64(accumulator, 1))
+                   + static_cast<size_t>(_mm256_extract_epi64(accumulator, 2)) + static_cast<size_t>(_mm256_extract_epi64(accumulator, 3));
+    for (; i < num_blocks; ++i)
+    {
+        count += _mm_popcnt_u64(blocks[i]);
+    }
+    return count;
+}
+
+__attribute__((target("avx512f"))) static void and_blocks_avx512(Block* out, const Block* lhs, const Block* rhs, size_t num_blocks)
+{
+    size_t i = 0;
+    for (; i + 8 <= num_blocks; i += 8)
+    {
+        const auto lhs_vector = _mm512_loadu_si512(lhs + i);
+        const auto rhs_vector = _mm512_loadu_si512(rhs + i);
+        _mm512_storeu_si512(out + i, _mm512_and_si512(lhs_vector, rhs_vector));
+    }
+    for (; i < num_blocks; ++i)
+    {
+        out[i] = lhs[i] & rhs[i];
+    }
+}
+
+__attribute__((target("avx512f,avx512vpopcntdq,popcnt"))) static size_t popcount_blocks_avx512(const Block* blocks, size_t num_blocks)
+{
+    auto accumulator = _mm512_set1_epi64(0);
+    size_t i = 0;
+    for (; i + 8 <= num_blocks; i += 8)
+    {
+        accumulator = _mm512_add_epi64(accumulator, _mm512_popcnt_epi64(_mm512_loadu_si512(blocks + i)));
+    }
+
+    alignas(64) Block lanes[8];
+    _mm512_store_si512(lanes, accumulator);
+    size_t count = 0;
+    for (const auto lane : lanes)
+    {
+        count += lane;
+    }
+    for (; i < num_blocks; ++i)
+    {
+        count += _mm_popcnt_u64(blocks[i]);
+    }
+    return count;
+}
+
+#endif
+
+bool is_supported(KPKCInstructionSet instruction_set)
+{
+    switch (instruction_set)
+    {
+        case KPKCInstructionSet::SCALAR:
+        {
+            return true;
+        }
+#ifdef MIMIR_KPKC_X86_KERNELS
+        case KPKCInstructionSet::AVX2:
+        {
+            return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt");
+        }
+        case KPKCInstructionSet::AVX512:
+        {
+            return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512vpopcntdq") && __builtin_cpu_supports("popcnt");
+        }
+#endif
+        default:
+        {
+            return false;
+        }
+    }
+}
+
+KPKCInstructionSet get_best_kpkc_instruction_set()
+{
+    static const auto best_instruction_set = []
+    {
+        if (is_supported(KPKCInstructionSet::AVX512))
+        {
+            return KPKCInstructionSet::AVX512;
+        }
+        if (is_supported(KPKCInstructionSet::AVX2))
+        {
+            return KPKCInstructionSet::AVX2;
+        }
+        return KPKCInstructionSet::SCALAR;
+    }();
+
+    return best_instruction_set;
+}
+
+/**
+ * KPartiteGraph
+ */
+
+KPartiteGraph::KPartiteGraph(std::vector<std::vector<size_t>> partitions, KPKCInstructionSet instruction_set) :
+    m_partitions(std::move(partitions)),
+    m_num_vertices(0),
+    m_k(m_partitions.size()),
+    m_partition_block_offsets(),
+    m_partition_num_blocks(),
+    m_vertex_partitions(),
+    m_vertex_positions(),
+    m_row_num_blocks(0),
+    m_adjacency_matrix(),
+    m_and_kernel(and_blocks_scalar),
+    m_popcount_kernel(popcount_blocks_scalar),
+    m_compatible_vertices(),
+    m_num_compatible_vertices(),
+    m_partition_used(),
+    m_partial_solution()
+{
+    if (!is_supported(instruction_set))
+    {
+        throw std::runtime_error("KPartiteGraph::KPartiteGraph: instruction set is not supported by the CPU.");
+    }
+#ifdef MIMIR_KPKC_X86_KERNELS
+    if (instruction_set == KPKCInstructionSet::AVX2)
+    {
+        m_and_kernel = and_blocks_avx2;
+        m_popcount_kernel = popcount_blocks_avx2;
+    }
+    else if (instruction_set == KPKCInstructionSet::AVX512)
+    {
+        m_and_kernel = and_blocks_avx512;
+        m_popcount_kernel = popcount_blocks_avx512;
+    }
+#endif
+
+    /* 1. Compute the layout of the rows, each partition starts at a block boundary. */
+
+    constexpr size_t block_size = std::numeric_limits<Block>::digits;
+    constexpr size_t row_alignment = 64 / sizeof(Block);
+
+    for (size_t partition = 0; partition < m_k; ++partition)
+    {
+        const auto& vertices = m_partitions[partition];
+
+        m_partition_block_offsets.push_back(m_row_num_blocks);
+        m_partition_num_blocks.push_back((vertices.size() + block_size - 1) / block_size);
+        m_row_num_blocks += m_partition_num_blocks.back();
+
+        for (size_t position = 0; position < vertices.size(); ++position)
+        {
+            const auto vertex = vertices[position];
+            if (vertex >= m_vertex_partitions.size())
+            {
+                m_vertex_partitions.resize(vertex + 1, std::numeric_limits<size_t>::max());
+                m_vertex_positions.resize(vertex + 1, std::numeric_limits<size_t>::max());
+            }
+            m_vertex_partitions[vertex] = partition;
+            m_vertex_positions[vertex] = position;
+        }
+    }
+    m_num_vertices = m_vertex_partitions.size();
+    m_row_num_blocks = (m_row_num_blocks + row_alignment - 1) / row_alignment * row_alignment;
+
+    /* 2. Allocate the adjacency matrix and the scratch buffers. */
+
+    m_adjacency_matrix.resize(m_num_vertices * m_row_num_blocks, 0);
+    m_compatible_vertices.resize(m_k * m_row_num_blocks, 0);
+    m_num_compatible_vertices.resize(m_k * m_k, 0);
+    m_partition_used.resize(m_k, false);
+    m_partial_solution.reserve(m_k);
+}
+
+void KPartiteGraph::reset() { std::fill(m_adjacency_matrix.begin(), m_adjacency_matrix.end(), Block(0)); }
+
+void KPartiteGraph::add_edge(size_t source, size_t target)
+{
+    constexpr size_t block_size = std::numeric_limits<Block>::digits;
+
+    const auto set_bit = [&](size_t row, size_t vertex)
+    {
+        const auto position = m_vertex_positions[vertex];
+        m_adjacency_matrix[row * m_row_num_blocks + m_partition_block_offsets[m_vertex_partitions[vertex]] + position / block_size] |= Block(1)
+                                                                                                                                     << (position % block_size);
+    };
+
+    set_bit(source, target);
+    set_bit(target, source);
+}
+
+void KPartiteGraph::find_all_k_cliques_helper(size_t depth, std::vector<size_t>& out_cliques)
+{
+    constexpr size_t block_size = std::numeric_limits<Block>::digits;
+
+    const auto* compatible_vertices = m_compatible_vertices.data() + depth * m_row_num_blocks;
+    const auto* num_compatible_vertices = m_num_compatible_vertices.data() + depth * m_k;
+
+    // Find the best partition to work with
+    auto best_partition = std::numeric_limits<size_t>::max();
+    auto best_num_compatible_vertices = std::numeric_limits<size_t>::max();
+    for (size_t partition = 0; partition < m_k; ++partition)
+    {
+        if (!m_partition_used[partition] && num_compatible_vertices[partition] < best_num_compatible_vertices)
+        {
+            best_num_compatible_vertices = num_compatible_vertices[partition];
+            best_partition = partition;
+        }
+    }
+
+    m_partition_used[best_partition] = true;
+
+    // Iterate through compatible vertices in the best partition
+    const auto best_partition_block_offset = m_partition_block_offsets[best_partition];
+    for (size_t block_index = 0; block_index < m_partition_num_blocks[best_partition]; ++block_index)
+    {
+        auto block = compatible_vertices[best_partition_block_offset + block_index];
+
+        while (block != 0)
+        {
+            const auto position = block_index * block_size + std::countr_zero(block);
+            block &= block - 1;
+
+            const auto vertex = m_partitions[best_partition][position];
+            m_partial_solution.push_back(vertex);
+
+            if (depth + 1 == m_k)
+            {
+                out_cliques.insert(out_cliques.end(), m_partial_solution.begin(), m_partial_solution.end());
+            }
+            else
+            {
+                // Update compatible vertices for the next recursion
+                auto* compatible_vertices_next = m_compatible_vertices.data() + (depth + 1) * m_row_num_blocks;
+                auto* num_compatible_vertices_next = m_num_compatible_vertices.data() + (depth + 1) * m_k;
+                m_and_kernel(compatible_vertices_next, compatible_vertices, m_adjacency_matrix.data() + vertex * m_row_num_blocks, m_row_num_blocks);
+
+                // Only recurse if every remaining partition has a compatible vertex
+                auto possible_addition = true;
+                for (size_t partition = 0; partition < m_k; ++partition)
+                {
+                    if (!m_partition_used[partition])
+                    {
+                        num_compatible_vertices_next[partition] =
+                            m_popcount_kernel(compatible_vertices_next + m_partition_block_offsets[partition], m_partition_num_blocks[partition]);
+
+                        if (num_compatible_vertices_next[partition] == 0)
+                        {
+                            possible_addition = false;
+                            break;
+                        }
+                    }
+                }
+
+                if (possible_addition)
+                {
+                    find_all_k_cliques_helper(depth + 1, out_cliques);
+                }
+            }
+
+            m_partial_solution.pop_back();
+        }
+    }
+
+    m_partition_used[best_partition] = false;
+}
+
+void KPartiteGraph::find_all_k_cliques(std::vector<std::vector<size_t>>& out_cliques)
+{
+    auto cliques = std::vector<size_t> {};
+    find_all_k_cliques(cliques);
+
+    for (size_t offset = 0; offset < cliques.size(); offset += m_k)
+    {
+        out_cliques.emplace_back(cliques.begin() + offset, cliques.begin() + offset + m_k);
+    }
+}
+
+void KPartiteGraph::find_all_k_cliques(std::vector<size_t>& out_cliques)
+{
+    constexpr size_t block_size = std::numeric_limits<Block>::digits;
+
+    if (m_k == 0)
+    {
+        return;
+    }
+
+    // Initially, all vertices are compatible
+    std::fill(m_compatible_vertices.begin(), m_compatible_vertices.begin() + m_row_num_blocks, Block(0));
+    for (size_t partition = 0; partition < m_k; ++partition)
+    {
+        const auto num_vertices = m_partitions[partition].size();
+        if (num_vertices == 0)
+        {
+            return;
+        }
+
+        auto* blocks = m_compatible_vertices.data() + m_partition_block_offsets[partition];
+        for (size_t position = 0; position < num_vertices; ++position)
+        {
+            blocks[position / block_size] |= Block(1) << (position % block_size);
+        }
+        m_num_compatible_vertices[partition] = num_vertices;
+    }
+
+    m_partial_solution.clear();
+    std::fill(m_partition_used.begin(), m_partition_used.end(), false);
+
+    find_all_k_cliques_helper(0, out_cliques);
+}
+
+const std::vector<std::vector<size_t>>& KPartiteGraph::get_partitions() const { return m_partitions; }
+
+size_t KPartiteGraph::get_num_vertices() const { return m_num_vertices; }
+
 }
@@ -97,6 +97,22 @@ FaithfulAbstraction::create(const fs::path& domain_filepath, const fs::path& pro
     return FaithfulAbstraction::create(parser.get_problem(), parser.get_pddl_factories(), aag, ssg, options);
 }
 
+/// @brief Compute the certificate of the object graph while reusing the memory of the nauty graph across calls.
+static std::shared_ptr<const Certificate> compute_certificate(const StaticVertexColoredDigraph& object_graph, nauty_wrapper::SparseGraph& nauty_graph)
+{
+    nauty_graph.clear(object_graph.get_num_vertices());
+    for (const auto& edge : object_graph.get_edges())
+    {
+        nauty_graph.add_edge(edge.get_source(), edge.get_target());
+    }
+    nauty_graph.add_vertex_coloring(compute_vertex_colors(object_graph));
+
+    return std::make_shared<const Certificate>(object_graph.get_num_vertices(),
+                                               object_graph.get_num_edges(),
+                                               nauty_graph.compute_certificate(),
+                                               compute_sorted_vertex_colors(object_graph));
+}
+
 std::optional<FaithfulAbstraction> FaithfulAbstraction::create(Problem problem,
                                                                std::shared_ptr<PDDLFactories> factories,
                                                                std::shared_ptr<IApplicableActionGenerator> aag,
@@ -148,10 +164,8 @@ std::optional<FaithfulAbstraction> FaithfulAbstraction::create(Problem problem,
                                                   *object_graph_pruning_strategy);
     // std::cout << problem->get_filepath().value() << std::endl;
     // std::cout << std::make_tuple(std::cref(object_graph), std::cref(color_function)) << std::endl;
-    auto certificate = std::make_shared<const Certificate>(object_graph.get_num_vertices(),
-                                                           object_graph.get_num_edges(),
-                                                           nauty_wrapper::SparseGraph(object_graph).compute_certificate(),
-                                                           compute_sorted_vertex_colors(object_graph));
+    auto nauty_graph = nauty_wrapper::SparseGraph();
+    auto certificate = compute_certificate(object_graph, nauty_graph);
     const auto abstract_initial_state_index = 0;
     abstract_states_by_certificate.emplace(std::move(certificate), abstract_initial_state_index);
     concrete_to_abstract_state.emplace(initial_state, abstract_initial_state_index);
@@ -202,10 +216,7 @@ std::optional<FaithfulAbstraction> FaithfulAbstraction::create(Problem problem,
                                                           *object_graph_pruning_strategy);
             // std::cout << std::make_tuple(std::cref(object_graph), std::cref(color_function)) << std::endl;
 
-            auto certificate = std::make_shared<const Certificate>(object_graph.get_num_vertices(),
-                                                                   object_graph.get_num_edges(),
-                                                                   nauty_wrapper::SparseGraph(object_graph).compute_certificate(),
-                                                                   compute_sorted_vertex_colors(object_graph));
+            auto certificate = compute_certificate(object_graph, nauty_graph);
             const auto it = abstract_states_by_certificate.find(certificate);
 
             // Regenerate abstract state
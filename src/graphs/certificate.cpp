@@ -19,23 +19,44 @@
 
 #include "mimir/common/hash.hpp"
 
+#include <cstring>
+
 namespace mimir
 {
 
-Certificate::Certificate(size_t num_vertices, size_t num_edges, std::string nauty_certificate, ColorList canonical_initial_coloring) :
+/// @brief Return true iff both vectors contain the same elements by comparing their memory.
+template<typename T>
+static bool equal_memory(const std::vector<T>& lhs, const std::vector<T>& rhs)
+{
+    return (lhs.size() == rhs.size()) && (lhs.empty() || std::memcmp(lhs.data(), rhs.data(), lhs.size() * sizeof(T)) == 0);
+}
+
+Certificate::Certificate(size_t num_vertices, size_t num_edges, NautyCertificate nauty_certificate, ColorList canonical_initial_coloring) :
     m_num_vertices(num_vertices),
     m_num_edges(num_edges),
     m_nauty_certificate(std::move(nauty_certificate)),
-    m_canonical_initial_coloring(std::move(canonical_initial_coloring))
+    m_canonical_initial_coloring(std::move(canonical_initial_coloring)),
+    m_hash(0)
 {
+    // Combine the hashes of the elements one by one to avoid creating an intermediate representation.
+    hash_combine(m_hash, m_num_vertices);
+    hash_combine(m_hash, m_num_edges);
+    for (const auto element : m_nauty_certificate)
+    {
+        hash_combine(m_hash, element);
+    }
+    for (const auto color : m_canonical_initial_coloring)
+    {
+        hash_combine(m_hash, color);
+    }
 }
 
 bool Certificate::operator==(const Certificate& other) const
 {
     if (this != &other)
     {
-        return (m_num_vertices == other.m_num_vertices) && (m_num_edges == other.m_num_edges)
-               && (m_canonical_initial_coloring == other.m_canonical_initial_coloring) && (m_nauty_certificate == other.m_nauty_certificate);
+        return (m_hash == other.m_hash) && (m_num_vertices == other.m_num_vertices) && (m_num_edges == other.m_num_edges)
+               && equal_memory(m_canonical_initial_coloring, other.m_canonical_initial_coloring) && equal_memory(m_nauty_certificate, other.m_nauty_certificate);
     }
     return true;
 }
@@ -44,10 +65,12 @@ size_t Certificate::get_num_vertices() const { return m_num_vertices; }
 
 size_t Certificate::get_num_edges() const { return m_num_edges; }
 
-const std::string& Certificate::get_nauty_certificate() const { return m_nauty_certificate; }
+const NautyCertificate& Certificate::get_nauty_certificate() const { return m_nauty_certificate; }
 
 const ColorList& Certificate::get_canonical_initial_coloring() const { return m_canonical_initial_coloring; }
 
+size_t Certificate::get_hash() const { return m_hash; }
+
 size_t UniqueCertificateSharedPtrHash::operator()(const std::shared_ptr<const Certificate>& element) const { return std::hash<Certificate>()(*element); }
 
 size_t UniqueCertificateSharedPtrEqualTo::operator()(const std::shared_ptr<const Certificate>& lhs, const std::shared_ptr<const Certificate>& rhs) const
@@ -59,5 +82,5 @@ size_t UniqueCertificateSharedPtrEqualTo::operator()(const std::shared_ptr<const
 
 size_t std::hash<mimir::Certificate>::operator()(const mimir::Certificate& element) const
 {
-    return mimir::hash_combine(element.get_nauty_certificate(), element.get_canonical_initial_coloring());
+    return element.get_hash();
 }
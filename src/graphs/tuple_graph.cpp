@@ -17,6 +17,12 @@
 
 #include "mimir/graphs/tuple_graph.hpp"
 
+#include "mimir/algorithms/BS_thread_pool.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+
 namespace mimir
 {
 
@@ -26,10 +32,10 @@ using TupleVertexIndexSet = std::unordered_set<TupleVertexIndex>;
  * TupleGraphVertex
  */
 
-TupleGraphVertex::TupleGraphVertex(TupleVertexIndex index, TupleIndex tuple_index, StateList states) :
+TupleGraphVertex::TupleGraphVertex(TupleVertexIndex index, TupleIndex tuple_index, std::span<const State> states) :
     m_index(index),
     m_tuple_index(tuple_index),
-    m_states(std::move(states))
+    m_states(states)
 {
 }
 
@@ -37,7 +43,7 @@ TupleVertexIndex TupleGraphVertex::get_index() const { return m_index; }
 
 TupleIndex TupleGraphVertex::get_tuple_index() const { return m_tuple_index; }
 
-const StateList& TupleGraphVertex::get_states() const { return m_states; }
+std::span<const State> TupleGraphVertex::get_states() const { return m_states; }
 
 /**
  * TupleGraph
@@ -47,15 +53,30 @@ TupleGraph::TupleGraph(std::shared_ptr<StateSpace> state_space,
                        std::shared_ptr<TupleIndexMapper> tuple_index_mapper,
                        bool prune_dominated_tuples,
                        StaticDigraph digraph,
-                       IndexGroupedVector<const TupleGraphVertex> vertices_grouped_by_distance,
+                       const TupleIndexList& vertex_tuple_indices,
+                       IndexGroupedVector<const State> states_grouped_by_vertex,
+                       const IndexGroupedVector<const TupleVertexIndex>& vertex_indices_grouped_by_distance,
                        IndexGroupedVector<const State> states_grouped_by_distance) :
     m_state_space(std::move(state_space)),
     m_tuple_index_mapper(std::move(tuple_index_mapper)),
     m_prune_dominated_tuples(prune_dominated_tuples),
     m_digraph(std::move(digraph)),
-    m_vertices_grouped_by_distance(std::move(vertices_grouped_by_distance)),
+    m_states_grouped_by_vertex(std::move(states_grouped_by_vertex)),
+    m_vertices_grouped_by_distance(),
     m_states_grouped_by_distance(std::move(states_grouped_by_distance))
 {
+    // The vertices refer to the states in m_states_grouped_by_vertex, hence, they must be created after it was moved into place.
+    auto vertices_grouped_by_distance = IndexGroupedVectorBuilder<const TupleGraphVertex>();
+    for (const auto vertex_indices : vertex_indices_grouped_by_distance)
+    {
+        vertices_grouped_by_distance.start_group();
+        for (const auto vertex_index : vertex_indices)
+        {
+            vertices_grouped_by_distance.add_group_element(
+                TupleGraphVertex(vertex_index, vertex_tuple_indices.at(vertex_index), m_states_grouped_by_vertex.at(vertex_index)));
+        }
+    }
+    m_vertices_grouped_by_distance = vertices_grouped_by_distance.get_result();
 }
 
 std::optional<TupleVertexIndexList> TupleGraph::compute_admissible_chain(const GroundAtomList<Fluent>& fluent_atoms,
@@ -164,6 +185,8 @@ const IndexGroupedVector<const TupleGraphVertex>& TupleGraph::get_vertices_group
 
 const IndexGroupedVector<const State>& TupleGraph::get_states_grouped_by_distance() const { return m_states_grouped_by_distance; }
 
+const IndexGroupedVector<const State>& TupleGraph::get_states_grouped_by_vertex() const { return m_states_grouped_by_vertex; }
+
 /**
  * TupleGraphFactory
  */
@@ -178,9 +201,13 @@ private:
 
     // Result structures to create tuple graph
     StaticDigraph m_digraph;
-    IndexGroupedVectorBuilder<const TupleGraphVertex> m_vertices_grouped_by_distance;
+    TupleIndexList m_vertex_tuple_indices;
+    IndexGroupedVectorBuilder<const State> m_states_grouped_by_vertex;
+    IndexGroupedVectorBuilder<const TupleVertexIndex> m_vertex_indices_grouped_by_distance;
     IndexGroupedVectorBuilder<const State> m_states_grouped_by_distance;
 
+    TupleVertexIndex add_vertex(State state);
+
 public:
     TupleGraphArityZeroComputation(std::shared_ptr<StateSpace> state_space, std::shared_ptr<TupleIndexMapper> tuple_index_mapper, bool prune_dominated_tuples);
 
@@ -190,8 +217,14 @@ public:
     /// @brief Compute the layer at distance 1, assumes that the root state layer exists.
     void compute_first_layer(State root_state);
 
-    /// @brief Return a reference to the tuple graph.
+    /// @brief Return the tuple graph.
     TupleGraph get_result();
+
+    /// @brief Clear the bookkeeping such that the next tuple graph can be computed.
+    void clear();
+
+    /// @brief Clear the bookkeeping and return the tuple graph for the given root state.
+    TupleGraph compute(State root_state);
 };
 
 // Bookkeeping for memory reuse when building tuple graph of width greater 0
@@ -205,14 +238,30 @@ private:
 
     // Result structures to create tuple graph
     StaticDigraph m_digraph;
-    IndexGroupedVectorBuilder<const TupleGraphVertex> m_vertices_grouped_by_distance;
+    TupleIndexList m_vertex_tuple_indices;
+    std::vector<size_t> m_vertex_states_begin;
+    IndexGroupedVectorBuilder<const State> m_states_grouped_by_vertex;
+    IndexGroupedVectorBuilder<const TupleVertexIndex> m_vertex_indices_grouped_by_distance;
     IndexGroupedVectorBuilder<const State> m_states_grouped_by_distance;
 
+    template<typename Range>
+    TupleVertexIndex add_vertex(TupleIndex tuple_index, const Range& states);
+
+    std::span<const State> get_vertex_states(TupleVertexIndex vertex_index) const;
+
+    // Parallelization, the thread pool is only created if more than one thread is used.
+    std::unique_ptr<BS::thread_pool> m_thread_pool;
+    std::vector<StateTupleIndexGenerator> m_tuple_index_generators;  ///< one per thread
+
+    /// @brief Call function(i, thread_index) for all 0 <= i < num_elements, distributed over the threads.
+    template<typename Function>
+    void parallel_for(size_t num_elements, const Function& function);
+
     // Common book-keeping
     StateList prev_states;
     StateList curr_states;
-    TupleGraphVertexList prev_vertices;
-    TupleGraphVertexList curr_vertices;
+    TupleVertexIndexList prev_vertices;
+    TupleVertexIndexList curr_vertices;
     StateSet visited_states;
     DynamicNoveltyTable novelty_table;
 
@@ -222,14 +271,17 @@ private:
 
     bool compute_next_state_layer();
 
-    TupleIndexSet novel_tuple_indices_set;
+    HashedNoveltyTableBackend novel_tuple_indices_set;       ///< concurrent set of the novel tuple indices of the layer
+    std::vector<TupleIndexList> thread_novel_tuple_indices;  ///< one per thread
     TupleIndexList novel_tuple_indices;
+    std::vector<TupleIndexList> curr_state_novel_tuple_indices;  ///< i-th element are the novel tuple indices of curr_states[i]
+    StateMap<size_t> state_to_curr_state_index;
     std::unordered_map<TupleIndex, StateSet> novel_tuple_index_to_states;
-    StateMap<TupleIndexList> state_to_novel_tuple_indices;
 
     void compute_next_novel_tuple_indices();
 
-    std::unordered_map<TupleIndex, StateSet> cur_novel_tuple_index_to_extended_state;
+    std::vector<std::unordered_map<TupleIndex, StateSet>> cur_novel_tuple_index_to_extended_state;  ///< one per thread
+    std::vector<TupleIndexList> prev_vertex_extended_novel_tuple_indices;                          ///< i-th element belongs to prev_vertices[i]
     std::unordered_map<TupleIndex, TupleVertexIndexSet> cur_extended_novel_tuple_index_to_prev_vertices;
     TupleIndexSet cur_extended_novel_tuple_indices_set;
     TupleIndexList cur_extended_novel_tuple_indices;
@@ -241,7 +293,10 @@ private:
     bool instantiate_next_layer();
 
 public:
-    TupleGraphArityKComputation(std::shared_ptr<StateSpace> state_space, std::shared_ptr<TupleIndexMapper> tuple_index_mapper, bool prune_dominated_tuples);
+    TupleGraphArityKComputation(std::shared_ptr<StateSpace> state_space,
+                                std::shared_ptr<TupleIndexMapper> tuple_index_mapper,
+                                bool prune_dominated_tuples,
+                                size_t num_threads);
 
     /// @brief Compute the root state layer.
     void compute_root_state_layer(State root_state);
@@ -250,8 +305,14 @@ public:
     /// and return true iff the layer is nonempty.
     bool compute_next_layer();
 
-    /// @brief Return a reference to the tuple graph.
+    /// @brief Return the tuple graph.
     TupleGraph get_result();
+
+    /// @brief Clear the bookkeeping such that the next tuple graph can be computed.
+    void clear();
+
+    /// @brief Clear the bookkeeping and return the tuple graph for the given root state.
+    TupleGraph compute(State root_state);
 };
 
 TupleGraphArityZeroComputation::TupleGraphArityZeroComputation(std::shared_ptr<StateSpace> state_space,
@@ -263,24 +324,31 @@ TupleGraphArityZeroComputation::TupleGraphArityZeroComputation(std::shared_ptr<S
 {
 }
 
+TupleVertexIndex TupleGraphArityZeroComputation::add_vertex(State state)
+{
+    const auto vertex_index = m_digraph.add_vertex();
+    m_vertex_tuple_indices.push_back(m_tuple_index_mapper->get_empty_tuple_index());
+    m_states_grouped_by_vertex.start_group();
+    m_states_grouped_by_vertex.add_group_element(state);
+    m_vertex_indices_grouped_by_distance.add_group_element(vertex_index);
+    return vertex_index;
+}
+
 void TupleGraphArityZeroComputation::compute_root_state_layer(State root_state)
 {
-    m_vertices_grouped_by_distance.start_group();
+    m_vertex_indices_grouped_by_distance.start_group();
     m_states_grouped_by_distance.start_group();
 
-    const auto empty_tuple_index = m_tuple_index_mapper->get_empty_tuple_index();
-    const auto root_state_vertex_index = m_digraph.add_vertex();
+    [[maybe_unused]] const auto root_state_vertex_index = add_vertex(root_state);
     assert(root_state_vertex_index == 0);
-    m_vertices_grouped_by_distance.add_group_element(TupleGraphVertex(root_state_vertex_index, empty_tuple_index, StateList { root_state }));
     m_states_grouped_by_distance.add_group_element(root_state);
 }
 
 void TupleGraphArityZeroComputation::compute_first_layer(State root_state)
 {
-    m_vertices_grouped_by_distance.start_group();
+    m_vertex_indices_grouped_by_distance.start_group();
     m_states_grouped_by_distance.start_group();
 
-    const auto empty_tuple_index = m_tuple_index_mapper->get_empty_tuple_index();
     const auto root_state_vertex_index = 0;
     const auto root_state_index = m_state_space->get_state_index(root_state);
     for (const auto& concrete_succ_state : m_state_space->get_graph().get_adjacent_vertices<ForwardTraversal>(root_state_index))
@@ -291,8 +359,7 @@ void TupleGraphArityZeroComputation::compute_first_layer(State root_state)
             // Root state was already visited
             continue;
         }
-        const auto succ_state_vertex_index = m_digraph.add_vertex();
-        m_vertices_grouped_by_distance.add_group_element(TupleGraphVertex(succ_state_vertex_index, empty_tuple_index, StateList { succ_state }));
+        const auto succ_state_vertex_index = add_vertex(succ_state);
         m_states_grouped_by_distance.add_group_element(succ_state);
         m_digraph.add_directed_edge(root_state_vertex_index, succ_state_vertex_index);
     }
@@ -303,31 +370,62 @@ TupleGraph TupleGraphArityZeroComputation::get_result()
     return TupleGraph(m_state_space,
                       m_tuple_index_mapper,
                       m_prune_dominated_tuples,
-                      m_digraph,
-                      m_vertices_grouped_by_distance.get_result(),
+                      std::move(m_digraph),
+                      m_vertex_tuple_indices,
+                      m_states_grouped_by_vertex.get_result(),
+                      m_vertex_indices_grouped_by_distance.get_result(),
                       m_states_grouped_by_distance.get_result());
 }
 
+void TupleGraphArityZeroComputation::clear()
+{
+    m_digraph.clear();
+    m_vertex_tuple_indices.clear();
+    m_states_grouped_by_vertex.clear();
+    m_vertex_indices_grouped_by_distance.clear();
+    m_states_grouped_by_distance.clear();
+}
+
+TupleGraph TupleGraphArityZeroComputation::compute(State root_state)
+{
+    clear();
+
+    compute_root_state_layer(root_state);
+
+    compute_first_layer(root_state);
+
+    return get_result();
+}
+
 TupleGraphArityKComputation::TupleGraphArityKComputation(std::shared_ptr<StateSpace> state_space,
                                                          std::shared_ptr<TupleIndexMapper> tuple_index_mapper,
-                                                         bool prune_dominated_tuples) :
+                                                         bool prune_dominated_tuples,
+                                                         size_t num_threads) :
     m_state_space(std::move(state_space)),
     m_tuple_index_mapper(std::move(tuple_index_mapper)),
     m_prune_dominated_tuples(prune_dominated_tuples),
     m_digraph(),
-    m_vertices_grouped_by_distance(),
+    m_vertex_tuple_indices(),
+    m_vertex_states_begin(),
+    m_states_grouped_by_vertex(),
+    m_vertex_indices_grouped_by_distance(),
     m_states_grouped_by_distance(),
+    m_thread_pool((num_threads > 1) ? std::make_unique<BS::thread_pool>(static_cast<BS::concurrency_t>(num_threads)) : nullptr),
+    m_tuple_index_generators(std::max(num_threads, size_t(1)), StateTupleIndexGenerator(m_tuple_index_mapper)),
     prev_states(),
     curr_states(),
     prev_vertices(),
     curr_vertices(),
     visited_states(),
     novelty_table(m_tuple_index_mapper),
-    novel_tuple_indices_set(),
+    novel_tuple_indices_set(static_cast<size_t>(m_tuple_index_mapper->get_max_tuple_index()) + 1),
+    thread_novel_tuple_indices(std::max(num_threads, size_t(1))),
     novel_tuple_indices(),
+    curr_state_novel_tuple_indices(),
+    state_to_curr_state_index(),
     novel_tuple_index_to_states(),
-    state_to_novel_tuple_indices(),
-    cur_novel_tuple_index_to_extended_state(),
+    cur_novel_tuple_index_to_extended_state(std::max(num_threads, size_t(1))),
+    prev_vertex_extended_novel_tuple_indices(),
     cur_extended_novel_tuple_index_to_prev_vertices(),
     cur_extended_novel_tuple_indices_set(),
     cur_extended_novel_tuple_indices(),
@@ -335,17 +433,54 @@ TupleGraphArityKComputation::TupleGraphArityKComputation(std::shared_ptr<StateSp
 {
 }
 
+template<typename Range>
+TupleVertexIndex TupleGraphArityKComputation::add_vertex(TupleIndex tuple_index, const Range& states)
+{
+    const auto vertex_index = m_digraph.add_vertex();
+    m_vertex_tuple_indices.push_back(tuple_index);
+    m_vertex_states_begin.push_back(m_states_grouped_by_vertex.start_group());
+    for (const auto& state : states)
+    {
+        m_states_grouped_by_vertex.add_group_element(state);
+    }
+    return vertex_index;
+}
+
+std::span<const State> TupleGraphArityKComputation::get_vertex_states(TupleVertexIndex vertex_index) const
+{
+    const auto& states = m_states_grouped_by_vertex.data();
+    const auto begin = m_vertex_states_begin.at(vertex_index);
+    const auto end = (static_cast<size_t>(vertex_index) + 1 < m_vertex_states_begin.size()) ? m_vertex_states_begin.at(vertex_index + 1) : states.size();
+    return std::span<const State>(states.data() + begin, states.data() + end);
+}
+
+template<typename Function>
+void TupleGraphArityKComputation::parallel_for(size_t num_elements, const Function& function)
+{
+    if (!m_thread_pool)
+    {
+        for (size_t i = 0; i < num_elements; ++i)
+        {
+            function(i, 0);
+        }
+        return;
+    }
+
+    m_thread_pool->detach_loop<size_t>(0, num_elements, [&function](size_t i) { function(i, BS::this_thread::get_index().value()); });
+    m_thread_pool->wait();
+}
+
 void TupleGraphArityKComputation::compute_root_state_layer(State root_state)
 {
-    m_vertices_grouped_by_distance.start_group();
+    m_vertex_indices_grouped_by_distance.start_group();
     m_states_grouped_by_distance.start_group();
 
     novelty_table.compute_novel_tuple_indices(root_state, novel_tuple_indices);
 
     for (const auto& novel_tuple_index : novel_tuple_indices)
     {
-        const auto vertex_index = m_digraph.add_vertex();
-        m_vertices_grouped_by_distance.add_group_element(curr_vertices.emplace_back(vertex_index, novel_tuple_index, StateList { root_state }));
+        const auto vertex_index = add_vertex(novel_tuple_index, StateList { root_state });
+        m_vertex_indices_grouped_by_distance.add_group_element(curr_vertices.emplace_back(vertex_index));
 
         if (m_prune_dominated_tuples)
         {
@@ -389,23 +524,54 @@ bool TupleGraphArityKComputation::compute_next_state_layer()
 void TupleGraphArityKComputation::compute_next_novel_tuple_indices()
 {
     // Clear data structures
-    novel_tuple_indices_set.clear();
+    novel_tuple_indices_set.reset();
     novel_tuple_indices.clear();
     novel_tuple_index_to_states.clear();
-    state_to_novel_tuple_indices.clear();
+    state_to_curr_state_index.clear();
+
+    // The novelty table is not modified while testing the states of the layer, hence, the states are tested in parallel.
+    curr_state_novel_tuple_indices.resize(curr_states.size());
+    parallel_for(curr_states.size(),
+                 [this](size_t i, size_t thread_index)
+                 { novelty_table.compute_novel_tuple_indices(curr_states[i], m_tuple_index_generators[thread_index], curr_state_novel_tuple_indices[i]); });
+
+    // The distinct novel tuple indices of the layer are collected in parallel by inserting them concurrently into a hash set,
+    // which must be large enough beforehand because it cannot grow during concurrent insertions.
+    auto num_state_novel_tuple_indices = size_t(0);
+    for (const auto& state_novel_tuple_indices : curr_state_novel_tuple_indices)
+    {
+        num_state_novel_tuple_indices += state_novel_tuple_indices.size();
+    }
+    novel_tuple_indices_set.reserve(num_state_novel_tuple_indices);
+    for (auto& novel_tuple_indices_of_thread : thread_novel_tuple_indices)
+    {
+        novel_tuple_indices_of_thread.clear();
+    }
+    parallel_for(curr_states.size(),
+                 [this](size_t i, size_t thread_index)
+                 {
+                     for (const auto tuple_index : curr_state_novel_tuple_indices[i])
+                     {
+                         if (novel_tuple_indices_set.insert_concurrent(tuple_index))
+                         {
+                             thread_novel_tuple_indices[thread_index].push_back(tuple_index);
+                         }
+                     }
+                 });
+    for (const auto& novel_tuple_indices_of_thread : thread_novel_tuple_indices)
+    {
+        novel_tuple_indices.insert(novel_tuple_indices.end(), novel_tuple_indices_of_thread.begin(), novel_tuple_indices_of_thread.end());
+    }
 
-    for (const auto& state : curr_states)
+    for (size_t i = 0; i < curr_states.size(); ++i)
     {
-        novelty_table.compute_novel_tuple_indices(state, novel_tuple_indices);
-        for (const auto& tuple_index : novel_tuple_indices)
+        const auto state = curr_states[i];
+        for (const auto& tuple_index : curr_state_novel_tuple_indices[i])
         {
             novel_tuple_index_to_states[tuple_index].insert(state);
         }
-        state_to_novel_tuple_indices.emplace(state, novel_tuple_indices);
-        novel_tuple_indices_set.insert(novel_tuple_indices.begin(), novel_tuple_indices.end());
+        state_to_curr_state_index.emplace(state, i);
     }
-    novel_tuple_indices.clear();
-    novel_tuple_indices.insert(novel_tuple_indices.end(), novel_tuple_indices_set.begin(), novel_tuple_indices_set.end());
     novelty_table.insert_tuple_indices(novel_tuple_indices);
 }
 
@@ -418,41 +584,58 @@ void TupleGraphArityKComputation::extend_optimal_plans_from_prev_layer()
 
     // Part 2 of definition of width: Check whether all optimal plans for tuple t_{i-1}
     // can be extended into an optimal plan for tuple t_i by means of a single action.
-    for (const auto& prev_vertex : prev_vertices)
+    // The vertices of the previous layer are independent, hence, they are extended in parallel and merged afterwards.
+    prev_vertex_extended_novel_tuple_indices.resize(prev_vertices.size());
+    parallel_for(prev_vertices.size(),
+                 [this](size_t i, size_t thread_index)
+                 {
+                     auto& novel_tuple_index_to_extended_state = cur_novel_tuple_index_to_extended_state[thread_index];
+                     auto& extended_novel_tuple_indices = prev_vertex_extended_novel_tuple_indices[i];
+                     novel_tuple_index_to_extended_state.clear();
+                     extended_novel_tuple_indices.clear();
+
+                     const auto prev_vertex_states = get_vertex_states(prev_vertices[i]);
+
+                     // Bookkeeping..
+                     for (const auto state : prev_vertex_states)
+                     {
+                         const auto state_index = m_state_space->get_state_index(state);
+
+                         // "[...] by means of a single action".
+                         for (const auto& concrete_succ_state : m_state_space->get_graph().get_adjacent_vertices<ForwardTraversal>(state_index))
+                         {
+                             const auto succ_state = get_state(concrete_succ_state);
+
+                             const auto it = state_to_curr_state_index.find(succ_state);
+                             if (it != state_to_curr_state_index.end())
+                             {
+                                 for (const auto target_tuple_index : curr_state_novel_tuple_indices[it->second])
+                                 {
+                                     novel_tuple_index_to_extended_state[target_tuple_index].insert(state);
+                                 }
+                             }
+                         }
+                     }
+
+                     // "Check whether all optimal plans for tuple t_{i-1}
+                     // can be extended into an optimal plan for tuple t_i [...]""
+                     for (const auto& [cur_novel_tuple_index, extended_states] : novel_tuple_index_to_extended_state)
+                     {
+                         bool all_optimal_plans_extended = (extended_states.size() == prev_vertex_states.size());
+
+                         if (all_optimal_plans_extended)
+                         {
+                             extended_novel_tuple_indices.push_back(cur_novel_tuple_index);
+                         }
+                     }
+                 });
+
+    for (size_t i = 0; i < prev_vertices.size(); ++i)
     {
-        cur_novel_tuple_index_to_extended_state.clear();
-
-        // Bookkeeping..
-        for (const auto state : prev_vertex.get_states())
-        {
-            const auto state_index = m_state_space->get_state_index(state);
-
-            // "[...] by means of a single action".
-            for (const auto& concrete_succ_state : m_state_space->get_graph().get_adjacent_vertices<ForwardTraversal>(state_index))
-            {
-                const auto succ_state = get_state(concrete_succ_state);
-
-                if (state_to_novel_tuple_indices.count(succ_state))
-                {
-                    for (const auto target_tuple_index : state_to_novel_tuple_indices.at(succ_state))
-                    {
-                        cur_novel_tuple_index_to_extended_state[target_tuple_index].insert(state);
-                    }
-                }
-            }
-        }
-
-        // "Check whether all optimal plans for tuple t_{i-1}
-        // can be extended into an optimal plan for tuple t_i [...]""
-        for (const auto& [cur_novel_tuple_index, extended_states] : cur_novel_tuple_index_to_extended_state)
+        for (const auto cur_novel_tuple_index : prev_vertex_extended_novel_tuple_indices[i])
         {
-            bool all_optimal_plans_extended = (extended_states.size() == prev_vertex.get_states().size());
-
-            if (all_optimal_plans_extended)
-            {
-                cur_extended_novel_tuple_indices_set.insert(cur_novel_tuple_index);
-                cur_extended_novel_tuple_index_to_prev_vertices[cur_novel_tuple_index].insert(prev_vertex.get_index());
-            }
+            cur_extended_novel_tuple_indices_set.insert(cur_novel_tuple_index);
+            cur_extended_novel_tuple_index_to_prev_vertices[cur_novel_tuple_index].insert(prev_vertices[i]);
         }
     }
     cur_extended_novel_tuple_indices.insert(cur_extended_novel_tuple_indices.end(),
@@ -518,9 +701,8 @@ bool TupleGraphArityKComputation::instantiate_next_layer()
 
     for (const auto& tuple_index : cur_extended_novel_tuple_indices_set)
     {
-        const auto cur_vertex_index = m_digraph.add_vertex();
-        const auto& cur_states = novel_tuple_index_to_states.at(tuple_index);
-        curr_vertices.emplace_back(cur_vertex_index, tuple_index, StateList(cur_states.begin(), cur_states.end()));
+        const auto cur_vertex_index = add_vertex(tuple_index, novel_tuple_index_to_states.at(tuple_index));
+        curr_vertices.push_back(cur_vertex_index);
 
         for (const auto prev_vertex_index : cur_extended_novel_tuple_index_to_prev_vertices[tuple_index])
         {
@@ -577,10 +759,10 @@ bool TupleGraphArityKComputation::compute_next_layer()
     {
         m_states_grouped_by_distance.add_group_element(state);
     }
-    m_vertices_grouped_by_distance.start_group();
-    for (const auto& vertex : curr_vertices)
+    m_vertex_indices_grouped_by_distance.start_group();
+    for (const auto& vertex_index : curr_vertices)
     {
-        m_vertices_grouped_by_distance.add_group_element(vertex);
+        m_vertex_indices_grouped_by_distance.add_group_element(vertex_index);
     }
 
     return true;
@@ -591,39 +773,88 @@ TupleGraph TupleGraphArityKComputation::get_result()
     return TupleGraph(m_state_space,
                       m_tuple_index_mapper,
                       m_prune_dominated_tuples,
-                      m_digraph,
-                      m_vertices_grouped_by_distance.get_result(),
+                      std::move(m_digraph),
+                      m_vertex_tuple_indices,
+                      m_states_grouped_by_vertex.get_result(),
+                      m_vertex_indices_grouped_by_distance.get_result(),
                       m_states_grouped_by_distance.get_result());
 }
 
-TupleGraph TupleGraphFactory::create_for_arity_zero(State root_state)
+void TupleGraphArityKComputation::clear()
 {
-    auto arity_zero_computation = TupleGraphArityZeroComputation(m_state_space, m_tuple_index_mapper, m_prune_dominated_tuples);
+    m_digraph.clear();
+    m_vertex_tuple_indices.clear();
+    m_vertex_states_begin.clear();
+    m_states_grouped_by_vertex.clear();
+    m_vertex_indices_grouped_by_distance.clear();
+    m_states_grouped_by_distance.clear();
+
+    prev_states.clear();
+    curr_states.clear();
+    prev_vertices.clear();
+    curr_vertices.clear();
+    visited_states.clear();
+    novelty_table.reset();
+}
+
+TupleGraph TupleGraphArityKComputation::compute(State root_state)
+{
+    clear();
 
-    arity_zero_computation.compute_root_state_layer(root_state);
+    compute_root_state_layer(root_state);
 
-    arity_zero_computation.compute_first_layer(root_state);
+    while (compute_next_layer()) {}
 
-    return arity_zero_computation.get_result();
+    return get_result();
 }
 
-TupleGraph TupleGraphFactory::create_for_arity_k(State root_state)
+/// @brief Compute the tuple graphs of the root states in parallel, where each thread reuses the computation at its thread index.
+template<typename Computation>
+static TupleGraphList create_all_with_computations(std::vector<Computation>& computations, const StateList& root_states)
 {
-    auto arity_k_computation = TupleGraphArityKComputation(m_state_space, m_tuple_index_mapper, m_prune_dominated_tuples);
+    auto tuple_graphs = std::vector<std::optional<TupleGraph>>(root_states.size());
 
-    arity_k_computation.compute_root_state_layer(root_state);
-
-    while (true)
+    if (computations.size() == 1)
     {
-        auto is_empty = arity_k_computation.compute_next_layer();
-
-        if (!is_empty)
+        for (size_t i = 0; i < root_states.size(); ++i)
         {
-            break;
+            tuple_graphs[i].emplace(computations.front().compute(root_states[i]));
         }
     }
+    else
+    {
+        auto pool = BS::thread_pool(static_cast<BS::concurrency_t>(computations.size()));
+        // One block per root state because the sizes of the tuple graphs can differ a lot.
+        pool.detach_loop<size_t>(
+            0,
+            root_states.size(),
+            [&computations, &root_states, &tuple_graphs](size_t i)
+            { tuple_graphs[i].emplace(computations[BS::this_thread::get_index().value()].compute(root_states[i])); },
+            root_states.size());
+        pool.wait();
+    }
+
+    auto result = TupleGraphList {};
+    result.reserve(root_states.size());
+    for (auto& tuple_graph : tuple_graphs)
+    {
+        result.push_back(std::move(tuple_graph.value()));
+    }
+    return result;
+}
+
+TupleGraph TupleGraphFactory::create_for_arity_zero(State root_state)
+{
+    auto arity_zero_computation = TupleGraphArityZeroComputation(m_state_space, m_tuple_index_mapper, m_prune_dominated_tuples);
+
+    return arity_zero_computation.compute(root_state);
+}
+
+TupleGraph TupleGraphFactory::create_for_arity_k(State root_state, size_t num_threads)
+{
+    auto arity_k_computation = TupleGraphArityKComputation(m_state_space, m_tuple_index_mapper, m_prune_dominated_tuples, num_threads);
 
-    return arity_k_computation.get_result();
+    return arity_k_computation.compute(root_state);
 }
 
 TupleGraphFactory::TupleGraphFactory(std::shared_ptr<StateSpace> state_space, int arity, bool prune_dominated_tuples) :
@@ -636,9 +867,36 @@ TupleGraphFactory::TupleGraphFactory(std::shared_ptr<StateSpace> state_space, in
 {
 }
 
-TupleGraph TupleGraphFactory::create(State root_state)
+TupleGraph TupleGraphFactory::create(State root_state, size_t num_threads)
+{
+    return (m_tuple_index_mapper->get_arity() > 0) ? create_for_arity_k(root_state, num_threads) : create_for_arity_zero(root_state);
+}
+
+TupleGraphList TupleGraphFactory::create_all(const StateList& root_states, size_t num_threads)
 {
-    return (m_tuple_index_mapper->get_arity() > 0) ? create_for_arity_k(root_state) : create_for_arity_zero(root_state);
+    // Each root state is handled by a single thread, hence, the layers of a tuple graph are computed sequentially.
+    num_threads = std::clamp(num_threads, size_t(1), std::max(root_states.size(), size_t(1)));
+
+    if (m_tuple_index_mapper->get_arity() > 0)
+    {
+        auto computations = std::vector<TupleGraphArityKComputation> {};
+        computations.reserve(num_threads);
+        for (size_t i = 0; i < num_threads; ++i)
+        {
+            computations.emplace_back(m_state_space, m_tuple_index_mapper, m_prune_dominated_tuples, 1);
+        }
+        return create_all_with_computations(computations, root_states);
+    }
+    else
+    {
+        auto computations = std::vector<TupleGraphArityZeroComputation> {};
+        computations.reserve(num_threads);
+        for (size_t i = 0; i < num_threads; ++i)
+        {
+            computations.emplace_back(m_state_space, m_tuple_index_mapper, m_prune_dominated_tuples);
+        }
+        return create_all_with_computations(computations, root_states);
+    }
 }
 
 const std::shared_ptr<StateSpace>& TupleGraphFactory::get_state_space() const { return m_state_space; }
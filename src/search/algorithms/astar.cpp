@@ -17,15 +17,25 @@
 
 #include "mimir/search/algorithms/astar.hpp"
 
+#include "mimir/formalism/action.hpp"
+#include "mimir/formalism/domain.hpp"
+#include "mimir/formalism/function_expressions.hpp"
+#include "mimir/formalism/numeric_fluent.hpp"
+#include "mimir/formalism/problem.hpp"
 #include "mimir/search/algorithms/astar/event_handlers.hpp"
 #include "mimir/search/algorithms/strategies/goal_strategy.hpp"
 #include "mimir/search/algorithms/strategies/pruning_strategy.hpp"
 #include "mimir/search/heuristics/interface.hpp"
+#include "mimir/search/openlists/bucket.hpp"
 #include "mimir/search/openlists/interface.hpp"
 #include "mimir/search/openlists/priority_queue.hpp"
 #include "mimir/search/search_node.hpp"
 #include "mimir/search/state_repository.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <variant>
+
 namespace mimir
 {
 
@@ -53,6 +63,72 @@ get_or_create_search_node(size_t state_index, const AStarSearchNodeImpl& default
     return search_nodes[state_index];
 }
 
+/**
+ * Open list selection
+ */
+
+static bool is_integral(double value) { return std::isfinite(value) && value >= 0 && std::floor(value) == value; }
+
+/// @brief Return true iff the function expression evaluates to a non-negative integral value for all bindings.
+/// The analysis is conservative, i.e., divisions, subtractions, and negations are never considered non-negative integral.
+class IsIntegralFunctionExpressionVisitor
+{
+private:
+    bool m_integral_numeric_fluents;
+
+public:
+    explicit IsIntegralFunctionExpressionVisitor(bool integral_numeric_fluents) : m_integral_numeric_fluents(integral_numeric_fluents) {}
+
+    bool operator()(const FunctionExpressionNumberImpl& expr) { return is_integral(expr.get_number()); }
+
+    bool operator()(const FunctionExpressionBinaryOperatorImpl& expr)
+    {
+        return expr.get_binary_operator() != loki::BinaryOperatorEnum::DIV && expr.get_binary_operator() != loki::BinaryOperatorEnum::MINUS
+               && std::visit(*this, *expr.get_left_function_expression()) && std::visit(*this, *expr.get_right_function_expression());
+    }
+
+    bool operator()(const FunctionExpressionMultiOperatorImpl& expr)
+    {
+        return std::all_of(expr.get_function_expressions().begin(),
+                           expr.get_function_expressions().end(),
+                           [this](const auto& child) { return std::visit(*this, *child); });
+    }
+
+    bool operator()(const FunctionExpressionMinusImpl& /*expr*/) { return false; }
+
+    bool operator()(const FunctionExpressionFunctionImpl& /*expr*/) { return m_integral_numeric_fluents; }
+};
+
+/// @brief Return true iff all action costs of the problem are non-negative integers.
+/// Then the f-values in A* are integral up to the heuristic value and a `BucketOpenList` can be used.
+static bool has_integral_action_costs(Problem problem)
+{
+    const auto& numeric_fluents = problem->get_numeric_fluents();
+    const auto integral_numeric_fluents = std::all_of(numeric_fluents.begin(),
+                                                      numeric_fluents.end(),
+                                                      [](const auto& numeric_fluent) { return is_integral(numeric_fluent->get_number()); });
+
+    auto visitor = IsIntegralFunctionExpressionVisitor(integral_numeric_fluents);
+    for (const auto& action : problem->get_domain()->get_actions())
+    {
+        if (!std::visit(visitor, *action->get_function_expression()))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void insert_into_openlist(PriorityQueue<State>& openlist, ContinuousCost f_value, ContinuousCost /*h_value*/, State state)
+{
+    openlist.insert(f_value, state);
+}
+
+static void insert_into_openlist(BucketOpenList<State>& openlist, ContinuousCost f_value, ContinuousCost h_value, State state)
+{
+    openlist.insert(f_value, h_value, state);
+}
+
 /**
  * AStar
  */
@@ -94,6 +170,28 @@ SearchStatus AStarAlgorithm::find_solution(State start_state,
                                            std::unique_ptr<IPruningStrategy>&& pruning_strategy,
                                            GroundActionList& out_plan,
                                            std::optional<State>& out_goal_state)
+{
+    /* With integral action costs, the buckets are indexed by g + floor(h).
+       This equals A* with the heuristic floor(h), which remains admissible and consistent if h is,
+       hence, the returned plans remain optimal. */
+
+    if (has_integral_action_costs(m_aag->get_problem()))
+    {
+        auto openlist = BucketOpenList<State>(BucketTieBreaking::MIN_SECONDARY);
+        return find_solution(openlist, start_state, std::move(goal_strategy), std::move(pruning_strategy), out_plan, out_goal_state);
+    }
+
+    auto openlist = PriorityQueue<State>();
+    return find_solution(openlist, start_state, std::move(goal_strategy), std::move(pruning_strategy), out_plan, out_goal_state);
+}
+
+template<typename OpenList>
+SearchStatus AStarAlgorithm::find_solution(OpenList& openlist,
+                                           State start_state,
+                                           std::unique_ptr<IGoalStrategy>&& goal_strategy,
+                                           std::unique_ptr<IPruningStrategy>&& pruning_strategy,
+                                           GroundActionList& out_plan,
+                                           std::optional<State>& out_goal_state)
 {
     auto default_search_node = AStarSearchNodeImpl { SearchNodeStatus::NEW,
                                                      std::numeric_limits<Index>::max(),
@@ -102,8 +200,6 @@ SearchStatus AStarAlgorithm::find_solution(State start_state,
                                                      ContinuousCost(0) };
     auto search_nodes = cista::storage::Vector<AStarSearchNodeImpl>();
 
-    auto openlist = PriorityQueue<State>();
-
     const auto problem = m_aag->get_problem();
     const auto& pddl_factories = *m_aag->get_pddl_factories();
     m_event_handler->on_start_search(start_state, problem, pddl_factories);
@@ -144,7 +240,7 @@ SearchStatus AStarAlgorithm::find_solution(State start_state,
 
     auto applicable_actions = GroundActionList {};
     auto f_value = ContinuousCost(0);
-    openlist.insert(start_f_value, start_state);
+    insert_into_openlist(openlist, start_f_value, start_h_value, start_state);
 
     while (!openlist.empty())
     {
@@ -245,7 +341,7 @@ SearchStatus AStarAlgorithm::find_solution(State start_state,
                 m_event_handler->on_generate_state_relaxed(successor_state, action, problem, pddl_factories);
 
                 const auto successor_f_value = get_g_value(successor_search_node) + get_h_value(successor_search_node);
-                openlist.insert(successor_f_value, successor_state);
+                insert_into_openlist(openlist, successor_f_value, get_h_value(successor_search_node), successor_state);
             }
             else
             {
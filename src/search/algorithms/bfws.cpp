@@ -0,0 +1,469 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "mimir/search/algorithms/bfws.hpp"
+
+#include "mimir/search/action.hpp"
+#include "mimir/search/algorithms/bfws/event_handlers.hpp"
+#include "mimir/search/algorithms/iw/dynamic_novelty_table.hpp"
+#include "mimir/search/algorithms/iw/tuple_index_mapper.hpp"
+#include "mimir/search/algorithms/siw/goal_strategy.hpp"
+#include "mimir/search/algorithms/strategies/goal_strategy.hpp"
+#include "mimir/search/algorithms/strategies/pruning_strategy.hpp"
+#include "mimir/search/applicable_action_generators/interface.hpp"
+#include "mimir/search/heuristics/hff.hpp"
+#include "mimir/search/openlists/bucket.hpp"
+#include "mimir/search/search_node.hpp"
+#include "mimir/search/state_repository.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <list>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+
+namespace mimir
+{
+
+/**
+ * BFWS search node
+ */
+
+using BFWSSearchNodeImpl = SearchNodeImpl<ContinuousCost, Index>;
+using BFWSSearchNode = BFWSSearchNodeImpl*;
+using ConstBFWSSearchNode = const BFWSSearchNodeImpl*;
+
+static void set_g_value(BFWSSearchNode node, ContinuousCost g_value) { return set_property<0>(node, g_value); }
+static void set_novelty_table_id(BFWSSearchNode node, Index novelty_table_id) { return set_property<1>(node, novelty_table_id); }
+
+static ContinuousCost get_g_value(ConstBFWSSearchNode node) { return get_property<0>(node); }
+static Index get_novelty_table_id(ConstBFWSSearchNode node) { return get_property<1>(node); }
+
+static BFWSSearchNode
+get_or_create_search_node(size_t state_index, const BFWSSearchNodeImpl& default_node, cista::storage::Vector<BFWSSearchNodeImpl>& search_nodes)
+{
+    while (state_index >= search_nodes.size())
+    {
+        search_nodes.push_back(default_node);
+    }
+    return search_nodes[state_index];
+}
+
+static BFWSSearchNodeImpl create_default_search_node()
+{
+    return BFWSSearchNodeImpl { SearchNodeStatus::NEW,
+                                std::numeric_limits<Index>::max(),
+                                std::numeric_limits<Index>::max(),
+                                std::numeric_limits<ContinuousCost>::infinity(),
+                                std::numeric_limits<Index>::max() };
+}
+
+/// @brief `RelaxedPlanAtomCounter` counts the atoms of a state that are added by the relaxed plan of its goal count.
+/// The relaxed plan of a goal count is computed once for the first state with that goal count
+/// and we keep the atoms that do not hold in that state.
+class RelaxedPlanAtomCounter
+{
+private:
+    std::shared_ptr<HFFHeuristic> m_heuristic;
+    const IApplicableActionGenerator& m_aag;
+
+    std::unordered_map<Index, IndexList> m_relaxed_plan_atoms;
+
+    const IndexList& get_or_compute_relaxed_plan_atoms(State state, Index num_unsatisfied_goals)
+    {
+        auto it = m_relaxed_plan_atoms.find(num_unsatisfied_goals);
+        if (it != m_relaxed_plan_atoms.end())
+        {
+            return it->second;
+        }
+
+        const auto& state_atoms = state.get_atoms<Fluent>();
+        auto relaxed_plan_atoms = IndexList {};
+        if (m_heuristic->compute_heuristic(state) != std::numeric_limits<double>::infinity())
+        {
+            for (const auto action_index : m_heuristic->get_relaxed_plan())
+            {
+                const auto action = m_aag.get_ground_action(action_index);
+                for (const auto atom_index : StripsActionEffect(action.get_strips_effect()).get_positive_effects())
+                {
+                    if (!state_atoms.get(atom_index))
+                    {
+                        relaxed_plan_atoms.push_back(atom_index);
+                    }
+                }
+                for (const auto& flat_conditional_effect : action.get_conditional_effects())
+                {
+                    const auto& simple_effect = ConditionalEffect(flat_conditional_effect).get_simple_effect();
+                    if (!simple_effect.is_negated && !state_atoms.get(simple_effect.atom_index))
+                    {
+                        relaxed_plan_atoms.push_back(simple_effect.atom_index);
+                    }
+                }
+            }
+            std::sort(relaxed_plan_atoms.begin(), relaxed_plan_atoms.end());
+            relaxed_plan_atoms.erase(std::unique(relaxed_plan_atoms.begin(), relaxed_plan_atoms.end()), relaxed_plan_atoms.end());
+        }
+        return m_relaxed_plan_atoms.emplace(num_unsatisfied_goals, std::move(relaxed_plan_atoms)).first->second;
+    }
+
+public:
+    RelaxedPlanAtomCounter(std::shared_ptr<HFFHeuristic> heuristic, const IApplicableActionGenerator& aag) : m_heuristic(std::move(heuristic)), m_aag(aag) {}
+
+    Index count_relaxed_plan_atoms(State state, Index num_unsatisfied_goals)
+    {
+        if (!m_heuristic)
+        {
+            return 0;
+        }
+
+        const auto& state_atoms = state.get_atoms<Fluent>();
+        const auto& relaxed_plan_atoms = get_or_compute_relaxed_plan_atoms(state, num_unsatisfied_goals);
+        return std::count_if(relaxed_plan_atoms.begin(), relaxed_plan_atoms.end(), [&state_atoms](Index atom_index) { return state_atoms.get(atom_index); });
+    }
+};
+
+/// @brief `PartitionedNoveltyTables` maintains one novelty table for each partition of the states.
+/// The least recently used tables are evicted when their total memory usage exceeds the bound.
+/// Each table gets a new id when it is created such that a table that was evicted and created again is distinguishable.
+class PartitionedNoveltyTables
+{
+private:
+    struct Partition
+    {
+        DynamicNoveltyTable novelty_table;
+        std::list<uint64_t>::iterator lru_position;
+        size_t memory_usage;
+        Index id;
+    };
+
+    const BFWSAlgorithmOptions& m_options;
+    IBFWSAlgorithmEventHandler& m_event_handler;
+
+    std::unordered_map<uint64_t, Partition> m_partitions;
+    /// @brief The keys of the partitions with the most recently used one at the front.
+    std::list<uint64_t> m_lru;
+    size_t m_memory_usage;
+    /// @brief New tables are created with the largest number of atoms of any table to avoid repeated resizing.
+    size_t m_num_atoms;
+    /// @brief At most one table is created per evaluated state, hence, the ids fit into an Index.
+    Index m_num_created_tables;
+
+    static uint64_t to_key(Index num_unsatisfied_goals, Index num_relaxed_plan_atoms)
+    {
+        return (static_cast<uint64_t>(num_unsatisfied_goals) << 32) | num_relaxed_plan_atoms;
+    }
+
+    Partition& get_or_create_partition(Index num_unsatisfied_goals, Index num_relaxed_plan_atoms)
+    {
+        const auto key = to_key(num_unsatisfied_goals, num_relaxed_plan_atoms);
+
+        auto it = m_partitions.find(key);
+        if (it != m_partitions.end())
+        {
+            m_lru.splice(m_lru.begin(), m_lru, it->second.lru_position);
+            return it->second;
+        }
+
+        m_lru.push_front(key);
+        auto& partition =
+            m_partitions
+                .emplace(key,
+                         Partition { DynamicNoveltyTable(std::make_shared<TupleIndexMapper>(m_options.max_arity, m_num_atoms), m_options.novelty_table_backend),
+                                     m_lru.begin(),
+                                     0,
+                                     m_num_created_tables++ })
+                .first->second;
+        m_event_handler.on_create_novelty_table(num_unsatisfied_goals, num_relaxed_plan_atoms);
+        return partition;
+    }
+
+    void update_memory_usage(Partition& partition)
+    {
+        const auto memory_usage = partition.novelty_table.get_memory_usage();
+        m_memory_usage = m_memory_usage - partition.memory_usage + memory_usage;
+        partition.memory_usage = memory_usage;
+        m_num_atoms = std::max(m_num_atoms, partition.novelty_table.get_tuple_index_mapper()->get_num_atoms());
+
+        // Never evict the most recently used table of the state that was just evaluated.
+        while (m_memory_usage > m_options.max_novelty_table_memory_usage && m_lru.size() > 1)
+        {
+            const auto key = m_lru.back();
+            m_lru.pop_back();
+
+            auto it = m_partitions.find(key);
+            m_memory_usage -= it->second.memory_usage;
+            m_partitions.erase(it);
+
+            m_event_handler.on_evict_novelty_table(key >> 32, key & std::numeric_limits<uint32_t>::max());
+        }
+        m_event_handler.on_update_novelty_table_memory_usage(m_memory_usage);
+    }
+
+public:
+    PartitionedNoveltyTables(const BFWSAlgorithmOptions& options, IBFWSAlgorithmEventHandler& event_handler) :
+        m_options(options),
+        m_event_handler(event_handler),
+        m_partitions(),
+        m_lru(),
+        m_memory_usage(0),
+        m_num_atoms(INITIAL_TABLE_ATOMS),
+        m_num_created_tables(0)
+    {
+    }
+
+    /// @brief Compute the novelty of the state in its partition and mark its tuples as seen.
+    /// @param out_novelty_table_id is the id of the table of the partition.
+    size_t compute_novelty_and_update_table(State state, Index num_unsatisfied_goals, Index num_relaxed_plan_atoms, Index& out_novelty_table_id)
+    {
+        auto& partition = get_or_create_partition(num_unsatisfied_goals, num_relaxed_plan_atoms);
+        out_novelty_table_id = partition.id;
+        const auto novelty = partition.novelty_table.compute_novelty_and_update_table(state);
+        update_memory_usage(partition);
+        return novelty;
+    }
+
+    /// @brief Compute the novelty of the successor state in its partition and mark its tuples as seen.
+    /// If the state was evaluated in the same table, then the table contains all tuples of the state
+    /// and only the tuples with an atom added by the transition must be tested.
+    /// @param novelty_table_id is the id of the table in which the state was evaluated.
+    /// @param out_novelty_table_id is the id of the table of the partition of the successor state.
+    size_t compute_novelty_and_update_table(State state,
+                                            State succ_state,
+                                            Index novelty_table_id,
+                                            Index num_unsatisfied_goals,
+                                            Index num_relaxed_plan_atoms,
+                                            Index& out_novelty_table_id)
+    {
+        auto& partition = get_or_create_partition(num_unsatisfied_goals, num_relaxed_plan_atoms);
+        out_novelty_table_id = partition.id;
+        const auto novelty = (partition.id == novelty_table_id) ? partition.novelty_table.compute_novelty_and_update_table(state, succ_state) :
+                                                                  partition.novelty_table.compute_novelty_and_update_table(succ_state);
+        update_memory_usage(partition);
+        return novelty;
+    }
+};
+
+/**
+ * BFWS
+ */
+
+BFWSAlgorithm::BFWSAlgorithm(std::shared_ptr<IApplicableActionGenerator> applicable_action_generator, BFWSAlgorithmOptions options) :
+    BFWSAlgorithm(applicable_action_generator,
+                  std::make_shared<StateRepository>(applicable_action_generator),
+                  nullptr,
+                  std::make_shared<DefaultBFWSAlgorithmEventHandler>(),
+                  options)
+{
+}
+
+BFWSAlgorithm::BFWSAlgorithm(std::shared_ptr<IApplicableActionGenerator> applicable_action_generator,
+                             std::shared_ptr<StateRepository> successor_state_generator,
+                             std::shared_ptr<HFFHeuristic> relaxed_plan_heuristic,
+                             std::shared_ptr<IBFWSAlgorithmEventHandler> event_handler,
+                             BFWSAlgorithmOptions options) :
+    m_aag(std::move(applicable_action_generator)),
+    m_ssg(std::move(successor_state_generator)),
+    m_relaxed_plan_heuristic(std::move(relaxed_plan_heuristic)),
+    m_event_handler(std::move(event_handler)),
+    m_options(options)
+{
+    if (m_options.max_arity == 0 || m_options.max_arity >= MAX_ARITY)
+    {
+        throw std::runtime_error("BFWSAlgorithm::BFWSAlgorithm(...): max_arity (" + std::to_string(m_options.max_arity) + ") must be in the range [1, "
+                                 + std::to_string(MAX_ARITY) + ").");
+    }
+}
+
+SearchStatus BFWSAlgorithm::find_solution(GroundActionList& out_plan) { return find_solution(m_ssg->get_or_create_initial_state(), out_plan); }
+
+SearchStatus BFWSAlgorithm::find_solution(State start_state, GroundActionList& out_plan)
+{
+    std::optional<State> unused_out_state = std::nullopt;
+    return find_solution(start_state, out_plan, unused_out_state);
+}
+
+SearchStatus BFWSAlgorithm::find_solution(State start_state, GroundActionList& out_plan, std::optional<State>& out_goal_state)
+{
+    return find_solution(start_state, std::make_unique<ProblemGoal>(m_aag->get_problem()), std::make_unique<NoStatePruning>(), out_plan, out_goal_state);
+}
+
+SearchStatus BFWSAlgorithm::find_solution(State start_state,
+                                          std::unique_ptr<IGoalStrategy>&& goal_strategy,
+                                          std::unique_ptr<IPruningStrategy>&& pruning_strategy,
+                                          GroundActionList& out_plan,
+                                          std::optional<State>& out_goal_state)
+{
+    const auto default_search_node = create_default_search_node();
+    auto search_nodes = cista::storage::Vector<BFWSSearchNodeImpl>();
+
+    // Novelty first, then the number of unsatisfied goals, then FIFO.
+    auto openlist = BucketOpenList<State>(BucketTieBreaking::MIN_SECONDARY);
+
+    const auto problem = m_aag->get_problem();
+    const auto& pddl_factories = *m_aag->get_pddl_factories();
+    m_event_handler->on_start_search(start_state, problem, pddl_factories);
+
+    const auto goal_counter = ProblemGoalCounter(problem, start_state);
+    auto relaxed_plan_atom_counter = RelaxedPlanAtomCounter(m_relaxed_plan_heuristic, *m_aag);
+    auto novelty_tables = PartitionedNoveltyTables(m_options, *m_event_handler);
+
+    /* Test static goal. */
+
+    if (!goal_strategy->test_static_goal())
+    {
+        m_event_handler->on_unsolvable();
+
+        return SearchStatus::UNSOLVABLE;
+    }
+
+    /* Test pruning of start state. */
+
+    if (pruning_strategy->test_prune_initial_state(start_state))
+    {
+        return SearchStatus::FAILED;
+    }
+
+    /* Evaluate the start state. */
+
+    const auto start_num_unsatisfied_goals = static_cast<Index>(goal_counter.count_unsatisfied_goals(start_state));
+    const auto start_num_relaxed_plan_atoms = relaxed_plan_atom_counter.count_relaxed_plan_atoms(start_state, start_num_unsatisfied_goals);
+    auto start_novelty_table_id = Index(0);
+    const auto start_novelty =
+        novelty_tables.compute_novelty_and_update_table(start_state, start_num_unsatisfied_goals, start_num_relaxed_plan_atoms, start_novelty_table_id);
+    m_event_handler->on_evaluate_state(start_state, start_novelty, start_num_unsatisfied_goals, problem, pddl_factories);
+
+    auto start_search_node = get_or_create_search_node(start_state.get_index(), default_search_node, search_nodes);
+    set_status(start_search_node, SearchNodeStatus::OPEN);
+    set_g_value(start_search_node, ContinuousCost(0));
+    set_novelty_table_id(start_search_node, start_novelty_table_id);
+
+    auto best_num_unsatisfied_goals = start_num_unsatisfied_goals;
+    m_event_handler->on_new_best_goal_count(best_num_unsatisfied_goals);
+
+    auto applicable_actions = GroundActionList {};
+    openlist.insert(start_novelty, start_num_unsatisfied_goals, start_state);
+
+    while (!openlist.empty())
+    {
+        const auto state = openlist.top();
+        openlist.pop();
+
+        auto search_node = get_or_create_search_node(state.get_index(), default_search_node, search_nodes);
+
+        /* Avoid unnecessary extra work by testing whether the state was already expanded. */
+
+        if (get_status(search_node) == SearchNodeStatus::CLOSED)
+        {
+            continue;
+        }
+
+        /* Test whether state achieves the dynamic goal. */
+
+        if (goal_strategy->test_dynamic_goal(state))
+        {
+            set_plan(search_nodes, m_aag->get_ground_actions(), search_node, out_plan);
+            out_goal_state = state;
+            m_event_handler->on_end_search();
+            if (!m_event_handler->is_quiet())
+            {
+                m_aag->on_end_search();
+            }
+            m_event_handler->on_solved(out_plan, pddl_factories);
+
+            return SearchStatus::SOLVED;
+        }
+
+        /* Expand the successors of the state. */
+
+        m_event_handler->on_expand_state(state, problem, pddl_factories);
+
+        m_aag->generate_applicable_actions(state, applicable_actions);
+
+        for (const auto& action : applicable_actions)
+        {
+            const auto successor_state = m_ssg->get_or_create_successor_state(state, action);
+            auto successor_search_node = get_or_create_search_node(successor_state.get_index(), default_search_node, search_nodes);
+
+            m_event_handler->on_generate_state(successor_state, action, problem, pddl_factories);
+
+            const bool is_new_successor_state = (get_status(successor_search_node) == SearchNodeStatus::NEW);
+
+            /* Customization point 1: pruning strategy, default never prunes. */
+
+            if (pruning_strategy->test_prune_successor_state(state, successor_state, is_new_successor_state))
+            {
+                m_event_handler->on_prune_state(successor_state, problem, pddl_factories);
+                continue;
+            }
+
+            /* States are evaluated once when they are generated for the first time. */
+
+            if (!is_new_successor_state)
+            {
+                continue;
+            }
+
+            const auto num_unsatisfied_goals = static_cast<Index>(goal_counter.count_unsatisfied_goals(successor_state));
+            const auto num_relaxed_plan_atoms = relaxed_plan_atom_counter.count_relaxed_plan_atoms(successor_state, num_unsatisfied_goals);
+            auto novelty_table_id = Index(0);
+            const auto novelty = novelty_tables.compute_novelty_and_update_table(state,
+                                                                                 successor_state,
+                                                                                 get_novelty_table_id(search_node),
+                                                                                 num_unsatisfied_goals,
+                                                                                 num_relaxed_plan_atoms,
+                                                                                 novelty_table_id);
+            m_event_handler->on_evaluate_state(successor_state, novelty, num_unsatisfied_goals, problem, pddl_factories);
+
+            if (num_unsatisfied_goals < best_num_unsatisfied_goals)
+            {
+                best_num_unsatisfied_goals = num_unsatisfied_goals;
+                m_event_handler->on_new_best_goal_count(best_num_unsatisfied_goals);
+            }
+
+            if (m_options.prune_non_novel_states && novelty > m_options.max_arity)
+            {
+                m_event_handler->on_prune_state(successor_state, problem, pddl_factories);
+                continue;
+            }
+
+            set_status(successor_search_node, SearchNodeStatus::OPEN);
+            set_parent_state(successor_search_node, state.get_index());
+            set_creating_action(successor_search_node, action.get_index());
+            set_g_value(successor_search_node, get_g_value(search_node) + action.get_cost());
+            set_novelty_table_id(successor_search_node, novelty_table_id);
+
+            openlist.insert(novelty, num_unsatisfied_goals, successor_state);
+        }
+
+        /* Close state. */
+
+        set_status(search_node, SearchNodeStatus::CLOSED);
+    }
+
+    m_event_handler->on_end_search();
+    m_event_handler->on_exhausted();
+
+    return SearchStatus::EXHAUSTED;
+}
+
+const std::shared_ptr<PDDLFactories>& BFWSAlgorithm::get_pddl_factories() const { return m_aag->get_pddl_factories(); }
+
+const BFWSAlgorithmOptions& BFWSAlgorithm::get_options() const { return m_options; }
+
+}
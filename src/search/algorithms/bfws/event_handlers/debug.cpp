@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "mimir/search/algorithms/bfws/event_handlers/debug.hpp"
+
+#include "mimir/common/printers.hpp"
+#include "mimir/search/plan.hpp"
+
+namespace mimir
+{
+void DebugBFWSAlgorithmEventHandler::on_expand_state_impl(State state, Problem problem, const PDDLFactories& pddl_factories) const
+{
+    std::cout << "[BFWS] ----------------------------------------\n"
+              << "[BFWS] State: " << std::make_tuple(problem, state, std::cref(pddl_factories)) << std::endl
+              << std::endl;
+}
+
+void DebugBFWSAlgorithmEventHandler::on_generate_state_impl(State state, GroundAction action, Problem problem, const PDDLFactories& pddl_factories) const
+{
+    std::cout << "[BFWS] Action: " << std::make_tuple(action, std::cref(pddl_factories)) << "\n"
+              << "[BFWS] Successor: " << std::make_tuple(problem, state, std::cref(pddl_factories)) << "\n"
+              << std::endl;
+}
+
+void DebugBFWSAlgorithmEventHandler::on_evaluate_state_impl(State state,
+                                                            size_t novelty,
+                                                            size_t num_unsatisfied_goals,
+                                                            Problem problem,
+                                                            const PDDLFactories& pddl_factories) const
+{
+    std::cout << "[BFWS] Novelty: " << novelty << "\n"
+              << "[BFWS] Number of unsatisfied goals: " << num_unsatisfied_goals << std::endl;
+}
+
+void DebugBFWSAlgorithmEventHandler::on_new_best_goal_count_impl(size_t num_unsatisfied_goals, uint64_t num_expanded_states, uint64_t num_generated_states) const
+{
+    std::cout << "[BFWS] New best goal count " << num_unsatisfied_goals << " with num expanded states " << num_expanded_states << " and num generated states "
+              << num_generated_states << std::endl;
+}
+
+void DebugBFWSAlgorithmEventHandler::on_prune_state_impl(State state, Problem problem, const PDDLFactories& pddl_factories) const {}
+
+void DebugBFWSAlgorithmEventHandler::on_create_novelty_table_impl(size_t num_unsatisfied_goals, size_t num_relaxed_plan_atoms) const
+{
+    std::cout << "[BFWS] Create novelty table for " << num_unsatisfied_goals << " unsatisfied goals and " << num_relaxed_plan_atoms
+              << " achieved relaxed plan atoms" << std::endl;
+}
+
+void DebugBFWSAlgorithmEventHandler::on_evict_novelty_table_impl(size_t num_unsatisfied_goals, size_t num_relaxed_plan_atoms) const
+{
+    std::cout << "[BFWS] Evict novelty table for " << num_unsatisfied_goals << " unsatisfied goals and " << num_relaxed_plan_atoms
+              << " achieved relaxed plan atoms" << std::endl;
+}
+
+void DebugBFWSAlgorithmEventHandler::on_start_search_impl(State start_state, Problem problem, const PDDLFactories& pddl_factories) const
+{
+    std::cout << "[BFWS] Search started.\n"
+              << "[BFWS] Initial: " << std::make_tuple(problem, start_state, std::cref(pddl_factories)) << std::endl;
+}
+
+void DebugBFWSAlgorithmEventHandler::on_end_search_impl() const { std::cout << "[BFWS] Search ended.\n" << m_statistics << std::endl; }
+
+void DebugBFWSAlgorithmEventHandler::on_solved_impl(const GroundActionList& ground_action_plan, const PDDLFactories& pddl_factories) const
+{
+    auto plan = to_plan(ground_action_plan, pddl_factories);
+    std::cout << "[BFWS] Plan found.\n"
+              << "[BFWS] Plan cost: " << plan.get_cost() << "\n"
+              << "[BFWS] Plan length: " << plan.get_actions().size() << std::endl;
+    for (size_t i = 0; i < plan.get_actions().size(); ++i)
+    {
+        std::cout << "[BFWS] " << i + 1 << ". " << plan.get_actions()[i] << std::endl;
+    }
+}
+
+void DebugBFWSAlgorithmEventHandler::on_unsolvable_impl() const { std::cout << "[BFWS] Unsolvable!" << std::endl; }
+
+void DebugBFWSAlgorithmEventHandler::on_exhausted_impl() const { std::cout << "[BFWS] Exhausted!" << std::endl; }
+}
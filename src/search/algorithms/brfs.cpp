@@ -22,7 +22,10 @@
 #include "mimir/search/algorithms/brfs/event_handlers/interface.hpp"
 #include "mimir/search/algorithms/strategies/goal_strategy.hpp"
 #include "mimir/search/algorithms/strategies/pruning_strategy.hpp"
+#include "mimir/search/applicable_action_generators/grounded.hpp"
 #include "mimir/search/applicable_action_generators/interface.hpp"
+#include "mimir/search/delta_state_repository.hpp"
+#include "mimir/search/packed_state_repository.hpp"
 #include "mimir/search/search_node.hpp"
 #include "mimir/search/state_repository.hpp"
 
@@ -73,6 +76,30 @@ BrFSAlgorithm::BrFSAlgorithm(std::shared_ptr<IApplicableActionGenerator> applica
                              std::shared_ptr<IBrFSAlgorithmEventHandler> event_handler) :
     m_aag(std::move(applicable_action_generator)),
     m_ssg(std::move(successor_state_generator)),
+    m_packed_ssg(nullptr),
+    m_delta_ssg(nullptr),
+    m_event_handler(std::move(event_handler))
+{
+}
+
+BrFSAlgorithm::BrFSAlgorithm(std::shared_ptr<GroundedApplicableActionGenerator> applicable_action_generator,
+                             std::shared_ptr<PackedStateRepository> packed_state_repository,
+                             std::shared_ptr<IBrFSAlgorithmEventHandler> event_handler) :
+    m_aag(applicable_action_generator),
+    m_ssg(std::make_shared<StateRepository>(std::move(applicable_action_generator))),
+    m_packed_ssg(std::move(packed_state_repository)),
+    m_delta_ssg(nullptr),
+    m_event_handler(std::move(event_handler))
+{
+}
+
+BrFSAlgorithm::BrFSAlgorithm(std::shared_ptr<IApplicableActionGenerator> applicable_action_generator,
+                             std::shared_ptr<DeltaStateRepository> delta_state_repository,
+                             std::shared_ptr<IBrFSAlgorithmEventHandler> event_handler) :
+    m_aag(applicable_action_generator),
+    m_ssg(std::make_shared<StateRepository>(std::move(applicable_action_generator))),
+    m_packed_ssg(nullptr),
+    m_delta_ssg(std::move(delta_state_repository)),
     m_event_handler(std::move(event_handler))
 {
 }
@@ -96,6 +123,15 @@ SearchStatus BrFSAlgorithm::find_solution(State start_state,
                                           GroundActionList& out_plan,
                                           std::optional<State>& out_goal_state)
 {
+    if (m_packed_ssg)
+    {
+        return find_solution_compressed(*m_packed_ssg, start_state, std::move(goal_strategy), std::move(pruning_strategy), out_plan, out_goal_state);
+    }
+    if (m_delta_ssg)
+    {
+        return find_solution_compressed(*m_delta_ssg, start_state, std::move(goal_strategy), std::move(pruning_strategy), out_plan, out_goal_state);
+    }
+
     auto default_search_node =
         BrFSSearchNodeImpl { SearchNodeStatus::NEW, std::numeric_limits<Index>::max(), std::numeric_limits<Index>::max(), DiscreteCost(0) };
     auto search_nodes = cista::storage::Vector<BrFSSearchNodeImpl>();
@@ -193,6 +229,117 @@ SearchStatus BrFSAlgorithm::find_solution(State start_state,
     return SearchStatus::EXHAUSTED;
 }
 
+template<typename CompressedStateRepository>
+SearchStatus BrFSAlgorithm::find_solution_compressed(CompressedStateRepository& compressed_ssg,
+                                                     State start_state,
+                                                     std::unique_ptr<IGoalStrategy>&& goal_strategy,
+                                                     std::unique_ptr<IPruningStrategy>&& pruning_strategy,
+                                                     GroundActionList& out_plan,
+                                                     std::optional<State>& out_goal_state)
+{
+    auto default_search_node =
+        BrFSSearchNodeImpl { SearchNodeStatus::NEW, std::numeric_limits<Index>::max(), std::numeric_limits<Index>::max(), DiscreteCost(0) };
+    auto search_nodes = cista::storage::Vector<BrFSSearchNodeImpl>();
+    // The queue stores the indices of the compressed states.
+    auto queue = std::deque<Index>();
+
+    const auto problem = m_aag->get_problem();
+    const auto& pddl_factories = *m_aag->get_pddl_factories();
+    m_event_handler->on_start_search(start_state, problem, pddl_factories);
+
+    const auto start_state_index = compressed_ssg.get_or_create_state(start_state.get_atoms<Fluent>());
+    auto start_search_node = get_or_create_search_node(start_state_index, default_search_node, search_nodes);
+    set_status(start_search_node, SearchNodeStatus::OPEN);
+    set_g_value(start_search_node, 0);
+
+    if (!goal_strategy->test_static_goal())
+    {
+        m_event_handler->on_unsolvable();
+
+        return SearchStatus::UNSOLVABLE;
+    }
+
+    auto applicable_actions = GroundActionList {};
+
+    if (pruning_strategy->test_prune_initial_state(start_state))
+    {
+        return SearchStatus::FAILED;
+    }
+
+    queue.emplace_back(start_state_index);
+
+    auto state_builder = StateBuilder();
+    auto successor_state_builder = StateBuilder();
+    auto g_value = DiscreteCost(0);
+
+    while (!queue.empty())
+    {
+        const auto state = compressed_ssg.unpack_state(queue.front(), state_builder);
+        queue.pop_front();
+
+        // We need this before goal test for correct statistics reporting.
+        auto search_node = get_or_create_search_node(state.get_index(), default_search_node, search_nodes);
+
+        if (get_g_value(search_node) > g_value)
+        {
+            g_value = get_g_value(search_node);
+            m_aag->on_finish_search_layer();
+            m_event_handler->on_finish_g_layer();
+        }
+
+        if (goal_strategy->test_dynamic_goal(state))
+        {
+            set_plan(search_nodes, m_aag->get_ground_actions(), search_node, out_plan);
+            // The unpacked state is only a view on the state builder, hence, we store the goal state persistently.
+            out_goal_state = m_ssg->get_or_create_state(state.get_atoms<Fluent>());
+            m_event_handler->on_end_search();
+            if (!m_event_handler->is_quiet())
+            {
+                m_aag->on_end_search();
+            }
+            m_event_handler->on_solved(out_plan, pddl_factories);
+
+            return SearchStatus::SOLVED;
+        }
+
+        m_event_handler->on_expand_state(state, problem, pddl_factories);
+
+        this->m_aag->generate_applicable_actions(state, applicable_actions);
+
+        for (const auto& action : applicable_actions)
+        {
+            /* Open state. */
+            const auto successor_state_index = compressed_ssg.get_or_create_successor_state(state, action);
+            const auto successor_state = compressed_ssg.unpack_state(successor_state_index, successor_state_builder);
+            auto successor_search_node = get_or_create_search_node(successor_state_index, default_search_node, search_nodes);
+
+            m_event_handler->on_generate_state(successor_state, action, problem, pddl_factories);
+
+            const bool is_new_successor_state = (get_status(successor_search_node) == SearchNodeStatus::NEW);
+            if (pruning_strategy->test_prune_successor_state(state, successor_state, is_new_successor_state))
+            {
+                m_event_handler->on_prune_state(successor_state, problem, pddl_factories);
+                continue;
+            }
+
+            set_status(successor_search_node, SearchNodeStatus::OPEN);
+            set_parent_state(successor_search_node, state.get_index());
+            set_creating_action(successor_search_node, action.get_index());
+            set_g_value(successor_search_node, get_g_value(search_node) + 1);
+
+            queue.emplace_back(successor_state_index);
+        }
+
+        /* Close state. */
+        set_status(search_node, SearchNodeStatus::CLOSED);
+    }
+
+    m_event_handler->on_end_search();
+    m_event_handler->on_exhausted();
+
+    return SearchStatus::EXHAUSTED;
+}
+
 const std::shared_ptr<PDDLFactories>& BrFSAlgorithm::get_pddl_factories() const { return m_aag->get_pddl_factories(); }
 
 }
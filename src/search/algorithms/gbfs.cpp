@@ -0,0 +1,529 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "mimir/search/algorithms/gbfs.hpp"
+
+#include "mimir/search/algorithms/gbfs/event_handlers.hpp"
+#include "mimir/search/algorithms/strategies/goal_strategy.hpp"
+#include "mimir/search/algorithms/strategies/pruning_strategy.hpp"
+#include "mimir/search/heuristics/interface.hpp"
+#include "mimir/search/openlists/alternating.hpp"
+#include "mimir/search/search_node.hpp"
+#include "mimir/search/state_repository.hpp"
+
+#include <limits>
+#include <optional>
+#include <stdexcept>
+
+namespace mimir
+{
+
+/**
+ * GBFS search node
+ */
+
+using GBFSSearchNodeImpl = SearchNodeImpl<ContinuousCost, ContinuousCost>;
+using GBFSSearchNode = GBFSSearchNodeImpl*;
+using ConstGBFSSearchNode = const GBFSSearchNodeImpl*;
+
+static void set_g_value(GBFSSearchNode node, ContinuousCost g_value) { return set_property<0>(node, g_value); }
+static void set_h_value(GBFSSearchNode node, ContinuousCost h_value) { return set_property<1>(node, h_value); }
+
+static ContinuousCost get_g_value(ConstGBFSSearchNode node) { return get_property<0>(node); }
+static ContinuousCost get_h_value(ConstGBFSSearchNode node) { return get_property<1>(node); }
+
+static GBFSSearchNode
+get_or_create_search_node(size_t state_index, const GBFSSearchNodeImpl& default_node, cista::storage::Vector<GBFSSearchNodeImpl>& search_nodes)
+{
+    while (state_index >= search_nodes.size())
+    {
+        search_nodes.push_back(default_node);
+    }
+    return search_nodes[state_index];
+}
+
+static GBFSSearchNodeImpl create_default_search_node()
+{
+    return GBFSSearchNodeImpl { SearchNodeStatus::NEW,
+                                std::numeric_limits<Index>::max(),
+                                std::numeric_limits<Index>::max(),
+                                std::numeric_limits<ContinuousCost>::infinity(),
+                                ContinuousCost(0) };
+}
+
+/// @brief Entry of the open list in lazy search.
+/// The successor of `state` under `action` is generated when the entry is removed from the open list.
+/// The entry of the start state has no action.
+struct LazyOpenListEntry
+{
+    State state;
+    std::optional<GroundAction> action;
+};
+
+/**
+ * GBFS
+ */
+
+GBFSAlgorithm::GBFSAlgorithm(std::shared_ptr<IApplicableActionGenerator> applicable_action_generator,
+                             std::shared_ptr<IHeuristic> heuristic,
+                             GBFSAlgorithmOptions options) :
+    GBFSAlgorithm(applicable_action_generator,
+                  std::make_shared<StateRepository>(applicable_action_generator),
+                  std::move(heuristic),
+                  std::make_shared<DefaultGBFSAlgorithmEventHandler>(),
+                  options)
+{
+}
+
+GBFSAlgorithm::GBFSAlgorithm(std::shared_ptr<IApplicableActionGenerator> applicable_action_generator,
+                             std::shared_ptr<StateRepository> successor_state_generator,
+                             std::shared_ptr<IHeuristic> heuristic,
+                             std::shared_ptr<IGBFSAlgorithmEventHandler> event_handler,
+                             GBFSAlgorithmOptions options) :
+    m_aag(std::move(applicable_action_generator)),
+    m_ssg(std::move(successor_state_generator)),
+    m_heuristic(std::move(heuristic)),
+    m_event_handler(std::move(event_handler)),
+    m_options(options)
+{
+}
+
+SearchStatus GBFSAlgorithm::find_solution(GroundActionList& out_plan) { return find_solution(m_ssg->get_or_create_initial_state(), out_plan); }
+
+SearchStatus GBFSAlgorithm::find_solution(State start_state, GroundActionList& out_plan)
+{
+    std::optional<State> unused_out_state = std::nullopt;
+    return find_solution(start_state, out_plan, unused_out_state);
+}
+
+SearchStatus GBFSAlgorithm::find_solution(State start_state, GroundActionList& out_plan, std::optional<State>& out_goal_state)
+{
+    return find_solution(start_state, std::make_unique<ProblemGoal>(m_aag->get_problem()), std::make_unique<NoStatePruning>(), out_plan, out_goal_state);
+}
+
+SearchStatus GBFSAlgorithm::find_solution(State start_state,
+                                          std::unique_ptr<IGoalStrategy>&& goal_strategy,
+                                          std::unique_ptr<IPruningStrategy>&& pruning_strategy,
+                                          GroundActionList& out_plan,
+                                          std::optional<State>& out_goal_state)
+{
+    switch (m_options.evaluation)
+    {
+        case HeuristicEvaluation::EAGER:
+        {
+            return find_solution_eager(start_state, *goal_strategy, *pruning_strategy, out_plan, out_goal_state);
+        }
+        case HeuristicEvaluation::LAZY:
+        {
+            return find_solution_lazy(start_state, *goal_strategy, *pruning_strategy, out_plan, out_goal_state);
+        }
+        default:
+        {
+            throw std::logic_error("GBFSAlgorithm::find_solution(...): Missing implementation for HeuristicEvaluation.");
+        }
+    }
+}
+
+SearchStatus GBFSAlgorithm::find_solution_eager(State start_state,
+                                                IGoalStrategy& goal_strategy,
+                                                IPruningStrategy& pruning_strategy,
+                                                GroundActionList& out_plan,
+                                                std::optional<State>& out_goal_state)
+{
+    const auto default_search_node = create_default_search_node();
+    auto search_nodes = cista::storage::Vector<GBFSSearchNodeImpl>();
+
+    auto openlist = AlternatingOpenList<State>();
+
+    const auto problem = m_aag->get_problem();
+    const auto& pddl_factories = *m_aag->get_pddl_factories();
+    m_event_handler->on_start_search(start_state, problem, pddl_factories);
+
+    const auto compute_priority = [this](ContinuousCost g_value, ContinuousCost h_value)
+    { return m_options.g_weight * g_value + m_options.h_weight * h_value; };
+
+    const auto start_g_value = ContinuousCost(0);
+    const auto start_h_value = m_heuristic->compute_heuristic(start_state);
+    m_event_handler->on_evaluate_state(start_state, start_h_value, problem, pddl_factories);
+    auto last_evaluated_state_index = start_state.get_index();
+
+    auto start_search_node = get_or_create_search_node(start_state.get_index(), default_search_node, search_nodes);
+    set_status(start_search_node, (start_h_value == std::numeric_limits<ContinuousCost>::infinity()) ? SearchNodeStatus::DEAD_END : SearchNodeStatus::OPEN);
+    set_g_value(start_search_node, start_g_value);
+    set_h_value(start_search_node, start_h_value);
+
+    /* Test whether start state is deadend. */
+
+    if (get_status(start_search_node) == SearchNodeStatus::DEAD_END)
+    {
+        m_event_handler->on_unsolvable();
+
+        return SearchStatus::UNSOLVABLE;
+    }
+
+    /* Test static goal. */
+
+    if (!goal_strategy.test_static_goal())
+    {
+        m_event_handler->on_unsolvable();
+
+        return SearchStatus::UNSOLVABLE;
+    }
+
+    /* Test pruning of start state. */
+
+    if (pruning_strategy.test_prune_initial_state(start_state))
+    {
+        return SearchStatus::FAILED;
+    }
+
+    auto applicable_actions = GroundActionList {};
+    auto is_preferred_action = std::vector<bool> {};
+    auto best_h_value = std::numeric_limits<ContinuousCost>::infinity();
+    openlist.insert(compute_priority(start_g_value, start_h_value), start_state);
+
+    while (!openlist.empty())
+    {
+        const auto state = openlist.top();
+        openlist.pop();
+
+        auto search_node = get_or_create_search_node(state.get_index(), default_search_node, search_nodes);
+
+        /* Avoid unnecessary extra work by testing whether the state was already expanded. */
+
+        if (get_status(search_node) == SearchNodeStatus::CLOSED)
+        {
+            continue;
+        }
+
+        /* Report search progress. */
+
+        if (get_h_value(search_node) < best_h_value)
+        {
+            best_h_value = get_h_value(search_node);
+            m_event_handler->on_new_best_h_value(best_h_value);
+            if (m_options.use_preferred_actions)
+            {
+                openlist.boost_preferred(m_options.preferred_actions_boost);
+            }
+        }
+
+        /* Test whether state achieves the dynamic goal. */
+
+        if (goal_strategy.test_dynamic_goal(state))
+        {
+            set_plan(search_nodes, m_aag->get_ground_actions(), search_node, out_plan);
+            out_goal_state = state;
+            m_event_handler->on_end_search();
+            if (!m_event_handler->is_quiet())
+            {
+                m_aag->on_end_search();
+            }
+            m_event_handler->on_solved(out_plan, pddl_factories);
+
+            return SearchStatus::SOLVED;
+        }
+
+        /* Expand the successors of the state. */
+
+        m_event_handler->on_expand_state(state, problem, pddl_factories);
+
+        m_aag->generate_applicable_actions(state, applicable_actions);
+
+        /* Obtain the preferred actions before the heuristic is called on the successors. */
+
+        is_preferred_action.assign(applicable_actions.size(), false);
+        if (m_options.use_preferred_actions)
+        {
+            if (last_evaluated_state_index != state.get_index())
+            {
+                // Successors were evaluated since this state was evaluated.
+                const auto h_value = m_heuristic->compute_heuristic(state);
+                m_event_handler->on_evaluate_state(state, h_value, problem, pddl_factories);
+                last_evaluated_state_index = state.get_index();
+            }
+            for (size_t i = 0; i < applicable_actions.size(); ++i)
+            {
+                is_preferred_action[i] = m_heuristic->is_preferred_action(applicable_actions[i]);
+            }
+        }
+
+        for (size_t i = 0; i < applicable_actions.size(); ++i)
+        {
+            const auto& action = applicable_actions[i];
+            const auto successor_state = m_ssg->get_or_create_successor_state(state, action);
+            auto successor_search_node = get_or_create_search_node(successor_state.get_index(), default_search_node, search_nodes);
+
+            m_event_handler->on_generate_state(successor_state, action, problem, pddl_factories);
+
+            const bool is_new_successor_state = (get_status(successor_search_node) == SearchNodeStatus::NEW);
+
+            /* Customization point 1: pruning strategy, default never prunes. */
+
+            if (pruning_strategy.test_prune_successor_state(state, successor_state, is_new_successor_state))
+            {
+                m_event_handler->on_prune_state(successor_state, problem, pddl_factories);
+                continue;
+            }
+
+            if (get_status(successor_search_node) == SearchNodeStatus::DEAD_END)
+            {
+                continue;
+            }
+
+            /* Check whether state must be reopened or not. */
+
+            const auto new_successor_g_value = get_g_value(search_node) + action.get_cost();
+            if (new_successor_g_value < get_g_value(successor_search_node))
+            {
+                if (is_new_successor_state)
+                {
+                    // Compute heuristic if state is new.
+                    const auto successor_h_value = m_heuristic->compute_heuristic(successor_state);
+                    m_event_handler->on_evaluate_state(successor_state, successor_h_value, problem, pddl_factories);
+                    last_evaluated_state_index = successor_state.get_index();
+                    set_h_value(successor_search_node, successor_h_value);
+
+                    if (successor_h_value == std::numeric_limits<ContinuousCost>::infinity())
+                    {
+                        set_status(successor_search_node, SearchNodeStatus::DEAD_END);
+                        continue;
+                    }
+                }
+
+                /* Open/Reopen state with updated priority. */
+
+                set_status(successor_search_node, SearchNodeStatus::OPEN);
+                set_parent_state(successor_search_node, state.get_index());
+                set_creating_action(successor_search_node, action.get_index());
+                set_g_value(successor_search_node, new_successor_g_value);
+
+                const auto successor_priority = compute_priority(get_g_value(successor_search_node), get_h_value(successor_search_node));
+                if (is_preferred_action[i])
+                {
+                    openlist.insert_preferred(successor_priority, successor_state);
+                }
+                else
+                {
+                    openlist.insert(successor_priority, successor_state);
+                }
+            }
+        }
+
+        /* Close state. */
+
+        set_status(search_node, SearchNodeStatus::CLOSED);
+    }
+
+    m_event_handler->on_end_search();
+    m_event_handler->on_exhausted();
+
+    return SearchStatus::EXHAUSTED;
+}
+
+SearchStatus GBFSAlgorithm::find_solution_lazy(State start_state,
+                                               IGoalStrategy& goal_strategy,
+                                               IPruningStrategy& pruning_strategy,
+                                               GroundActionList& out_plan,
+                                               std::optional<State>& out_goal_state)
+{
+    const auto default_search_node = create_default_search_node();
+    auto search_nodes = cista::storage::Vector<GBFSSearchNodeImpl>();
+
+    auto openlist = AlternatingOpenList<LazyOpenListEntry>();
+
+    const auto problem = m_aag->get_problem();
+    const auto& pddl_factories = *m_aag->get_pddl_factories();
+    m_event_handler->on_start_search(start_state, problem, pddl_factories);
+
+    const auto compute_priority = [this](ContinuousCost g_value, ContinuousCost h_value)
+    { return m_options.g_weight * g_value + m_options.h_weight * h_value; };
+
+    const auto start_g_value = ContinuousCost(0);
+    const auto start_h_value = m_heuristic->compute_heuristic(start_state);
+    m_event_handler->on_evaluate_state(start_state, start_h_value, problem, pddl_factories);
+    auto last_evaluated_state_index = start_state.get_index();
+
+    auto start_search_node = get_or_create_search_node(start_state.get_index(), default_search_node, search_nodes);
+    set_status(start_search_node, (start_h_value == std::numeric_limits<ContinuousCost>::infinity()) ? SearchNodeStatus::DEAD_END : SearchNodeStatus::OPEN);
+    set_g_value(start_search_node, start_g_value);
+    set_h_value(start_search_node, start_h_value);
+
+    /* Test whether start state is deadend. */
+
+    if (get_status(start_search_node) == SearchNodeStatus::DEAD_END)
+    {
+        m_event_handler->on_unsolvable();
+
+        return SearchStatus::UNSOLVABLE;
+    }
+
+    /* Test static goal. */
+
+    if (!goal_strategy.test_static_goal())
+    {
+        m_event_handler->on_unsolvable();
+
+        return SearchStatus::UNSOLVABLE;
+    }
+
+    /* Test pruning of start state. */
+
+    if (pruning_strategy.test_prune_initial_state(start_state))
+    {
+        return SearchStatus::FAILED;
+    }
+
+    auto applicable_actions = GroundActionList {};
+    auto best_h_value = std::numeric_limits<ContinuousCost>::infinity();
+    openlist.insert(compute_priority(start_g_value, start_h_value), LazyOpenListEntry { start_state, std::nullopt });
+
+    while (!openlist.empty())
+    {
+        const auto entry = openlist.top();
+        openlist.pop();
+
+        auto state = entry.state;
+        auto search_node = get_or_create_search_node(state.get_index(), default_search_node, search_nodes);
+
+        /* Generate the successor state if the entry was created by an action. */
+
+        if (entry.action.has_value())
+        {
+            const auto& action = entry.action.value();
+            const auto parent_g_value = get_g_value(search_node);
+            const auto parent_state_index = state.get_index();
+
+            state = m_ssg->get_or_create_successor_state(entry.state, action);
+            search_node = get_or_create_search_node(state.get_index(), default_search_node, search_nodes);
+
+            m_event_handler->on_generate_state(state, action, problem, pddl_factories);
+
+            const bool is_new_state = (get_status(search_node) == SearchNodeStatus::NEW);
+
+            /* Customization point 1: pruning strategy, default never prunes. */
+
+            if (pruning_strategy.test_prune_successor_state(entry.state, state, is_new_state))
+            {
+                m_event_handler->on_prune_state(state, problem, pddl_factories);
+                continue;
+            }
+
+            /* Skip dead ends and states that were already reached with smaller or equal cost. */
+
+            const auto new_g_value = parent_g_value + action.get_cost();
+            if (get_status(search_node) == SearchNodeStatus::DEAD_END || new_g_value >= get_g_value(search_node))
+            {
+                continue;
+            }
+
+            set_parent_state(search_node, parent_state_index);
+            set_creating_action(search_node, action.get_index());
+            set_g_value(search_node, new_g_value);
+
+            /* Deferred evaluation */
+
+            if (is_new_state)
+            {
+                const auto h_value = m_heuristic->compute_heuristic(state);
+                m_event_handler->on_evaluate_state(state, h_value, problem, pddl_factories);
+                last_evaluated_state_index = state.get_index();
+                set_h_value(search_node, h_value);
+
+                if (h_value == std::numeric_limits<ContinuousCost>::infinity())
+                {
+                    set_status(search_node, SearchNodeStatus::DEAD_END);
+                    continue;
+                }
+            }
+            set_status(search_node, SearchNodeStatus::OPEN);
+        }
+
+        const auto g_value = get_g_value(search_node);
+        const auto h_value = get_h_value(search_node);
+
+        /* Report search progress. */
+
+        if (h_value < best_h_value)
+        {
+            best_h_value = h_value;
+            m_event_handler->on_new_best_h_value(best_h_value);
+            if (m_options.use_preferred_actions)
+            {
+                openlist.boost_preferred(m_options.preferred_actions_boost);
+            }
+        }
+
+        /* Test whether state achieves the dynamic goal. */
+
+        if (goal_strategy.test_dynamic_goal(state))
+        {
+            set_plan(search_nodes, m_aag->get_ground_actions(), search_node, out_plan);
+            out_goal_state = state;
+            m_event_handler->on_end_search();
+            if (!m_event_handler->is_quiet())
+            {
+                m_aag->on_end_search();
+            }
+            m_event_handler->on_solved(out_plan, pddl_factories);
+
+            return SearchStatus::SOLVED;
+        }
+
+        /* Expand the state by inserting its successors with the heuristic value of the state. */
+
+        m_event_handler->on_expand_state(state, problem, pddl_factories);
+
+        m_aag->generate_applicable_actions(state, applicable_actions);
+
+        if (m_options.use_preferred_actions && last_evaluated_state_index != state.get_index())
+        {
+            // The state is reopened, hence, we must recompute the preferred actions.
+            const auto h_value = m_heuristic->compute_heuristic(state);
+            m_event_handler->on_evaluate_state(state, h_value, problem, pddl_factories);
+            last_evaluated_state_index = state.get_index();
+        }
+
+        for (const auto& action : applicable_actions)
+        {
+            const auto successor_priority = compute_priority(g_value + action.get_cost(), h_value);
+            if (m_options.use_preferred_actions && m_heuristic->is_preferred_action(action))
+            {
+                openlist.insert_preferred(successor_priority, LazyOpenListEntry { state, action });
+            }
+            else
+            {
+                openlist.insert(successor_priority, LazyOpenListEntry { state, action });
+            }
+        }
+
+        /* Close state. */
+
+        set_status(search_node, SearchNodeStatus::CLOSED);
+    }
+
+    m_event_handler->on_end_search();
+    m_event_handler->on_exhausted();
+
+    return SearchStatus::EXHAUSTED;
+}
+
+const std::shared_ptr<PDDLFactories>& GBFSAlgorithm::get_pddl_factories() const { return m_aag->get_pddl_factories(); }
+
+const GBFSAlgorithmOptions& GBFSAlgorithm::get_options() const { return m_options; }
+
+}
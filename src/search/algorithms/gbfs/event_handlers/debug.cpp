@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "mimir/search/algorithms/gbfs/event_handlers/debug.hpp"
+
+#include "mimir/common/printers.hpp"
+#include "mimir/search/plan.hpp"
+
+namespace mimir
+{
+void DebugGBFSAlgorithmEventHandler::on_expand_state_impl(State state, Problem problem, const PDDLFactories& pddl_factories) const
+{
+    std::cout << "[GBFS] ----------------------------------------\n"
+              << "[GBFS] State: " << std::make_tuple(problem, state, std::cref(pddl_factories)) << std::endl
+              << std::endl;
+}
+
+void DebugGBFSAlgorithmEventHandler::on_generate_state_impl(State state, GroundAction action, Problem problem, const PDDLFactories& pddl_factories) const
+{
+    std::cout << "[GBFS] Action: " << std::make_tuple(action, std::cref(pddl_factories)) << "\n"
+              << "[GBFS] Successor: " << std::make_tuple(problem, state, std::cref(pddl_factories)) << "\n"
+              << std::endl;
+}
+
+void DebugGBFSAlgorithmEventHandler::on_evaluate_state_impl(State state, double h_value, Problem problem, const PDDLFactories& pddl_factories) const
+{
+    std::cout << "[GBFS] Heuristic value: " << h_value << std::endl;
+}
+
+void DebugGBFSAlgorithmEventHandler::on_new_best_h_value_impl(double h_value, uint64_t num_expanded_states, uint64_t num_generated_states) const
+{
+    std::cout << "[GBFS] New best h-value " << h_value << " with num expanded states " << num_expanded_states << " and num generated states "
+              << num_generated_states << std::endl;
+}
+
+void DebugGBFSAlgorithmEventHandler::on_prune_state_impl(State state, Problem problem, const PDDLFactories& pddl_factories) const {}
+
+void DebugGBFSAlgorithmEventHandler::on_start_search_impl(State start_state, Problem problem, const PDDLFactories& pddl_factories) const
+{
+    std::cout << "[GBFS] Search started.\n"
+              << "[GBFS] Initial: " << std::make_tuple(problem, start_state, std::cref(pddl_factories)) << std::endl;
+}
+
+void DebugGBFSAlgorithmEventHandler::on_end_search_impl() const { std::cout << "[GBFS] Search ended.\n" << m_statistics << std::endl; }
+
+void DebugGBFSAlgorithmEventHandler::on_solved_impl(const GroundActionList& ground_action_plan, const PDDLFactories& pddl_factories) const
+{
+    auto plan = to_plan(ground_action_plan, pddl_factories);
+    std::cout << "[GBFS] Plan found.\n"
+              << "[GBFS] Plan cost: " << plan.get_cost() << "\n"
+              << "[GBFS] Plan length: " << plan.get_actions().size() << std::endl;
+    for (size_t i = 0; i < plan.get_actions().size(); ++i)
+    {
+        std::cout << "[GBFS] " << i + 1 << ". " << plan.get_actions()[i] << std::endl;
+    }
+}
+
+void DebugGBFSAlgorithmEventHandler::on_unsolvable_impl() const { std::cout << "[GBFS] Unsolvable!" << std::endl; }
+
+void DebugGBFSAlgorithmEventHandler::on_exhausted_impl() const { std::cout << "[GBFS] Exhausted!" << std::endl; }
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "mimir/search/algorithms/gbfs/event_handlers/default.hpp"
+
+#include "mimir/common/printers.hpp"
+#include "mimir/search/plan.hpp"
+
+namespace mimir
+{
+void DefaultGBFSAlgorithmEventHandler::on_expand_state_impl(State state, Problem problem, const PDDLFactories& pddl_factories) const {}
+
+void DefaultGBFSAlgorithmEventHandler::on_generate_state_impl(State state, GroundAction action, Problem problem, const PDDLFactories& pddl_factories) const {}
+
+void DefaultGBFSAlgorithmEventHandler::on_evaluate_state_impl(State state, double h_value, Problem problem, const PDDLFactories& pddl_factories) const {}
+
+void DefaultGBFSAlgorithmEventHandler::on_new_best_h_value_impl(double h_value, uint64_t num_expanded_states, uint64_t num_generated_states) const
+{
+    std::cout << "[GBFS] New best h-value " << h_value << " with num expanded states " << num_expanded_states << " and num generated states "
+              << num_generated_states << std::endl;
+}
+
+void DefaultGBFSAlgorithmEventHandler::on_prune_state_impl(State state, Problem problem, const PDDLFactories& pddl_factories) const {}
+
+void DefaultGBFSAlgorithmEventHandler::on_start_search_impl(State start_state, Problem problem, const PDDLFactories& pddl_factories) const
+{  //
+    std::cout << "[GBFS] Search started." << std::endl;
+}
+
+void DefaultGBFSAlgorithmEventHandler::on_end_search_impl() const { std::cout << "[GBFS] Search ended.\n" << m_statistics << std::endl; }
+
+void DefaultGBFSAlgorithmEventHandler::on_solved_impl(const GroundActionList& ground_action_plan, const PDDLFactories& pddl_factories) const
+{
+    auto plan = to_plan(ground_action_plan, pddl_factories);
+    std::cout << "[GBFS] Plan found.\n"
+              << "[GBFS] Plan cost: " << plan.get_cost() << "\n"
+              << "[GBFS] Plan length: " << plan.get_actions().size() << std::endl;
+    for (size_t i = 0; i < plan.get_actions().size(); ++i)
+    {
+        std::cout << "[GBFS] " << i + 1 << ". " << plan.get_actions()[i] << std::endl;
+    }
+}
+
+void DefaultGBFSAlgorithmEventHandler::on_unsolvable_impl() const { std::cout << "[GBFS] Unsolvable!" << std::endl; }
+
+void DefaultGBFSAlgorithmEventHandler::on_exhausted_impl() const { std::cout << "[GBFS] Exhausted!" << std::endl; }
+}
@@ -0,0 +1,571 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "mimir/search/algorithms/hdastar.hpp"
+
+#include "mimir/algorithms/BS_thread_pool.hpp"
+#include "mimir/algorithms/mpsc_queue.hpp"
+#include "mimir/common/hash_cista.hpp"
+#include "mimir/search/algorithms/hdastar/event_handlers.hpp"
+#include "mimir/search/algorithms/strategies/goal_strategy.hpp"
+#include "mimir/search/applicable_action_generators/grounded.hpp"
+#include "mimir/search/heuristics/interface.hpp"
+#include "mimir/search/openlists/priority_queue.hpp"
+#include "mimir/search/search_node.hpp"
+#include "mimir/search/state_repository.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <limits>
+#include <mutex>
+#include <tuple>
+
+namespace mimir
+{
+
+/**
+ * HDAStar search node
+ */
+
+/// The third property is the worker that owns the parent state.
+using HDAStarSearchNodeImpl = SearchNodeImpl<ContinuousCost, ContinuousCost, Index>;
+using HDAStarSearchNode = HDAStarSearchNodeImpl*;
+using ConstHDAStarSearchNode = const HDAStarSearchNodeImpl*;
+
+static void set_g_value(HDAStarSearchNode node, ContinuousCost g_value) { return set_property<0>(node, g_value); }
+static void set_h_value(HDAStarSearchNode node, ContinuousCost h_value) { return set_property<1>(node, h_value); }
+static void set_parent_worker(HDAStarSearchNode node, Index worker) { return set_property<2>(node, worker); }
+
+static ContinuousCost get_g_value(ConstHDAStarSearchNode node) { return get_property<0>(node); }
+static ContinuousCost get_h_value(ConstHDAStarSearchNode node) { return get_property<1>(node); }
+static Index get_parent_worker(ConstHDAStarSearchNode node) { return get_property<2>(node); }
+
+static HDAStarSearchNode
+get_or_create_search_node(size_t state_index, const HDAStarSearchNodeImpl& default_node, cista::storage::Vector<HDAStarSearchNodeImpl>& search_nodes)
+{
+    while (state_index >= search_nodes.size())
+    {
+        search_nodes.push_back(default_node);
+    }
+    return search_nodes[state_index];
+}
+
+/**
+ * Communication between workers
+ */
+
+static constexpr Index NO_INDEX = std::numeric_limits<Index>::max();
+
+/// @brief A successor that was generated by another worker.
+struct HDAStarMessage
+{
+    FlatBitset fluent_atoms;
+    ContinuousCost g_value;
+    Index parent_worker;
+    Index parent_state;
+    Index creating_action;
+};
+
+using HDAStarMessageBatch = std::vector<HDAStarMessage>;
+
+/// @brief Return the worker that owns the state with the given fluent atoms.
+static size_t get_owner(const FlatBitset& fluent_atoms, size_t num_workers)
+{
+    // Remix the hash value because the workers use it for their state sets as well.
+    const auto hash = static_cast<uint64_t>(std::hash<FlatBitset>()(fluent_atoms)) * 0x9E3779B97F4A7C15ULL;
+    return (hash >> 32) % num_workers;
+}
+
+/// @brief `HDAStarSharedData` encapsulates the data that is accessed by all workers.
+struct HDAStarSharedData
+{
+    std::vector<std::unique_ptr<MPSCQueue<HDAStarMessageBatch>>> inboxes;
+    /// @brief The number of batches that were sent but not yet processed by their receiver.
+    std::atomic<int64_t> num_in_flight;
+
+    /// @brief The cost of the best plan found so far, read without locking to prune states.
+    std::atomic<ContinuousCost> incumbent_cost;
+    std::mutex incumbent_mutex;
+    Index incumbent_worker;
+    std::optional<State> incumbent_state;
+
+    /// @brief A worker is idle if its open list contains no state with an f-value below the incumbent cost.
+    /// The search terminates once all workers are idle and no batches are in flight.
+    std::mutex termination_mutex;
+    std::condition_variable termination_cv;
+    std::atomic<size_t> num_idle;
+    bool terminated;
+
+    explicit HDAStarSharedData(size_t num_workers) :
+        inboxes(),
+        num_in_flight(0),
+        incumbent_cost(std::numeric_limits<ContinuousCost>::infinity()),
+        incumbent_mutex(),
+        incumbent_worker(NO_INDEX),
+        incumbent_state(std::nullopt),
+        termination_mutex(),
+        termination_cv(),
+        num_idle(0),
+        terminated(false)
+    {
+        for (size_t i = 0; i < num_workers; ++i)
+        {
+            inboxes.push_back(std::make_unique<MPSCQueue<HDAStarMessageBatch>>());
+        }
+    }
+};
+
+/**
+ * Worker
+ */
+
+class HDAStarWorker
+{
+private:
+    Index m_index;
+    HDAStarSharedData& m_shared;
+    const HDAStarAlgorithmOptions& m_options;
+
+    std::shared_ptr<GroundedApplicableActionGenerator> m_aag;
+    std::shared_ptr<StateRepository> m_ssg;
+    std::shared_ptr<IHeuristic> m_heuristic;
+    ProblemGoal m_goal_strategy;
+
+    HDAStarSearchNodeImpl m_default_search_node;
+    cista::storage::Vector<HDAStarSearchNodeImpl> m_search_nodes;
+    PriorityQueue<State> m_openlist;
+
+    std::vector<HDAStarMessageBatch> m_outboxes;
+    HDAStarWorkerStatistics m_statistics;
+
+    /* Preallocated buffers */
+    GroundActionList m_applicable_actions;
+    FlatBitset m_successor_fluent_atoms;
+
+    void send(size_t receiver)
+    {
+        auto& outbox = m_outboxes[receiver];
+        if (outbox.empty())
+        {
+            return;
+        }
+
+        // Count before pushing, such that the batch is in flight until the receiver processed it.
+        m_shared.num_in_flight.fetch_add(1, std::memory_order_acq_rel);
+        m_shared.inboxes[receiver]->push(std::move(outbox));
+        ++m_statistics.num_sent_messages;
+        outbox = HDAStarMessageBatch {};
+        outbox.reserve(m_options.message_batch_size);
+
+        if (m_shared.num_idle.load(std::memory_order_acquire) > 0)
+        {
+            m_shared.termination_cv.notify_all();
+        }
+    }
+
+    void send_all()
+    {
+        for (size_t receiver = 0; receiver < m_outboxes.size(); ++receiver)
+        {
+            send(receiver);
+        }
+    }
+
+    void receive()
+    {
+        const auto num_batches = m_shared.inboxes[m_index]->consume_all(
+            [this](HDAStarMessageBatch&& batch)
+            {
+                for (const auto& message : batch)
+                {
+                    insert(message.fluent_atoms, message.g_value, message.parent_worker, message.parent_state, message.creating_action);
+                }
+            });
+
+        if (num_batches > 0)
+        {
+            m_statistics.num_received_messages += num_batches;
+            m_shared.num_in_flight.fetch_sub(num_batches, std::memory_order_acq_rel);
+        }
+    }
+
+    /// @brief Return true iff the open list contains a state with an f-value below the incumbent cost.
+    /// Removes outdated entries from the open list.
+    bool has_work()
+    {
+        while (!m_openlist.empty())
+        {
+            const auto search_node = get_or_create_search_node(m_openlist.top().get_index(), m_default_search_node, m_search_nodes);
+
+            if (get_status(search_node) == SearchNodeStatus::CLOSED)
+            {
+                m_openlist.pop();
+                continue;
+            }
+
+            if (get_g_value(search_node) + get_h_value(search_node) >= m_shared.incumbent_cost.load(std::memory_order_acquire))
+            {
+                // All remaining states have an f-value of at least the cost of the incumbent plan.
+                m_openlist.clear();
+                return false;
+            }
+
+            return true;
+        }
+        return false;
+    }
+
+    /// @brief Block until a batch arrives or the search terminates.
+    /// @return false iff the search terminated.
+    bool wait_for_work()
+    {
+        auto lock = std::unique_lock<std::mutex>(m_shared.termination_mutex);
+        m_shared.num_idle.fetch_add(1, std::memory_order_acq_rel);
+
+        while (true)
+        {
+            if (m_shared.terminated)
+            {
+                return false;
+            }
+            if (!m_shared.inboxes[m_index]->empty())
+            {
+                m_shared.num_idle.fetch_sub(1, std::memory_order_acq_rel);
+                return true;
+            }
+            // Only active workers send batches, hence, no new work can emerge.
+            if (m_shared.num_idle.load(std::memory_order_acquire) == m_shared.inboxes.size()
+                && m_shared.num_in_flight.load(std::memory_order_acquire) == 0)
+            {
+                m_shared.terminated = true;
+                m_shared.termination_cv.notify_all();
+                return false;
+            }
+            // Wake up regularly in case a notification was missed.
+            m_shared.termination_cv.wait_for(lock, std::chrono::milliseconds(1));
+        }
+    }
+
+    void update_incumbent(State state, ContinuousCost cost)
+    {
+        auto lock = std::lock_guard<std::mutex>(m_shared.incumbent_mutex);
+
+        if (cost < m_shared.incumbent_cost.load(std::memory_order_acquire))
+        {
+            m_shared.incumbent_worker = m_index;
+            m_shared.incumbent_state = state;
+            m_shared.incumbent_cost.store(cost, std::memory_order_release);
+        }
+    }
+
+    void expand()
+    {
+        const auto state = m_openlist.top();
+        m_openlist.pop();
+
+        auto search_node = get_or_create_search_node(state.get_index(), m_default_search_node, m_search_nodes);
+        set_status(search_node, SearchNodeStatus::CLOSED);
+
+        /* Test whether state achieves the goal. Successors of goal states cannot lead to cheaper plans. */
+
+        if (m_goal_strategy.test_dynamic_goal(state))
+        {
+            update_incumbent(state, get_g_value(search_node));
+            return;
+        }
+
+        /* Expand the successors of the state. */
+
+        ++m_statistics.num_expanded;
+
+        const auto g_value = get_g_value(search_node);
+        const auto num_workers = m_outboxes.size();
+
+        m_aag->generate_applicable_actions(state, m_applicable_actions);
+
+        for (const auto& action : m_applicable_actions)
+        {
+            ++m_statistics.num_generated;
+
+            const auto successor_g_value = g_value + action.get_cost();
+            if (successor_g_value >= m_shared.incumbent_cost.load(std::memory_order_relaxed))
+            {
+                continue;
+            }
+
+            m_ssg->compute_successor_fluent_atoms(state, action, m_successor_fluent_atoms);
+
+            const auto owner = get_owner(m_successor_fluent_atoms, num_workers);
+            if (owner == m_index)
+            {
+                insert(m_successor_fluent_atoms, successor_g_value, m_index, state.get_index(), action.get_index());
+            }
+            else
+            {
+                auto& outbox = m_outboxes[owner];
+                outbox.push_back(HDAStarMessage { m_successor_fluent_atoms, successor_g_value, m_index, state.get_index(), action.get_index() });
+                if (outbox.size() >= m_options.message_batch_size)
+                {
+                    send(owner);
+                }
+            }
+        }
+    }
+
+public:
+    HDAStarWorker(Index index,
+                  HDAStarSharedData& shared,
+                  const HDAStarAlgorithmOptions& options,
+                  std::shared_ptr<GroundedApplicableActionGenerator> aag,
+                  std::shared_ptr<StateRepository> ssg,
+                  std::shared_ptr<IHeuristic> heuristic) :
+        m_index(index),
+        m_shared(shared),
+        m_options(options),
+        m_aag(std::move(aag)),
+        m_ssg(std::move(ssg)),
+        m_heuristic(std::move(heuristic)),
+        m_goal_strategy(m_aag->get_problem()),
+        m_default_search_node(HDAStarSearchNodeImpl { SearchNodeStatus::NEW,
+                                                      NO_INDEX,
+                                                      NO_INDEX,
+                                                      std::numeric_limits<ContinuousCost>::infinity(),
+                                                      ContinuousCost(0),
+                                                      NO_INDEX }),
+        m_search_nodes(),
+        m_openlist(),
+        m_outboxes(shared.inboxes.size()),
+        m_statistics(),
+        m_applicable_actions(),
+        m_successor_fluent_atoms()
+    {
+        for (auto& outbox : m_outboxes)
+        {
+            outbox.reserve(m_options.message_batch_size);
+        }
+    }
+
+    /// @brief Insert a state that is owned by this worker if it was reached with a smaller g-value.
+    /// @return true iff the state was inserted into the open list.
+    bool insert(const FlatBitset& fluent_atoms, ContinuousCost g_value, Index parent_worker, Index parent_state, Index creating_action)
+    {
+        const auto state = m_ssg->get_or_create_state(fluent_atoms);
+        auto search_node = get_or_create_search_node(state.get_index(), m_default_search_node, m_search_nodes);
+
+        if (get_status(search_node) == SearchNodeStatus::DEAD_END || g_value >= get_g_value(search_node))
+        {
+            return false;
+        }
+
+        const bool is_new_state = (get_status(search_node) == SearchNodeStatus::NEW);
+
+        set_status(search_node, SearchNodeStatus::OPEN);
+        set_parent_worker(search_node, parent_worker);
+        set_parent_state(search_node, parent_state);
+        set_creating_action(search_node, creating_action);
+        set_g_value(search_node, g_value);
+
+        if (is_new_state)
+        {
+            // Compute heuristic if state is new.
+            const auto h_value = m_heuristic->compute_heuristic(state);
+            set_h_value(search_node, h_value);
+
+            if (h_value == std::numeric_limits<ContinuousCost>::infinity())
+            {
+                set_status(search_node, SearchNodeStatus::DEAD_END);
+                ++m_statistics.num_deadends;
+                return false;
+            }
+        }
+
+        m_openlist.insert(g_value + get_h_value(search_node), state);
+
+        return true;
+    }
+
+    void run()
+    {
+        while (true)
+        {
+            receive();
+
+            if (has_work())
+            {
+                expand();
+                send_all();
+            }
+            else if (!wait_for_work())
+            {
+                break;
+            }
+        }
+    }
+
+    /// @brief Return the creating action and the parent of the given state.
+    std::tuple<Index, Index, Index> get_parent(Index state_index) const
+    {
+        const auto search_node = m_search_nodes.at(state_index);
+        return { get_creating_action(search_node), get_parent_worker(search_node), get_parent_state(search_node) };
+    }
+
+    const HDAStarWorkerStatistics& get_statistics() const { return m_statistics; }
+};
+
+/**
+ * HDAStar
+ */
+
+HDAStarAlgorithm::HDAStarAlgorithm(std::shared_ptr<GroundedApplicableActionGenerator> applicable_action_generator,
+                                   HeuristicFactory heuristic_factory,
+                                   HDAStarAlgorithmOptions options) :
+    HDAStarAlgorithm(std::move(applicable_action_generator),
+                     std::move(heuristic_factory),
+                     std::make_shared<DefaultHDAStarAlgorithmEventHandler>(),
+                     std::move(options))
+{
+}
+
+HDAStarAlgorithm::HDAStarAlgorithm(std::shared_ptr<GroundedApplicableActionGenerator> applicable_action_generator,
+                                   HeuristicFactory heuristic_factory,
+                                   std::shared_ptr<IHDAStarAlgorithmEventHandler> event_handler,
+                                   HDAStarAlgorithmOptions options) :
+    m_aag(std::move(applicable_action_generator)),
+    m_ssgs(),
+    m_heuristics(),
+    m_event_handler(std::move(event_handler)),
+    m_options(std::move(options))
+{
+    m_options.num_threads = std::max(m_options.num_threads, size_t(1));
+    m_options.message_batch_size = std::max(m_options.message_batch_size, size_t(1));
+
+    for (size_t i = 0; i < m_options.num_threads; ++i)
+    {
+        m_ssgs.push_back(std::make_shared<StateRepository>(m_aag));
+        m_heuristics.push_back(heuristic_factory());
+    }
+}
+
+SearchStatus HDAStarAlgorithm::find_solution(GroundActionList& out_plan)
+{
+    return find_solution(m_ssgs.front()->get_or_create_initial_state(), out_plan);
+}
+
+SearchStatus HDAStarAlgorithm::find_solution(State start_state, GroundActionList& out_plan)
+{
+    std::optional<State> unused_out_state = std::nullopt;
+    return find_solution(start_state, out_plan, unused_out_state);
+}
+
+SearchStatus HDAStarAlgorithm::find_solution(State start_state, GroundActionList& out_plan, std::optional<State>& out_goal_state)
+{
+    const auto problem = m_aag->get_problem();
+    const auto& pddl_factories = *m_aag->get_pddl_factories();
+    const auto num_workers = m_options.num_threads;
+
+    m_event_handler->on_start_search(start_state, problem, pddl_factories);
+
+    /* Test static goal. */
+
+    if (!ProblemGoal(problem).test_static_goal())
+    {
+        m_event_handler->on_unsolvable();
+
+        return SearchStatus::UNSOLVABLE;
+    }
+
+    auto shared = HDAStarSharedData(num_workers);
+    auto workers = std::vector<std::unique_ptr<HDAStarWorker>> {};
+    for (size_t i = 0; i < num_workers; ++i)
+    {
+        workers.push_back(std::make_unique<HDAStarWorker>(i, shared, m_options, m_aag, m_ssgs[i], m_heuristics[i]));
+    }
+
+    /* Test whether start state is deadend. */
+
+    const auto& start_fluent_atoms = start_state.get_atoms<Fluent>();
+    if (!workers[get_owner(start_fluent_atoms, num_workers)]->insert(start_fluent_atoms, ContinuousCost(0), NO_INDEX, NO_INDEX, NO_INDEX))
+    {
+        m_event_handler->on_unsolvable();
+
+        return SearchStatus::UNSOLVABLE;
+    }
+
+    /* Run the workers until termination. */
+
+    auto pool = BS::thread_pool(static_cast<BS::concurrency_t>(num_workers));
+    auto futures = std::vector<std::future<void>> {};
+    for (auto& worker : workers)
+    {
+        futures.push_back(pool.submit_task([&worker] { worker->run(); }));
+    }
+    for (auto& future : futures)
+    {
+        future.get();
+    }
+
+    for (size_t i = 0; i < num_workers; ++i)
+    {
+        m_event_handler->on_finish_worker(i, workers[i]->get_statistics());
+    }
+
+    if (!shared.incumbent_state.has_value())
+    {
+        m_event_handler->on_end_search();
+        m_event_handler->on_exhausted();
+
+        return SearchStatus::EXHAUSTED;
+    }
+
+    /* Follow the parents across the workers. */
+
+    out_plan.clear();
+    auto worker_index = shared.incumbent_worker;
+    auto state_index = shared.incumbent_state->get_index();
+    while (true)
+    {
+        const auto [creating_action, parent_worker, parent_state] = workers[worker_index]->get_parent(state_index);
+        if (parent_state == NO_INDEX)
+        {
+            break;
+        }
+        out_plan.push_back(m_aag->get_ground_action(creating_action));
+        worker_index = parent_worker;
+        state_index = parent_state;
+    }
+    std::reverse(out_plan.begin(), out_plan.end());
+    out_goal_state = shared.incumbent_state;
+
+    m_event_handler->on_end_search();
+    if (!m_event_handler->is_quiet())
+    {
+        m_aag->on_end_search();
+    }
+    m_event_handler->on_solved(out_plan, pddl_factories);
+
+    return SearchStatus::SOLVED;
+}
+
+const std::shared_ptr<PDDLFactories>& HDAStarAlgorithm::get_pddl_factories() const { return m_aag->get_pddl_factories(); }
+
+const HDAStarAlgorithmOptions& HDAStarAlgorithm::get_options() const { return m_options; }
+
+const std::vector<std::shared_ptr<StateRepository>>& HDAStarAlgorithm::get_state_repositories() const { return m_ssgs; }
+
+}
@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "mimir/search/algorithms/hdastar/event_handlers/debug.hpp"
+
+#include "mimir/common/printers.hpp"
+#include "mimir/search/plan.hpp"
+
+namespace mimir
+{
+void DebugHDAStarAlgorithmEventHandler::on_start_search_impl(State start_state, Problem problem, const PDDLFactories& pddl_factories) const
+{
+    std::cout << "[HDAStar] Search started.\n"
+              << "[HDAStar] Initial: " << std::make_tuple(problem, start_state, std::cref(pddl_factories)) << std::endl;
+}
+
+void DebugHDAStarAlgorithmEventHandler::on_finish_worker_impl(size_t worker_index, const HDAStarWorkerStatistics& worker_statistics) const
+{
+    std::cout << "[HDAStar] Worker " << worker_index << " finished with num expanded states " << worker_statistics.num_expanded
+              << ", num generated states " << worker_statistics.num_generated << ", num sent messages " << worker_statistics.num_sent_messages
+              << " and num received messages " << worker_statistics.num_received_messages << std::endl;
+}
+
+void DebugHDAStarAlgorithmEventHandler::on_end_search_impl() const { std::cout << "[HDAStar] Search ended.\n" << m_statistics << std::endl; }
+
+void DebugHDAStarAlgorithmEventHandler::on_solved_impl(const GroundActionList& ground_action_plan, const PDDLFactories& pddl_factories) const
+{
+    auto plan = to_plan(ground_action_plan, pddl_factories);
+    std::cout << "[HDAStar] Plan found.\n"
+              << "[HDAStar] Plan cost: " << plan.get_cost() << "\n"
+              << "[HDAStar] Plan length: " << plan.get_actions().size() << std::endl;
+    for (size_t i = 0; i < plan.get_actions().size(); ++i)
+    {
+        std::cout << "[HDAStar] " << i + 1 << ". " << plan.get_actions()[i] << std::endl;
+    }
+}
+
+void DebugHDAStarAlgorithmEventHandler::on_unsolvable_impl() const { std::cout << "[HDAStar] Unsolvable!" << std::endl; }
+
+void DebugHDAStarAlgorithmEventHandler::on_exhausted_impl() const { std::cout << "[HDAStar] Exhausted!" << std::endl; }
+}
@@ -0,0 +1,49 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "mimir/search/algorithms/hdastar/event_handlers/default.hpp"
+
+#include "mimir/common/printers.hpp"
+#include "mimir/search/plan.hpp"
+
+namespace mimir
+{
+void DefaultHDAStarAlgorithmEventHandler::on_start_search_impl(State start_state, Problem problem, const PDDLFactories& pddl_factories) const
+{  //
+    std::cout << "[HDAStar] Search started." << std::endl;
+}
+
+void DefaultHDAStarAlgorithmEventHandler::on_finish_worker_impl(size_t worker_index, const HDAStarWorkerStatistics& worker_statistics) const {}
+
+void DefaultHDAStarAlgorithmEventHandler::on_end_search_impl() const { std::cout << "[HDAStar] Search ended.\n" << m_statistics << std::endl; }
+
+void DefaultHDAStarAlgorithmEventHandler::on_solved_impl(const GroundActionList& ground_action_plan, const PDDLFactories& pddl_factories) const
+{
+    auto plan = to_plan(ground_action_plan, pddl_factories);
+    std::cout << "[HDAStar] Plan found.\n"
+              << "[HDAStar] Plan cost: " << plan.get_cost() << "\n"
+              << "[HDAStar] Plan length: " << plan.get_actions().size() << std::endl;
+    for (size_t i = 0; i < plan.get_actions().size(); ++i)
+    {
+        std::cout << "[HDAStar] " << i + 1 << ". " << plan.get_actions()[i] << std::endl;
+    }
+}
+
+void DefaultHDAStarAlgorithmEventHandler::on_unsolvable_impl() const { std::cout << "[HDAStar] Unsolvable!" << std::endl; }
+
+void DefaultHDAStarAlgorithmEventHandler::on_exhausted_impl() const { std::cout << "[HDAStar] Exhausted!" << std::endl; }
+}
@@ -28,9 +28,16 @@
 #include "mimir/search/algorithms/iw/tuple_index_mapper.hpp"
 #include "mimir/search/algorithms/iw/types.hpp"
 #include "mimir/search/algorithms/strategies/goal_strategy.hpp"
+#include "mimir/search/applicable_action_generators/interface.hpp"
+#include "mimir/search/search_node.hpp"
 #include "mimir/search/state_repository.hpp"
 
+#include <chrono>
+#include <deque>
+#include <limits>
+#include <optional>
 #include <sstream>
+#include <variant>
 
 namespace mimir
 {
@@ -45,6 +52,12 @@ TupleIndexMapper::TupleIndexMapper(size_t arity, size_t num_atoms) : m_arity(ari
     {
         throw std::runtime_error("TupleIndexMapper only works with 0 <= arity < " + std::to_string(MAX_ARITY) + ".");
     }
+    // The largest tuple index is num_atoms * (num_atoms^0 + ... + num_atoms^(arity-1)) < (num_atoms + 1)^arity
+    if (std::pow(static_cast<double>(m_num_atoms) + 1, m_arity) > static_cast<double>(std::numeric_limits<TupleIndex>::max()))
+    {
+        throw std::runtime_error("TupleIndexMapper::TupleIndexMapper(...): the tuple indices of " + std::to_string(m_num_atoms) + " atoms and arity "
+                                 + std::to_string(m_arity) + " do not fit into TupleIndex.");
+    }
     //  Initialize factors
     for (size_t i = 0; i < m_arity; ++i)
     {
@@ -101,6 +114,21 @@ std::string TupleIndexMapper::tuple_index_to_string(TupleIndex tuple_index) cons
     return ss.str();
 }
 
+size_t TupleIndexMapper::get_tuple_size(TupleIndex tuple_index) const
+{
+    size_t tuple_size = 0;
+    for (int i = m_arity - 1; i >= 0; --i)
+    {
+        const auto atom_index = std::min(m_num_atoms, tuple_index / m_factors[i]);
+        if (atom_index != m_num_atoms)
+        {
+            ++tuple_size;
+        }
+        tuple_index -= atom_index * m_factors[i];
+    }
+    return tuple_size;
+}
+
 size_t TupleIndexMapper::get_num_atoms() const { return m_num_atoms; }
 
 size_t TupleIndexMapper::get_arity() const { return m_arity; }
@@ -109,8 +137,8 @@ const std::array<size_t, MAX_ARITY>& TupleIndexMapper::get_factors() const { ret
 
 TupleIndex TupleIndexMapper::get_max_tuple_index() const
 {
-    // x^0 + ... + x^n = (x^{n+1} - 1) / 2
-    return ((std::pow(get_num_atoms(), get_arity() + 1) - 1) / 2) - 1;
+    // The placeholder is the largest atom index, hence, the empty tuple has the largest tuple index.
+    return m_empty_tuple_index;
 }
 
 TupleIndex TupleIndexMapper::get_empty_tuple_index() const { return m_empty_tuple_index; }
@@ -132,7 +160,7 @@ StateTupleIndexGenerator::const_iterator::const_iterator(StateTupleIndexGenerato
     m_tuple_index_mapper(begin ? stig->tuple_index_mapper.get() : nullptr),
     m_atoms(begin ? &stig->atom_indices : nullptr),
     m_end(!begin),
-    m_cur(begin ? 0 : -1)
+    m_cur(begin ? 0 : std::numeric_limits<TupleIndex>::max())
 {
     if (begin)
     {
@@ -188,7 +216,8 @@ void StateTupleIndexGenerator::const_iterator::advance()
 
     /* Advance and update cur based on the change. */
     const auto index = ++m_indices[i];
-    const auto diff_i = get_atoms()[index] - get_atoms()[index - 1];
+    // The differences can be negative, hence, we compute them modulo 2^64 like the tuple index.
+    const auto diff_i = static_cast<TupleIndex>(get_atoms()[index]) - get_atoms()[index - 1];
     m_cur += diff_i * factors[i];
 
     // Update indices right of the incremented rightmost index i.
@@ -201,7 +230,7 @@ void StateTupleIndexGenerator::const_iterator::advance()
         size_t new_index = m_indices[j] = std::min(num_atoms - 1, m_indices[j - 1] + 1);
 
         // Update and update cur based on the change
-        const auto diff_j = get_atoms()[new_index] - get_atoms()[old_index];
+        const auto diff_j = static_cast<TupleIndex>(get_atoms()[new_index]) - get_atoms()[old_index];
         m_cur += diff_j * factors[j];
     }
 }
@@ -221,7 +250,6 @@ const AtomIndexList& StateTupleIndexGenerator::const_iterator::get_atoms() const
 StateTupleIndexGenerator::const_iterator::value_type StateTupleIndexGenerator::const_iterator::operator*() const
 {
     assert(m_tuple_index_mapper && m_atoms);
-    assert(m_cur >= 0);
     return m_cur;
 }
 
@@ -291,7 +319,7 @@ StatePairTupleIndexGenerator::const_iterator::const_iterator() :
     m_indices(),
     m_a(),
     m_cur_outter(-1),
-    m_cur_inner(-1),
+    m_cur_inner(std::numeric_limits<TupleIndex>::max()),
     m_end_outter(false),
     m_end_inner(false)
 {
@@ -304,7 +332,7 @@ StatePairTupleIndexGenerator::const_iterator::const_iterator(StatePairTupleIndex
     m_indices(),
     m_a(),
     m_cur_outter(begin ? 0 : -1),
-    m_cur_inner(begin ? 0 : -1),
+    m_cur_inner(begin ? 0 : std::numeric_limits<TupleIndex>::max()),
     m_end_outter(begin ? false : true),
     m_end_inner(begin ? false : true)
 {
@@ -542,7 +570,7 @@ bool StatePairTupleIndexGenerator::const_iterator::try_create_next_inner_tuple(s
     const auto index = ++m_indices[i];
 
     // 2.2. Difference update
-    const auto diff_i = (get_atoms()[m_a[i]][index] - get_atoms()[m_a[i]][index - 1]);
+    const auto diff_i = (static_cast<TupleIndex>(get_atoms()[m_a[i]][index]) - get_atoms()[m_a[i]][index - 1]);
     m_cur_inner += diff_i * factors[i];
 
     // 2.3. Update indices j right of the incremented rightmost index i.
@@ -560,7 +588,7 @@ bool StatePairTupleIndexGenerator::const_iterator::try_create_next_inner_tuple(s
 
         m_indices[j] = new_index;
         // Difference update
-        const auto diff_j = (get_atoms()[m_a[j]][new_index] - get_atoms()[m_a[j]][old_index]);
+        const auto diff_j = (static_cast<TupleIndex>(get_atoms()[m_a[j]][new_index]) - get_atoms()[m_a[j]][old_index]);
         m_cur_inner += diff_j * factors[j];
     }
 
@@ -588,7 +616,6 @@ std::array<std::vector<size_t>, 2>& StatePairTupleIndexGenerator::const_iterator
 StatePairTupleIndexGenerator::const_iterator::value_type StatePairTupleIndexGenerator::const_iterator::operator*() const
 {
     assert(m_tuple_index_mapper && m_a_atoms && m_a_jumpers);
-    assert(m_cur_inner >= 0);
     return m_cur_inner;
 }
 
@@ -655,22 +682,71 @@ StatePairTupleIndexGenerator::const_iterator StatePairTupleIndexGenerator::end()
  * DynamicNoveltyTable
  */
 
-DynamicNoveltyTable::DynamicNoveltyTable(std::shared_ptr<TupleIndexMapper> tuple_index_mapper) :
+static NoveltyTableBackend create_novelty_table_backend(NoveltyTableBackendType backend_type, const TupleIndexMapper& tuple_index_mapper)
+{
+    const auto num_tuple_indices = static_cast<size_t>(tuple_index_mapper.get_max_tuple_index()) + 1;
+
+    if (backend_type == NoveltyTableBackendType::AUTOMATIC)
+    {
+        backend_type = select_novelty_table_backend(tuple_index_mapper.get_arity(), num_tuple_indices);
+    }
+
+    switch (backend_type)
+    {
+        case NoveltyTableBackendType::DENSE:
+            return NoveltyTableBackend(std::in_place_type<DenseNoveltyTableBackend>, num_tuple_indices);
+        case NoveltyTableBackendType::BLOCKED:
+            return NoveltyTableBackend(std::in_place_type<BlockedNoveltyTableBackend>, num_tuple_indices);
+        case NoveltyTableBackendType::HASHED:
+            return NoveltyTableBackend(std::in_place_type<HashedNoveltyTableBackend>, num_tuple_indices);
+        default:
+            throw std::logic_error("create_novelty_table_backend(...): Missing implementation for NoveltyTableBackendType.");
+    }
+}
+
+static NoveltyTableBackendType get_novelty_table_backend_type(const NoveltyTableBackend& backend)
+{
+    if (std::holds_alternative<DenseNoveltyTableBackend>(backend))
+    {
+        return NoveltyTableBackendType::DENSE;
+    }
+    else if (std::holds_alternative<BlockedNoveltyTableBackend>(backend))
+    {
+        return NoveltyTableBackendType::BLOCKED;
+    }
+    return NoveltyTableBackendType::HASHED;
+}
+
+static size_t get_novelty_table_memory_usage(const NoveltyTableBackend& backend)
+{
+    return std::visit([](const auto& arg) { return arg.get_memory_usage(); }, backend);
+}
+
+DynamicNoveltyTable::DynamicNoveltyTable(std::shared_ptr<TupleIndexMapper> tuple_index_mapper, NoveltyTableBackendType backend_type) :
     m_tuple_index_mapper(std::move(tuple_index_mapper)),
-    m_table(std::vector<bool>(m_tuple_index_mapper->get_max_tuple_index() + 1, false)),
+    m_backend_type(backend_type),
+    m_backend(create_novelty_table_backend(m_backend_type, *m_tuple_index_mapper)),
+    m_statistics(),
     m_state_tuple_index_generator(m_tuple_index_mapper),
     m_state_pair_tuple_index_generator(m_tuple_index_mapper)
 {
+    m_statistics.set_backend_type(get_backend_type());
+    m_statistics.update_memory_usage(get_novelty_table_memory_usage(m_backend));
 }
 
 void DynamicNoveltyTable::resize_to_fit(AtomIndex atom_index)
 {
+    if (atom_index < m_tuple_index_mapper->get_num_atoms())
+    {
+        return;
+    }
+
     // Fetch data.
     const auto arity = m_tuple_index_mapper->get_arity();
     const auto old_placeholder = m_tuple_index_mapper->get_num_atoms();
 
     // Compute size of new table
-    auto new_size = m_tuple_index_mapper->get_num_atoms();
+    auto new_size = std::max(m_tuple_index_mapper->get_num_atoms(), size_t(1));
     while (new_size < atom_index + 1 + 1)  // additional +1 for placeholder
     {
         // Use doubling strategy to get amortized cost O(arity) for resize.
@@ -678,98 +754,182 @@ void DynamicNoveltyTable::resize_to_fit(AtomIndex atom_index)
     }
     const auto new_placeholder = new_size;
     auto new_tuple_index_mapper = std::make_shared<TupleIndexMapper>(arity, new_size);
-    auto new_table = std::vector<bool>(new_tuple_index_mapper->get_max_tuple_index() + 1, false);
+    // The backend is selected again because the larger table might not fit into the old one anymore.
+    auto new_backend = create_novelty_table_backend(m_backend_type, *new_tuple_index_mapper);
 
     // Convert tuple indices that are not novel from old to new table.
     auto atom_indices = AtomIndexList(arity);
-    for (TupleIndex tuple_index = 0; tuple_index < m_table.size(); ++tuple_index)
+    std::visit(
+        [&](const auto& old_backend)
+        {
+            std::visit(
+                [&](auto& backend)
+                {
+                    old_backend.for_each(
+                        [&](TupleIndex tuple_index)
+                        {
+                            // to_atom_indices drops placeholders, hence, we pad them again at the back.
+                            m_tuple_index_mapper->to_atom_indices(tuple_index, atom_indices);
+                            atom_indices.resize(arity, old_placeholder);
+                            for (size_t i = 0; i < arity; ++i)
+                            {
+                                if (atom_indices[i] == old_placeholder)
+                                {
+                                    atom_indices[i] = new_placeholder;
+                                }
+                            }
+                            backend.insert(new_tuple_index_mapper->to_tuple_index(atom_indices));
+                        });
+                },
+                new_backend);
+        },
+        m_backend);
+
+    // Swap old and new data.
+    m_tuple_index_mapper = std::move(new_tuple_index_mapper);
+    m_backend = std::move(new_backend);
+    m_state_tuple_index_generator = StateTupleIndexGenerator(m_tuple_index_mapper);
+    m_state_pair_tuple_index_generator = StatePairTupleIndexGenerator(m_tuple_index_mapper);
+
+    m_statistics.on_resize();
+    m_statistics.set_backend_type(get_backend_type());
+    m_statistics.update_memory_usage(get_novelty_table_memory_usage(m_backend));
+}
+
+void DynamicNoveltyTable::resize_to_fit(const State state)
+{
+    // The fluent atoms are iterated in increasing order, hence, the last one is the largest.
+    auto max_atom_index = std::optional<AtomIndex>();
+    for (const auto atom_index : state.get_atoms<Fluent>())
+    {
+        max_atom_index = atom_index;
+    }
+    if (max_atom_index.has_value())
     {
-        if (m_table[tuple_index])
+        resize_to_fit(max_atom_index.value());
+    }
+}
+
+template<typename Iterator>
+size_t DynamicNoveltyTable::compute_novelty_and_update_table_impl(Iterator begin, Iterator end)
+{
+    const auto is_timed = m_statistics.is_next_test_timed();
+    const auto start_time_point = is_timed ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
+
+    auto novelty = m_tuple_index_mapper->get_arity() + 1;
+    uint64_t num_tested_tuple_indices = 0;
+    uint64_t num_novel_tuple_indices = 0;
+    std::visit(
+        [&](auto& backend)
         {
-            m_tuple_index_mapper->to_atom_indices(tuple_index, atom_indices);
-            for (size_t i = 0; i < arity; ++i)
+            for (auto it = begin; it != end; ++it)
             {
-                if (atom_indices[i] == old_placeholder)
+                const auto tuple_index = *it;
+                // std::cout << tuple_index << " " << m_tuple_index_mapper->tuple_index_to_string(tuple_index) << std::endl;
+
+                ++num_tested_tuple_indices;
+                if (backend.insert(tuple_index))
                 {
-                    atom_indices[i] = new_placeholder;
+                    ++num_novel_tuple_indices;
+                    // The empty tuple is only novel together with the singletons of the state, hence, the novelty is at least 1.
+                    novelty = std::min(novelty, std::max(m_tuple_index_mapper->get_tuple_size(tuple_index), size_t(1)));
                 }
             }
-            const auto new_tuple_index = new_tuple_index_mapper->to_tuple_index(atom_indices);
-            new_table[new_tuple_index] = true;
-        }
+        },
+        m_backend);
+
+    if (is_timed)
+    {
+        m_statistics.on_time_test_state(num_tested_tuple_indices, std::chrono::steady_clock::now() - start_time_point);
+    }
+    m_statistics.on_test_state(num_tested_tuple_indices, num_novel_tuple_indices);
+    if (num_novel_tuple_indices > 0)
+    {
+        m_statistics.update_memory_usage(get_memory_usage());
     }
 
-    // Swap old and new data.
-    m_tuple_index_mapper = std::move(new_tuple_index_mapper);
-    m_table = std::move(new_table);
+    return novelty;
 }
 
 void DynamicNoveltyTable::compute_novel_tuple_indices(const State state, TupleIndexList& out_novel_tuple_indices)
 {
-    out_novel_tuple_indices.clear();
-
-    for (auto it = m_state_tuple_index_generator.begin(state); it != m_state_tuple_index_generator.end(); ++it)
-    {
-        const auto tuple_index = *it;
+    compute_novel_tuple_indices(state, m_state_tuple_index_generator, out_novel_tuple_indices);
+}
 
-        assert(tuple_index < m_table.size());
+void DynamicNoveltyTable::compute_novel_tuple_indices(const State state,
+                                                      StateTupleIndexGenerator& tuple_index_generator,
+                                                      TupleIndexList& out_novel_tuple_indices) const
+{
+    out_novel_tuple_indices.clear();
 
-        if (!m_table[tuple_index])
+    std::visit(
+        [&](const auto& backend)
         {
-            out_novel_tuple_indices.push_back(tuple_index);
-        }
-    }
+            for (auto it = tuple_index_generator.begin(state); it != tuple_index_generator.end(); ++it)
+            {
+                const auto tuple_index = *it;
+
+                if (!backend.test(tuple_index))
+                {
+                    out_novel_tuple_indices.push_back(tuple_index);
+                }
+            }
+        },
+        m_backend);
 }
 
 void DynamicNoveltyTable::insert_tuple_indices(const TupleIndexList& tuple_indices)
 {
-    for (const auto& tuple_index : tuple_indices)
-    {
-        assert(tuple_index < m_table.size());
+    std::visit(
+        [&](auto& backend)
+        {
+            for (const auto& tuple_index : tuple_indices)
+            {
+                backend.insert(tuple_index);
+            }
+        },
+        m_backend);
 
-        m_table[tuple_index] = true;
-    }
+    m_statistics.update_memory_usage(get_novelty_table_memory_usage(m_backend));
 }
 
 bool DynamicNoveltyTable::test_novelty_and_update_table(const State state)
 {
-    bool is_novel = false;
-    for (auto it = m_state_tuple_index_generator.begin(state); it != m_state_tuple_index_generator.end(); ++it)
-    {
-        const auto tuple_index = *it;
-        // std::cout << tuple_index << " " << m_tuple_index_mapper->tuple_index_to_string(tuple_index) << std::endl;
+    return compute_novelty_and_update_table(state) <= m_tuple_index_mapper->get_arity();
+}
 
-        assert(tuple_index < m_table.size());
+bool DynamicNoveltyTable::test_novelty_and_update_table(const State state, const State succ_state)
+{
+    return compute_novelty_and_update_table(state, succ_state) <= m_tuple_index_mapper->get_arity();
+}
 
-        if (!is_novel && !m_table[tuple_index])
-        {
-            is_novel = true;
-        }
-        m_table[tuple_index] = true;
-    }
-    return is_novel;
+size_t DynamicNoveltyTable::compute_novelty_and_update_table(const State state)
+{
+    resize_to_fit(state);
+
+    return compute_novelty_and_update_table_impl(m_state_tuple_index_generator.begin(state), m_state_tuple_index_generator.end());
 }
 
-bool DynamicNoveltyTable::test_novelty_and_update_table(const State state, const State succ_state)
+size_t DynamicNoveltyTable::compute_novelty_and_update_table(const State state, const State succ_state)
 {
-    bool is_novel = false;
-    for (auto it = m_state_pair_tuple_index_generator.begin(state, succ_state); it != m_state_pair_tuple_index_generator.end(); ++it)
-    {
-        const auto tuple_index = *it;
-        // std::cout << tuple_index << " " << m_tuple_index_mapper->tuple_index_to_string(tuple_index) << std::endl;
+    // The tuples consist of atoms of the successor state only.
+    resize_to_fit(succ_state);
 
-        assert(tuple_index < m_table.size());
+    return compute_novelty_and_update_table_impl(m_state_pair_tuple_index_generator.begin(state, succ_state), m_state_pair_tuple_index_generator.end());
+}
 
-        if (!is_novel && !m_table[tuple_index])
-        {
-            is_novel = true;
-        }
-        m_table[tuple_index] = true;
-    }
-    return is_novel;
+void DynamicNoveltyTable::reset()
+{
+    std::visit([](auto& backend) { backend.reset(); }, m_backend);
 }
 
-void DynamicNoveltyTable::reset() { std::fill(m_table.begin(), m_table.end(), false); }
+const std::shared_ptr<TupleIndexMapper>& DynamicNoveltyTable::get_tuple_index_mapper() const { return m_tuple_index_mapper; }
+
+NoveltyTableBackendType DynamicNoveltyTable::get_backend_type() const { return get_novelty_table_backend_type(m_backend); }
+
+size_t DynamicNoveltyTable::get_memory_usage() const { return get_novelty_table_memory_usage(m_backend); }
+
+const NoveltyTableStatistics& DynamicNoveltyTable::get_statistics() const { return m_statistics; }
 
 /**
  * NoveltyPruning
@@ -784,18 +944,23 @@ bool ArityZeroNoveltyPruning::test_prune_successor_state(const State state, cons
     return state != m_initial_state || state == succ_state;
 }
 
-ArityKNoveltyPruning::ArityKNoveltyPruning(size_t arity, size_t num_atoms) : m_novelty_table(std::make_shared<TupleIndexMapper>(arity, num_atoms)) {}
+ArityKNoveltyPruning::ArityKNoveltyPruning(size_t arity, size_t num_atoms) :
+    ArityKNoveltyPruning(std::make_shared<DynamicNoveltyTable>(std::make_shared<TupleIndexMapper>(arity, num_atoms)))
+{
+}
+
+ArityKNoveltyPruning::ArityKNoveltyPruning(std::shared_ptr<DynamicNoveltyTable> novelty_table) : m_novelty_table(std::move(novelty_table)) {}
 
 bool ArityKNoveltyPruning::test_prune_initial_state(const State state)
 {
     if (m_generated_states.count(state.get_index()))
     {
-        assert(!m_novelty_table.test_novelty_and_update_table(state));
+        assert(!m_novelty_table->test_novelty_and_update_table(state));
         return true;
     }
     m_generated_states.insert(state.get_index());
 
-    return !m_novelty_table.test_novelty_and_update_table(state);
+    return !m_novelty_table->test_novelty_and_update_table(state);
 }
 
 bool ArityKNoveltyPruning::test_prune_successor_state(const State state, const State succ_state, bool is_new_succ)
@@ -807,21 +972,51 @@ bool ArityKNoveltyPruning::test_prune_successor_state(const State state, const S
 
     if (m_generated_states.count(succ_state.get_index()))
     {
-        assert(!m_novelty_table.test_novelty_and_update_table(state, succ_state));
+        assert(!m_novelty_table->test_novelty_and_update_table(state, succ_state));
         return true;
     }
     m_generated_states.insert(succ_state.get_index());
 
-    return !m_novelty_table.test_novelty_and_update_table(state, succ_state);
+    return !m_novelty_table->test_novelty_and_update_table(state, succ_state);
 }
 
 /* IterativeWidthAlgorithm */
-IterativeWidthAlgorithm::IterativeWidthAlgorithm(std::shared_ptr<IApplicableActionGenerator> applicable_action_generator, size_t max_arity) :
+
+using IWSearchNodeImpl = SearchNodeImpl<DiscreteCost>;
+using IWSearchNode = IWSearchNodeImpl*;
+using ConstIWSearchNode = const IWSearchNodeImpl*;
+
+static void set_g_value(IWSearchNode node, DiscreteCost g_value) { return set_property<0>(node, g_value); }
+
+static DiscreteCost get_g_value(ConstIWSearchNode node) { return get_property<0>(node); }
+
+static IWSearchNode get_or_create_search_node(size_t state_index, const IWSearchNodeImpl& default_node, cista::storage::Vector<IWSearchNodeImpl>& search_nodes)
+{
+    while (state_index >= search_nodes.size())
+    {
+        search_nodes.push_back(default_node);
+    }
+    return search_nodes[state_index];
+}
+
+static constexpr DiscreteCost UNDEFINED_DISCRETE_COST = std::numeric_limits<DiscreteCost>::max();
+
+/// @brief A transition from a state in the search tree to a successor state that is kept by the incremental search across arities.
+struct IWTransition
+{
+    State state;
+    State successor_state;
+};
+
+IterativeWidthAlgorithm::IterativeWidthAlgorithm(std::shared_ptr<IApplicableActionGenerator> applicable_action_generator,
+                                                 size_t max_arity,
+                                                 IWAlgorithmOptions options) :
     IterativeWidthAlgorithm(applicable_action_generator,
                             max_arity,
                             std::make_shared<StateRepository>(applicable_action_generator),
                             std::make_shared<DefaultBrFSAlgorithmEventHandler>(),
-                            std::make_shared<DefaultIWAlgorithmEventHandler>())
+                            std::make_shared<DefaultIWAlgorithmEventHandler>(),
+                            options)
 {
 }
 
@@ -829,9 +1024,11 @@ IterativeWidthAlgorithm::IterativeWidthAlgorithm(std::shared_ptr<IApplicableActi
                                                  size_t max_arity,
                                                  std::shared_ptr<StateRepository> successor_state_generator,
                                                  std::shared_ptr<IBrFSAlgorithmEventHandler> brfs_event_handler,
-                                                 std::shared_ptr<IIWAlgorithmEventHandler> iw_event_handler) :
+                                                 std::shared_ptr<IIWAlgorithmEventHandler> iw_event_handler,
+                                                 IWAlgorithmOptions options) :
     m_aag(applicable_action_generator),
     m_max_arity(max_arity),
+    m_options(options),
     m_ssg(successor_state_generator),
     m_brfs_event_handler(brfs_event_handler),
     m_iw_event_handler(iw_event_handler),
@@ -863,6 +1060,11 @@ SearchStatus IterativeWidthAlgorithm::find_solution(State start_state,
                                                     GroundActionList& out_plan,
                                                     std::optional<State>& out_goal_state)
 {
+    if (m_options.incremental)
+    {
+        return find_solution_incremental(start_state, *goal_strategy, out_plan, out_goal_state);
+    }
+
     const auto problem = m_aag->get_problem();
     const auto& pddl_factories = *m_aag->get_pddl_factories();
     m_iw_event_handler->on_start_search(problem, start_state, pddl_factories);
@@ -872,16 +1074,16 @@ SearchStatus IterativeWidthAlgorithm::find_solution(State start_state,
     {
         m_iw_event_handler->on_start_arity_search(problem, start_state, pddl_factories, cur_arity);
 
+        const auto novelty_table =
+            (cur_arity > 0) ? std::make_shared<DynamicNoveltyTable>(std::make_shared<TupleIndexMapper>(cur_arity, INITIAL_TABLE_ATOMS)) : nullptr;
+
         const auto search_status =
             (cur_arity > 0) ?
-                m_brfs.find_solution(start_state,
-                                     std::move(goal_strategy),
-                                     std::make_unique<ArityKNoveltyPruning>(cur_arity, INITIAL_TABLE_ATOMS),
-                                     out_plan,
-                                     out_goal_state) :
+                m_brfs.find_solution(start_state, std::move(goal_strategy), std::make_unique<ArityKNoveltyPruning>(novelty_table), out_plan, out_goal_state) :
                 m_brfs.find_solution(start_state, std::move(goal_strategy), std::make_unique<ArityZeroNoveltyPruning>(start_state), out_plan, out_goal_state);
 
-        m_iw_event_handler->on_end_arity_search(m_brfs_event_handler->get_statistics());
+        m_iw_event_handler->on_end_arity_search(m_brfs_event_handler->get_statistics(),
+                                                novelty_table ? novelty_table->get_statistics() : NoveltyTableStatistics());
 
         if (search_status == SearchStatus::SOLVED)
         {
@@ -904,5 +1106,196 @@ SearchStatus IterativeWidthAlgorithm::find_solution(State start_state,
     return SearchStatus::FAILED;
 }
 
+SearchStatus IterativeWidthAlgorithm::find_solution_incremental(State start_state,
+                                                                IGoalStrategy& goal_strategy,
+                                                                GroundActionList& out_plan,
+                                                                std::optional<State>& out_goal_state)
+{
+    // The search nodes are shared by all arities.
+    // A node with status NEW and finite g-value belongs to a state in the list of pruned transitions of the current arity.
+    const auto default_search_node =
+        IWSearchNodeImpl { SearchNodeStatus::NEW, std::numeric_limits<Index>::max(), std::numeric_limits<Index>::max(), UNDEFINED_DISCRETE_COST };
+    auto search_nodes = cista::storage::Vector<IWSearchNodeImpl>();
+
+    // The transitions into the states of the search tree in the order of their generation, excluding the start state.
+    auto tree_transitions = std::vector<IWTransition>();
+    // The transitions into pruned states that must be tested again by the next arity, ordered by the g-value of the pruned state.
+    auto pruned_transitions = std::vector<IWTransition>();
+    auto next_pruned_transitions = std::vector<IWTransition>();
+
+    const auto problem = m_aag->get_problem();
+    const auto& pddl_factories = *m_aag->get_pddl_factories();
+    m_iw_event_handler->on_start_search(problem, start_state, pddl_factories);
+
+    if (!goal_strategy.test_static_goal())
+    {
+        m_iw_event_handler->on_unsolvable();
+
+        return SearchStatus::UNSOLVABLE;
+    }
+
+    auto start_search_node = get_or_create_search_node(start_state.get_index(), default_search_node, search_nodes);
+    set_status(start_search_node, SearchNodeStatus::OPEN);
+    set_g_value(start_search_node, 0);
+
+    auto applicable_actions = GroundActionList {};
+    auto queue = std::deque<State>();
+
+    for (size_t cur_arity = 0; cur_arity <= m_max_arity; ++cur_arity)
+    {
+        m_iw_event_handler->on_start_arity_search(problem, start_state, pddl_factories, cur_arity);
+        m_brfs_event_handler->on_start_search(start_state, problem, pddl_factories);
+
+        const auto novelty_table =
+            (cur_arity > 0) ? std::make_shared<DynamicNoveltyTable>(std::make_shared<TupleIndexMapper>(cur_arity, INITIAL_TABLE_ATOMS)) : nullptr;
+        const auto pruning_strategy = (cur_arity > 0) ? std::unique_ptr<IPruningStrategy>(std::make_unique<ArityKNoveltyPruning>(novelty_table)) :
+                                                        std::unique_ptr<IPruningStrategy>(std::make_unique<ArityZeroNoveltyPruning>(start_state));
+
+        /* Mark the tuples of the states in the search tree of the previous arity as seen without expanding them again. */
+
+        pruning_strategy->test_prune_initial_state(start_state);
+        for (const auto& transition : tree_transitions)
+        {
+            pruning_strategy->test_prune_successor_state(transition.state, transition.successor_state, false);
+        }
+        if (cur_arity == 0)
+        {
+            queue.push_back(start_state);
+        }
+
+        /* Continue the search from the pruned states that are novel in the current arity. */
+
+        std::swap(pruned_transitions, next_pruned_transitions);
+        next_pruned_transitions.clear();
+        auto pruned_pos = size_t(0);
+
+        // Open the successor state of a transition if it is novel in the current arity and remember the transition otherwise.
+        const auto open_or_prune = [&](const IWTransition& transition, GroundAction action, bool is_new_successor_state)
+        {
+            auto successor_search_node = get_or_create_search_node(transition.successor_state.get_index(), default_search_node, search_nodes);
+
+            if (pruning_strategy->test_prune_successor_state(transition.state, transition.successor_state, is_new_successor_state))
+            {
+                m_brfs_event_handler->on_prune_state(transition.successor_state, problem, pddl_factories);
+
+                // Remember the first transition into a pruned state such that the next arity can test it again.
+                if (get_status(successor_search_node) == SearchNodeStatus::NEW && get_g_value(successor_search_node) == UNDEFINED_DISCRETE_COST)
+                {
+                    set_parent_state(successor_search_node, transition.state.get_index());
+                    set_creating_action(successor_search_node, action.get_index());
+                    set_g_value(successor_search_node, get_g_value(search_nodes[transition.state.get_index()]) + 1);
+                    next_pruned_transitions.push_back(transition);
+                }
+                return;
+            }
+
+            set_status(successor_search_node, SearchNodeStatus::OPEN);
+            set_parent_state(successor_search_node, transition.state.get_index());
+            set_creating_action(successor_search_node, action.get_index());
+            set_g_value(successor_search_node, get_g_value(search_nodes[transition.state.get_index()]) + 1);
+
+            tree_transitions.push_back(transition);
+            queue.push_back(transition.successor_state);
+        };
+
+        // Test the pruned states of the previous arity before expanding states with at least the same g-value,
+        // which is when the breadth-first search would have generated them.
+        const auto reopen_pruned_states = [&](DiscreteCost g_value)
+        {
+            for (; pruned_pos < pruned_transitions.size(); ++pruned_pos)
+            {
+                const auto& transition = pruned_transitions[pruned_pos];
+                auto pruned_search_node = get_or_create_search_node(transition.successor_state.get_index(), default_search_node, search_nodes);
+                if (get_g_value(pruned_search_node) > g_value)
+                {
+                    break;
+                }
+                if (get_status(pruned_search_node) != SearchNodeStatus::NEW)
+                {
+                    // The state was opened by a transition that was generated in the current arity.
+                    continue;
+                }
+                // Forget the transition such that it is remembered again if the state is still pruned.
+                const auto action = m_aag->get_ground_action(get_creating_action(pruned_search_node));
+                set_g_value(pruned_search_node, UNDEFINED_DISCRETE_COST);
+                open_or_prune(transition, action, true);
+            }
+        };
+
+        auto g_value = DiscreteCost(0);
+
+        while (!queue.empty() || pruned_pos < pruned_transitions.size())
+        {
+            if (queue.empty())
+            {
+                reopen_pruned_states(get_g_value(search_nodes[pruned_transitions[pruned_pos].successor_state.get_index()]));
+                continue;
+            }
+            reopen_pruned_states(get_g_value(search_nodes[queue.front().get_index()]));
+
+            const auto state = queue.front();
+            queue.pop_front();
+
+            auto search_node = get_or_create_search_node(state.get_index(), default_search_node, search_nodes);
+
+            if (get_g_value(search_node) > g_value)
+            {
+                g_value = get_g_value(search_node);
+                m_aag->on_finish_search_layer();
+                m_brfs_event_handler->on_finish_g_layer();
+            }
+
+            if (goal_strategy.test_dynamic_goal(state))
+            {
+                set_plan(search_nodes, m_aag->get_ground_actions(), search_node, out_plan);
+                out_goal_state = state;
+                m_brfs_event_handler->on_end_search();
+                m_brfs_event_handler->on_solved(out_plan, pddl_factories);
+                m_iw_event_handler->on_end_arity_search(m_brfs_event_handler->get_statistics(),
+                                                        novelty_table ? novelty_table->get_statistics() : NoveltyTableStatistics());
+                m_iw_event_handler->on_end_search();
+                if (!m_iw_event_handler->is_quiet())
+                {
+                    m_aag->on_end_search();
+                }
+                m_iw_event_handler->on_solved(out_plan, pddl_factories);
+
+                return SearchStatus::SOLVED;
+            }
+
+            m_brfs_event_handler->on_expand_state(state, problem, pddl_factories);
+
+            m_aag->generate_applicable_actions(state, applicable_actions);
+
+            for (const auto& action : applicable_actions)
+            {
+                const auto successor_state = m_ssg->get_or_create_successor_state(state, action);
+                const auto successor_search_node = get_or_create_search_node(successor_state.get_index(), default_search_node, search_nodes);
+
+                m_brfs_event_handler->on_generate_state(successor_state, action, problem, pddl_factories);
+
+                open_or_prune(IWTransition { state, successor_state }, action, get_status(successor_search_node) == SearchNodeStatus::NEW);
+            }
+
+            set_status(search_node, SearchNodeStatus::CLOSED);
+        }
+
+        m_brfs_event_handler->on_end_search();
+        m_brfs_event_handler->on_exhausted();
+        m_iw_event_handler->on_end_arity_search(m_brfs_event_handler->get_statistics(),
+                                                novelty_table ? novelty_table->get_statistics() : NoveltyTableStatistics());
+
+        if (next_pruned_transitions.empty())
+        {
+            // Nothing was pruned, hence, the search of a larger arity cannot find more states.
+            break;
+        }
+    }
+
+    return SearchStatus::FAILED;
+}
+
 const std::shared_ptr<PDDLFactories>& IterativeWidthAlgorithm::get_pddl_factories() const { return m_aag->get_pddl_factories(); }
+
+const IWAlgorithmOptions& IterativeWidthAlgorithm::get_options() const { return m_options; }
 }
\ No newline at end of file
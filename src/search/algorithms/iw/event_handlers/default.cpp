@@ -31,7 +31,11 @@ void DefaultIWAlgorithmEventHandler::on_start_arity_search_impl(const Problem pr
     std::cout << "[IW] Start search with arity " << arity << std::endl;
 }
 
-void DefaultIWAlgorithmEventHandler::on_end_arity_search_impl(const BrFSAlgorithmStatistics& brfs_statistics) const {}
+void DefaultIWAlgorithmEventHandler::on_end_arity_search_impl(const BrFSAlgorithmStatistics& brfs_statistics,
+                                                              const NoveltyTableStatistics& novelty_table_statistics) const
+{
+    std::cout << novelty_table_statistics << std::endl;
+}
 
 void DefaultIWAlgorithmEventHandler::on_end_search_impl() const { std::cout << "[IW] Search ended.\n" << m_statistics << std::endl; }
 
@@ -20,9 +20,9 @@
 #include "mimir/common/collections.hpp"
 #include "mimir/common/itertools.hpp"
 #include "mimir/common/printers.hpp"
-#include "mimir/formalism/transformers/delete_relax.hpp"
 #include "mimir/formalism/utils.hpp"
 #include "mimir/search/algorithms/brfs.hpp"
+#include "mimir/search/applicable_action_generators/grounded/relaxed_reachability_grounder.hpp"
 #include "mimir/search/applicable_action_generators/interface.hpp"
 #include "mimir/search/applicable_action_generators/lifted.hpp"
 #include "mimir/search/state_repository.hpp"
@@ -84,75 +84,31 @@ GroundedApplicableActionGenerator::GroundedApplicableActionGenerator(Problem pro
 
 GroundedApplicableActionGenerator::GroundedApplicableActionGenerator(Problem problem,
                                                                      std::shared_ptr<PDDLFactories> pddl_factories,
-                                                                     std::shared_ptr<IGroundedApplicableActionGeneratorEventHandler> event_handler) :
+                                                                     std::shared_ptr<IGroundedApplicableActionGeneratorEventHandler> event_handler,
+                                                                     size_t num_threads,
+                                                                     bool use_compact_match_tree) :
     m_problem(problem),
     m_pddl_factories(std::move(pddl_factories)),
     m_event_handler(std::move(event_handler)),
-    m_lifted_aag(m_problem, m_pddl_factories)
+    m_lifted_aag(m_problem, m_pddl_factories),
+    m_use_compact_match_tree(use_compact_match_tree)
 {
-    /* 1. Explore delete relaxed task. We explicitly require to keep actions and axioms with empty effects. */
-    auto delete_relax_transformer = DeleteRelaxTransformer(*m_pddl_factories, false);
+    /* 1. Explore delete relaxed task and ground the reachable actions and axioms once. */
     // TODO: In the case of positive normal form, we want this problem
     // to be modified such that grounded actions have no negative preconditions.
     // We also need access to the dual predicates to set the polarity of the initial literals.
     // auto to_pnf_grounded_transformer = ToPositiveNormalFormGroundTransformer(m_pddl_factories);
     // m_problem = to_pnf_grounded_transformer.run(*m_problem);
-    const auto delete_free_problem = delete_relax_transformer.run(*m_problem);
-    auto delete_free_lifted_aag = std::make_shared<LiftedApplicableActionGenerator>(delete_free_problem, m_pddl_factories);
-    auto delete_free_ssg = StateRepository(delete_free_lifted_aag);
-
-    auto state_builder = StateBuilder();
-    auto state_builder_tmp = StateBuilder();
-    auto& fluent_state_atoms = state_builder.get_atoms<Fluent>();
-    auto& derived_state_atoms = state_builder.get_atoms<Derived>();
-    const auto initial_state = delete_free_ssg.get_or_create_initial_state();
-    fluent_state_atoms = initial_state.get_atoms<Fluent>();
-    derived_state_atoms = initial_state.get_atoms<Derived>();
-
-    // Keep track of changes
-    bool reached_delete_free_explore_fixpoint = true;
-
-    // Serialization buffer
-    cista::buf<std::vector<uint8_t>> state_buf;
-
-    auto actions = GroundActionList {};
-    do
-    {
-        reached_delete_free_explore_fixpoint = true;
-
-        state_builder_tmp = state_builder;
-        const auto state = State(state_builder_tmp.get_data());
-
-        auto num_atoms_before = fluent_state_atoms.count();
-
-        // Create and all applicable actions and apply them
-        // Attention: we cannot just apply newly generated actions because conditional effects might trigger later.
-        delete_free_lifted_aag->generate_applicable_actions(state, actions);
-        for (const auto& action : actions)
-        {
-            const auto succ_state = delete_free_ssg.get_or_create_successor_state(state, action);
-            for (const auto atom_id : succ_state.get_atoms<Fluent>())
-            {
-                fluent_state_atoms.set(atom_id);
-            }
-        }
-
-        // Create and all applicable axioms and apply them
-        delete_free_lifted_aag->generate_and_apply_axioms(fluent_state_atoms, derived_state_atoms);
-
-        auto num_atoms_after = fluent_state_atoms.count();
-
-        if (num_atoms_before != num_atoms_after)
-        {
-            reached_delete_free_explore_fixpoint = false;
-        }
+    auto relaxed_reachability_grounder = RelaxedReachabilityGrounder(m_problem, m_pddl_factories, num_threads);
+    relaxed_reachability_grounder.ground(m_lifted_aag);
 
-    } while (!reached_delete_free_explore_fixpoint);
+    const auto& fluent_state_atoms = relaxed_reachability_grounder.get_reached_fluent_atoms();
+    const auto& derived_state_atoms = relaxed_reachability_grounder.get_reached_derived_atoms();
 
     m_event_handler->on_finish_delete_free_exploration(m_pddl_factories->get_ground_atoms_from_indices<Fluent>(fluent_state_atoms),
                                                        m_pddl_factories->get_ground_atoms_from_indices<Derived>(derived_state_atoms),
-                                                       delete_free_lifted_aag->get_ground_actions(),
-                                                       delete_free_lifted_aag->get_ground_axioms());
+                                                       relaxed_reachability_grounder.get_num_delete_free_actions(),
+                                                       relaxed_reachability_grounder.get_delete_free_axioms());
 
     auto fluent_ground_atoms_order = compute_ground_atom_order(m_pddl_factories->get_ground_atoms_from_indices<Fluent>(fluent_state_atoms), *m_pddl_factories);
     auto derived_ground_atoms_order =
@@ -163,102 +119,84 @@ GroundedApplicableActionGenerator::GroundedApplicableActionGenerator(Problem pro
        Ok, we got the relaxed reachable initial atoms.
        We still need modified lifted actions for grounding.
      */
-    auto ground_actions = GroundActionList {};
-    for (const auto& action : delete_free_lifted_aag->get_ground_actions())
-    {
-        // Map relaxed to unrelaxed actions and ground them with the same arguments.
-        for (const auto& unrelaxed_action : delete_relax_transformer.get_unrelaxed_actions(m_pddl_factories->get_action(action.get_action_index())))
-        {
-            auto action_arguments = m_pddl_factories->get_objects_from_indices(action.get_object_indices());
-            auto grounded_action = m_lifted_aag.ground_action(unrelaxed_action, std::move(action_arguments));
-            if (grounded_action.is_statically_applicable(problem->get_static_initial_positive_atoms()))
-            {
-                ground_actions.push_back(grounded_action);
-            }
-        }
-    }
+    const auto& ground_actions = relaxed_reachability_grounder.get_ground_actions();
 
     m_event_handler->on_finish_grounding_unrelaxed_actions(ground_actions);
 
     // 3. Build match tree
-    m_action_match_tree = MatchTree(ground_actions, fluent_ground_atoms_order, derived_ground_atoms_order);
-
-    m_event_handler->on_finish_build_action_match_tree(m_action_match_tree);
+    if (m_use_compact_match_tree)
+    {
+        m_compact_action_match_tree = CompactMatchTree(ground_actions);
 
-    // 2. Create ground axioms
-    auto ground_axioms = GroundAxiomList {};
-    for (const auto& axiom : delete_free_lifted_aag->get_ground_axioms())
+        m_event_handler->on_finish_build_action_match_tree(m_compact_action_match_tree);
+    }
+    else
     {
-        // Map relaxed to unrelaxed actions and ground them with the same arguments.
-        for (const auto& unrelaxed_axiom : delete_relax_transformer.get_unrelaxed_axioms(m_pddl_factories->get_axiom(axiom.get_axiom_index())))
-        {
-            auto axiom_arguments = m_pddl_factories->get_objects_from_indices(axiom.get_objects());
-            auto grounded_axiom = m_lifted_aag.ground_axiom(unrelaxed_axiom, std::move(axiom_arguments));
-            if (grounded_axiom.is_statically_applicable(problem->get_static_initial_positive_atoms()))
-            {
-                ground_axioms.push_back(grounded_axiom);
-            }
-        }
+        m_action_match_tree = MatchTree(ground_actions, fluent_ground_atoms_order, derived_ground_atoms_order);
+
+        m_event_handler->on_finish_build_action_match_tree(m_action_match_tree);
     }
 
-    m_event_handler->on_finish_grounding_unrelaxed_axioms(ground_axioms);
+    // 2. Create ground axioms
+    const auto& ground_axioms = relaxed_reachability_grounder.get_ground_axioms();
 
-    // 3. Build match tree
-    m_axiom_match_tree = MatchTree(ground_axioms, fluent_ground_atoms_order, derived_ground_atoms_order);
+    m_event_handler->on_finish_grounding_unrelaxed_axioms(ground_axioms);
 
-    m_event_handler->on_finish_build_axiom_match_tree(m_axiom_match_tree);
+    // 3. Compile axioms for counter-based evaluation
+    m_axiom_evaluator = GroundedAxiomEvaluator(ground_axioms, m_lifted_aag.get_axiom_partitioning(), *m_pddl_factories);
 }
 
 void GroundedApplicableActionGenerator::generate_applicable_actions(State state, GroundActionList& out_applicable_actions)
 {
     out_applicable_actions.clear();
 
+    if (m_use_compact_match_tree)
+    {
+        m_compact_action_match_tree.get_applicable_elements(state.get_atoms<Fluent>(), state.get_atoms<Derived>(), out_applicable_actions);
+        return;
+    }
+
     m_action_match_tree.get_applicable_elements(state.get_atoms<Fluent>(), state.get_atoms<Derived>(), out_applicable_actions);
 }
 
-void GroundedApplicableActionGenerator::generate_and_apply_axioms(const FlatBitset& fluent_state_atoms, FlatBitset& ref_derived_state_atoms)
+void GroundedApplicableActionGenerator::generate_applicable_actions(std::span<const State> states,
+                                                                    std::vector<size_t>& out_offsets,
+                                                                    GroundActionList& out_applicable_actions)
 {
-    for (const auto& lifted_partition : m_lifted_aag.get_axiom_partitioning())
+    if (m_use_compact_match_tree)
     {
-        bool reached_partition_fixed_point;
+        // The compact match tree has no batched traversal, hence, we query the states one by one.
+        static thread_local GroundActionList s_applicable_actions_buffer;
 
-        do
+        out_offsets.assign(1, 0);
+        out_applicable_actions.clear();
+        for (const auto& state : states)
         {
-            reached_partition_fixed_point = true;
-
-            /* Compute applicable axioms. */
-
-            auto applicable_axioms = GroundAxiomList {};
-
-            // TODO: For axioms, the same fluent branch is taken all the time.
-            // Exploit this!
-            m_axiom_match_tree.get_applicable_elements(fluent_state_atoms, ref_derived_state_atoms, applicable_axioms);
-
-            /* Apply applicable axioms */
-
-            for (const auto& grounded_axiom : applicable_axioms)
-            {
-                if (!lifted_partition.get_axioms().count(m_pddl_factories->get_axiom(grounded_axiom.get_axiom_index())))
-                {
-                    // axiom not part of same partition
-                    continue;
-                }
-
-                assert(!grounded_axiom.get_derived_effect().is_negated);
+            m_compact_action_match_tree.get_applicable_elements(state.get_atoms<Fluent>(), state.get_atoms<Derived>(), s_applicable_actions_buffer);
+            out_applicable_actions.insert(out_applicable_actions.end(), s_applicable_actions_buffer.begin(), s_applicable_actions_buffer.end());
+            out_offsets.push_back(out_applicable_actions.size());
+        }
+        return;
+    }
 
-                const auto grounded_atom_id = grounded_axiom.get_derived_effect().atom_index;
+    // Thread-local to keep concurrent calls safe.
+    static thread_local std::vector<const FlatBitset*> s_fluent_atoms_buffer;
+    static thread_local std::vector<const FlatBitset*> s_derived_atoms_buffer;
 
-                if (!ref_derived_state_atoms.get(grounded_atom_id))
-                {
-                    // GENERATED NEW DERIVED ATOM!
-                    reached_partition_fixed_point = false;
-                }
+    s_fluent_atoms_buffer.clear();
+    s_derived_atoms_buffer.clear();
+    for (const auto& state : states)
+    {
+        s_fluent_atoms_buffer.push_back(&state.get_atoms<Fluent>());
+        s_derived_atoms_buffer.push_back(&state.get_atoms<Derived>());
+    }
 
-                ref_derived_state_atoms.set(grounded_atom_id);
-            }
+    m_action_match_tree.get_applicable_elements(s_fluent_atoms_buffer, s_derived_atoms_buffer, out_offsets, out_applicable_actions);
+}
 
-        } while (!reached_partition_fixed_point);
-    }
+void GroundedApplicableActionGenerator::generate_and_apply_axioms(const FlatBitset& fluent_state_atoms, FlatBitset& ref_derived_state_atoms)
+{
+    m_axiom_evaluator.generate_and_apply_axioms(fluent_state_atoms, ref_derived_state_atoms);
 }
 
 void GroundedApplicableActionGenerator::on_finish_search_layer() const { m_event_handler->on_finish_search_layer(); }
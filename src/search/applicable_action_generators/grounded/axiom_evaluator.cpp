@@ -0,0 +1,278 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "mimir/search/applicable_action_generators/grounded/axiom_evaluator.hpp"
+
+#include "mimir/formalism/factories.hpp"
+#include "mimir/search/action.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <unordered_map>
+#include <utility>
+
+namespace mimir
+{
+
+/// @brief Group the axioms by atom using counting sort.
+static void compute_trigger_lists(const std::vector<std::pair<Index, Index>>& atom_axiom_pairs, IndexList& out_offsets, IndexList& out_triggers)
+{
+    auto num_atoms = size_t(0);
+    for (const auto& [atom_index, axiom] : atom_axiom_pairs)
+    {
+        num_atoms = std::max(num_atoms, static_cast<size_t>(atom_index + 1));
+    }
+
+    out_offsets.assign(num_atoms + 1, 0);
+    for (const auto& [atom_index, axiom] : atom_axiom_pairs)
+    {
+        ++out_offsets[atom_index + 1];
+    }
+    for (size_t atom_index = 0; atom_index < num_atoms; ++atom_index)
+    {
+        out_offsets[atom_index + 1] += out_offsets[atom_index];
+    }
+
+    out_triggers.resize(atom_axiom_pairs.size());
+    auto positions = IndexList(out_offsets.begin(), out_offsets.end() - 1);
+    for (const auto& [atom_index, axiom] : atom_axiom_pairs)
+    {
+        out_triggers[positions[atom_index]++] = axiom;
+    }
+}
+
+static std::span<const Index> get_triggers(const IndexList& offsets, const IndexList& triggers, Index atom_index)
+{
+    if (static_cast<size_t>(atom_index) + 1 >= offsets.size())
+    {
+        return {};
+    }
+    return std::span<const Index>(triggers.data() + offsets[atom_index], triggers.data() + offsets[atom_index + 1]);
+}
+
+/// @brief Return a new evaluator id. The id 0 is reserved for workspaces that were not used yet.
+static size_t get_next_evaluator_id()
+{
+    static std::atomic<size_t> s_next_id = 1;
+    return s_next_id.fetch_add(1, std::memory_order_relaxed);
+}
+
+GroundedAxiomEvaluator::GroundedAxiomEvaluator() : m_id(get_next_evaluator_id()) {}
+
+GroundedAxiomEvaluator::GroundedAxiomEvaluator(const GroundAxiomList& ground_axioms,
+                                               const std::vector<AxiomPartition>& partitioning,
+                                               const PDDLFactories& pddl_factories) :
+    m_id(get_next_evaluator_id()),
+    m_axioms(ground_axioms),
+    m_strata(),
+    m_heads(),
+    m_initial_counters(),
+    m_negative_derived_precondition_offsets({ 0 }),
+    m_negative_derived_preconditions(),
+    m_unconditional_axioms(partitioning.size()),
+    m_fluent_trigger_offsets(),
+    m_fluent_triggers(),
+    m_negative_fluent_trigger_offsets(),
+    m_negative_fluent_triggers(),
+    m_derived_trigger_offsets(),
+    m_derived_triggers()
+{
+    auto stratum_of_axiom = std::unordered_map<Axiom, Index> {};
+    for (size_t stratum = 0; stratum < partitioning.size(); ++stratum)
+    {
+        for (const auto& axiom : partitioning[stratum].get_axioms())
+        {
+            stratum_of_axiom.emplace(axiom, stratum);
+        }
+    }
+
+    auto fluent_atom_axiom_pairs = std::vector<std::pair<Index, Index>> {};
+    auto negative_fluent_atom_axiom_pairs = std::vector<std::pair<Index, Index>> {};
+    auto derived_atom_axiom_pairs = std::vector<std::pair<Index, Index>> {};
+
+    for (size_t axiom = 0; axiom < m_axioms.size(); ++axiom)
+    {
+        const auto& ground_axiom = m_axioms[axiom];
+        const auto strips_precondition = StripsActionPrecondition(ground_axiom.get_strips_precondition());
+
+        assert(!ground_axiom.get_derived_effect().is_negated);
+
+        const auto stratum = stratum_of_axiom.at(pddl_factories.get_axiom(ground_axiom.get_axiom_index()));
+        m_strata.push_back(stratum);
+        m_heads.push_back(ground_axiom.get_derived_effect().atom_index);
+
+        auto num_positive_preconditions = Index(0);
+        for (const auto atom_index : strips_precondition.get_positive_precondition<Fluent>())
+        {
+            fluent_atom_axiom_pairs.emplace_back(atom_index, axiom);
+            ++num_positive_preconditions;
+        }
+        for (const auto atom_index : strips_precondition.get_positive_precondition<Derived>())
+        {
+            derived_atom_axiom_pairs.emplace_back(atom_index, axiom);
+            ++num_positive_preconditions;
+        }
+        for (const auto atom_index : strips_precondition.get_negative_precondition<Fluent>())
+        {
+            negative_fluent_atom_axiom_pairs.emplace_back(atom_index, axiom);
+        }
+        for (const auto atom_index : strips_precondition.get_negative_precondition<Derived>())
+        {
+            m_negative_derived_preconditions.push_back(atom_index);
+        }
+        m_negative_derived_precondition_offsets.push_back(m_negative_derived_preconditions.size());
+
+        m_initial_counters.push_back(num_positive_preconditions);
+        if (num_positive_preconditions == 0)
+        {
+            m_unconditional_axioms[stratum].push_back(axiom);
+        }
+    }
+
+    compute_trigger_lists(fluent_atom_axiom_pairs, m_fluent_trigger_offsets, m_fluent_triggers);
+    compute_trigger_lists(negative_fluent_atom_axiom_pairs, m_negative_fluent_trigger_offsets, m_negative_fluent_triggers);
+    compute_trigger_lists(derived_atom_axiom_pairs, m_derived_trigger_offsets, m_derived_triggers);
+}
+
+GroundedAxiomEvaluator::Workspace& GroundedAxiomEvaluator::get_workspace()
+{
+    static thread_local Workspace workspace;
+    return workspace;
+}
+
+void GroundedAxiomEvaluator::on_new_derived_atom(Index atom_index, Workspace& workspace) const
+{
+    for (const auto axiom : get_derived_triggers(atom_index))
+    {
+        if (workspace.counters[axiom] == m_initial_counters[axiom])
+        {
+            workspace.touched_axioms.push_back(axiom);
+        }
+        if (--workspace.counters[axiom] == 0)
+        {
+            workspace.ready_axioms[m_strata[axiom]].push_back(axiom);
+        }
+    }
+}
+
+void GroundedAxiomEvaluator::generate_and_apply_axioms(const FlatBitset& fluent_state_atoms, FlatBitset& ref_derived_state_atoms) const
+{
+    auto& workspace = get_workspace();
+    auto& [evaluator_id, counters, is_blocked, ready_axioms_by_stratum, touched_axioms] = workspace;
+
+    /* 1. Initialize the counters */
+
+    // Each evaluation resets the counters it touched, hence, they only need to be copied when the thread switches evaluators.
+    if (evaluator_id != m_id)
+    {
+        evaluator_id = m_id;
+        counters.assign(m_initial_counters.begin(), m_initial_counters.end());
+        is_blocked.assign(m_axioms.size(), false);
+        touched_axioms.clear();
+    }
+    ready_axioms_by_stratum.resize(m_unconditional_axioms.size());
+    for (size_t stratum = 0; stratum < m_unconditional_axioms.size(); ++stratum)
+    {
+        ready_axioms_by_stratum[stratum].assign(m_unconditional_axioms[stratum].begin(), m_unconditional_axioms[stratum].end());
+    }
+
+    /* 2. Process the fluent atoms once per state */
+
+    for (const auto atom_index : fluent_state_atoms)
+    {
+        for (const auto axiom : get_triggers(m_negative_fluent_trigger_offsets, m_negative_fluent_triggers, atom_index))
+        {
+            if (!is_blocked[axiom])
+            {
+                is_blocked[axiom] = true;
+                touched_axioms.push_back(axiom);
+            }
+        }
+        for (const auto axiom : get_triggers(m_fluent_trigger_offsets, m_fluent_triggers, atom_index))
+        {
+            if (counters[axiom] == m_initial_counters[axiom])
+            {
+                touched_axioms.push_back(axiom);
+            }
+            if (--counters[axiom] == 0)
+            {
+                ready_axioms_by_stratum[m_strata[axiom]].push_back(axiom);
+            }
+        }
+    }
+
+    for (const auto atom_index : ref_derived_state_atoms)
+    {
+        on_new_derived_atom(atom_index, workspace);
+    }
+
+    /* 3. Propagate the derived atoms stratum by stratum */
+
+    for (size_t stratum = 0; stratum < ready_axioms_by_stratum.size(); ++stratum)
+    {
+        auto& ready_axioms = ready_axioms_by_stratum[stratum];
+
+        while (!ready_axioms.empty())
+        {
+            const auto axiom = ready_axioms.back();
+            ready_axioms.pop_back();
+
+            if (is_blocked[axiom])
+            {
+                continue;
+            }
+
+            // Negative derived preconditions refer to lower strata, hence, they are final.
+            const auto negative_derived_precondition_violated = std::any_of(m_negative_derived_preconditions.begin() + m_negative_derived_precondition_offsets[axiom],
+                                                                            m_negative_derived_preconditions.begin() + m_negative_derived_precondition_offsets[axiom + 1],
+                                                                            [&ref_derived_state_atoms](Index atom_index) { return ref_derived_state_atoms.get(atom_index); });
+            if (negative_derived_precondition_violated)
+            {
+                continue;
+            }
+
+            const auto head = m_heads[axiom];
+            if (!ref_derived_state_atoms.get(head))
+            {
+                // GENERATED NEW DERIVED ATOM!
+                ref_derived_state_atoms.set(head);
+                on_new_derived_atom(head, workspace);
+            }
+        }
+    }
+
+    /* 4. Reset the touched counters */
+
+    for (const auto axiom : touched_axioms)
+    {
+        counters[axiom] = m_initial_counters[axiom];
+        is_blocked[axiom] = false;
+    }
+    touched_axioms.clear();
+}
+
+const GroundAxiomList& GroundedAxiomEvaluator::get_axioms() const { return m_axioms; }
+
+size_t GroundedAxiomEvaluator::get_num_strata() const { return m_unconditional_axioms.size(); }
+
+std::span<const Index> GroundedAxiomEvaluator::get_derived_triggers(Index atom_index) const
+{
+    return get_triggers(m_derived_trigger_offsets, m_derived_triggers, atom_index);
+}
+
+}
@@ -17,6 +17,7 @@
 
 #include "mimir/search/applicable_action_generators/grounded/event_handlers/default.hpp"
 
+#include "mimir/search/applicable_action_generators/grounded/compact_match_tree.hpp"
 #include "mimir/search/applicable_action_generators/grounded/match_tree.hpp"
 
 #include <iostream>
@@ -26,13 +27,13 @@ namespace mimir
 
 void DefaultGroundedApplicableActionGeneratorEventHandler::on_finish_delete_free_exploration_impl(const GroundAtomList<Fluent>& reached_fluent_atoms,
                                                                                                   const GroundAtomList<Derived>& reached_derived_atoms,
-                                                                                                  const GroundActionList& instantiated_actions,
+                                                                                                  size_t num_instantiated_actions,
                                                                                                   const GroundAxiomList& instantiated_axioms)
 {
     std::cout << "[GroundedApplicableActionGenerator] Number of fluent grounded atoms reachable in delete-free problem: " << reached_fluent_atoms.size() << "\n"
               << "[GroundedApplicableActionGenerator] Number of derived grounded atoms reachable in delete-free problem: " << reached_derived_atoms.size()
               << "\n"
-              << "[GroundedApplicableActionGenerator] Number of delete-free grounded actions: " << instantiated_actions.size() << "\n"
+              << "[GroundedApplicableActionGenerator] Number of delete-free grounded actions: " << num_instantiated_actions << "\n"
               << "[GroundedApplicableActionGenerator] Number of delete-free grounded axioms: " << instantiated_axioms.size() << std::endl;
 }
 
@@ -46,14 +47,14 @@ void DefaultGroundedApplicableActionGeneratorEventHandler::on_finish_build_actio
     std::cout << "[GroundedApplicableActionGenerator] Number of nodes in action match tree: " << action_match_tree.get_num_nodes() << std::endl;
 }
 
-void DefaultGroundedApplicableActionGeneratorEventHandler::on_finish_grounding_unrelaxed_axioms_impl(const GroundAxiomList& unrelaxed_axioms)
+void DefaultGroundedApplicableActionGeneratorEventHandler::on_finish_build_action_match_tree_impl(const CompactMatchTree<GroundAction>& action_match_tree)
 {
-    std::cout << "[GroundedApplicableActionGenerator] Number of grounded axioms in problem: " << unrelaxed_axioms.size() << std::endl;
+    std::cout << "[GroundedApplicableActionGenerator] Number of nodes in compact action match tree: " << action_match_tree.get_num_nodes() << std::endl;
 }
 
-void DefaultGroundedApplicableActionGeneratorEventHandler::on_finish_build_axiom_match_tree_impl(const MatchTree<GroundAxiom>& axiom_match_tree)
+void DefaultGroundedApplicableActionGeneratorEventHandler::on_finish_grounding_unrelaxed_axioms_impl(const GroundAxiomList& unrelaxed_axioms)
 {
-    std::cout << "[GroundedApplicableActionGenerator] Number of nodes in axiom match tree: " << axiom_match_tree.get_num_nodes() << std::endl;
+    std::cout << "[GroundedApplicableActionGenerator] Number of grounded axioms in problem: " << unrelaxed_axioms.size() << std::endl;
 }
 
 void DefaultGroundedApplicableActionGeneratorEventHandler::on_finish_search_layer_impl() const
@@ -0,0 +1,319 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "mimir/search/applicable_action_generators/grounded/relaxed_reachability_grounder.hpp"
+
+#include "mimir/formalism/factories.hpp"
+#include "mimir/formalism/ground_atom.hpp"
+#include "mimir/formalism/ground_literal.hpp"
+#include "mimir/formalism/literal.hpp"
+#include "mimir/formalism/problem.hpp"
+#include "mimir/formalism/utils.hpp"
+
+#include <algorithm>
+
+namespace mimir
+{
+
+RelaxedReachabilityGrounder::RelaxedReachabilityGrounder(Problem problem, std::shared_ptr<PDDLFactories> pddl_factories, size_t num_threads) :
+    m_problem(problem),
+    m_pddl_factories(std::move(pddl_factories)),
+    // We explicitly require to keep actions and axioms with empty effects.
+    m_delete_relax_transformer(*m_pddl_factories, false),
+    m_delete_free_problem(m_delete_relax_transformer.run(*m_problem)),
+    m_delete_free_axiom_evaluator(m_delete_free_problem, m_pddl_factories, std::make_shared<DefaultLiftedApplicableActionGeneratorEventHandler>()),
+    m_ground_atom_index_tables(std::make_shared<GroundAtomIndexTables>(m_delete_free_problem)),
+    m_condition_grounders(),
+    m_reached_bindings(),
+    m_thread_pool((num_threads > 1) ? std::make_unique<BS::thread_pool>(static_cast<BS::concurrency_t>(num_threads)) : nullptr),
+    m_reached_fluent_atoms(),
+    m_reached_derived_atoms(),
+    m_num_delete_free_actions(0),
+    m_ground_actions(),
+    m_ground_axioms(),
+    m_new_fluent_atoms(),
+    m_new_derived_atoms(),
+    m_new_fluent_atoms_by_predicate(),
+    m_new_derived_atoms_by_predicate(),
+    m_schema_bindings(),
+    m_schema_num_bindings(),
+    m_binding(),
+    m_pending_conditional_effects()
+{
+    auto static_initial_atoms = to_ground_atoms(m_delete_free_problem->get_static_initial_literals());
+    auto static_assignment_set =
+        AssignmentSet<Static>(m_delete_free_problem, m_delete_free_problem->get_domain()->get_predicates<Static>(), static_initial_atoms);
+
+    const auto& actions = m_delete_free_problem->get_domain()->get_actions();
+    m_condition_grounders.reserve(actions.size());
+    for (const auto& action : actions)
+    {
+        m_condition_grounders.emplace_back(action,
+                                           ConditionGrounder<PartiallyExtendedState>(m_delete_free_problem,
+                                                                                     action->get_parameters(),
+                                                                                     action->get_conditions<Static>(),
+                                                                                     action->get_conditions<Fluent>(),
+                                                                                     action->get_conditions<Derived>(),
+                                                                                     static_assignment_set,
+                                                                                     m_pddl_factories,
+                                                                                     m_ground_atom_index_tables));
+    }
+    m_reached_bindings.resize(actions.size());
+    m_schema_bindings.resize(actions.size());
+    m_schema_num_bindings.resize(actions.size());
+}
+
+void RelaxedReachabilityGrounder::compute_schema_bindings(size_t schema_index, bool is_first_round)
+{
+    auto& [action, condition_grounder] = m_condition_grounders[schema_index];
+    auto& schema_bindings = m_schema_bindings[schema_index];
+    auto& schema_num_bindings = m_schema_num_bindings[schema_index];
+    schema_bindings.clear();
+    schema_num_bindings = 0;
+
+    const auto& fluent_assignment_set = m_delete_free_axiom_evaluator.get_fluent_assignment_set();
+    const auto& derived_assignment_set = m_delete_free_axiom_evaluator.get_derived_assignment_set();
+    const auto state = PartiallyExtendedState(m_reached_fluent_atoms, m_reached_derived_atoms);
+
+    const auto on_binding = [&schema_bindings, &schema_num_bindings](const ObjectList& binding)
+    {
+        schema_bindings.insert(schema_bindings.end(), binding.begin(), binding.end());
+        ++schema_num_bindings;
+    };
+
+    if (is_first_round)
+    {
+        condition_grounder.compute_bindings(state, fluent_assignment_set, derived_assignment_set, on_binding);
+        return;
+    }
+
+    // Semi-naive evaluation: the conditions of delete-free actions are positive,
+    // hence, a binding that does not use a newly reached atom was already found in an earlier round.
+    // A binding that uses several new atoms is found several times, duplicates are removed when grounding.
+    for (const auto& literal : action->get_conditions<Fluent>())
+    {
+        const auto it = m_new_fluent_atoms_by_predicate.find(literal->get_atom()->get_predicate());
+        if (literal->is_negated() || it == m_new_fluent_atoms_by_predicate.end())
+        {
+            continue;
+        }
+        for (const auto& ground_atom : it->second)
+        {
+            condition_grounder.compute_bindings(state, fluent_assignment_set, derived_assignment_set, literal, ground_atom, on_binding);
+        }
+    }
+    for (const auto& literal : action->get_conditions<Derived>())
+    {
+        const auto it = m_new_derived_atoms_by_predicate.find(literal->get_atom()->get_predicate());
+        if (literal->is_negated() || it == m_new_derived_atoms_by_predicate.end())
+        {
+            continue;
+        }
+        for (const auto& ground_atom : it->second)
+        {
+            condition_grounder.compute_bindings(state, fluent_assignment_set, derived_assignment_set, literal, ground_atom, on_binding);
+        }
+    }
+}
+
+bool RelaxedReachabilityGrounder::is_relaxed_applicable(const ConditionalEffect& conditional_effect) const
+{
+    const auto& static_atoms = m_problem->get_static_initial_positive_atoms();
+    const auto holds = [](const FlatIndexList& atom_indices, const FlatBitset& atoms)
+    { return std::all_of(atom_indices.begin(), atom_indices.end(), [&atoms](Index atom_index) { return atoms.get(atom_index); }); };
+
+    return holds(conditional_effect.get_positive_precondition<Static>(), static_atoms)
+           && holds(conditional_effect.get_positive_precondition<Fluent>(), m_reached_fluent_atoms)
+           && holds(conditional_effect.get_positive_precondition<Derived>(), m_reached_derived_atoms);
+}
+
+void RelaxedReachabilityGrounder::apply_relaxed(GroundAction action)
+{
+    for (const auto atom_index : StripsActionEffect(action.get_strips_effect()).get_positive_effects())
+    {
+        m_reached_fluent_atoms.set(atom_index);
+    }
+
+    const auto& conditional_effects = action.get_conditional_effects();
+    for (size_t i = 0; i < conditional_effects.size(); ++i)
+    {
+        const auto conditional_effect = ConditionalEffect(conditional_effects[i]);
+        const auto& simple_effect = conditional_effect.get_simple_effect();
+        if (simple_effect.is_negated)
+        {
+            continue;
+        }
+
+        if (is_relaxed_applicable(conditional_effect))
+        {
+            m_reached_fluent_atoms.set(simple_effect.atom_index);
+        }
+        else
+        {
+            m_pending_conditional_effects.emplace_back(action, i);
+        }
+    }
+}
+
+void RelaxedReachabilityGrounder::ground(LiftedApplicableActionGenerator& ref_lifted_aag)
+{
+    const auto& static_positive_atoms = m_problem->get_static_initial_positive_atoms();
+
+    m_reached_fluent_atoms.unset_all();
+    m_reached_derived_atoms.unset_all();
+    for (const auto& literal : m_delete_free_problem->get_fluent_initial_literals())
+    {
+        m_reached_fluent_atoms.set(literal->get_atom()->get_index());
+    }
+
+    // The atoms that were reached when the bindings were last computed.
+    auto previous_fluent_atoms = FlatBitset();
+    auto previous_derived_atoms = FlatBitset();
+
+    for (bool is_first_round = true;; is_first_round = false)
+    {
+        /* 1. Close the reached atoms under the delete-free axioms. */
+
+        m_delete_free_axiom_evaluator.generate_and_apply_axioms(m_reached_fluent_atoms, m_reached_derived_atoms);
+
+        /* 2. Compute the newly reached atoms. */
+
+        m_new_fluent_atoms = m_reached_fluent_atoms;
+        m_new_fluent_atoms -= previous_fluent_atoms;
+        m_new_derived_atoms = m_reached_derived_atoms;
+        m_new_derived_atoms -= previous_derived_atoms;
+
+        if (!is_first_round && m_new_fluent_atoms.count() == 0 && m_new_derived_atoms.count() == 0)
+        {
+            break;
+        }
+
+        m_new_fluent_atoms_by_predicate.clear();
+        for (const auto atom_index : m_new_fluent_atoms)
+        {
+            const auto ground_atom = m_pddl_factories->get_ground_atom<Fluent>(atom_index);
+            m_new_fluent_atoms_by_predicate[ground_atom->get_predicate()].push_back(ground_atom);
+        }
+        m_new_derived_atoms_by_predicate.clear();
+        for (const auto atom_index : m_new_derived_atoms)
+        {
+            const auto ground_atom = m_pddl_factories->get_ground_atom<Derived>(atom_index);
+            m_new_derived_atoms_by_predicate[ground_atom->get_predicate()].push_back(ground_atom);
+        }
+
+        previous_fluent_atoms = m_reached_fluent_atoms;
+        previous_derived_atoms = m_reached_derived_atoms;
+
+        /* 3. Compute the bindings of the delete-free action schemas, optionally in parallel. */
+
+        m_delete_free_axiom_evaluator.get_fluent_assignment_set().update_ground_atoms(m_reached_fluent_atoms, *m_pddl_factories);
+        m_delete_free_axiom_evaluator.get_derived_assignment_set().update_ground_atoms(m_reached_derived_atoms, *m_pddl_factories);
+
+        const auto num_schemas = m_condition_grounders.size();
+        if (!m_thread_pool)
+        {
+            for (size_t schema_index = 0; schema_index < num_schemas; ++schema_index)
+            {
+                compute_schema_bindings(schema_index, is_first_round);
+            }
+        }
+        else
+        {
+            m_thread_pool->detach_loop<size_t>(
+                0,
+                num_schemas,
+                [this, is_first_round](size_t schema_index) { compute_schema_bindings(schema_index, is_first_round); },
+                num_schemas);
+            m_thread_pool->wait();
+        }
+
+        /* 4. Ground each new binding once as unrelaxed actions and apply their add effects. */
+
+        for (size_t schema_index = 0; schema_index < num_schemas; ++schema_index)
+        {
+            const auto action = m_condition_grounders[schema_index].first;
+            const auto arity = action->get_arity();
+            const auto& schema_bindings = m_schema_bindings[schema_index];
+
+            for (size_t binding_index = 0; binding_index < m_schema_num_bindings[schema_index]; ++binding_index)
+            {
+                m_binding.assign(schema_bindings.begin() + binding_index * arity, schema_bindings.begin() + (binding_index + 1) * arity);
+
+                if (!m_reached_bindings[schema_index].insert(m_binding).second)
+                {
+                    continue;
+                }
+                ++m_num_delete_free_actions;
+
+                for (const auto& unrelaxed_action : m_delete_relax_transformer.get_unrelaxed_actions(action))
+                {
+                    const auto ground_action = ref_lifted_aag.ground_action(unrelaxed_action, m_binding);
+
+                    apply_relaxed(ground_action);
+
+                    if (ground_action.is_statically_applicable(static_positive_atoms))
+                    {
+                        m_ground_actions.push_back(ground_action);
+                    }
+                }
+            }
+        }
+
+        /* 5. Fire the pending conditional effects whose conditions became true. */
+
+        std::erase_if(m_pending_conditional_effects,
+                      [this](const auto& pending)
+                      {
+                          const auto conditional_effect = ConditionalEffect(pending.first.get_conditional_effects()[pending.second]);
+                          if (!is_relaxed_applicable(conditional_effect))
+                          {
+                              return false;
+                          }
+                          m_reached_fluent_atoms.set(conditional_effect.get_simple_effect().atom_index);
+                          return true;
+                      });
+    }
+
+    /* 6. Ground the unrelaxed axioms with the same bindings as the reachable delete-free axioms. */
+
+    for (const auto& axiom : m_delete_free_axiom_evaluator.get_ground_axioms())
+    {
+        for (const auto& unrelaxed_axiom : m_delete_relax_transformer.get_unrelaxed_axioms(m_pddl_factories->get_axiom(axiom.get_axiom_index())))
+        {
+            const auto axiom_arguments = m_pddl_factories->get_objects_from_indices(axiom.get_objects());
+            const auto ground_axiom = ref_lifted_aag.ground_axiom(unrelaxed_axiom, axiom_arguments);
+            if (ground_axiom.is_statically_applicable(static_positive_atoms))
+            {
+                m_ground_axioms.push_back(ground_axiom);
+            }
+        }
+    }
+}
+
+const FlatBitset& RelaxedReachabilityGrounder::get_reached_fluent_atoms() const { return m_reached_fluent_atoms; }
+
+const FlatBitset& RelaxedReachabilityGrounder::get_reached_derived_atoms() const { return m_reached_derived_atoms; }
+
+size_t RelaxedReachabilityGrounder::get_num_delete_free_actions() const { return m_num_delete_free_actions; }
+
+const GroundAxiomList& RelaxedReachabilityGrounder::get_delete_free_axioms() const { return m_delete_free_axiom_evaluator.get_ground_axioms(); }
+
+const GroundActionList& RelaxedReachabilityGrounder::get_ground_actions() const { return m_ground_actions; }
+
+const GroundAxiomList& RelaxedReachabilityGrounder::get_ground_axioms() const { return m_ground_axioms; }
+
+}
@@ -102,12 +102,12 @@ public:
 
 const std::vector<AxiomPartition>& LiftedApplicableActionGenerator::get_axiom_partitioning() const { return m_axiom_evaluator.get_axiom_partitioning(); }
 
-GroundAxiom LiftedApplicableActionGenerator::ground_axiom(Axiom axiom, ObjectList&& binding)
+GroundAxiom LiftedApplicableActionGenerator::ground_axiom(Axiom axiom, const ObjectList& binding)
 {
-    return m_axiom_evaluator.ground_axiom(axiom, std::move(binding));
+    return m_axiom_evaluator.ground_axiom(axiom, binding);
 }
 
-GroundAction LiftedApplicableActionGenerator::ground_action(Action action, ObjectList&& binding)
+GroundAction LiftedApplicableActionGenerator::ground_action(Action action, const ObjectList& binding)
 {
     /* 1. Check if grounding is cached */
 
@@ -301,7 +301,7 @@ GroundAction LiftedApplicableActionGenerator::ground_action(Action action, Objec
 
     /* 3. Insert to groundings table */
 
-    groundings.emplace(std::move(binding), GroundAction(grounded_action));
+    groundings.emplace(binding, GroundAction(grounded_action));
 
     /* 4. Return the resulting ground action */
 
@@ -314,30 +314,72 @@ void LiftedApplicableActionGenerator::generate_applicable_actions(State state, G
 
     m_event_handler->on_start_generating_applicable_actions();
 
-    // Create the assignment sets that are shared by all action schemas.
+    // Update the assignment sets that are shared by all action schemas with the atoms that differ from the last state.
+    // The axiom evaluator owns the assignment sets, hence, they are already up to date if the axioms were just evaluated for the state.
 
-    auto& fluent_predicates = m_problem->get_domain()->get_predicates<Fluent>();
-    auto fluent_atoms = m_pddl_factories->get_ground_atoms_from_indices<Fluent>(state.get_atoms<Fluent>());
-
-    auto fluent_assignment_set = AssignmentSet<Fluent>(m_problem, fluent_predicates, fluent_atoms);
-
-    auto& derived_predicates = m_problem->get_problem_and_domain_derived_predicates();
-
-    auto derived_atoms = m_pddl_factories->get_ground_atoms_from_indices<Derived>(state.get_atoms<Derived>());
-    auto derived_assignment_set = AssignmentSet<Derived>(m_problem, derived_predicates, derived_atoms);
+    auto& fluent_assignment_set = m_axiom_evaluator.get_fluent_assignment_set();
+    auto& derived_assignment_set = m_axiom_evaluator.get_derived_assignment_set();
+    fluent_assignment_set.update_ground_atoms(state.get_atoms<Fluent>(), *m_pddl_factories);
+    derived_assignment_set.update_ground_atoms(state.get_atoms<Derived>(), *m_pddl_factories);
 
     // Get all applicable ground actions.
     // This is done by getting bindings in the given state using the precondition.
     // These bindings are then used to ground the actual action schemas.
 
-    std::vector<ObjectList> bindings;
-    for (auto& [action, condition_grounder] : m_action_precondition_grounders)
+    if (!m_thread_pool)
     {
-        condition_grounder.compute_bindings(state, fluent_assignment_set, derived_assignment_set, bindings);
-
-        for (auto& binding : bindings)
+        for (auto& [action, condition_grounder] : m_action_precondition_grounder_list)
+        {
+            condition_grounder->compute_bindings(state,
+                                                 fluent_assignment_set,
+                                                 derived_assignment_set,
+                                                 [this, action = action, &out_applicable_actions](const ObjectList& binding)
+                                                 { out_applicable_actions.emplace_back(ground_action(action, binding)); });
+        }
+    }
+    else
+    {
+        // 1. Compute the bindings of each action schema in its own task.
+        //    The grounders only share the ground atom index tables, which are safe for concurrent use.
+
+        const auto num_schemas = m_action_precondition_grounder_list.size();
+        m_thread_pool->detach_loop<size_t>(
+            0,
+            num_schemas,
+            [this, state, &fluent_assignment_set, &derived_assignment_set](size_t schema_index)
+            {
+                auto& schema_bindings = m_schema_bindings[schema_index];
+                auto& schema_num_bindings = m_schema_num_bindings[schema_index];
+                schema_bindings.clear();
+                schema_num_bindings = 0;
+
+                m_action_precondition_grounder_list[schema_index].second->compute_bindings(
+                    state,
+                    fluent_assignment_set,
+                    derived_assignment_set,
+                    [&schema_bindings, &schema_num_bindings](const ObjectList& binding)
+                    {
+                        schema_bindings.insert(schema_bindings.end(), binding.begin(), binding.end());
+                        ++schema_num_bindings;
+                    });
+            },
+            num_schemas);
+        m_thread_pool->wait();
+
+        // 2. Ground the bindings sequentially in the same order as without parallelization,
+        //    which keeps the grounding tables and action indices deterministic.
+
+        for (size_t schema_index = 0; schema_index < num_schemas; ++schema_index)
         {
-            out_applicable_actions.emplace_back(ground_action(action, std::move(binding)));
+            const auto action = m_action_precondition_grounder_list[schema_index].first;
+            const auto arity = action->get_arity();
+            const auto& schema_bindings = m_schema_bindings[schema_index];
+
+            for (size_t binding_index = 0; binding_index < m_schema_num_bindings[schema_index]; ++binding_index)
+            {
+                m_binding.assign(schema_bindings.begin() + binding_index * arity, schema_bindings.begin() + (binding_index + 1) * arity);
+                out_applicable_actions.emplace_back(ground_action(action, m_binding));
+            }
         }
     }
 
@@ -361,14 +403,21 @@ LiftedApplicableActionGenerator::LiftedApplicableActionGenerator(Problem problem
 
 LiftedApplicableActionGenerator::LiftedApplicableActionGenerator(Problem problem,
                                                                  std::shared_ptr<PDDLFactories> pddl_factories,
-                                                                 std::shared_ptr<ILiftedApplicableActionGeneratorEventHandler> event_handler) :
+                                                                 std::shared_ptr<ILiftedApplicableActionGeneratorEventHandler> event_handler,
+                                                                 size_t num_threads) :
     m_problem(problem),
     m_pddl_factories(std::move(pddl_factories)),
     m_event_handler(std::move(event_handler)),
     m_axiom_evaluator(problem, m_pddl_factories, m_event_handler),
+    m_ground_atom_index_tables(std::make_shared<GroundAtomIndexTables>(problem)),
     m_action_precondition_grounders(),
+    m_action_precondition_grounder_list(),
     m_action_universal_effects(),
-    m_ground_function_value_costs()
+    m_ground_function_value_costs(),
+    m_thread_pool((num_threads > 1) ? std::make_unique<BS::thread_pool>(static_cast<BS::concurrency_t>(num_threads)) : nullptr),
+    m_schema_bindings(),
+    m_schema_num_bindings(),
+    m_binding()
 {
     /* 1. Initialize ground function costs. */
 
@@ -391,7 +440,8 @@ LiftedApplicableActionGenerator::LiftedApplicableActionGenerator(Problem problem
                                                                          action->get_conditions<Fluent>(),
                                                                          action->get_conditions<Derived>(),
                                                                          static_assignment_set,
-                                                                         m_pddl_factories));
+                                                                         m_pddl_factories,
+                                                                         m_ground_atom_index_tables));
         auto universal_effects = std::vector<consistency_graph::StaticConsistencyGraph>();
         universal_effects.reserve(action->get_universal_effects().size());
 
@@ -406,6 +456,15 @@ LiftedApplicableActionGenerator::LiftedApplicableActionGenerator(Problem problem
 
         m_action_universal_effects.emplace(action, std::move(universal_effects));
     }
+
+    /* 3. Fix the order of the action schemas and prepare the buffers of the parallel mode. */
+
+    for (auto& [action, condition_grounder] : m_action_precondition_grounders)
+    {
+        m_action_precondition_grounder_list.emplace_back(action, &condition_grounder);
+    }
+    m_schema_bindings.resize(m_action_precondition_grounder_list.size());
+    m_schema_num_bindings.resize(m_action_precondition_grounder_list.size());
 }
 
 const GroundActionList& LiftedApplicableActionGenerator::get_ground_actions() const { return m_actions_by_index; }
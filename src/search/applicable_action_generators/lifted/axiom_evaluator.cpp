@@ -35,33 +35,28 @@ void AxiomEvaluator::generate_and_apply_axioms(const FlatBitset& fluent_state_at
 
     m_event_handler->on_start_generating_applicable_axioms();
 
-    // TODO: In principle, we could reuse the resulting assignment set from the lifted AAG but it is difficult to access here.
-    const auto fluent_assignment_set = AssignmentSet<Fluent>(m_problem,
-                                                             m_problem->get_domain()->get_predicates<Fluent>(),
-                                                             m_pddl_factories->get_ground_atoms_from_indices<Fluent>(fluent_state_atoms));
+    // Update the assignment sets with the atoms that differ from the last evaluation or action generation.
+    m_fluent_assignment_set.update_ground_atoms(fluent_state_atoms, *m_pddl_factories);
+    m_derived_assignment_set.update_ground_atoms(ref_derived_state_atoms, *m_pddl_factories);
 
-    auto derived_assignment_set = AssignmentSet<Derived>(m_problem,
-                                                         m_problem->get_problem_and_domain_derived_predicates(),
-                                                         m_pddl_factories->get_ground_atoms_from_indices<Derived>(ref_derived_state_atoms));
+    const auto& fluent_assignment_set = m_fluent_assignment_set;
+    auto& derived_assignment_set = m_derived_assignment_set;
 
     /* 2. Fixed point computation */
 
-    auto bindings = std::vector<ObjectList> {};
-    auto applicable_axioms = GroundAxiomList {};
+    auto& applicable_axioms = m_applicable_axioms;
+    auto& new_ground_atoms = m_new_ground_atoms;
+    applicable_axioms.clear();
+
+    const auto partially_extended_state = PartiallyExtendedState(fluent_state_atoms, ref_derived_state_atoms);
 
     for (const auto& partition : m_partitioning)
     {
         bool reached_partition_fixed_point;
-
-        // Optimization 1: Track new ground atoms to simplify the clique enumeration graph in the next iteration.
-        auto new_ground_atoms = GroundAtomList<Derived> {};
+        bool is_first_iteration = true;
 
         // TODO: Optimization 4: Inductively compile away axioms with static bodies. (grounded in match tree?)
 
-        // Optimization 2: Track axioms that might trigger in next iteration.
-        // Optimization 3: Use precomputed set of axioms that might be applicable initially
-        auto relevant_axioms = partition.get_initially_relevant_axioms();
-
         do
         {
             reached_partition_fixed_point = true;
@@ -69,22 +64,55 @@ void AxiomEvaluator::generate_and_apply_axioms(const FlatBitset& fluent_state_at
             /* Compute applicable axioms */
 
             applicable_axioms.clear();
-            for (const auto& axiom : relevant_axioms)
-            {
-                auto partially_extended_state = PartiallyExtendedState(fluent_state_atoms, ref_derived_state_atoms);
-                auto& condition_grounder = m_condition_grounders.at(axiom);
-                condition_grounder.compute_bindings(partially_extended_state, fluent_assignment_set, derived_assignment_set, bindings);
 
-                for (auto& binding : bindings)
+            if (is_first_iteration)
+            {
+                // Optimization 3: Use precomputed set of axioms that might be applicable initially
+                for (const auto& axiom : partition.get_initially_relevant_axioms())
+                {
+                    m_condition_grounders.at(axiom).compute_bindings(partially_extended_state,
+                                                                     fluent_assignment_set,
+                                                                     derived_assignment_set,
+                                                                     [this, &axiom, &applicable_axioms](const ObjectList& binding)
+                                                                     { applicable_axioms.emplace_back(ground_axiom(axiom, binding)); });
+                }
+            }
+            else
+            {
+                // Optimization 5: Semi-naive evaluation.
+                // Bindings that do not use a ground atom derived in the last iteration were already found in an earlier iteration,
+                // because the derived literals of the current partition occur positively in the bodies.
+                // Hence, we only enumerate the bindings in which some body literal is grounded to a new ground atom.
+                for (const auto& new_ground_atom : new_ground_atoms)
                 {
-                    applicable_axioms.emplace_back(ground_axiom(axiom, std::move(binding)));
+                    const auto predicate = new_ground_atom->get_predicate();
+
+                    for (const auto& axiom : partition.get_axioms_with_body_predicate(predicate))
+                    {
+                        auto& condition_grounder = m_condition_grounders.at(axiom);
+
+                        for (const auto& literal : axiom->get_conditions<Derived>())
+                        {
+                            if (literal->is_negated() || literal->get_atom()->get_predicate() != predicate)
+                            {
+                                continue;
+                            }
+
+                            condition_grounder.compute_bindings(partially_extended_state,
+                                                                fluent_assignment_set,
+                                                                derived_assignment_set,
+                                                                literal,
+                                                                new_ground_atom,
+                                                                [this, &axiom, &applicable_axioms](const ObjectList& binding)
+                                                                { applicable_axioms.emplace_back(ground_axiom(axiom, binding)); });
+                        }
+                    }
                 }
             }
 
             /* Apply applicable axioms */
 
             new_ground_atoms.clear();
-            relevant_axioms.clear();
 
             for (const auto& grounded_axiom : applicable_axioms)
             {
@@ -100,20 +128,18 @@ void AxiomEvaluator::generate_and_apply_axioms(const FlatBitset& fluent_state_at
                     const auto new_ground_atom = m_pddl_factories->get_ground_atom<Derived>(grounded_atom_id);
                     reached_partition_fixed_point = false;
 
-                    // TODO: Optimization 5: Update new ground atoms to speed up successive iterations, i.e.,
-                    // only cliques that takes these new atoms into account must be computed.
+                    // Optimization 1: Track new ground atoms to restrict the clique enumeration in the next iteration.
                     new_ground_atoms.push_back(new_ground_atom);
 
                     // Update the assignment set
                     derived_assignment_set.insert_ground_atom(new_ground_atom);
 
-                    // Retrieve relevant axioms
-                    partition.retrieve_axioms_with_same_body_predicate(new_ground_atom, relevant_axioms);
+                    ref_derived_state_atoms.set(grounded_atom_id);
                 }
-
-                ref_derived_state_atoms.set(grounded_atom_id);
             }
 
+            is_first_iteration = false;
+
         } while (!reached_partition_fixed_point);
     }
 
@@ -131,8 +157,12 @@ AxiomEvaluator::AxiomEvaluator(Problem problem,
     m_axioms_by_index(),
     m_axiom_builder(),
     m_axiom_groundings(),
-    m_condition_grounders()
-
+    m_ground_atom_index_tables(std::make_shared<GroundAtomIndexTables>(problem)),
+    m_condition_grounders(),
+    m_fluent_assignment_set(problem, problem->get_domain()->get_predicates<Fluent>()),
+    m_derived_assignment_set(problem, problem->get_problem_and_domain_derived_predicates()),
+    m_applicable_axioms(),
+    m_new_ground_atoms()
 {
     /* 1. Error checking */
 
@@ -185,13 +215,18 @@ AxiomEvaluator::AxiomEvaluator(Problem problem,
                                                                                 axiom->get_conditions<Fluent>(),
                                                                                 axiom->get_conditions<Derived>(),
                                                                                 static_assignment_set,
-                                                                                m_pddl_factories));
+                                                                                m_pddl_factories,
+                                                                                m_ground_atom_index_tables));
     }
 }
 
 const std::vector<AxiomPartition>& AxiomEvaluator::get_axiom_partitioning() const { return m_partitioning; }
 
-GroundAxiom AxiomEvaluator::ground_axiom(Axiom axiom, ObjectList&& binding)
+AssignmentSet<Fluent>& AxiomEvaluator::get_fluent_assignment_set() { return m_fluent_assignment_set; }
+
+AssignmentSet<Derived>& AxiomEvaluator::get_derived_assignment_set() { return m_derived_assignment_set; }
+
+GroundAxiom AxiomEvaluator::ground_axiom(Axiom axiom, const ObjectList& binding)
 {
     /* 1. Check if grounding is cached */
 
@@ -264,7 +299,7 @@ GroundAxiom AxiomEvaluator::ground_axiom(Axiom axiom, ObjectList&& binding)
 
     /* 3. Insert to groundings table */
 
-    groundings.emplace(std::move(binding), GroundAxiom(grounded_axiom));
+    groundings.emplace(binding, GroundAxiom(grounded_axiom));
 
     /* 4. Return the resulting ground axiom */
 
@@ -59,21 +59,18 @@ AxiomPartition::AxiomPartition(AxiomSet axioms,
     }
 }
 
-void AxiomPartition::retrieve_axioms_with_same_body_predicate(GroundAtom<Derived> derived_atom, AxiomSet& ref_axioms) const
-{
-    auto it = m_axioms_by_body_predicates.find(derived_atom->get_predicate());
-    if (it != m_axioms_by_body_predicates.end())
-    {
-        const auto& relevant_axioms = it->second;
-
-        ref_axioms.insert(relevant_axioms.begin(), relevant_axioms.end());
-    }
-}
-
 const AxiomSet& AxiomPartition::get_axioms() const { return m_axioms; }
 
 const AxiomSet& AxiomPartition::get_initially_relevant_axioms() const { return m_initially_relevant_axioms; }
 
+const AxiomSet& AxiomPartition::get_axioms_with_body_predicate(Predicate<Derived> predicate) const
+{
+    static const auto s_empty_axioms = AxiomSet {};
+
+    auto it = m_axioms_by_body_predicates.find(predicate);
+    return (it != m_axioms_by_body_predicates.end()) ? it->second : s_empty_axioms;
+}
+
 /// @brief Compute occurrences of predicates in axiom heads
 /// @param axioms a set of axioms
 /// @param predicates the set of all predicates occuring in axioms
@@ -0,0 +1,172 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "mimir/search/concurrent_state_repository.hpp"
+
+#include "mimir/common/hash_cista.hpp"
+#include "mimir/common/types_cista.hpp"
+#include "mimir/formalism/ground_literal.hpp"
+#include "mimir/formalism/problem.hpp"
+#include "mimir/search/applicable_action_generators.hpp"
+#include "mimir/search/state_repository.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace mimir
+{
+
+/// @brief The state builder of each thread. It only serves as a buffer and can be shared among repositories.
+static thread_local StateBuilder s_state_builder;
+
+ConcurrentStateRepository::ConcurrentStateRepository(std::shared_ptr<IApplicableActionGenerator> aag, size_t num_shards) :
+    m_aag(std::move(aag)),
+    m_problem_or_domain_has_axioms(!m_aag->get_problem()->get_axioms().empty() || !m_aag->get_problem()->get_domain()->get_axioms().empty()),
+    m_shards(),
+    m_next_state_index(0)
+{
+    for (size_t i = 0; i < std::max(num_shards, size_t(1)); ++i)
+    {
+        m_shards.push_back(std::make_unique<Shard>());
+    }
+}
+
+State ConcurrentStateRepository::get_or_create_initial_state()
+{
+    auto ground_atoms = GroundAtomList<Fluent> {};
+
+    for (const auto& literal : m_aag->get_problem()->get_fluent_initial_literals())
+    {
+        if (literal->is_negated())
+        {
+            throw std::runtime_error("negative literals in the initial state are not supported");
+        }
+
+        ground_atoms.push_back(literal->get_atom());
+    }
+
+    return get_or_create_state(ground_atoms);
+}
+
+State ConcurrentStateRepository::get_or_create_state(const GroundAtomList<Fluent>& atoms)
+{
+    auto& fluent_state_atoms = s_state_builder.get_atoms<Fluent>();
+    fluent_state_atoms.unset_all();
+
+    for (const auto& atom : atoms)
+    {
+        fluent_state_atoms.set(atom->get_index());
+    }
+
+    return get_or_create_state_from_builder(s_state_builder);
+}
+
+State ConcurrentStateRepository::get_or_create_state(const FlatBitset& fluent_atoms)
+{
+    s_state_builder.get_atoms<Fluent>() = fluent_atoms;
+
+    return get_or_create_state_from_builder(s_state_builder);
+}
+
+State ConcurrentStateRepository::get_or_create_successor_state(State state, GroundAction action)
+{
+    apply_action_effects(m_aag->get_problem(), state, action, s_state_builder.get_atoms<Fluent>());
+
+    return get_or_create_state_from_builder(s_state_builder);
+}
+
+State ConcurrentStateRepository::get_or_create_state_from_builder(StateBuilder& state_builder)
+{
+    const auto& fluent_state_atoms = state_builder.get_atoms<Fluent>();
+
+    /* 1. Select the shard, remix the hash value because the shard uses it for its hash set as well. */
+
+    const auto hash = static_cast<uint64_t>(std::hash<FlatBitset>()(fluent_state_atoms)) * 0x9E3779B97F4A7C15ULL;
+    auto& shard = *m_shards[(hash >> 32) % m_shards.size()];
+
+    /* 2. Retrieve cached extended state */
+
+    {
+        auto lock = std::lock_guard<std::mutex>(shard.mutex);
+
+        auto iter = shard.states.find(state_builder.get_data());
+        if (iter != shard.states.end())
+        {
+            return State(**iter);
+        }
+    }
+
+    /* 3. Construct extended state by evaluating Axioms outside of the critical section. */
+
+    auto& derived_state_atoms = state_builder.get_atoms<Derived>();
+    derived_state_atoms.unset_all();
+
+    if (m_problem_or_domain_has_axioms)
+    {
+        m_aag->generate_and_apply_axioms(fluent_state_atoms, derived_state_atoms);
+    }
+
+    /* 4. Cache extended state unless another thread was faster */
+
+    auto lock = std::lock_guard<std::mutex>(shard.mutex);
+
+    auto iter = shard.states.find(state_builder.get_data());
+    if (iter != shard.states.end())
+    {
+        return State(**iter);
+    }
+
+    state_builder.get_index() = m_next_state_index.fetch_add(1, std::memory_order_relaxed);
+    shard.reached_fluent_atoms |= fluent_state_atoms;
+    shard.reached_derived_atoms |= derived_state_atoms;
+
+    auto [iter2, inserted] = shard.states.insert(state_builder.get_data());
+
+    /* 5. Return newly generated extended state */
+
+    return State(**iter2);
+}
+
+size_t ConcurrentStateRepository::get_state_count() const { return m_next_state_index.load(std::memory_order_acquire); }
+
+FlatBitset ConcurrentStateRepository::get_reached_fluent_ground_atoms() const
+{
+    auto reached_atoms = FlatBitset {};
+    for (const auto& shard : m_shards)
+    {
+        auto lock = std::lock_guard<std::mutex>(shard->mutex);
+        reached_atoms |= shard->reached_fluent_atoms;
+    }
+    return reached_atoms;
+}
+
+FlatBitset ConcurrentStateRepository::get_reached_derived_ground_atoms() const
+{
+    auto reached_atoms = FlatBitset {};
+    for (const auto& shard : m_shards)
+    {
+        auto lock = std::lock_guard<std::mutex>(shard->mutex);
+        reached_atoms |= shard->reached_derived_atoms;
+    }
+    return reached_atoms;
+}
+
+size_t ConcurrentStateRepository::get_num_shards() const { return m_shards.size(); }
+
+std::shared_ptr<IApplicableActionGenerator> ConcurrentStateRepository::get_aag() const { return m_aag; }
+
+}
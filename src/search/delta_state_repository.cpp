@@ -0,0 +1,355 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "mimir/search/delta_state_repository.hpp"
+
+#include "mimir/formalism/ground_literal.hpp"
+#include "mimir/formalism/problem.hpp"
+#include "mimir/search/applicable_action_generators.hpp"
+
+#include <span>
+#include <stdexcept>
+
+namespace mimir
+{
+
+static void apply_delta(std::span<const Index> delta, FlatBitset& ref_fluent_atoms)
+{
+    for (const auto entry : delta)
+    {
+        if (entry & 1)
+        {
+            ref_fluent_atoms.set(entry >> 1);
+        }
+        else
+        {
+            ref_fluent_atoms.unset(entry >> 1);
+        }
+    }
+}
+
+static void encode_as_delta(const FlatBitset& fluent_atoms, IndexList& out_delta)
+{
+    out_delta.clear();
+    for (const auto atom_index : fluent_atoms)
+    {
+        out_delta.push_back((atom_index << 1) | 1);
+    }
+}
+
+DeltaStateRepository::DeltaStateRepository(std::shared_ptr<IApplicableActionGenerator> aag, DeltaStateRepositoryOptions options) :
+    m_aag(std::move(aag)),
+    m_options(options),
+    m_problem_or_domain_has_axioms(!m_aag->get_problem()->get_axioms().empty() || !m_aag->get_problem()->get_domain()->get_axioms().empty()),
+    m_parents(),
+    m_chain_lengths(),
+    m_hashes(),
+    m_delta_offsets({ 0 }),
+    m_deltas(),
+    m_slots(),
+    m_cache_order(),
+    m_cache(),
+    m_reached_fluent_atoms(),
+    m_effects_buffer(),
+    m_touched_buffer(),
+    m_delta_buffer(),
+    m_chain_buffer(),
+    m_successor_buffer(),
+    m_candidate_buffer()
+{
+    resize_slots(1024);
+}
+
+uint64_t DeltaStateRepository::get_zobrist_key(Index atom_index)
+{
+    // SplitMix64 yields well distributed keys without storing a table of random numbers.
+    auto key = static_cast<uint64_t>(atom_index) + 0x9E3779B97F4A7C15ULL;
+    key = (key ^ (key >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    key = (key ^ (key >> 27)) * 0x94D049BB133111EBULL;
+    return key ^ (key >> 31);
+}
+
+void DeltaStateRepository::resize_slots(size_t num_slots)
+{
+    const auto mask = num_slots - 1;
+
+    m_slots.assign(num_slots, EMPTY_SLOT);
+
+    for (size_t state_index = 0; state_index < m_hashes.size(); ++state_index)
+    {
+        auto slot = m_hashes[state_index] & mask;
+        while (m_slots[slot] != EMPTY_SLOT)
+        {
+            slot = (slot + 1) & mask;
+        }
+        m_slots[slot] = state_index;
+    }
+}
+
+template<typename MaterializeFunction>
+std::pair<Index, size_t> DeltaStateRepository::find_state(uint64_t hash, MaterializeFunction&& materialize)
+{
+    const auto mask = m_slots.size() - 1;
+
+    auto slot = hash & mask;
+    while (m_slots[slot] != EMPTY_SLOT)
+    {
+        const auto state_index = m_slots[slot];
+        if (m_hashes[state_index] == hash)
+        {
+            // Verify the hash hit since different states might have the same Zobrist hash.
+            decode(state_index, m_candidate_buffer);
+            if (m_candidate_buffer == materialize())
+            {
+                return { state_index, slot };
+            }
+        }
+        slot = (slot + 1) & mask;
+    }
+    return { NO_STATE, slot };
+}
+
+Index DeltaStateRepository::create_state(size_t slot, uint64_t hash, Index parent, const IndexList& delta)
+{
+    const auto state_index = static_cast<Index>(m_hashes.size());
+
+    m_slots[slot] = state_index;
+    m_parents.push_back(parent);
+    m_chain_lengths.push_back((parent == NO_STATE) ? 0 : m_chain_lengths[parent] + 1);
+    m_hashes.push_back(hash);
+    m_deltas.insert(m_deltas.end(), delta.begin(), delta.end());
+    m_delta_offsets.push_back(m_deltas.size());
+
+    for (const auto entry : delta)
+    {
+        if (entry & 1)
+        {
+            m_reached_fluent_atoms.set(entry >> 1);
+        }
+    }
+
+    // Keep the load factor of the hash table below 1/2.
+    if (2 * m_hashes.size() > m_slots.size())
+    {
+        resize_slots(2 * m_slots.size());
+    }
+
+    return state_index;
+}
+
+void DeltaStateRepository::decode(Index state_index, FlatBitset& out_fluent_atoms)
+{
+    /* 1. Walk the chain of deltas up to a checkpoint or a cached state. */
+
+    m_chain_buffer.clear();
+    auto current = state_index;
+    auto cache_iter = m_cache.end();
+    while (current != NO_STATE)
+    {
+        cache_iter = m_cache.find(current);
+        if (cache_iter != m_cache.end())
+        {
+            break;
+        }
+        m_chain_buffer.push_back(current);
+        current = m_parents[current];
+    }
+
+    if (cache_iter != m_cache.end())
+    {
+        out_fluent_atoms = cache_iter->second.first;
+        m_cache_order.splice(m_cache_order.begin(), m_cache_order, cache_iter->second.second);
+    }
+    else
+    {
+        out_fluent_atoms.unset_all();
+    }
+
+    /* 2. Apply the deltas from the oldest to the newest state. */
+
+    for (auto iter = m_chain_buffer.rbegin(); iter != m_chain_buffer.rend(); ++iter)
+    {
+        apply_delta(std::span<const Index>(m_deltas.data() + m_delta_offsets[*iter], m_deltas.data() + m_delta_offsets[*iter + 1]), out_fluent_atoms);
+    }
+
+    /* 3. Cache the decoded state. */
+
+    if (m_chain_buffer.empty() || m_options.cache_size == 0)
+    {
+        return;
+    }
+    if (m_cache.size() >= m_options.cache_size)
+    {
+        m_cache.erase(m_cache_order.back());
+        m_cache_order.pop_back();
+    }
+    m_cache_order.push_front(state_index);
+    m_cache.emplace(state_index, std::make_pair(out_fluent_atoms, m_cache_order.begin()));
+}
+
+Index DeltaStateRepository::get_or_create_initial_state()
+{
+    auto& fluent_atoms = m_successor_buffer;
+    fluent_atoms.unset_all();
+
+    for (const auto& literal : m_aag->get_problem()->get_fluent_initial_literals())
+    {
+        if (literal->is_negated())
+        {
+            throw std::runtime_error("negative literals in the initial state are not supported");
+        }
+
+        fluent_atoms.set(literal->get_atom()->get_index());
+    }
+
+    return get_or_create_state(fluent_atoms);
+}
+
+Index DeltaStateRepository::get_or_create_state(const FlatBitset& fluent_atoms)
+{
+    auto hash = uint64_t(0);
+    for (const auto atom_index : fluent_atoms)
+    {
+        hash ^= get_zobrist_key(atom_index);
+    }
+
+    const auto [state_index, slot] = find_state(hash, [&]() -> const FlatBitset& { return fluent_atoms; });
+    if (state_index != NO_STATE)
+    {
+        return state_index;
+    }
+
+    encode_as_delta(fluent_atoms, m_delta_buffer);
+
+    return create_state(slot, hash, NO_STATE, m_delta_buffer);
+}
+
+Index DeltaStateRepository::get_or_create_successor_state(State state, GroundAction action)
+{
+    const auto& parent_atoms = state.get_atoms<Fluent>();
+    const auto parent = state.get_index();
+
+    /* 1. Collect the effects in the order in which they are applied. */
+
+    m_effects_buffer.clear();
+
+    const auto strips_action_effect = StripsActionEffect(action.get_strips_effect());
+    for (const auto atom_index : strips_action_effect.get_negative_effects())
+    {
+        m_effects_buffer.emplace_back(atom_index, false);
+    }
+    for (const auto atom_index : strips_action_effect.get_positive_effects())
+    {
+        m_effects_buffer.emplace_back(atom_index, true);
+    }
+    for (const auto& flat_conditional_effect : action.get_conditional_effects())
+    {
+        const auto conditional_effect = ConditionalEffect(flat_conditional_effect);
+
+        if (conditional_effect.is_applicable(m_aag->get_problem(), state))
+        {
+            const auto& simple_effect = conditional_effect.get_simple_effect();
+            m_effects_buffer.emplace_back(simple_effect.atom_index, !simple_effect.is_negated);
+        }
+    }
+
+    /* 2. Compute the delta and update the hash, the last effect on an atom takes precedence. */
+
+    auto hash = m_hashes.at(parent);
+    m_delta_buffer.clear();
+
+    for (auto iter = m_effects_buffer.rbegin(); iter != m_effects_buffer.rend(); ++iter)
+    {
+        const auto [atom_index, is_added] = *iter;
+        if (m_touched_buffer.get(atom_index))
+        {
+            continue;
+        }
+        m_touched_buffer.set(atom_index);
+
+        if (parent_atoms.get(atom_index) != is_added)
+        {
+            m_delta_buffer.push_back((atom_index << 1) | is_added);
+            hash ^= get_zobrist_key(atom_index);
+        }
+    }
+    for (const auto& [atom_index, is_added] : m_effects_buffer)
+    {
+        m_touched_buffer.unset(atom_index);
+    }
+
+    /* 3. Retrieve cached state, the successor atoms are only materialized for hash hits. */
+
+    auto is_materialized = false;
+    const auto materialize = [&]() -> const FlatBitset&
+    {
+        if (!is_materialized)
+        {
+            m_successor_buffer = parent_atoms;
+            apply_delta(m_delta_buffer, m_successor_buffer);
+            is_materialized = true;
+        }
+        return m_successor_buffer;
+    };
+
+    const auto [state_index, slot] = find_state(hash, materialize);
+    if (state_index != NO_STATE)
+    {
+        return state_index;
+    }
+
+    /* 4. Cache state, either as delta or as checkpoint. */
+
+    if (m_chain_lengths[parent] + 1 >= m_options.checkpoint_interval)
+    {
+        encode_as_delta(materialize(), m_delta_buffer);
+
+        return create_state(slot, hash, NO_STATE, m_delta_buffer);
+    }
+
+    return create_state(slot, hash, parent, m_delta_buffer);
+}
+
+State DeltaStateRepository::unpack_state(Index state_index, StateBuilder& out_state_builder)
+{
+    out_state_builder.get_index() = state_index;
+
+    auto& fluent_state_atoms = out_state_builder.get_atoms<Fluent>();
+    decode(state_index, fluent_state_atoms);
+
+    auto& derived_state_atoms = out_state_builder.get_atoms<Derived>();
+    derived_state_atoms.unset_all();
+
+    if (m_problem_or_domain_has_axioms)
+    {
+        m_aag->generate_and_apply_axioms(fluent_state_atoms, derived_state_atoms);
+    }
+
+    return State(out_state_builder.get_data());
+}
+
+uint64_t DeltaStateRepository::get_hash(Index state_index) const { return m_hashes.at(state_index); }
+
+size_t DeltaStateRepository::get_state_count() const { return m_hashes.size(); }
+
+size_t DeltaStateRepository::get_num_delta_entries() const { return m_deltas.size(); }
+
+const FlatBitset& DeltaStateRepository::get_reached_fluent_ground_atoms() const { return m_reached_fluent_atoms; }
+
+std::shared_ptr<IApplicableActionGenerator> DeltaStateRepository::get_aag() const { return m_aag; }
+
+}
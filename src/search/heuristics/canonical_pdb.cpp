@@ -0,0 +1,213 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "mimir/search/heuristics/canonical_pdb.hpp"
+
+#include "mimir/formalism/factories.hpp"
+#include "mimir/formalism/problem.hpp"
+#include "mimir/search/action.hpp"
+#include "mimir/search/applicable_action_generators/grounded.hpp"
+#include "mimir/search/heuristics/pdb/pattern_selection.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <numeric>
+
+namespace mimir
+{
+
+/// @brief Compute the sorted indices of the ground actions that change an atom of the pattern.
+static IndexList compute_affecting_actions(Problem problem, const GroundActionList& actions, std::span<const Index> pattern)
+{
+    auto affecting_actions = IndexList {};
+    for (const auto& action : actions)
+    {
+        if (!action.is_statically_applicable(problem->get_static_initial_positive_atoms()))
+        {
+            continue;
+        }
+
+        const auto strips_effect = StripsActionEffect(action.get_strips_effect());
+        auto is_affecting = std::any_of(pattern.begin(),
+                                        pattern.end(),
+                                        [&](Index atom_index)
+                                        { return strips_effect.get_positive_effects().get(atom_index) || strips_effect.get_negative_effects().get(atom_index); });
+        for (const auto& flat_conditional_effect : action.get_conditional_effects())
+        {
+            const auto atom_index = ConditionalEffect(flat_conditional_effect).get_simple_effect().atom_index;
+            is_affecting |= std::binary_search(pattern.begin(), pattern.end(), atom_index);
+        }
+        if (is_affecting)
+        {
+            affecting_actions.push_back(action.get_index());
+        }
+    }
+    std::sort(affecting_actions.begin(), affecting_actions.end());
+    return affecting_actions;
+}
+
+static bool are_disjoint(const IndexList& left, const IndexList& right)
+{
+    auto left_it = left.begin();
+    auto right_it = right.begin();
+    while (left_it != left.end() && right_it != right.end())
+    {
+        if (*left_it < *right_it)
+        {
+            ++left_it;
+        }
+        else if (*right_it < *left_it)
+        {
+            ++right_it;
+        }
+        else
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// @brief Enumerate the maximal cliques of the compatibility graph with the Bron-Kerbosch algorithm with pivoting.
+static void bron_kerbosch(const std::vector<std::vector<bool>>& adjacent,
+                          IndexList& clique,
+                          IndexList candidates,
+                          IndexList excluded,
+                          std::vector<IndexList>& out_maximal_cliques)
+{
+    if (candidates.empty() && excluded.empty())
+    {
+        out_maximal_cliques.push_back(clique);
+        return;
+    }
+
+    const auto pivot = candidates.empty() ? excluded.front() : candidates.front();
+    const auto remaining = IndexList(candidates);
+    for (const auto vertex : remaining)
+    {
+        if (adjacent[pivot][vertex])
+        {
+            continue;
+        }
+
+        auto next_candidates = IndexList {};
+        std::copy_if(candidates.begin(), candidates.end(), std::back_inserter(next_candidates), [&](Index other) { return adjacent[vertex][other]; });
+        auto next_excluded = IndexList {};
+        std::copy_if(excluded.begin(), excluded.end(), std::back_inserter(next_excluded), [&](Index other) { return adjacent[vertex][other]; });
+
+        clique.push_back(vertex);
+        bron_kerbosch(adjacent, clique, std::move(next_candidates), std::move(next_excluded), out_maximal_cliques);
+        clique.pop_back();
+
+        candidates.erase(std::find(candidates.begin(), candidates.end(), vertex));
+        excluded.push_back(vertex);
+    }
+}
+
+CanonicalPDBHeuristic::CanonicalPDBHeuristic(std::shared_ptr<GroundedApplicableActionGenerator> applicable_action_generator) :
+    CanonicalPDBHeuristic(applicable_action_generator, GreedyPatternSelector(applicable_action_generator).compute_patterns())
+{
+}
+
+CanonicalPDBHeuristic::CanonicalPDBHeuristic(std::shared_ptr<GroundedApplicableActionGenerator> applicable_action_generator,
+                                             PatternList patterns,
+                                             std::optional<fs::path> cache_directory) :
+    m_pattern_databases(),
+    m_additive_subsets(),
+    m_distances()
+{
+    const auto problem = applicable_action_generator->get_problem();
+    const auto& pddl_factories = *applicable_action_generator->get_pddl_factories();
+
+    /* 1. Compute or load the pattern databases */
+
+    if (cache_directory.has_value())
+    {
+        fs::create_directories(cache_directory.value());
+    }
+    for (auto& pattern : patterns)
+    {
+        if (cache_directory.has_value())
+        {
+            std::sort(pattern.begin(), pattern.end());
+            pattern.erase(std::unique(pattern.begin(), pattern.end()), pattern.end());
+            const auto file_path = cache_directory.value() / (std::to_string(compute_pattern_database_fingerprint(pddl_factories, problem, pattern)) + ".pdb");
+            m_pattern_databases.push_back(PatternDatabase::load_or_create(applicable_action_generator, std::move(pattern), file_path));
+        }
+        else
+        {
+            m_pattern_databases.emplace_back(applicable_action_generator, std::move(pattern));
+        }
+    }
+    m_distances.resize(m_pattern_databases.size());
+
+    /* 2. Compute the maximal additive subsets */
+
+    const auto num_patterns = m_pattern_databases.size();
+    auto affecting_actions = std::vector<IndexList> {};
+    for (const auto& pattern_database : m_pattern_databases)
+    {
+        affecting_actions.push_back(compute_affecting_actions(problem, applicable_action_generator->get_ground_actions(), pattern_database.get_pattern()));
+    }
+    auto adjacent = std::vector<std::vector<bool>>(num_patterns, std::vector<bool>(num_patterns, false));
+    for (size_t i = 0; i < num_patterns; ++i)
+    {
+        for (size_t j = i + 1; j < num_patterns; ++j)
+        {
+            adjacent[i][j] = adjacent[j][i] = are_disjoint(affecting_actions[i], affecting_actions[j]);
+        }
+    }
+
+    if (num_patterns > 0)
+    {
+        auto clique = IndexList {};
+        auto candidates = IndexList(num_patterns);
+        std::iota(candidates.begin(), candidates.end(), 0);
+        bron_kerbosch(adjacent, clique, std::move(candidates), IndexList {}, m_additive_subsets);
+    }
+}
+
+double CanonicalPDBHeuristic::compute_heuristic(State state)
+{
+    for (size_t i = 0; i < m_pattern_databases.size(); ++i)
+    {
+        m_distances[i] = m_pattern_databases[i].get_distance(state);
+        if (m_distances[i] == std::numeric_limits<ContinuousCost>::infinity())
+        {
+            return std::numeric_limits<ContinuousCost>::infinity();
+        }
+    }
+
+    auto value = ContinuousCost(0);
+    for (const auto& additive_subset : m_additive_subsets)
+    {
+        auto sum = ContinuousCost(0);
+        for (const auto pattern_index : additive_subset)
+        {
+            sum += m_distances[pattern_index];
+        }
+        value = std::max(value, sum);
+    }
+    return value;
+}
+
+const PatternDatabaseList& CanonicalPDBHeuristic::get_pattern_databases() const { return m_pattern_databases; }
+
+const std::vector<IndexList>& CanonicalPDBHeuristic::get_additive_subsets() const { return m_additive_subsets; }
+
+}
@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "mimir/search/heuristics/hff.hpp"
+
+#include <limits>
+
+namespace mimir
+{
+
+HFFHeuristic::HFFHeuristic(std::shared_ptr<GroundedApplicableActionGenerator> applicable_action_generator) :
+    HFFHeuristic(std::make_shared<RelaxedOperatorGraph>(std::move(applicable_action_generator)))
+{
+}
+
+HFFHeuristic::HFFHeuristic(std::shared_ptr<RelaxedOperatorGraph> graph) :
+    RelaxedExplorationHeuristic(std::move(graph)),
+    m_is_in_relaxed_plan(m_graph->get_num_actions(), false)
+{
+}
+
+double HFFHeuristic::compute_heuristic(State state)
+{
+    for (const auto action_index : m_relaxed_plan)
+    {
+        m_is_in_relaxed_plan[action_index] = false;
+    }
+    m_relaxed_plan.clear();
+
+    if (explore(state, RelaxedCostCombination::ADD) == std::numeric_limits<ContinuousCost>::infinity())
+    {
+        return std::numeric_limits<double>::infinity();
+    }
+
+    const auto cost = extract_relaxed_plan();
+
+    for (const auto action_index : m_relaxed_plan)
+    {
+        m_is_in_relaxed_plan[action_index] = true;
+    }
+
+    return cost;
+}
+
+bool HFFHeuristic::is_preferred_action(GroundAction action) const
+{
+    return action.get_index() < m_is_in_relaxed_plan.size() && m_is_in_relaxed_plan[action.get_index()];
+}
+
+const IndexList& HFFHeuristic::get_relaxed_plan() const { return m_relaxed_plan; }
+
+}
@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "mimir/search/heuristics/lifted_relaxed_exploration.hpp"
+
+#include "mimir/formalism/factories.hpp"
+#include "mimir/formalism/problem.hpp"
+#include "mimir/formalism/transformers/delete_relax.hpp"
+#include "mimir/search/applicable_action_generators/lifted.hpp"
+#include "mimir/search/axiom.hpp"
+
+#include <limits>
+
+namespace mimir
+{
+
+static std::shared_ptr<LiftedApplicableActionGenerator>
+create_delete_free_applicable_action_generator(const std::shared_ptr<LiftedApplicableActionGenerator>& applicable_action_generator)
+{
+    const auto& pddl_factories = applicable_action_generator->get_pddl_factories();
+    // Actions and axioms with empty effects do not contribute to the relaxed exploration.
+    auto delete_relax_transformer = DeleteRelaxTransformer(*pddl_factories, true);
+    const auto delete_free_problem = delete_relax_transformer.run(*applicable_action_generator->get_problem());
+    return std::make_shared<LiftedApplicableActionGenerator>(delete_free_problem, pddl_factories);
+}
+
+LiftedRelaxedExplorationHeuristic::LiftedRelaxedExplorationHeuristic(std::shared_ptr<LiftedApplicableActionGenerator> applicable_action_generator) :
+    RelaxedExplorationHeuristic(std::make_shared<RelaxedOperatorGraph>(applicable_action_generator->get_problem())),
+    m_delete_free_applicable_action_generator(create_delete_free_applicable_action_generator(applicable_action_generator)),
+    m_num_known_actions(0),
+    m_num_known_axioms(0),
+    m_reached_atoms_builder(),
+    m_applicable_actions()
+{
+}
+
+bool LiftedRelaxedExplorationHeuristic::update_relaxed_operator_graph()
+{
+    auto& graph = *m_graph;
+    const auto& aag = *m_delete_free_applicable_action_generator;
+
+    // Groundings are appended to the lists of the applicable action generator, hence, new ones are at the end.
+    const auto num_actions = aag.get_num_ground_actions();
+    const auto num_axioms = aag.get_num_ground_axioms();
+    if (num_actions == m_num_known_actions && num_axioms == m_num_known_axioms)
+    {
+        return false;
+    }
+
+    for (; m_num_known_actions < num_actions; ++m_num_known_actions)
+    {
+        graph.add_ground_action(aag.get_ground_action(m_num_known_actions));
+    }
+    for (; m_num_known_axioms < num_axioms; ++m_num_known_axioms)
+    {
+        graph.add_ground_axiom(aag.get_ground_axiom(m_num_known_axioms));
+    }
+    graph.finalize();
+
+    return true;
+}
+
+ContinuousCost LiftedRelaxedExplorationHeuristic::explore_lifted(State state, RelaxedCostCombination combination)
+{
+    const auto& graph = *m_graph;
+    auto& reached_fluent_atoms = m_reached_atoms_builder.get_atoms<Fluent>();
+    auto& reached_derived_atoms = m_reached_atoms_builder.get_atoms<Derived>();
+
+    while (true)
+    {
+        // The exploration must not stop at the goals because a new grounding might yield cheaper goal costs.
+        const auto cost = explore(state, combination, false);
+
+        /* Collect the reached atoms */
+
+        reached_fluent_atoms = state.get_atoms<Fluent>();
+        reached_derived_atoms = state.get_atoms<Derived>();
+        for (Index proposition = 0; proposition < graph.get_num_propositions(); ++proposition)
+        {
+            if (m_proposition_costs[proposition] != std::numeric_limits<ContinuousCost>::infinity())
+            {
+                auto& reached_atoms = graph.is_derived(proposition) ? reached_derived_atoms : reached_fluent_atoms;
+                reached_atoms.set(graph.get_atom_index(proposition));
+            }
+        }
+
+        /* Ground the axioms and actions that are applicable in the reached atoms */
+
+        m_delete_free_applicable_action_generator->generate_and_apply_axioms(reached_fluent_atoms, reached_derived_atoms);
+        m_delete_free_applicable_action_generator->generate_applicable_actions(State(m_reached_atoms_builder.get_data()), m_applicable_actions);
+
+        if (!update_relaxed_operator_graph())
+        {
+            return cost;
+        }
+    }
+}
+
+}
@@ -0,0 +1,444 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "mimir/search/heuristics/lmcut.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <functional>
+#include <limits>
+
+namespace mimir
+{
+
+static constexpr Index NO_SUPPORTER = std::numeric_limits<Index>::max();
+
+/// @brief Invert a relation given in compressed sparse row format using counting sort.
+static void invert_relation(size_t num_sources,
+                            size_t num_targets,
+                            const IndexList& offsets,
+                            const IndexList& targets,
+                            IndexList& out_inverted_offsets,
+                            IndexList& out_inverted_targets)
+{
+    out_inverted_offsets.assign(num_targets + 1, 0);
+    for (const auto target : targets)
+    {
+        ++out_inverted_offsets[target + 1];
+    }
+    for (size_t target = 0; target < num_targets; ++target)
+    {
+        out_inverted_offsets[target + 1] += out_inverted_offsets[target];
+    }
+    out_inverted_targets.resize(targets.size());
+    auto positions = IndexList(out_inverted_offsets.begin(), out_inverted_offsets.end() - 1);
+    for (size_t source = 0; source < num_sources; ++source)
+    {
+        for (size_t i = offsets[source]; i < offsets[source + 1]; ++i)
+        {
+            out_inverted_targets[positions[targets[i]]++] = source;
+        }
+    }
+}
+
+LMCutHeuristic::LMCutHeuristic(std::shared_ptr<GroundedApplicableActionGenerator> applicable_action_generator) :
+    LMCutHeuristic(std::move(applicable_action_generator), std::make_shared<DefaultLMCutHeuristicEventHandler>())
+{
+}
+
+LMCutHeuristic::LMCutHeuristic(std::shared_ptr<GroundedApplicableActionGenerator> applicable_action_generator,
+                               std::shared_ptr<ILMCutHeuristicEventHandler> event_handler) :
+    LMCutHeuristic(std::make_shared<RelaxedOperatorGraph>(std::move(applicable_action_generator)), std::move(event_handler))
+{
+}
+
+LMCutHeuristic::LMCutHeuristic(std::shared_ptr<RelaxedOperatorGraph> graph, std::shared_ptr<ILMCutHeuristicEventHandler> event_handler) :
+    m_graph(std::move(graph)),
+    m_event_handler(std::move(event_handler)),
+    m_init_proposition(m_graph->get_num_propositions()),
+    m_goal_proposition(m_graph->get_num_propositions() + 1),
+    m_goal_operator(m_graph->get_num_operators()),
+    m_num_propositions(m_graph->get_num_propositions() + 2),
+    m_num_operators(m_graph->get_num_operators() + 1),
+    m_precondition_offsets({ 0 }),
+    m_preconditions(),
+    m_effect_offsets({ 0 }),
+    m_effects(),
+    m_costs(),
+    m_precondition_of_offsets(),
+    m_precondition_of(),
+    m_achiever_offsets(),
+    m_achievers(),
+    m_proposition_costs(m_num_propositions, std::numeric_limits<ContinuousCost>::infinity()),
+    m_operator_costs(m_num_operators, ContinuousCost(0)),
+    m_operator_supporters(m_num_operators, NO_SUPPORTER),
+    m_operator_supporter_costs(m_num_operators, ContinuousCost(0)),
+    m_operator_num_unsatisfied(m_num_operators, 0),
+    m_goal_zone_rounds(m_num_propositions, 0),
+    m_before_goal_zone_rounds(m_num_propositions, 0),
+    m_round(1),
+    m_queue(),
+    m_stack(),
+    m_cut()
+{
+    const auto& graph = *m_graph;
+
+    /* 1. Copy the operators of the relaxed operator graph */
+
+    for (Index op = 0; op < graph.get_num_operators(); ++op)
+    {
+        const auto preconditions = graph.get_preconditions(op);
+        if (preconditions.empty())
+        {
+            m_preconditions.push_back(m_init_proposition);
+        }
+        m_preconditions.insert(m_preconditions.end(), preconditions.begin(), preconditions.end());
+        m_precondition_offsets.push_back(m_preconditions.size());
+
+        const auto effects = graph.get_effects(op);
+        m_effects.insert(m_effects.end(), effects.begin(), effects.end());
+        m_effect_offsets.push_back(m_effects.size());
+
+        // Operators of the same ground action are consecutive in the graph.
+        const auto action_index = graph.get_action_index(op);
+        const auto is_additional_operator = (op > 0 && action_index != RelaxedOperatorGraph::NO_ACTION && graph.get_action_index(op - 1) == action_index);
+        m_costs.push_back(is_additional_operator ? ContinuousCost(0) : graph.get_cost(op));
+    }
+
+    /* 2. Add the artificial goal operator */
+
+    if (graph.get_goal_propositions().empty())
+    {
+        m_preconditions.push_back(m_init_proposition);
+    }
+    m_preconditions.insert(m_preconditions.end(), graph.get_goal_propositions().begin(), graph.get_goal_propositions().end());
+    m_precondition_offsets.push_back(m_preconditions.size());
+    m_effects.push_back(m_goal_proposition);
+    m_effect_offsets.push_back(m_effects.size());
+    m_costs.push_back(ContinuousCost(0));
+
+    /* 3. Invert the precondition and effect relations */
+
+    invert_relation(m_num_operators, m_num_propositions, m_precondition_offsets, m_preconditions, m_precondition_of_offsets, m_precondition_of);
+    invert_relation(m_num_operators, m_num_propositions, m_effect_offsets, m_effects, m_achiever_offsets, m_achievers);
+
+    m_queue.reserve(m_num_propositions);
+}
+
+std::span<const Index> LMCutHeuristic::get_preconditions(Index op) const
+{
+    return std::span<const Index>(m_preconditions.data() + m_precondition_offsets[op], m_preconditions.data() + m_precondition_offsets[op + 1]);
+}
+
+std::span<const Index> LMCutHeuristic::get_effects(Index op) const
+{
+    return std::span<const Index>(m_effects.data() + m_effect_offsets[op], m_effects.data() + m_effect_offsets[op + 1]);
+}
+
+std::span<const Index> LMCutHeuristic::get_precondition_of(Index proposition) const
+{
+    return std::span<const Index>(m_precondition_of.data() + m_precondition_of_offsets[proposition],
+                                  m_precondition_of.data() + m_precondition_of_offsets[proposition + 1]);
+}
+
+std::span<const Index> LMCutHeuristic::get_achievers(Index proposition) const
+{
+    return std::span<const Index>(m_achievers.data() + m_achiever_offsets[proposition], m_achievers.data() + m_achiever_offsets[proposition + 1]);
+}
+
+void LMCutHeuristic::enqueue(Index proposition, ContinuousCost cost)
+{
+    if (cost < m_proposition_costs[proposition])
+    {
+        m_proposition_costs[proposition] = cost;
+        m_queue.emplace_back(cost, proposition);
+        std::push_heap(m_queue.begin(), m_queue.end(), std::greater<std::pair<ContinuousCost, Index>>());
+    }
+}
+
+void LMCutHeuristic::first_exploration(State state)
+{
+    std::fill(m_proposition_costs.begin(), m_proposition_costs.end(), std::numeric_limits<ContinuousCost>::infinity());
+    std::fill(m_operator_supporters.begin(), m_operator_supporters.end(), NO_SUPPORTER);
+    for (Index op = 0; op < m_num_operators; ++op)
+    {
+        m_operator_num_unsatisfied[op] = m_precondition_offsets[op + 1] - m_precondition_offsets[op];
+    }
+    m_queue.clear();
+
+    enqueue(m_init_proposition, ContinuousCost(0));
+    for (const auto atom_index : state.get_atoms<Fluent>())
+    {
+        const auto proposition = m_graph->get_proposition<Fluent>(atom_index);
+        if (proposition != RelaxedOperatorGraph::NO_PROPOSITION)
+        {
+            enqueue(proposition, ContinuousCost(0));
+        }
+    }
+    for (const auto atom_index : state.get_atoms<Derived>())
+    {
+        const auto proposition = m_graph->get_proposition<Derived>(atom_index);
+        if (proposition != RelaxedOperatorGraph::NO_PROPOSITION)
+        {
+            enqueue(proposition, ContinuousCost(0));
+        }
+    }
+
+    while (!m_queue.empty())
+    {
+        std::pop_heap(m_queue.begin(), m_queue.end(), std::greater<std::pair<ContinuousCost, Index>>());
+        const auto [cost, proposition] = m_queue.back();
+        m_queue.pop_back();
+
+        if (cost > m_proposition_costs[proposition])
+        {
+            // Stale entry
+            continue;
+        }
+
+        for (const auto op : get_precondition_of(proposition))
+        {
+            if (--m_operator_num_unsatisfied[op] == 0)
+            {
+                // The last precondition that is reached has maximum h_max value.
+                m_operator_supporters[op] = proposition;
+                m_operator_supporter_costs[op] = cost;
+                const auto target_cost = cost + m_operator_costs[op];
+                for (const auto effect : get_effects(op))
+                {
+                    enqueue(effect, target_cost);
+                }
+            }
+        }
+    }
+}
+
+void LMCutHeuristic::update_supporter(Index op)
+{
+    auto supporter = NO_SUPPORTER;
+    auto supporter_cost = -std::numeric_limits<ContinuousCost>::infinity();
+    for (const auto precondition : get_preconditions(op))
+    {
+        if (m_proposition_costs[precondition] > supporter_cost)
+        {
+            supporter = precondition;
+            supporter_cost = m_proposition_costs[precondition];
+        }
+    }
+    m_operator_supporters[op] = supporter;
+    m_operator_supporter_costs[op] = supporter_cost;
+}
+
+void LMCutHeuristic::first_exploration_incremental()
+{
+    assert(m_queue.empty());
+
+    for (const auto op : m_cut)
+    {
+        const auto target_cost = m_operator_supporter_costs[op] + m_operator_costs[op];
+        for (const auto effect : get_effects(op))
+        {
+            enqueue(effect, target_cost);
+        }
+    }
+
+    while (!m_queue.empty())
+    {
+        std::pop_heap(m_queue.begin(), m_queue.end(), std::greater<std::pair<ContinuousCost, Index>>());
+        const auto [cost, proposition] = m_queue.back();
+        m_queue.pop_back();
+
+        if (cost > m_proposition_costs[proposition])
+        {
+            // Stale entry
+            continue;
+        }
+
+        for (const auto op : get_precondition_of(proposition))
+        {
+            if (m_operator_supporters[op] == proposition && m_operator_supporter_costs[op] > cost)
+            {
+                const auto old_supporter_cost = m_operator_supporter_costs[op];
+                update_supporter(op);
+                const auto new_supporter_cost = m_operator_supporter_costs[op];
+                if (new_supporter_cost != old_supporter_cost)
+                {
+                    assert(new_supporter_cost < old_supporter_cost);
+                    const auto target_cost = new_supporter_cost + m_operator_costs[op];
+                    for (const auto effect : get_effects(op))
+                    {
+                        enqueue(effect, target_cost);
+                    }
+                }
+            }
+        }
+    }
+}
+
+void LMCutHeuristic::mark_goal_plateau()
+{
+    m_stack.clear();
+    m_stack.push_back(m_goal_proposition);
+
+    while (!m_stack.empty())
+    {
+        const auto proposition = m_stack.back();
+        m_stack.pop_back();
+
+        if (m_goal_zone_rounds[proposition] == m_round)
+        {
+            continue;
+        }
+        m_goal_zone_rounds[proposition] = m_round;
+
+        for (const auto op : get_achievers(proposition))
+        {
+            // The supporter is undefined for relaxed unreachable zero cost operators.
+            if (m_operator_costs[op] == ContinuousCost(0) && m_operator_supporters[op] != NO_SUPPORTER)
+            {
+                m_stack.push_back(m_operator_supporters[op]);
+            }
+        }
+    }
+}
+
+void LMCutHeuristic::second_exploration(State state)
+{
+    m_cut.clear();
+    m_stack.clear();
+
+    const auto reach = [this](Index proposition)
+    {
+        if (m_before_goal_zone_rounds[proposition] != m_round)
+        {
+            m_before_goal_zone_rounds[proposition] = m_round;
+            m_stack.push_back(proposition);
+        }
+    };
+
+    reach(m_init_proposition);
+    for (const auto atom_index : state.get_atoms<Fluent>())
+    {
+        const auto proposition = m_graph->get_proposition<Fluent>(atom_index);
+        if (proposition != RelaxedOperatorGraph::NO_PROPOSITION)
+        {
+            reach(proposition);
+        }
+    }
+    for (const auto atom_index : state.get_atoms<Derived>())
+    {
+        const auto proposition = m_graph->get_proposition<Derived>(atom_index);
+        if (proposition != RelaxedOperatorGraph::NO_PROPOSITION)
+        {
+            reach(proposition);
+        }
+    }
+
+    while (!m_stack.empty())
+    {
+        const auto proposition = m_stack.back();
+        m_stack.pop_back();
+
+        for (const auto op : get_precondition_of(proposition))
+        {
+            if (m_operator_supporters[op] != proposition)
+            {
+                continue;
+            }
+
+            const auto effects = get_effects(op);
+            const auto reaches_goal_zone =
+                std::any_of(effects.begin(), effects.end(), [this](Index effect) { return m_goal_zone_rounds[effect] == m_round; });
+
+            if (reaches_goal_zone)
+            {
+                m_cut.push_back(op);
+            }
+            else
+            {
+                for (const auto effect : effects)
+                {
+                    reach(effect);
+                }
+            }
+        }
+    }
+}
+
+void LMCutHeuristic::next_round()
+{
+    if (++m_round == std::numeric_limits<Index>::max())
+    {
+        // Avoid stale stamps after an overflow of the round counter.
+        std::fill(m_goal_zone_rounds.begin(), m_goal_zone_rounds.end(), 0);
+        std::fill(m_before_goal_zone_rounds.begin(), m_before_goal_zone_rounds.end(), 0);
+        m_round = 1;
+    }
+}
+
+double LMCutHeuristic::compute_heuristic(State state)
+{
+    m_event_handler->on_start_compute_heuristic();
+
+    std::copy(m_costs.begin(), m_costs.end(), m_operator_costs.begin());
+
+    first_exploration(state);
+
+    if (m_proposition_costs[m_goal_proposition] == std::numeric_limits<ContinuousCost>::infinity())
+    {
+        m_event_handler->on_end_compute_heuristic(std::numeric_limits<double>::infinity(), 0);
+        return std::numeric_limits<double>::infinity();
+    }
+
+    auto h_value = ContinuousCost(0);
+    auto num_landmarks = uint64_t(0);
+
+    while (m_proposition_costs[m_goal_proposition] > ContinuousCost(0))
+    {
+        mark_goal_plateau();
+        second_exploration(state);
+
+        if (m_cut.empty())
+        {
+            // Cannot happen for non-negative costs but protects against numerical issues.
+            break;
+        }
+
+        auto cut_cost = std::numeric_limits<ContinuousCost>::infinity();
+        for (const auto op : m_cut)
+        {
+            cut_cost = std::min(cut_cost, m_operator_costs[op]);
+        }
+        for (const auto op : m_cut)
+        {
+            m_operator_costs[op] -= cut_cost;
+        }
+        h_value += cut_cost;
+        ++num_landmarks;
+
+        first_exploration_incremental();
+        next_round();
+    }
+
+    m_event_handler->on_end_compute_heuristic(h_value, num_landmarks);
+
+    return h_value;
+}
+
+const std::shared_ptr<ILMCutHeuristicEventHandler>& LMCutHeuristic::get_event_handler() const { return m_event_handler; }
+
+}
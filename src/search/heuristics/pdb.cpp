@@ -0,0 +1,34 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "mimir/search/heuristics/pdb.hpp"
+
+namespace mimir
+{
+
+PDBHeuristic::PDBHeuristic(std::shared_ptr<GroundedApplicableActionGenerator> applicable_action_generator, Pattern pattern) :
+    PDBHeuristic(PatternDatabase(std::move(applicable_action_generator), std::move(pattern)))
+{
+}
+
+PDBHeuristic::PDBHeuristic(PatternDatabase pattern_database) : m_pattern_database(std::move(pattern_database)) {}
+
+double PDBHeuristic::compute_heuristic(State state) { return m_pattern_database.get_distance(state); }
+
+const PatternDatabase& PDBHeuristic::get_pattern_database() const { return m_pattern_database; }
+
+}
@@ -0,0 +1,392 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "mimir/search/heuristics/pdb/pattern_database.hpp"
+
+#include "cista/serialization.h"
+#include "mimir/common/hash.hpp"
+#include "mimir/formalism/domain.hpp"
+#include "mimir/formalism/factories.hpp"
+#include "mimir/formalism/ground_atom.hpp"
+#include "mimir/formalism/ground_literal.hpp"
+#include "mimir/formalism/problem.hpp"
+#include "mimir/graphs/digraph.hpp"
+#include "mimir/graphs/static_graph_boost_adapter.hpp"
+#include "mimir/search/action.hpp"
+#include "mimir/search/applicable_action_generators/grounded.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <stdexcept>
+#include <tuple>
+#include <unordered_map>
+
+namespace mimir
+{
+
+static constexpr auto PATTERN_DATABASE_SERIALIZATION_MODE = cista::mode::WITH_VERSION | cista::mode::WITH_INTEGRITY;
+
+namespace
+{
+/// @brief Conditional effect projected onto a pattern.
+struct ProjectedConditionalEffect
+{
+    uint64_t positive_condition;
+    uint64_t negative_condition;
+    uint64_t add;
+    uint64_t del;
+    /// @brief False iff the condition mentions atoms outside of the pattern.
+    bool is_determined;
+};
+
+/// @brief Ground action projected onto a pattern.
+struct ProjectedOperator
+{
+    uint64_t positive_precondition;
+    uint64_t negative_precondition;
+    uint64_t add;
+    uint64_t del;
+    ContinuousCost cost;
+    std::vector<ProjectedConditionalEffect> conditional_effects;
+};
+}
+
+/// @brief Project a set of atoms onto the pattern.
+static uint64_t project(const FlatBitset& atoms, const Pattern& pattern)
+{
+    auto mask = uint64_t(0);
+    for (size_t i = 0; i < pattern.size(); ++i)
+    {
+        mask |= (static_cast<uint64_t>(atoms.get(pattern[i])) << i);
+    }
+    return mask;
+}
+
+/// @brief Project a list of atoms onto the pattern.
+/// @return true iff all atoms are in the pattern.
+static bool project(const FlatIndexList& atoms, const std::unordered_map<Index, size_t>& atom_to_position, uint64_t& out_mask)
+{
+    auto is_subset = true;
+    out_mask = 0;
+    for (const auto atom_index : atoms)
+    {
+        const auto it = atom_to_position.find(atom_index);
+        if (it == atom_to_position.end())
+        {
+            is_subset = false;
+        }
+        else
+        {
+            out_mask |= (uint64_t(1) << it->second);
+        }
+    }
+    return is_subset;
+}
+
+static std::vector<ProjectedOperator> project_ground_actions(Problem problem, const GroundActionList& actions, const Pattern& pattern)
+{
+    auto atom_to_position = std::unordered_map<Index, size_t> {};
+    for (size_t i = 0; i < pattern.size(); ++i)
+    {
+        atom_to_position.emplace(pattern[i], i);
+    }
+
+    // Operators without conditional effects are merged if they have the same projection.
+    using Key = std::tuple<uint64_t, uint64_t, uint64_t, uint64_t>;
+    auto unconditional_operators = std::map<Key, ContinuousCost> {};
+    auto operators = std::vector<ProjectedOperator> {};
+
+    for (const auto& action : actions)
+    {
+        if (!action.is_statically_applicable(problem->get_static_initial_positive_atoms()))
+        {
+            continue;
+        }
+
+        const auto strips_precondition = StripsActionPrecondition(action.get_strips_precondition());
+        const auto strips_effect = StripsActionEffect(action.get_strips_effect());
+
+        auto projected_operator = ProjectedOperator {};
+        projected_operator.positive_precondition = project(strips_precondition.get_positive_precondition<Fluent>(), pattern);
+        projected_operator.negative_precondition = project(strips_precondition.get_negative_precondition<Fluent>(), pattern);
+        projected_operator.add = project(strips_effect.get_positive_effects(), pattern);
+        projected_operator.del = project(strips_effect.get_negative_effects(), pattern) & ~projected_operator.add;
+        projected_operator.cost = action.get_cost();
+
+        if (projected_operator.positive_precondition & projected_operator.negative_precondition)
+        {
+            // Inconsistent precondition
+            continue;
+        }
+
+        for (const auto& flat_conditional_effect : action.get_conditional_effects())
+        {
+            const auto conditional_effect = ConditionalEffect(flat_conditional_effect);
+            const auto& simple_effect = conditional_effect.get_simple_effect();
+            const auto it = atom_to_position.find(simple_effect.atom_index);
+            if (it == atom_to_position.end() || !conditional_effect.is_statically_applicable(problem))
+            {
+                continue;
+            }
+
+            auto projected_effect = ProjectedConditionalEffect {};
+            const auto is_positive_condition_determined =
+                project(conditional_effect.get_positive_precondition<Fluent>(), atom_to_position, projected_effect.positive_condition);
+            const auto is_negative_condition_determined =
+                project(conditional_effect.get_negative_precondition<Fluent>(), atom_to_position, projected_effect.negative_condition);
+            projected_effect.is_determined = is_positive_condition_determined && is_negative_condition_determined
+                                             && conditional_effect.get_positive_precondition<Derived>().empty()
+                                             && conditional_effect.get_negative_precondition<Derived>().empty();
+            projected_effect.add = simple_effect.is_negated ? 0 : (uint64_t(1) << it->second);
+            projected_effect.del = simple_effect.is_negated ? (uint64_t(1) << it->second) : 0;
+            projected_operator.conditional_effects.push_back(projected_effect);
+        }
+
+        if (projected_operator.conditional_effects.empty())
+        {
+            if (projected_operator.add == 0 && projected_operator.del == 0)
+            {
+                // Only induces self loops.
+                continue;
+            }
+            const auto key = Key { projected_operator.positive_precondition, projected_operator.negative_precondition, projected_operator.add, projected_operator.del };
+            const auto [it, inserted] = unconditional_operators.emplace(key, projected_operator.cost);
+            if (!inserted)
+            {
+                it->second = std::min(it->second, projected_operator.cost);
+            }
+        }
+        else
+        {
+            operators.push_back(std::move(projected_operator));
+        }
+    }
+
+    for (const auto& [key, cost] : unconditional_operators)
+    {
+        const auto& [positive_precondition, negative_precondition, add, del] = key;
+        operators.push_back(ProjectedOperator { positive_precondition, negative_precondition, add, del, cost, {} });
+    }
+
+    return operators;
+}
+
+uint64_t compute_pattern_database_fingerprint(const PDDLFactories& pddl_factories, Problem problem, const Pattern& pattern)
+{
+    auto fingerprint = hash_combine(problem->get_domain()->str(), problem->str());
+    // Atom indices depend on the grounding order, hence, we hash the atoms by name in the order of the pattern that determines the ranking.
+    for (const auto atom_index : pattern)
+    {
+        hash_combine(fingerprint, pddl_factories.get_ground_atom<Fluent>(atom_index)->str());
+    }
+    return fingerprint;
+}
+
+PatternDatabase::PatternDatabase(std::unique_ptr<FlatPatternDatabase> owned_data, std::unique_ptr<cista::mmap> mmap, const FlatPatternDatabase* data) :
+    m_owned_data(std::move(owned_data)),
+    m_mmap(std::move(mmap)),
+    m_data(data)
+{
+}
+
+PatternDatabase::PatternDatabase(std::shared_ptr<GroundedApplicableActionGenerator> applicable_action_generator, Pattern pattern) :
+    m_owned_data(std::make_unique<FlatPatternDatabase>()),
+    m_mmap(nullptr),
+    m_data(m_owned_data.get())
+{
+    if (pattern.size() > MAX_PATTERN_SIZE)
+    {
+        throw std::runtime_error("PatternDatabase::PatternDatabase: pattern size " + std::to_string(pattern.size()) + " exceeds the maximum pattern size "
+                                 + std::to_string(MAX_PATTERN_SIZE) + ".");
+    }
+    std::sort(pattern.begin(), pattern.end());
+    pattern.erase(std::unique(pattern.begin(), pattern.end()), pattern.end());
+
+    const auto problem = applicable_action_generator->get_problem();
+    const auto num_abstract_states = size_t(1) << pattern.size();
+
+    /* 1. Project the ground actions */
+
+    const auto operators = project_ground_actions(problem, applicable_action_generator->get_ground_actions(), pattern);
+
+    /* 2. Build the abstract state space */
+
+    auto graph = StaticDigraph();
+    for (size_t abstract_state = 0; abstract_state < num_abstract_states; ++abstract_state)
+    {
+        graph.add_vertex();
+    }
+    auto transition_costs = ContinuousCostList {};
+
+    auto may_effects = std::vector<const ProjectedConditionalEffect*> {};
+    for (uint64_t source = 0; source < num_abstract_states; ++source)
+    {
+        for (const auto& op : operators)
+        {
+            if ((source & op.positive_precondition) != op.positive_precondition || (source & op.negative_precondition) != 0)
+            {
+                continue;
+            }
+
+            auto add = op.add;
+            auto del = op.del;
+            may_effects.clear();
+            for (const auto& effect : op.conditional_effects)
+            {
+                if ((source & effect.positive_condition) != effect.positive_condition || (source & effect.negative_condition) != 0)
+                {
+                    continue;
+                }
+                if (effect.is_determined)
+                {
+                    add |= effect.add;
+                    del |= effect.del;
+                }
+                else
+                {
+                    may_effects.push_back(&effect);
+                }
+            }
+
+            // Enumerate all combinations of conditional effects that may trigger.
+            for (uint64_t subset = 0; subset < (uint64_t(1) << may_effects.size()); ++subset)
+            {
+                auto subset_add = add;
+                auto subset_del = del;
+                for (size_t i = 0; i < may_effects.size(); ++i)
+                {
+                    if (subset & (uint64_t(1) << i))
+                    {
+                        subset_add |= may_effects[i]->add;
+                        subset_del |= may_effects[i]->del;
+                    }
+                }
+                const auto target = (source & ~subset_del) | subset_add;
+                if (target != source)
+                {
+                    graph.add_directed_edge(static_cast<Index>(source), static_cast<Index>(target));
+                    transition_costs.push_back(op.cost);
+                }
+            }
+        }
+    }
+
+    /* 3. Backward Dijkstra from the abstract goal states */
+
+    auto goal_positive = uint64_t(0);
+    auto goal_negative = uint64_t(0);
+    for (const auto& literal : problem->get_goal_condition<Fluent>())
+    {
+        const auto it = std::lower_bound(pattern.begin(), pattern.end(), literal->get_atom()->get_index());
+        if (it != pattern.end() && *it == literal->get_atom()->get_index())
+        {
+            (literal->is_negated() ? goal_negative : goal_positive) |= (uint64_t(1) << std::distance(pattern.begin(), it));
+        }
+    }
+    auto goal_states = IndexList {};
+    for (uint64_t abstract_state = 0; abstract_state < num_abstract_states; ++abstract_state)
+    {
+        if ((abstract_state & goal_positive) == goal_positive && (abstract_state & goal_negative) == 0)
+        {
+            goal_states.push_back(static_cast<Index>(abstract_state));
+        }
+    }
+
+    const auto bidirectional_graph = StaticBidirectionalDigraph(std::move(graph));
+    auto [predecessors, distances] =
+        dijkstra_shortest_paths(TraversalDirectionTaggedType(bidirectional_graph, BackwardTraversal()), transition_costs, goal_states.begin(), goal_states.end());
+
+    /* 4. Pack the distances */
+
+    m_owned_data->fingerprint = compute_pattern_database_fingerprint(*applicable_action_generator->get_pddl_factories(), problem, pattern);
+    m_owned_data->pattern.insert(m_owned_data->pattern.end(), pattern.begin(), pattern.end());
+    m_owned_data->distances.resize(num_abstract_states);
+    for (size_t abstract_state = 0; abstract_state < num_abstract_states; ++abstract_state)
+    {
+        const auto distance = distances[abstract_state];
+        m_owned_data->distances[abstract_state] = (distance == std::numeric_limits<ContinuousCost>::infinity()) ?
+                                                      DEADEND_DISTANCE :
+                                                      static_cast<uint8_t>(std::min(std::floor(distance), static_cast<ContinuousCost>(MAX_DISTANCE)));
+    }
+}
+
+PatternDatabase PatternDatabase::load_or_create(std::shared_ptr<GroundedApplicableActionGenerator> applicable_action_generator,
+                                                Pattern pattern,
+                                                const fs::path& file_path)
+{
+    std::sort(pattern.begin(), pattern.end());
+    pattern.erase(std::unique(pattern.begin(), pattern.end()), pattern.end());
+
+    if (fs::exists(file_path))
+    {
+        try
+        {
+            auto mmap = std::make_unique<cista::mmap>(file_path.c_str(), cista::mmap::protection::READ);
+            const auto* data = cista::deserialize<FlatPatternDatabase, PATTERN_DATABASE_SERIALIZATION_MODE>(*mmap);
+            if (data->fingerprint
+                    == compute_pattern_database_fingerprint(*applicable_action_generator->get_pddl_factories(), applicable_action_generator->get_problem(), pattern)
+                && std::equal(data->pattern.begin(), data->pattern.end(), pattern.begin(), pattern.end()))
+            {
+                return PatternDatabase(nullptr, std::move(mmap), data);
+            }
+        }
+        catch (const std::exception&)
+        {
+            // The file is corrupt or was written by an incompatible version, hence, we recompute it.
+        }
+    }
+
+    auto pdb = PatternDatabase(std::move(applicable_action_generator), std::move(pattern));
+    pdb.save(file_path);
+    return pdb;
+}
+
+void PatternDatabase::save(const fs::path& file_path) const
+{
+    auto buf = cista::buf<cista::mmap>(cista::mmap(file_path.c_str(), cista::mmap::protection::WRITE));
+    cista::serialize<PATTERN_DATABASE_SERIALIZATION_MODE>(buf, *m_data);
+}
+
+size_t PatternDatabase::get_abstract_state_index(State state) const
+{
+    const auto& fluent_atoms = state.get_atoms<Fluent>();
+    const auto& pattern = m_data->pattern;
+
+    auto abstract_state_index = size_t(0);
+    for (size_t i = 0; i < pattern.size(); ++i)
+    {
+        abstract_state_index |= (static_cast<size_t>(fluent_atoms.get(pattern[i])) << i);
+    }
+    return abstract_state_index;
+}
+
+ContinuousCost PatternDatabase::get_distance(State state) const
+{
+    const auto distance = m_data->distances[get_abstract_state_index(state)];
+    return (distance == DEADEND_DISTANCE) ? std::numeric_limits<ContinuousCost>::infinity() : static_cast<ContinuousCost>(distance);
+}
+
+std::span<const Index> PatternDatabase::get_pattern() const { return std::span<const Index>(m_data->pattern.data(), m_data->pattern.size()); }
+
+size_t PatternDatabase::get_num_abstract_states() const { return m_data->distances.size(); }
+
+uint64_t PatternDatabase::get_fingerprint() const { return m_data->fingerprint; }
+
+bool PatternDatabase::is_memory_mapped() const { return m_mmap != nullptr; }
+
+}
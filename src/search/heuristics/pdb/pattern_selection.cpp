@@ -0,0 +1,186 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "mimir/search/heuristics/pdb/pattern_selection.hpp"
+
+#include "mimir/formalism/ground_atom.hpp"
+#include "mimir/formalism/ground_literal.hpp"
+#include "mimir/formalism/problem.hpp"
+#include "mimir/search/action.hpp"
+#include "mimir/search/applicable_action_generators/grounded.hpp"
+
+#include <algorithm>
+#include <set>
+#include <unordered_map>
+
+namespace mimir
+{
+
+namespace
+{
+/// @brief Ground action reduced to the fluent atoms that matter for the pattern selection.
+struct SelectionOperator
+{
+    /// @brief The fluent atoms in the precondition.
+    IndexList preconditions;
+    /// @brief The fluent atoms that the operator changes.
+    IndexList effects;
+};
+}
+
+GreedyPatternSelector::GreedyPatternSelector(std::shared_ptr<GroundedApplicableActionGenerator> applicable_action_generator,
+                                             size_t max_pattern_size,
+                                             size_t max_num_abstract_states) :
+    m_applicable_action_generator(std::move(applicable_action_generator)),
+    m_max_pattern_size(std::min(max_pattern_size, PatternDatabase::MAX_PATTERN_SIZE)),
+    m_max_num_abstract_states(max_num_abstract_states)
+{
+}
+
+PatternList GreedyPatternSelector::compute_patterns() const
+{
+    const auto problem = m_applicable_action_generator->get_problem();
+
+    /* 1. Reduce the ground actions. Each conditional effect is treated as a separate operator. */
+
+    auto operators = std::vector<SelectionOperator> {};
+    auto changed_by = std::unordered_map<Index, IndexList> {};
+    const auto add_operator = [&](SelectionOperator op)
+    {
+        std::sort(op.preconditions.begin(), op.preconditions.end());
+        op.preconditions.erase(std::unique(op.preconditions.begin(), op.preconditions.end()), op.preconditions.end());
+        for (const auto atom_index : op.effects)
+        {
+            changed_by[atom_index].push_back(static_cast<Index>(operators.size()));
+        }
+        operators.push_back(std::move(op));
+    };
+
+    for (const auto& action : m_applicable_action_generator->get_ground_actions())
+    {
+        if (!action.is_statically_applicable(problem->get_static_initial_positive_atoms()))
+        {
+            continue;
+        }
+
+        const auto strips_precondition = StripsActionPrecondition(action.get_strips_precondition());
+        const auto strips_effect = StripsActionEffect(action.get_strips_effect());
+
+        auto op = SelectionOperator {};
+        for (const auto atom_index : strips_precondition.get_positive_precondition<Fluent>())
+        {
+            op.preconditions.push_back(atom_index);
+        }
+        for (const auto atom_index : strips_effect.get_positive_effects())
+        {
+            op.effects.push_back(atom_index);
+        }
+        for (const auto atom_index : strips_effect.get_negative_effects())
+        {
+            op.effects.push_back(atom_index);
+        }
+
+        for (const auto& flat_conditional_effect : action.get_conditional_effects())
+        {
+            const auto conditional_effect = ConditionalEffect(flat_conditional_effect);
+            if (!conditional_effect.is_statically_applicable(problem))
+            {
+                continue;
+            }
+            auto conditional_op = SelectionOperator { op.preconditions, { conditional_effect.get_simple_effect().atom_index } };
+            conditional_op.preconditions.insert(conditional_op.preconditions.end(),
+                                                conditional_effect.get_positive_precondition<Fluent>().begin(),
+                                                conditional_effect.get_positive_precondition<Fluent>().end());
+            add_operator(std::move(conditional_op));
+        }
+
+        add_operator(std::move(op));
+    }
+
+    /* 2. Grow one pattern for each fluent goal atom */
+
+    auto patterns = PatternList {};
+    auto unique_patterns = std::set<Pattern> {};
+    auto num_abstract_states = size_t(0);
+    auto counts = std::unordered_map<Index, size_t> {};
+
+    for (const auto& literal : problem->get_goal_condition<Fluent>())
+    {
+        auto pattern = Pattern { literal->get_atom()->get_index() };
+
+        while (pattern.size() < m_max_pattern_size)
+        {
+            // Count the occurrences of atoms outside of the pattern in the preconditions of operators that change the pattern.
+            counts.clear();
+            auto visited_operators = std::set<Index> {};
+            for (const auto atom_index : pattern)
+            {
+                const auto it = changed_by.find(atom_index);
+                if (it == changed_by.end())
+                {
+                    continue;
+                }
+                for (const auto op_index : it->second)
+                {
+                    if (!visited_operators.insert(op_index).second)
+                    {
+                        continue;
+                    }
+                    for (const auto precondition : operators[op_index].preconditions)
+                    {
+                        if (std::find(pattern.begin(), pattern.end(), precondition) == pattern.end())
+                        {
+                            ++counts[precondition];
+                        }
+                    }
+                }
+            }
+
+            auto best_atom_index = Index(0);
+            auto best_count = size_t(0);
+            for (const auto& [atom_index, count] : counts)
+            {
+                if (count > best_count || (count == best_count && atom_index < best_atom_index))
+                {
+                    best_atom_index = atom_index;
+                    best_count = count;
+                }
+            }
+            if (best_count == 0)
+            {
+                break;
+            }
+            pattern.push_back(best_atom_index);
+        }
+
+        std::sort(pattern.begin(), pattern.end());
+        const auto pattern_num_abstract_states = size_t(1) << pattern.size();
+        if (num_abstract_states + pattern_num_abstract_states > m_max_num_abstract_states)
+        {
+            break;
+        }
+        if (unique_patterns.insert(pattern).second)
+        {
+            num_abstract_states += pattern_num_abstract_states;
+            patterns.push_back(std::move(pattern));
+        }
+    }
+
+    return patterns;
+}
+
+}
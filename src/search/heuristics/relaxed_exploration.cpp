@@ -0,0 +1,223 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "mimir/search/heuristics/relaxed_exploration.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+
+namespace mimir
+{
+
+RelaxedExplorationHeuristic::RelaxedExplorationHeuristic(std::shared_ptr<RelaxedOperatorGraph> graph) :
+    m_graph(std::move(graph)),
+    m_proposition_costs(m_graph->get_num_propositions(), std::numeric_limits<ContinuousCost>::infinity()),
+    m_proposition_supporters(m_graph->get_num_propositions(), RelaxedOperatorGraph::NO_ACTION),
+    m_operator_num_unsatisfied(m_graph->get_num_preconditions()),
+    m_operator_costs(m_graph->get_num_operators(), ContinuousCost(0)),
+    m_queue(),
+    m_marked_propositions(m_graph->get_num_propositions(), false),
+    m_marked_operators(m_graph->get_num_operators(), false),
+    m_marked_actions(m_graph->get_num_actions(), false),
+    m_open_propositions(),
+    m_reached_propositions(),
+    m_reached_operators(),
+    m_relaxed_plan()
+{
+    m_queue.reserve(m_graph->get_num_propositions());
+}
+
+ContinuousCost RelaxedExplorationHeuristic::explore(State state, RelaxedCostCombination combination, bool stop_at_goals)
+{
+    const auto& graph = *m_graph;
+    const auto& goal_propositions = graph.get_goal_propositions();
+    const auto compare = std::greater<std::pair<ContinuousCost, Index>>();
+
+    /* 1. Reset buffers, the graph might have grown since the last call. */
+
+    m_proposition_costs.assign(graph.get_num_propositions(), std::numeric_limits<ContinuousCost>::infinity());
+    m_proposition_supporters.assign(graph.get_num_propositions(), RelaxedOperatorGraph::NO_ACTION);
+    m_operator_num_unsatisfied.assign(graph.get_num_preconditions().begin(), graph.get_num_preconditions().end());
+    m_operator_costs.assign(graph.get_num_operators(), ContinuousCost(0));
+    m_queue.clear();
+
+    const auto enqueue = [this, &compare](Index proposition, ContinuousCost cost, Index supporter)
+    {
+        if (cost < m_proposition_costs[proposition])
+        {
+            m_proposition_costs[proposition] = cost;
+            m_proposition_supporters[proposition] = supporter;
+            m_queue.emplace_back(cost, proposition);
+            std::push_heap(m_queue.begin(), m_queue.end(), compare);
+        }
+    };
+
+    /* 2. Initialize with the atoms of the state and operators without preconditions */
+
+    for (const auto atom_index : state.get_atoms<Fluent>())
+    {
+        const auto proposition = graph.get_proposition<Fluent>(atom_index);
+        if (proposition != RelaxedOperatorGraph::NO_PROPOSITION)
+        {
+            enqueue(proposition, ContinuousCost(0), RelaxedOperatorGraph::NO_ACTION);
+        }
+    }
+    for (const auto atom_index : state.get_atoms<Derived>())
+    {
+        const auto proposition = graph.get_proposition<Derived>(atom_index);
+        if (proposition != RelaxedOperatorGraph::NO_PROPOSITION)
+        {
+            enqueue(proposition, ContinuousCost(0), RelaxedOperatorGraph::NO_ACTION);
+        }
+    }
+    for (const auto op : graph.get_operators_without_preconditions())
+    {
+        for (const auto effect : graph.get_effects(op))
+        {
+            enqueue(effect, graph.get_cost(op), op);
+        }
+    }
+
+    /* 3. Generalized Dijkstra until all goal propositions have their final cost */
+
+    auto num_unreached_goals = goal_propositions.size();
+
+    while (!m_queue.empty() && (!stop_at_goals || num_unreached_goals > 0))
+    {
+        std::pop_heap(m_queue.begin(), m_queue.end(), compare);
+        const auto [cost, proposition] = m_queue.back();
+        m_queue.pop_back();
+
+        if (cost > m_proposition_costs[proposition])
+        {
+            // Stale entry
+            continue;
+        }
+
+        if (std::binary_search(goal_propositions.begin(), goal_propositions.end(), proposition))
+        {
+            --num_unreached_goals;
+        }
+
+        for (const auto op : graph.get_precondition_of(proposition))
+        {
+            auto& operator_cost = m_operator_costs[op];
+            operator_cost = (combination == RelaxedCostCombination::MAX) ? std::max(operator_cost, cost) : operator_cost + cost;
+
+            if (--m_operator_num_unsatisfied[op] == 0)
+            {
+                const auto effect_cost = operator_cost + graph.get_cost(op);
+                for (const auto effect : graph.get_effects(op))
+                {
+                    enqueue(effect, effect_cost, op);
+                }
+            }
+        }
+    }
+
+    /* 4. Combine the goal costs */
+
+    auto goal_cost = ContinuousCost(0);
+    for (const auto proposition : goal_propositions)
+    {
+        const auto proposition_cost = m_proposition_costs[proposition];
+        if (proposition_cost == std::numeric_limits<ContinuousCost>::infinity())
+        {
+            return std::numeric_limits<ContinuousCost>::infinity();
+        }
+        goal_cost = (combination == RelaxedCostCombination::MAX) ? std::max(goal_cost, proposition_cost) : goal_cost + proposition_cost;
+    }
+
+    return goal_cost;
+}
+
+ContinuousCost RelaxedExplorationHeuristic::extract_relaxed_plan()
+{
+    const auto& graph = *m_graph;
+
+    m_relaxed_plan.clear();
+    m_marked_propositions.resize(graph.get_num_propositions(), false);
+    m_marked_operators.resize(graph.get_num_operators(), false);
+    m_marked_actions.resize(graph.get_num_actions(), false);
+
+    auto cost = ContinuousCost(0);
+
+    for (const auto proposition : graph.get_goal_propositions())
+    {
+        m_marked_propositions[proposition] = true;
+        m_reached_propositions.push_back(proposition);
+        m_open_propositions.push_back(proposition);
+    }
+
+    while (!m_open_propositions.empty())
+    {
+        const auto proposition = m_open_propositions.back();
+        m_open_propositions.pop_back();
+
+        const auto op = m_proposition_supporters[proposition];
+        if (op == RelaxedOperatorGraph::NO_ACTION || m_marked_operators[op])
+        {
+            // Proposition holds in the state or its supporter was already processed.
+            continue;
+        }
+        m_marked_operators[op] = true;
+        m_reached_operators.push_back(op);
+
+        // Operators for conditional effects share the action, hence, we count the action only once.
+        const auto action_index = graph.get_action_index(op);
+        if (action_index != RelaxedOperatorGraph::NO_ACTION && !m_marked_actions[action_index])
+        {
+            m_marked_actions[action_index] = true;
+            m_relaxed_plan.push_back(action_index);
+            cost += graph.get_cost(op);
+        }
+
+        for (const auto precondition : graph.get_preconditions(op))
+        {
+            if (!m_marked_propositions[precondition])
+            {
+                m_marked_propositions[precondition] = true;
+                m_reached_propositions.push_back(precondition);
+                m_open_propositions.push_back(precondition);
+            }
+        }
+    }
+
+    /* Reset the marks */
+
+    for (const auto proposition : m_reached_propositions)
+    {
+        m_marked_propositions[proposition] = false;
+    }
+    for (const auto op : m_reached_operators)
+    {
+        m_marked_operators[op] = false;
+    }
+    for (const auto action_index : m_relaxed_plan)
+    {
+        m_marked_actions[action_index] = false;
+    }
+    m_reached_propositions.clear();
+    m_reached_operators.clear();
+
+    return cost;
+}
+
+const std::shared_ptr<RelaxedOperatorGraph>& RelaxedExplorationHeuristic::get_relaxed_operator_graph() const { return m_graph; }
+
+}
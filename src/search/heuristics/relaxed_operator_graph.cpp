@@ -0,0 +1,296 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "mimir/search/heuristics/relaxed_operator_graph.hpp"
+
+#include "mimir/common/concepts.hpp"
+#include "mimir/formalism/ground_atom.hpp"
+#include "mimir/formalism/ground_literal.hpp"
+#include "mimir/formalism/problem.hpp"
+#include "mimir/search/action.hpp"
+#include "mimir/search/applicable_action_generators/grounded.hpp"
+#include "mimir/search/axiom.hpp"
+
+#include <algorithm>
+
+namespace mimir
+{
+
+template<DynamicPredicateCategory P>
+Index RelaxedOperatorGraph::get_or_create_proposition(Index atom_index)
+{
+    auto& atom_to_proposition = std::is_same_v<P, Fluent> ? m_fluent_atom_to_proposition : m_derived_atom_to_proposition;
+
+    if (atom_index >= atom_to_proposition.size())
+    {
+        atom_to_proposition.resize(atom_index + 1, NO_PROPOSITION);
+    }
+    if (atom_to_proposition[atom_index] == NO_PROPOSITION)
+    {
+        atom_to_proposition[atom_index] = m_proposition_to_atom.size();
+        m_proposition_to_atom.push_back(atom_index);
+        m_proposition_is_derived.push_back(std::is_same_v<P, Derived>);
+    }
+    return atom_to_proposition[atom_index];
+}
+
+void RelaxedOperatorGraph::add_operator(const IndexList& preconditions, const IndexList& effects, ContinuousCost cost, Index action_index)
+{
+    if (effects.empty())
+    {
+        // Operators without add effects cannot contribute to the relaxed exploration.
+        return;
+    }
+
+    const auto op = static_cast<Index>(m_costs.size());
+
+    m_preconditions.insert(m_preconditions.end(), preconditions.begin(), preconditions.end());
+    m_precondition_offsets.push_back(m_preconditions.size());
+    m_num_preconditions.push_back(preconditions.size());
+    m_effects.insert(m_effects.end(), effects.begin(), effects.end());
+    m_effect_offsets.push_back(m_effects.size());
+    m_costs.push_back(cost);
+    m_action_indices.push_back(action_index);
+
+    if (preconditions.empty())
+    {
+        m_operators_without_preconditions.push_back(op);
+    }
+}
+
+RelaxedOperatorGraph::RelaxedOperatorGraph(Problem problem) :
+    m_problem(problem),
+    m_fluent_atom_to_proposition(),
+    m_derived_atom_to_proposition(),
+    m_proposition_to_atom(),
+    m_proposition_is_derived(),
+    m_precondition_offsets({ 0 }),
+    m_preconditions(),
+    m_num_preconditions(),
+    m_effect_offsets({ 0 }),
+    m_effects(),
+    m_costs(),
+    m_action_indices(),
+    m_num_actions(0),
+    m_precondition_of_offsets(),
+    m_precondition_of(),
+    m_operators_without_preconditions(),
+    m_goal_propositions(),
+    m_preconditions_buffer(),
+    m_conditional_preconditions_buffer(),
+    m_effects_buffer()
+{
+    for (const auto& literal : m_problem->get_goal_condition<Fluent>())
+    {
+        if (!literal->is_negated())
+        {
+            m_goal_propositions.push_back(get_or_create_proposition<Fluent>(literal->get_atom()->get_index()));
+        }
+    }
+    for (const auto& literal : m_problem->get_goal_condition<Derived>())
+    {
+        if (!literal->is_negated())
+        {
+            m_goal_propositions.push_back(get_or_create_proposition<Derived>(literal->get_atom()->get_index()));
+        }
+    }
+    std::sort(m_goal_propositions.begin(), m_goal_propositions.end());
+    m_goal_propositions.erase(std::unique(m_goal_propositions.begin(), m_goal_propositions.end()), m_goal_propositions.end());
+
+    finalize();
+}
+
+RelaxedOperatorGraph::RelaxedOperatorGraph(std::shared_ptr<GroundedApplicableActionGenerator> applicable_action_generator) :
+    RelaxedOperatorGraph(applicable_action_generator->get_problem())
+{
+    const auto& static_positive_atoms = m_problem->get_static_initial_positive_atoms();
+
+    for (const auto& action : applicable_action_generator->get_ground_actions())
+    {
+        if (action.is_statically_applicable(static_positive_atoms))
+        {
+            add_ground_action(action);
+        }
+    }
+
+    for (const auto& axiom : applicable_action_generator->get_ground_axioms())
+    {
+        if (axiom.is_statically_applicable(static_positive_atoms))
+        {
+            add_ground_axiom(axiom);
+        }
+    }
+
+    finalize();
+}
+
+void RelaxedOperatorGraph::add_ground_action(GroundAction action)
+{
+    m_num_actions = std::max(m_num_actions, static_cast<size_t>(action.get_index() + 1));
+
+    const auto strips_precondition = StripsActionPrecondition(action.get_strips_precondition());
+
+    m_preconditions_buffer.clear();
+    for (const auto atom_index : strips_precondition.get_positive_precondition<Fluent>())
+    {
+        m_preconditions_buffer.push_back(get_or_create_proposition<Fluent>(atom_index));
+    }
+    for (const auto atom_index : strips_precondition.get_positive_precondition<Derived>())
+    {
+        m_preconditions_buffer.push_back(get_or_create_proposition<Derived>(atom_index));
+    }
+
+    m_effects_buffer.clear();
+    for (const auto atom_index : StripsActionEffect(action.get_strips_effect()).get_positive_effects())
+    {
+        m_effects_buffer.push_back(get_or_create_proposition<Fluent>(atom_index));
+    }
+    add_operator(m_preconditions_buffer, m_effects_buffer, action.get_cost(), action.get_index());
+
+    for (const auto& flat_conditional_effect : action.get_conditional_effects())
+    {
+        const auto conditional_effect = ConditionalEffect(flat_conditional_effect);
+        const auto& simple_effect = conditional_effect.get_simple_effect();
+
+        if (simple_effect.is_negated || !conditional_effect.is_statically_applicable(m_problem))
+        {
+            continue;
+        }
+
+        m_conditional_preconditions_buffer = m_preconditions_buffer;
+        for (const auto atom_index : conditional_effect.get_positive_precondition<Fluent>())
+        {
+            m_conditional_preconditions_buffer.push_back(get_or_create_proposition<Fluent>(atom_index));
+        }
+        for (const auto atom_index : conditional_effect.get_positive_precondition<Derived>())
+        {
+            m_conditional_preconditions_buffer.push_back(get_or_create_proposition<Derived>(atom_index));
+        }
+        std::sort(m_conditional_preconditions_buffer.begin(), m_conditional_preconditions_buffer.end());
+        m_conditional_preconditions_buffer.erase(std::unique(m_conditional_preconditions_buffer.begin(), m_conditional_preconditions_buffer.end()),
+                                                 m_conditional_preconditions_buffer.end());
+
+        m_effects_buffer.clear();
+        m_effects_buffer.push_back(get_or_create_proposition<Fluent>(simple_effect.atom_index));
+        add_operator(m_conditional_preconditions_buffer, m_effects_buffer, action.get_cost(), action.get_index());
+    }
+}
+
+void RelaxedOperatorGraph::add_ground_axiom(GroundAxiom axiom)
+{
+    const auto strips_precondition = StripsActionPrecondition(axiom.get_strips_precondition());
+
+    m_preconditions_buffer.clear();
+    for (const auto atom_index : strips_precondition.get_positive_precondition<Fluent>())
+    {
+        m_preconditions_buffer.push_back(get_or_create_proposition<Fluent>(atom_index));
+    }
+    for (const auto atom_index : strips_precondition.get_positive_precondition<Derived>())
+    {
+        m_preconditions_buffer.push_back(get_or_create_proposition<Derived>(atom_index));
+    }
+
+    m_effects_buffer.clear();
+    m_effects_buffer.push_back(get_or_create_proposition<Derived>(axiom.get_derived_effect().atom_index));
+    add_operator(m_preconditions_buffer, m_effects_buffer, ContinuousCost(0), NO_ACTION);
+}
+
+void RelaxedOperatorGraph::finalize()
+{
+    /* Invert the precondition relation using counting sort */
+
+    const auto num_propositions = get_num_propositions();
+
+    m_precondition_of_offsets.assign(num_propositions + 1, 0);
+    for (const auto proposition : m_preconditions)
+    {
+        ++m_precondition_of_offsets[proposition + 1];
+    }
+    for (size_t proposition = 0; proposition < num_propositions; ++proposition)
+    {
+        m_precondition_of_offsets[proposition + 1] += m_precondition_of_offsets[proposition];
+    }
+    m_precondition_of.resize(m_preconditions.size());
+    auto positions = IndexList(m_precondition_of_offsets.begin(), m_precondition_of_offsets.end() - 1);
+    for (size_t op = 0; op < get_num_operators(); ++op)
+    {
+        for (const auto proposition : get_preconditions(op))
+        {
+            m_precondition_of[positions[proposition]++] = op;
+        }
+    }
+}
+
+template<DynamicPredicateCategory P>
+Index RelaxedOperatorGraph::get_proposition(Index atom_index) const
+{
+    if constexpr (std::is_same_v<P, Fluent>)
+    {
+        return (atom_index < m_fluent_atom_to_proposition.size()) ? m_fluent_atom_to_proposition[atom_index] : NO_PROPOSITION;
+    }
+    else if constexpr (std::is_same_v<P, Derived>)
+    {
+        return (atom_index < m_derived_atom_to_proposition.size()) ? m_derived_atom_to_proposition[atom_index] : NO_PROPOSITION;
+    }
+    else
+    {
+        static_assert(dependent_false<P>::value, "Missing implementation for DynamicPredicateCategory.");
+    }
+}
+
+template Index RelaxedOperatorGraph::get_proposition<Fluent>(Index atom_index) const;
+template Index RelaxedOperatorGraph::get_proposition<Derived>(Index atom_index) const;
+
+Index RelaxedOperatorGraph::get_atom_index(Index proposition) const { return m_proposition_to_atom[proposition]; }
+
+bool RelaxedOperatorGraph::is_derived(Index proposition) const { return m_proposition_is_derived[proposition]; }
+
+Problem RelaxedOperatorGraph::get_problem() const { return m_problem; }
+
+size_t RelaxedOperatorGraph::get_num_propositions() const { return m_proposition_to_atom.size(); }
+
+size_t RelaxedOperatorGraph::get_num_operators() const { return m_costs.size(); }
+
+size_t RelaxedOperatorGraph::get_num_actions() const { return m_num_actions; }
+
+std::span<const Index> RelaxedOperatorGraph::get_preconditions(Index op) const
+{
+    return std::span<const Index>(m_preconditions.data() + m_precondition_offsets[op], m_preconditions.data() + m_precondition_offsets[op + 1]);
+}
+
+std::span<const Index> RelaxedOperatorGraph::get_effects(Index op) const
+{
+    return std::span<const Index>(m_effects.data() + m_effect_offsets[op], m_effects.data() + m_effect_offsets[op + 1]);
+}
+
+const IndexList& RelaxedOperatorGraph::get_num_preconditions() const { return m_num_preconditions; }
+
+ContinuousCost RelaxedOperatorGraph::get_cost(Index op) const { return m_costs[op]; }
+
+Index RelaxedOperatorGraph::get_action_index(Index op) const { return m_action_indices[op]; }
+
+std::span<const Index> RelaxedOperatorGraph::get_precondition_of(Index proposition) const
+{
+    return std::span<const Index>(m_precondition_of.data() + m_precondition_of_offsets[proposition],
+                                  m_precondition_of.data() + m_precondition_of_offsets[proposition + 1]);
+}
+
+const IndexList& RelaxedOperatorGraph::get_operators_without_preconditions() const { return m_operators_without_preconditions; }
+
+const IndexList& RelaxedOperatorGraph::get_goal_propositions() const { return m_goal_propositions; }
+
+}
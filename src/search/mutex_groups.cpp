@@ -0,0 +1,347 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "mimir/search/mutex_groups.hpp"
+
+#include "mimir/formalism/factories.hpp"
+#include "mimir/formalism/ground_atom.hpp"
+#include "mimir/formalism/ground_literal.hpp"
+#include "mimir/formalism/object.hpp"
+#include "mimir/formalism/predicate.hpp"
+#include "mimir/formalism/problem.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <map>
+
+namespace mimir
+{
+
+/// @brief Special value for the position of a predicate that links all its atoms.
+static constexpr Index NO_POSITION = std::numeric_limits<Index>::max();
+
+/// @brief A predicate position is a predicate index together with an argument position or `NO_POSITION`.
+using PredicatePosition = std::pair<Index, Index>;
+
+static Index find_root(IndexList& parents, Index node)
+{
+    while (parents[node] != node)
+    {
+        parents[node] = parents[parents[node]];
+        node = parents[node];
+    }
+    return node;
+}
+
+static bool is_mutex_group(const MutexGroup& group,
+                           const FlatBitset& initial_atoms,
+                           const std::vector<GroundActionList>& adding_actions,
+                           const std::vector<bool>& is_conditionally_added,
+                           std::vector<bool>& in_group)
+{
+    for (const auto atom_index : group)
+    {
+        in_group[atom_index] = true;
+    }
+
+    const auto in_group_checker = [&](Index atom_index) { return atom_index < in_group.size() && in_group[atom_index]; };
+
+    auto is_mutex = true;
+
+    /* 1. At most one atom is true in the initial state. */
+
+    if (std::count_if(group.begin(), group.end(), [&](Index atom_index) { return initial_atoms.get(atom_index); }) > 1)
+    {
+        is_mutex = false;
+    }
+
+    /* 2. Every action that adds an atom of the group requires and deletes another atom of the group, or requires the added atom. */
+
+    for (size_t i = 0; is_mutex && i < group.size(); ++i)
+    {
+        const auto added_atom_index = group[i];
+
+        if (is_conditionally_added[added_atom_index])
+        {
+            is_mutex = false;
+            break;
+        }
+
+        for (const auto& action : adding_actions[added_atom_index])
+        {
+            const auto strips_precondition = StripsActionPrecondition(action.get_strips_precondition());
+            const auto strips_effect = StripsActionEffect(action.get_strips_effect());
+            const auto& positive_precondition = strips_precondition.get_positive_precondition<Fluent>();
+
+            if (positive_precondition.get(added_atom_index))
+            {
+                continue;
+            }
+
+            auto num_added = size_t(0);
+            for (const auto atom_index : strips_effect.get_positive_effects())
+            {
+                num_added += in_group_checker(atom_index);
+            }
+
+            auto has_deleted_precondition = false;
+            for (const auto atom_index : strips_effect.get_negative_effects())
+            {
+                if (in_group_checker(atom_index) && atom_index != added_atom_index && positive_precondition.get(atom_index))
+                {
+                    has_deleted_precondition = true;
+                    break;
+                }
+            }
+
+            if (num_added > 1 || !has_deleted_precondition)
+            {
+                is_mutex = false;
+                break;
+            }
+        }
+    }
+
+    for (const auto atom_index : group)
+    {
+        in_group[atom_index] = false;
+    }
+
+    return is_mutex;
+}
+
+MutexGroupList compute_mutex_groups(Problem problem, const GroundActionList& ground_actions, const PDDLFactories& pddl_factories)
+{
+    /* 1. Collect the fluent atoms of the task and the actions that add them. */
+
+    auto atom_indices = IndexList {};
+    auto adding_actions = std::vector<GroundActionList> {};
+    auto is_conditionally_added = std::vector<bool> {};
+    const auto add_atom = [&](Index atom_index)
+    {
+        atom_indices.push_back(atom_index);
+        if (atom_index >= adding_actions.size())
+        {
+            adding_actions.resize(atom_index + 1);
+            is_conditionally_added.resize(atom_index + 1, false);
+        }
+    };
+
+    auto initial_atoms = FlatBitset();
+    for (const auto& literal : problem->get_fluent_initial_literals())
+    {
+        if (!literal->is_negated())
+        {
+            initial_atoms.set(literal->get_atom()->get_index());
+            add_atom(literal->get_atom()->get_index());
+        }
+    }
+
+    for (const auto& action : ground_actions)
+    {
+        const auto strips_precondition = StripsActionPrecondition(action.get_strips_precondition());
+        const auto strips_effect = StripsActionEffect(action.get_strips_effect());
+
+        for (const auto atom_index : strips_precondition.get_positive_precondition<Fluent>())
+        {
+            add_atom(atom_index);
+        }
+        for (const auto atom_index : strips_precondition.get_negative_precondition<Fluent>())
+        {
+            add_atom(atom_index);
+        }
+        for (const auto atom_index : strips_effect.get_positive_effects())
+        {
+            add_atom(atom_index);
+            adding_actions[atom_index].push_back(action);
+        }
+        for (const auto atom_index : strips_effect.get_negative_effects())
+        {
+            add_atom(atom_index);
+        }
+        for (const auto& flat_conditional_effect : action.get_conditional_effects())
+        {
+            const auto conditional_effect = ConditionalEffect(flat_conditional_effect);
+            for (const auto atom_index : conditional_effect.get_positive_precondition<Fluent>())
+            {
+                add_atom(atom_index);
+            }
+            for (const auto atom_index : conditional_effect.get_negative_precondition<Fluent>())
+            {
+                add_atom(atom_index);
+            }
+            const auto& simple_effect = conditional_effect.get_simple_effect();
+            add_atom(simple_effect.atom_index);
+            if (!simple_effect.is_negated)
+            {
+                is_conditionally_added[simple_effect.atom_index] = true;
+            }
+        }
+    }
+    std::sort(atom_indices.begin(), atom_indices.end());
+    atom_indices.erase(std::unique(atom_indices.begin(), atom_indices.end()), atom_indices.end());
+
+    /* 2. Link the predicate positions of deleted precondition atoms and added atoms that share an object. */
+
+    auto predicate_position_to_node = std::map<PredicatePosition, Index> {};
+    auto parents = IndexList {};
+    const auto get_or_create_node = [&](PredicatePosition predicate_position)
+    {
+        const auto [iter, inserted] = predicate_position_to_node.emplace(predicate_position, parents.size());
+        if (inserted)
+        {
+            parents.push_back(parents.size());
+        }
+        return iter->second;
+    };
+    const auto link = [&](PredicatePosition lhs, PredicatePosition rhs)
+    {
+        const auto lhs_root = find_root(parents, get_or_create_node(lhs));
+        const auto rhs_root = find_root(parents, get_or_create_node(rhs));
+        parents[std::max(lhs_root, rhs_root)] = std::min(lhs_root, rhs_root);
+    };
+
+    for (const auto& action : ground_actions)
+    {
+        const auto strips_precondition = StripsActionPrecondition(action.get_strips_precondition());
+        const auto strips_effect = StripsActionEffect(action.get_strips_effect());
+        const auto& positive_precondition = strips_precondition.get_positive_precondition<Fluent>();
+
+        for (const auto deleted_atom_index : strips_effect.get_negative_effects())
+        {
+            if (!positive_precondition.get(deleted_atom_index))
+            {
+                continue;
+            }
+            const auto deleted_atom = pddl_factories.get_ground_atom<Fluent>(deleted_atom_index);
+
+            for (const auto added_atom_index : strips_effect.get_positive_effects())
+            {
+                const auto added_atom = pddl_factories.get_ground_atom<Fluent>(added_atom_index);
+
+                link(PredicatePosition(deleted_atom->get_predicate()->get_index(), NO_POSITION),
+                     PredicatePosition(added_atom->get_predicate()->get_index(), NO_POSITION));
+
+                for (size_t i = 0; i < deleted_atom->get_arity(); ++i)
+                {
+                    for (size_t j = 0; j < added_atom->get_arity(); ++j)
+                    {
+                        if (deleted_atom->get_objects()[i] == added_atom->get_objects()[j])
+                        {
+                            link(PredicatePosition(deleted_atom->get_predicate()->get_index(), i),
+                                 PredicatePosition(added_atom->get_predicate()->get_index(), j));
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    /* 3. Each component that links each predicate with at most one position induces candidate groups. */
+
+    auto component_predicate_positions = std::map<Index, std::map<Index, Index>> {};
+    auto invalid_components = std::vector<bool>(parents.size(), false);
+    for (const auto& [predicate_position, node] : predicate_position_to_node)
+    {
+        const auto [predicate_index, position] = predicate_position;
+        const auto root = find_root(parents, node);
+        const auto [iter, inserted] = component_predicate_positions[root].emplace(predicate_index, position);
+        if (!inserted && iter->second != position)
+        {
+            invalid_components[root] = true;
+        }
+    }
+
+    auto candidate_groups = MutexGroupList {};
+    for (const auto& [root, predicate_positions] : component_predicate_positions)
+    {
+        if (invalid_components[root])
+        {
+            continue;
+        }
+
+        auto groups_by_object = std::map<Index, MutexGroup> {};
+        for (const auto atom_index : atom_indices)
+        {
+            const auto atom = pddl_factories.get_ground_atom<Fluent>(atom_index);
+            const auto iter = predicate_positions.find(atom->get_predicate()->get_index());
+            if (iter == predicate_positions.end())
+            {
+                continue;
+            }
+            const auto position = iter->second;
+            const auto object_index = (position == NO_POSITION) ? NO_POSITION : atom->get_objects().at(position)->get_index();
+            groups_by_object[object_index].push_back(atom_index);
+        }
+        for (auto& [object_index, group] : groups_by_object)
+        {
+            if (group.size() > 1)
+            {
+                candidate_groups.push_back(std::move(group));
+            }
+        }
+    }
+
+    /* 4. Greedily choose verified groups by decreasing size, break ties by the smallest atom index. */
+
+    std::sort(candidate_groups.begin(),
+              candidate_groups.end(),
+              [](const MutexGroup& lhs, const MutexGroup& rhs)
+              {
+                  if (lhs.size() == rhs.size())
+                  {
+                      return lhs < rhs;
+                  }
+                  return lhs.size() > rhs.size();
+              });
+
+    const auto max_atom_index = atom_indices.empty() ? Index(0) : atom_indices.back() + 1;
+    auto in_group = std::vector<bool>(max_atom_index, false);
+    auto is_covered = std::vector<bool>(max_atom_index, false);
+    auto mutex_groups = MutexGroupList {};
+
+    for (const auto& group : candidate_groups)
+    {
+        if (std::any_of(group.begin(), group.end(), [&](Index atom_index) { return is_covered[atom_index]; }))
+        {
+            continue;
+        }
+        if (!is_mutex_group(group, initial_atoms, adding_actions, is_conditionally_added, in_group))
+        {
+            continue;
+        }
+        for (const auto atom_index : group)
+        {
+            is_covered[atom_index] = true;
+        }
+        mutex_groups.push_back(group);
+    }
+
+    /* 5. The remaining atoms form singleton groups. */
+
+    for (const auto atom_index : atom_indices)
+    {
+        if (!is_covered[atom_index])
+        {
+            mutex_groups.push_back(MutexGroup { atom_index });
+        }
+    }
+
+    return mutex_groups;
+}
+
+}
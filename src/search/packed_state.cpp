@@ -0,0 +1,121 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "mimir/search/packed_state.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+#include <string>
+
+namespace mimir
+{
+
+PackedStateEncoder::PackedStateEncoder(MutexGroupList mutex_groups) :
+    m_mutex_groups(std::move(mutex_groups)),
+    m_variable_blocks(),
+    m_variable_offsets(),
+    m_variable_masks(),
+    m_num_blocks(0),
+    m_atom_to_variable(),
+    m_atom_to_value()
+{
+    constexpr auto block_size = std::numeric_limits<PackedBlock>::digits;
+
+    auto block = Index(0);
+    auto offset = Index(0);
+
+    for (size_t variable = 0; variable < m_mutex_groups.size(); ++variable)
+    {
+        const auto& group = m_mutex_groups[variable];
+        const auto num_bits = static_cast<Index>(std::bit_width(group.size()));
+
+        if (offset + num_bits > block_size)
+        {
+            ++block;
+            offset = 0;
+        }
+        m_variable_blocks.push_back(block);
+        m_variable_offsets.push_back(offset);
+        m_variable_masks.push_back((num_bits == block_size) ? ~PackedBlock(0) : ((PackedBlock(1) << num_bits) - 1));
+        offset += num_bits;
+
+        for (size_t i = 0; i < group.size(); ++i)
+        {
+            const auto atom_index = group[i];
+            if (atom_index >= m_atom_to_variable.size())
+            {
+                m_atom_to_variable.resize(atom_index + 1, NO_VARIABLE);
+                m_atom_to_value.resize(atom_index + 1, 0);
+            }
+            if (m_atom_to_variable[atom_index] != NO_VARIABLE)
+            {
+                throw std::runtime_error("PackedStateEncoder::PackedStateEncoder: mutex groups must be disjoint.");
+            }
+            m_atom_to_variable[atom_index] = variable;
+            m_atom_to_value[atom_index] = i + 1;
+        }
+    }
+
+    m_num_blocks = m_mutex_groups.empty() ? 0 : block + 1;
+}
+
+void PackedStateEncoder::encode(const FlatBitset& fluent_atoms, std::span<PackedBlock> out_blocks) const
+{
+    std::fill(out_blocks.begin(), out_blocks.end(), PackedBlock(0));
+
+    for (const auto atom_index : fluent_atoms)
+    {
+        const auto variable = get_variable(atom_index);
+        if (variable == NO_VARIABLE)
+        {
+            throw std::runtime_error("PackedStateEncoder::encode: atom " + std::to_string(atom_index) + " is not covered by a mutex group.");
+        }
+        if (get_value(out_blocks, variable) != 0)
+        {
+            throw std::runtime_error("PackedStateEncoder::encode: mutex group " + std::to_string(variable) + " has more than one true atom.");
+        }
+        out_blocks[m_variable_blocks[variable]] |= PackedBlock(m_atom_to_value[atom_index]) << m_variable_offsets[variable];
+    }
+}
+
+void PackedStateEncoder::decode(std::span<const PackedBlock> blocks, FlatBitset& out_fluent_atoms) const
+{
+    out_fluent_atoms.unset_all();
+
+    for (size_t variable = 0; variable < m_mutex_groups.size(); ++variable)
+    {
+        const auto value = get_value(blocks, variable);
+        if (value != 0)
+        {
+            out_fluent_atoms.set(m_mutex_groups[variable][value - 1]);
+        }
+    }
+}
+
+const MutexGroupList& PackedStateEncoder::get_mutex_groups() const { return m_mutex_groups; }
+
+size_t PackedStateEncoder::get_num_variables() const { return m_mutex_groups.size(); }
+
+size_t PackedStateEncoder::get_num_blocks() const { return m_num_blocks; }
+
+Index PackedStateEncoder::get_variable(Index atom_index) const
+{
+    return (atom_index < m_atom_to_variable.size()) ? m_atom_to_variable[atom_index] : NO_VARIABLE;
+}
+
+}
@@ -0,0 +1,162 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "mimir/search/packed_state_repository.hpp"
+
+#include "mimir/common/hash.hpp"
+#include "mimir/formalism/ground_literal.hpp"
+#include "mimir/formalism/problem.hpp"
+#include "mimir/search/applicable_action_generators/grounded.hpp"
+#include "mimir/search/state_repository.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace mimir
+{
+
+PackedStateRepository::PackedStateRepository(std::shared_ptr<GroundedApplicableActionGenerator> aag) :
+    m_aag(std::move(aag)),
+    m_problem_or_domain_has_axioms(!m_aag->get_problem()->get_axioms().empty() || !m_aag->get_problem()->get_domain()->get_axioms().empty()),
+    m_encoder(compute_mutex_groups(m_aag->get_problem(), m_aag->get_ground_actions(), *m_aag->get_pddl_factories())),
+    m_blocks(),
+    m_num_states(0),
+    m_slots(),
+    m_blocks_buffer(m_encoder.get_num_blocks()),
+    m_fluent_atoms_buffer(),
+    m_reached_fluent_atoms()
+{
+    resize_slots(1024);
+}
+
+size_t PackedStateRepository::get_slot(std::span<const PackedBlock> blocks) const
+{
+    const auto num_blocks = m_encoder.get_num_blocks();
+    const auto mask = m_slots.size() - 1;
+
+    auto slot = Hash<std::span<const PackedBlock>>()(blocks) & mask;
+    while (m_slots[slot] != EMPTY_SLOT)
+    {
+        if (std::equal(blocks.begin(), blocks.end(), m_blocks.begin() + m_slots[slot] * num_blocks))
+        {
+            break;
+        }
+        slot = (slot + 1) & mask;
+    }
+    return slot;
+}
+
+void PackedStateRepository::resize_slots(size_t num_slots)
+{
+    m_slots.assign(num_slots, EMPTY_SLOT);
+
+    for (size_t state_index = 0; state_index < m_num_states; ++state_index)
+    {
+        m_slots[get_slot(get_packed_state(state_index))] = state_index;
+    }
+}
+
+Index PackedStateRepository::get_or_create_initial_state()
+{
+    auto& fluent_atoms = m_fluent_atoms_buffer;
+    fluent_atoms.unset_all();
+
+    for (const auto& literal : m_aag->get_problem()->get_fluent_initial_literals())
+    {
+        if (literal->is_negated())
+        {
+            throw std::runtime_error("negative literals in the initial state are not supported");
+        }
+
+        fluent_atoms.set(literal->get_atom()->get_index());
+    }
+
+    return get_or_create_state(fluent_atoms);
+}
+
+Index PackedStateRepository::get_or_create_state(const FlatBitset& fluent_atoms)
+{
+    m_encoder.encode(fluent_atoms, m_blocks_buffer);
+
+    /* 1. Retrieve cached state */
+
+    const auto slot = get_slot(m_blocks_buffer);
+    if (m_slots[slot] != EMPTY_SLOT)
+    {
+        return m_slots[slot];
+    }
+
+    /* 2. Cache state */
+
+    const auto state_index = static_cast<Index>(m_num_states++);
+    m_slots[slot] = state_index;
+    m_blocks.insert(m_blocks.end(), m_blocks_buffer.begin(), m_blocks_buffer.end());
+    m_reached_fluent_atoms |= fluent_atoms;
+
+    // Keep the load factor of the hash table below 1/2.
+    if (2 * m_num_states > m_slots.size())
+    {
+        resize_slots(2 * m_slots.size());
+    }
+
+    return state_index;
+}
+
+Index PackedStateRepository::get_or_create_successor_state(State state, GroundAction action)
+{
+    apply_action_effects(m_aag->get_problem(), state, action, m_fluent_atoms_buffer);
+
+    return get_or_create_state(m_fluent_atoms_buffer);
+}
+
+State PackedStateRepository::unpack_state(Index state_index, StateBuilder& out_state_builder) const
+{
+    out_state_builder.get_index() = state_index;
+
+    auto& fluent_state_atoms = out_state_builder.get_atoms<Fluent>();
+    m_encoder.decode(get_packed_state(state_index), fluent_state_atoms);
+
+    auto& derived_state_atoms = out_state_builder.get_atoms<Derived>();
+    derived_state_atoms.unset_all();
+
+    if (m_problem_or_domain_has_axioms)
+    {
+        m_aag->generate_and_apply_axioms(fluent_state_atoms, derived_state_atoms);
+    }
+
+    return State(out_state_builder.get_data());
+}
+
+std::span<const PackedBlock> PackedStateRepository::get_packed_state(Index state_index) const
+{
+    const auto num_blocks = m_encoder.get_num_blocks();
+    return std::span<const PackedBlock>(m_blocks.data() + state_index * num_blocks, num_blocks);
+}
+
+size_t PackedStateRepository::get_state_count() const { return m_num_states; }
+
+size_t PackedStateRepository::get_num_bytes_per_state() const { return m_encoder.get_num_blocks() * sizeof(PackedBlock); }
+
+size_t PackedStateRepository::get_num_bytes() const { return m_blocks.size() * sizeof(PackedBlock); }
+
+const FlatBitset& PackedStateRepository::get_reached_fluent_ground_atoms() const { return m_reached_fluent_atoms; }
+
+const PackedStateEncoder& PackedStateRepository::get_encoder() const { return m_encoder; }
+
+std::shared_ptr<GroundedApplicableActionGenerator> PackedStateRepository::get_aag() const { return m_aag; }
+
+}
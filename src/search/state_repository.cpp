@@ -24,6 +24,36 @@
 
 namespace mimir
 {
+void apply_action_effects(Problem problem, State state, GroundAction action, FlatBitset& out_fluent_atoms)
+{
+    // 1. Initialize non-extended state
+    out_fluent_atoms = state.get_atoms<Fluent>();
+
+    /* STRIPS effects*/
+    auto strips_action_effect = StripsActionEffect(action.get_strips_effect());
+    out_fluent_atoms -= strips_action_effect.get_negative_effects();
+    out_fluent_atoms |= strips_action_effect.get_positive_effects();
+    /* Conditional effects */
+    for (const auto& flat_conditional_effect : action.get_conditional_effects())
+    {
+        auto cond_effect_proxy = ConditionalEffect(flat_conditional_effect);
+
+        if (cond_effect_proxy.is_applicable(problem, state))
+        {
+            const auto simple_effect = cond_effect_proxy.get_simple_effect();
+
+            if (simple_effect.is_negated)
+            {
+                out_fluent_atoms.unset(simple_effect.atom_index);
+            }
+            else
+            {
+                out_fluent_atoms.set(simple_effect.atom_index);
+            }
+        }
+    }
+}
+
 StateRepository::StateRepository(std::shared_ptr<IApplicableActionGenerator> aag) :
     m_aag(std::move(aag)),
     m_problem_or_domain_has_axioms(!m_aag->get_problem()->get_axioms().empty() || !m_aag->get_problem()->get_domain()->get_axioms().empty()),
@@ -55,102 +85,57 @@ State StateRepository::get_or_create_state(const GroundAtomList<Fluent>& atoms)
 {
     /* Fetch member references for non extended construction. */
 
-    auto& state_index = m_state_builder.get_index();
     auto& fluent_state_atoms = m_state_builder.get_atoms<Fluent>();
     fluent_state_atoms.unset_all();
 
-    /* 1. Set state id */
-
-    int next_state_index = m_states.size();
-    state_index = next_state_index;
-
-    /* 2. Construct non-extended state */
+    /* 1. Construct non-extended state */
 
     for (const auto& atom : atoms)
     {
         fluent_state_atoms.set(atom->get_index());
     }
-    m_reached_fluent_atoms |= fluent_state_atoms;
-
-    /* 3. Retrieve cached extended state */
-
-    // Test whether there exists an extended state for the given non extended state
-    auto iter = m_states.find(m_state_builder.get_data());
-    if (iter != m_states.end())
-    {
-        return State(**iter);
-    }
-
-    /* Return early, if no axioms must be evaluated. */
-    if (!m_problem_or_domain_has_axioms)
-    {
-        auto [iter2, inserted] = m_states.insert(m_state_builder.get_data());
-        return State(**iter2);
-    }
 
-    /* Fetch member references for extended construction. */
+    return get_or_create_state_from_builder();
+}
 
-    auto& derived_state_atoms = m_state_builder.get_atoms<Derived>();
-    derived_state_atoms.unset_all();
+State StateRepository::get_or_create_state(const FlatBitset& fluent_atoms)
+{
+    /* 1. Construct non-extended state */
 
-    /* 4. Construct extended state by evaluating Axioms */
+    m_state_builder.get_atoms<Fluent>() = fluent_atoms;
 
-    m_aag->generate_and_apply_axioms(fluent_state_atoms, derived_state_atoms);
-    m_reached_derived_atoms |= derived_state_atoms;
+    return get_or_create_state_from_builder();
+}
 
-    /* 5. Cache extended state */
+State StateRepository::get_or_create_successor_state(State state, GroundAction action)
+{
+    /* 1. Construct non-extended state */
 
-    auto [iter2, inserted] = m_states.insert(m_state_builder.get_data());
+    compute_successor_fluent_atoms(state, action, m_state_builder.get_atoms<Fluent>());
 
-    /* 6. Return newly generated extended state */
+    return get_or_create_state_from_builder();
+}
 
-    return State(**iter2);
+void StateRepository::compute_successor_fluent_atoms(State state, GroundAction action, FlatBitset& out_fluent_atoms) const
+{
+    apply_action_effects(m_aag->get_problem(), state, action, out_fluent_atoms);
 }
 
-State StateRepository::get_or_create_successor_state(State state, GroundAction action)
+State StateRepository::get_or_create_state_from_builder()
 {
     /* Fetch member references for non extended construction. */
 
     auto& state_index = m_state_builder.get_index();
     auto& fluent_state_atoms = m_state_builder.get_atoms<Fluent>();
-    fluent_state_atoms.unset_all();
-
-    // 1. Initialize non-extended state
-    fluent_state_atoms = state.get_atoms<Fluent>();
 
-    /* 2. Set state id */
+    /* 1. Set state id */
 
     int next_state_index = m_states.size();
     state_index = next_state_index;
 
-    /* 3. Construct non-extended state */
-
-    /* STRIPS effects*/
-    auto strips_action_effect = StripsActionEffect(action.get_strips_effect());
-    fluent_state_atoms -= strips_action_effect.get_negative_effects();
-    fluent_state_atoms |= strips_action_effect.get_positive_effects();
-    /* Conditional effects */
-    for (const auto& flat_conditional_effect : action.get_conditional_effects())
-    {
-        auto cond_effect_proxy = ConditionalEffect(flat_conditional_effect);
-
-        if (cond_effect_proxy.is_applicable(m_aag->get_problem(), state))
-        {
-            const auto simple_effect = cond_effect_proxy.get_simple_effect();
-
-            if (simple_effect.is_negated)
-            {
-                fluent_state_atoms.unset(simple_effect.atom_index);
-            }
-            else
-            {
-                fluent_state_atoms.set(simple_effect.atom_index);
-            }
-        }
-    }
     m_reached_fluent_atoms |= fluent_state_atoms;
 
-    /* 4. Retrieve cached extended state */
+    /* 2. Retrieve cached extended state */
 
     // Test whether there exists an extended state for the given non extended state
     auto iter = m_states.find(m_state_builder.get_data());
@@ -171,22 +156,24 @@ State StateRepository::get_or_create_successor_state(State state, GroundAction a
     auto& derived_state_atoms = m_state_builder.get_atoms<Derived>();
     derived_state_atoms.unset_all();
 
-    /* 5. Construct extended state by evaluating Axioms */
+    /* 3. Construct extended state by evaluating Axioms */
 
     m_aag->generate_and_apply_axioms(fluent_state_atoms, derived_state_atoms);
     m_reached_derived_atoms |= derived_state_atoms;
 
-    /* 6. Cache extended state */
+    /* 4. Cache extended state */
 
     auto [iter2, inserted] = m_states.insert(m_state_builder.get_data());
 
-    /* 7. Return newly generated extended state */
+    /* 5. Return newly generated extended state */
 
     return State(**iter2);
 }
 
 size_t StateRepository::get_state_count() const { return m_states.size(); }
 
+size_t StateRepository::get_num_bytes() const { return m_states.num_bytes(); }
+
 const FlatBitset& StateRepository::get_reached_fluent_ground_atoms() const { return m_reached_fluent_atoms; }
 
 const FlatBitset& StateRepository::get_reached_derived_ground_atoms() const { return m_reached_derived_atoms; }
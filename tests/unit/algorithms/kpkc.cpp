@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "mimir/algorithms/kpkc.hpp"
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <random>
+
+namespace mimir::tests
+{
+
+/// @brief Create a random k-partite graph with consecutive vertex indices per partition.
+static std::pair<std::vector<boost::dynamic_bitset<>>, std::vector<std::vector<size_t>>>
+create_random_k_partite_graph(size_t k, size_t partition_size, double edge_probability, std::mt19937& rng)
+{
+    auto partitions = std::vector<std::vector<size_t>>(k);
+    for (size_t vertex = 0; vertex < k * partition_size; ++vertex)
+    {
+        partitions[vertex / partition_size].push_back(vertex);
+    }
+
+    auto distribution = std::bernoulli_distribution(edge_probability);
+    auto adjacency_matrix = std::vector<boost::dynamic_bitset<>>(k * partition_size, boost::dynamic_bitset<>(k * partition_size));
+    for (size_t source = 0; source < k * partition_size; ++source)
+    {
+        for (size_t target = source + 1; target < k * partition_size; ++target)
+        {
+            if (source / partition_size != target / partition_size && distribution(rng))
+            {
+                adjacency_matrix[source][target] = 1;
+                adjacency_matrix[target][source] = 1;
+            }
+        }
+    }
+
+    return { std::move(adjacency_matrix), std::move(partitions) };
+}
+
+static std::vector<std::vector<size_t>> normalize(std::vector<std::vector<size_t>> cliques)
+{
+    for (auto& clique : cliques)
+    {
+        std::sort(clique.begin(), clique.end());
+    }
+    std::sort(cliques.begin(), cliques.end());
+    return cliques;
+}
+
+TEST(MimirTests, AlgorithmsKPKCTest)
+{
+    auto rng = std::mt19937(42);
+
+    for (const auto instruction_set : { KPKCInstructionSet::SCALAR, KPKCInstructionSet::AVX2, KPKCInstructionSet::AVX512 })
+    {
+        if (!is_supported(instruction_set))
+        {
+            continue;
+        }
+
+        for (const auto& [k, partition_size, edge_probability] :
+             std::vector<std::tuple<size_t, size_t, double>> { { 1, 5, 0.0 }, { 2, 3, 0.5 }, { 3, 70, 0.3 }, { 4, 20, 0.6 }, { 5, 130, 0.1 } })
+        {
+            const auto [adjacency_matrix, partitions] = create_random_k_partite_graph(k, partition_size, edge_probability, rng);
+
+            auto expected_cliques = std::vector<std::vector<size_t>> {};
+            find_all_k_cliques_in_k_partite_graph(adjacency_matrix, partitions, expected_cliques);
+
+            auto graph = KPartiteGraph(partitions, instruction_set);
+            // Reuse the graph to check that reset removes all edges.
+            graph.add_edge(0, adjacency_matrix.size() - 1);
+            graph.reset();
+            for (size_t source = 0; source < adjacency_matrix.size(); ++source)
+            {
+                for (auto target = adjacency_matrix[source].find_first(); target < adjacency_matrix[source].size();
+                     target = adjacency_matrix[source].find_next(target))
+                {
+                    graph.add_edge(source, target);
+                }
+            }
+            auto cliques = std::vector<std::vector<size_t>> {};
+            graph.find_all_k_cliques(cliques);
+
+            EXPECT_EQ(normalize(cliques), normalize(expected_cliques));
+        }
+    }
+}
+
+}
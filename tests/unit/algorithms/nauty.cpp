@@ -48,4 +48,66 @@ TEST(MimirTests, AlgorithmsNautySparseGraphConstructorEmptyTest)
     EXPECT_NO_THROW(graph.add_vertex_coloring({ 0, 0 }));
 }
 
+TEST(MimirTests, AlgorithmsNautyDenseGraphCertificateTest)
+{
+    auto graph = nauty_wrapper::DenseGraph(3);
+    graph.add_edge(0, 1);
+    graph.add_edge(1, 2);
+    graph.add_vertex_coloring({ 0, 0, 0 });
+    const auto path_certificate = graph.compute_certificate();
+
+    // The certificate consists of the degrees followed by the adjacency lists.
+    EXPECT_EQ(path_certificate.size(), 3 + 2);
+
+    // Isomorphic path with permuted vertices and a duplicate edge.
+    graph.clear(3);
+    graph.add_edge(2, 0);
+    graph.add_edge(0, 1);
+    graph.add_edge(0, 1);
+    graph.add_vertex_coloring({ 0, 0, 0 });
+    EXPECT_EQ(graph.compute_certificate(), path_certificate);
+
+    // Non-isomorphic star.
+    graph.clear(3);
+    graph.add_edge(0, 1);
+    graph.add_edge(0, 2);
+    graph.add_vertex_coloring({ 0, 0, 0 });
+    EXPECT_NE(graph.compute_certificate(), path_certificate);
+}
+
+TEST(MimirTests, AlgorithmsNautySparseGraphCertificateTest)
+{
+    auto graph = nauty_wrapper::SparseGraph(3);
+    graph.add_edge(0, 1);
+    graph.add_edge(1, 2);
+    graph.add_vertex_coloring({ 0, 0, 0 });
+    const auto path_certificate = graph.compute_certificate();
+
+    // The certificate consists of the degrees followed by the adjacency lists.
+    EXPECT_EQ(path_certificate.size(), 3 + 2);
+
+    // Isomorphic path with permuted vertices and a duplicate edge.
+    graph.clear(3);
+    graph.add_edge(2, 0);
+    graph.add_edge(0, 1);
+    graph.add_edge(0, 1);
+    graph.add_vertex_coloring({ 0, 0, 0 });
+    EXPECT_EQ(graph.compute_certificate(), path_certificate);
+
+    // Non-isomorphic star.
+    graph.clear(3);
+    graph.add_edge(0, 1);
+    graph.add_edge(0, 2);
+    graph.add_vertex_coloring({ 0, 0, 0 });
+    EXPECT_NE(graph.compute_certificate(), path_certificate);
+
+    // Reuse the memory for a larger graph.
+    graph.clear(4);
+    graph.add_edge(3, 2);
+    graph.add_edge(2, 1);
+    graph.add_edge(1, 0);
+    graph.add_vertex_coloring({ 0, 0, 0, 0 });
+    EXPECT_EQ(graph.compute_certificate().size(), 4 + 3);
+}
+
 }
@@ -125,6 +125,52 @@ TEST(MimirTests, GraphsTupleGraphTest)
     EXPECT_EQ(tuple_graphs_2_pruned.at(7).get_states_grouped_by_distance().size(), 4);
 }
 
+TEST(MimirTests, GraphsTupleGraphCreateAllTest)
+{
+    const auto domain_file = fs::path(std::string(DATA_DIR) + "gripper/domain.pddl");
+    const auto problem_file = fs::path(std::string(DATA_DIR) + "gripper/p-1-0.pddl");
+
+    const auto state_space = std::make_shared<StateSpace>(std::move(StateSpace::create(domain_file, problem_file).value()));
+
+    auto states = StateList {};
+    for (const auto& vertex : state_space->get_graph().get_vertices())
+    {
+        states.push_back(get_state(vertex));
+    }
+
+    for (const auto arity : { 0, 1, 2 })
+    {
+        for (const auto prune_dominated_tuples : { false, true })
+        {
+            auto tuple_graph_factory = TupleGraphFactory(state_space, arity, prune_dominated_tuples);
+
+            const auto tuple_graphs = tuple_graph_factory.create_all(states, 4);
+
+            ASSERT_EQ(tuple_graphs.size(), states.size());
+            for (size_t i = 0; i < states.size(); ++i)
+            {
+                // Layers computed in parallel must result in the same tuple graph as the batch computation.
+                const auto tuple_graph = tuple_graph_factory.create(states.at(i), 2);
+
+                EXPECT_EQ(tuple_graphs.at(i).get_root_state(), states.at(i));
+                EXPECT_EQ(tuple_graphs.at(i).get_digraph().get_num_vertices(), tuple_graph.get_digraph().get_num_vertices());
+                EXPECT_EQ(tuple_graphs.at(i).get_digraph().get_num_edges(), tuple_graph.get_digraph().get_num_edges());
+                EXPECT_EQ(tuple_graphs.at(i).get_vertices_grouped_by_distance().size(), tuple_graph.get_vertices_grouped_by_distance().size());
+                EXPECT_EQ(tuple_graphs.at(i).get_states_grouped_by_vertex().size(), tuple_graph.get_digraph().get_num_vertices());
+                EXPECT_EQ(tuple_graphs.at(i).get_states_grouped_by_vertex().data().size(), tuple_graph.get_states_grouped_by_vertex().data().size());
+
+                for (const auto group : tuple_graphs.at(i).get_vertices_grouped_by_distance())
+                {
+                    for (const auto& vertex : group)
+                    {
+                        EXPECT_EQ(vertex.get_states().size(), tuple_graphs.at(i).get_states_grouped_by_vertex().at(vertex.get_index()).size());
+                    }
+                }
+            }
+        }
+    }
+}
+
 TEST(MimirTests, GraphsTupleGraphAdmissibleChainTest)
 {
     const auto domain_file = fs::path(std::string(DATA_DIR) + "visitall/domain.pddl");
@@ -0,0 +1,120 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "mimir/search/algorithms/bfws.hpp"
+
+#include "mimir/formalism/parser.hpp"
+#include "mimir/search/algorithms/bfws/event_handlers.hpp"
+#include "mimir/search/applicable_action_generators.hpp"
+#include "mimir/search/applicable_action_generators/grounded/event_handlers.hpp"
+#include "mimir/search/applicable_action_generators/lifted/event_handlers.hpp"
+#include "mimir/search/heuristics.hpp"
+#include "mimir/search/plan.hpp"
+#include "mimir/search/planners/single.hpp"
+#include "mimir/search/state_repository.hpp"
+
+#include <gtest/gtest.h>
+
+namespace mimir::tests
+{
+
+/**
+ * Gripper
+ */
+
+TEST(MimirTests, SearchAlgorithmsBFWSGroundedGripperTest)
+{
+    const auto domain_file = fs::path(std::string(DATA_DIR) + "gripper/domain.pddl");
+    const auto problem_file = fs::path(std::string(DATA_DIR) + "gripper/test_problem.pddl");
+    auto parser = PDDLParser(domain_file, problem_file);
+    auto aag_event_handler = std::make_shared<DefaultGroundedApplicableActionGeneratorEventHandler>();
+    auto aag = std::make_shared<GroundedApplicableActionGenerator>(parser.get_problem(), parser.get_pddl_factories(), aag_event_handler);
+    auto ssg = std::make_shared<StateRepository>(aag);
+    auto bfws_event_handler = std::make_shared<DefaultBFWSAlgorithmEventHandler>();
+    auto bfws = std::make_shared<BFWSAlgorithm>(aag, ssg, nullptr, bfws_event_handler);
+    auto planner = SinglePlanner(bfws);
+    auto [search_status, plan] = planner.find_solution();
+
+    EXPECT_EQ(search_status, SearchStatus::SOLVED);
+    EXPECT_EQ(plan.get_actions().size(), 3);
+
+    const auto& bfws_statistics = bfws_event_handler->get_statistics();
+
+    // The start state, its five successors, the goal state and the six states reached by two actions from the start state
+    // that are evaluated before the goal state is generated. Only the latter have a novel pair but no novel atom.
+    EXPECT_EQ(bfws_statistics.get_num_evaluated(), 13);
+    EXPECT_EQ(bfws_statistics.get_num_evaluated_by_novelty().at(1), 7);
+    EXPECT_EQ(bfws_statistics.get_num_evaluated_by_novelty().at(2), 6);
+    // There is one novelty table for each goal count.
+    EXPECT_EQ(bfws_statistics.get_num_created_novelty_tables(), bfws_statistics.get_goal_counts().size());
+    EXPECT_EQ(bfws_statistics.get_num_evicted_novelty_tables(), 0);
+    EXPECT_EQ(bfws_statistics.get_goal_counts().back(), 0);
+}
+
+TEST(MimirTests, SearchAlgorithmsBFWSGroundedHFFGripperTest)
+{
+    const auto domain_file = fs::path(std::string(DATA_DIR) + "gripper/domain.pddl");
+    const auto problem_file = fs::path(std::string(DATA_DIR) + "gripper/test_problem.pddl");
+    auto parser = PDDLParser(domain_file, problem_file);
+    auto aag_event_handler = std::make_shared<DefaultGroundedApplicableActionGeneratorEventHandler>();
+    auto aag = std::make_shared<GroundedApplicableActionGenerator>(parser.get_problem(), parser.get_pddl_factories(), aag_event_handler);
+    auto ssg = std::make_shared<StateRepository>(aag);
+    auto bfws_event_handler = std::make_shared<DefaultBFWSAlgorithmEventHandler>();
+    auto hff = std::make_shared<HFFHeuristic>(aag);
+    auto bfws = std::make_shared<BFWSAlgorithm>(aag, ssg, hff, bfws_event_handler);
+    auto planner = SinglePlanner(bfws);
+    auto [search_status, plan] = planner.find_solution();
+
+    EXPECT_EQ(search_status, SearchStatus::SOLVED);
+    EXPECT_EQ(plan.get_actions().size(), 3);
+
+    const auto& bfws_statistics = bfws_event_handler->get_statistics();
+
+    // The partitions are refined by the number of achieved relaxed plan atoms,
+    // which are 0, 1 and 2 for one unsatisfied goal and 0 for the goal state.
+    EXPECT_EQ(bfws_statistics.get_num_created_novelty_tables(), 4);
+    EXPECT_GT(bfws_statistics.get_peak_novelty_table_memory_usage(), 0);
+}
+
+TEST(MimirTests, SearchAlgorithmsBFWSLiftedEvictionGripperTest)
+{
+    const auto domain_file = fs::path(std::string(DATA_DIR) + "gripper/domain.pddl");
+    const auto problem_file = fs::path(std::string(DATA_DIR) + "gripper/test_problem.pddl");
+    auto parser = PDDLParser(domain_file, problem_file);
+    auto aag_event_handler = std::make_shared<DefaultLiftedApplicableActionGeneratorEventHandler>();
+    auto aag = std::make_shared<LiftedApplicableActionGenerator>(parser.get_problem(), parser.get_pddl_factories(), aag_event_handler);
+    auto ssg = std::make_shared<StateRepository>(aag);
+    auto bfws_event_handler = std::make_shared<DefaultBFWSAlgorithmEventHandler>();
+    auto options = BFWSAlgorithmOptions();
+    // Keep at most one novelty table.
+    options.max_novelty_table_memory_usage = 0;
+    auto bfws = std::make_shared<BFWSAlgorithm>(aag, ssg, nullptr, bfws_event_handler, options);
+    auto planner = SinglePlanner(bfws);
+    auto [search_status, plan] = planner.find_solution();
+
+    // Eviction only affects the order in which states are expanded.
+    EXPECT_EQ(search_status, SearchStatus::SOLVED);
+    EXPECT_EQ(plan.get_actions().size(), 3);
+
+    const auto& bfws_statistics = bfws_event_handler->get_statistics();
+
+    // The table of the goal state evicts the table of the states with one unsatisfied goal.
+    EXPECT_EQ(bfws_statistics.get_num_created_novelty_tables(), 2);
+    EXPECT_EQ(bfws_statistics.get_num_evicted_novelty_tables(), 1);
+}
+
+}
@@ -128,7 +128,6 @@ TEST(MimirTests, SearchAlgorithmsBrFSGroundedAssemblyTest)
     EXPECT_EQ(aag_statistics.get_num_nodes_in_action_match_tree(), 10);
 
     EXPECT_EQ(aag_statistics.get_num_ground_axioms(), 2);
-    EXPECT_EQ(aag_statistics.get_num_nodes_in_axiom_match_tree(), 2);
 
     const auto& brfs_statistics = brfs.get_algorithm_statistics();
 
@@ -179,7 +178,6 @@ TEST(MimirTests, SearchAlgorithmsBrFSGroundedAirportTest)
     EXPECT_EQ(aag_statistics.get_num_nodes_in_action_match_tree(), 138);
 
     EXPECT_EQ(aag_statistics.get_num_ground_axioms(), 420);
-    EXPECT_EQ(aag_statistics.get_num_nodes_in_axiom_match_tree(), 26);
 
     const auto& brfs_statistics = brfs.get_algorithm_statistics();
 
@@ -230,7 +228,6 @@ TEST(MimirTests, SearchAlgorithmsBrFSGroundedBarmanTest)
     EXPECT_EQ(aag_statistics.get_num_nodes_in_action_match_tree(), 237);
 
     EXPECT_EQ(aag_statistics.get_num_ground_axioms(), 0);
-    EXPECT_EQ(aag_statistics.get_num_nodes_in_axiom_match_tree(), 1);
 
     const auto& brfs_statistics = brfs.get_algorithm_statistics();
 
@@ -281,7 +278,6 @@ TEST(MimirTests, SearchAlgorithmsBrFSGroundedBlocks3opsTest)
     EXPECT_EQ(aag_statistics.get_num_nodes_in_action_match_tree(), 96);
 
     EXPECT_EQ(aag_statistics.get_num_ground_axioms(), 0);
-    EXPECT_EQ(aag_statistics.get_num_nodes_in_axiom_match_tree(), 1);
 
     const auto& brfs_statistics = brfs.get_algorithm_statistics();
 
@@ -332,7 +328,6 @@ TEST(MimirTests, SearchAlgorithmsBrFSGroundedBlocks4opsTest)
     EXPECT_EQ(aag_statistics.get_num_nodes_in_action_match_tree(), 72);
 
     EXPECT_EQ(aag_statistics.get_num_ground_axioms(), 0);
-    EXPECT_EQ(aag_statistics.get_num_nodes_in_axiom_match_tree(), 1);
 
     const auto& brfs_statistics = brfs.get_algorithm_statistics();
 
@@ -384,7 +379,6 @@ TEST(MimirTests, SearchAlgorithmsBrFSGroundedChildsnackTest)
     EXPECT_EQ(aag_statistics.get_num_nodes_in_action_match_tree(), 12);
 
     EXPECT_EQ(aag_statistics.get_num_ground_axioms(), 0);
-    EXPECT_EQ(aag_statistics.get_num_nodes_in_axiom_match_tree(), 1);
 
     const auto& brfs_statistics = brfs.get_algorithm_statistics();
 
@@ -435,7 +429,6 @@ TEST(MimirTests, SearchAlgorithmsBrFSGroundedDeliveryTest)
     EXPECT_EQ(aag_statistics.get_num_nodes_in_action_match_tree(), 32);
 
     EXPECT_EQ(aag_statistics.get_num_ground_axioms(), 0);
-    EXPECT_EQ(aag_statistics.get_num_nodes_in_axiom_match_tree(), 1);
 
     const auto& brfs_statistics = brfs.get_algorithm_statistics();
 
@@ -486,7 +479,6 @@ TEST(MimirTests, SearchAlgorithmsBrFSGroundedDriverlogTest)
     EXPECT_EQ(aag_statistics.get_num_nodes_in_action_match_tree(), 28);
 
     EXPECT_EQ(aag_statistics.get_num_ground_axioms(), 0);
-    EXPECT_EQ(aag_statistics.get_num_nodes_in_axiom_match_tree(), 1);
 
     const auto& brfs_statistics = brfs.get_algorithm_statistics();
 
@@ -537,7 +529,6 @@ TEST(MimirTests, SearchAlgorithmsBrFSGroundedFerryTest)
     EXPECT_EQ(aag_statistics.get_num_nodes_in_action_match_tree(), 30);
 
     EXPECT_EQ(aag_statistics.get_num_ground_axioms(), 0);
-    EXPECT_EQ(aag_statistics.get_num_nodes_in_axiom_match_tree(), 1);
 
     const auto& brfs_statistics = brfs.get_algorithm_statistics();
 
@@ -588,7 +579,6 @@ TEST(MimirTests, SearchAlgorithmsBrFSGroundedGridTest)
     EXPECT_EQ(aag_statistics.get_num_nodes_in_action_match_tree(), 88);
 
     EXPECT_EQ(aag_statistics.get_num_ground_axioms(), 0);
-    EXPECT_EQ(aag_statistics.get_num_nodes_in_axiom_match_tree(), 1);
 
     const auto& brfs_statistics = brfs.get_algorithm_statistics();
 
@@ -639,7 +629,6 @@ TEST(MimirTests, SearchAlgorithmsBrFSGroundedGripperTest)
     EXPECT_EQ(aag_statistics.get_num_nodes_in_action_match_tree(), 48);
 
     EXPECT_EQ(aag_statistics.get_num_ground_axioms(), 0);
-    EXPECT_EQ(aag_statistics.get_num_nodes_in_axiom_match_tree(), 1);
 
     const auto& brfs_statistics = brfs.get_algorithm_statistics();
 
@@ -690,7 +679,6 @@ TEST(MimirTests, SearchAlgorithmsBrFSGroundedHikingTest)
     EXPECT_EQ(aag_statistics.get_num_nodes_in_action_match_tree(), 60);
 
     EXPECT_EQ(aag_statistics.get_num_ground_axioms(), 0);
-    EXPECT_EQ(aag_statistics.get_num_nodes_in_axiom_match_tree(), 1);
 
     const auto& brfs_statistics = brfs.get_algorithm_statistics();
 
@@ -741,7 +729,6 @@ TEST(MimirTests, SearchAlgorithmsBrFSGroundedLogisticsTest)
     EXPECT_EQ(aag_statistics.get_num_nodes_in_action_match_tree(), 26);
 
     EXPECT_EQ(aag_statistics.get_num_ground_axioms(), 0);
-    EXPECT_EQ(aag_statistics.get_num_nodes_in_axiom_match_tree(), 1);
 
     const auto& brfs_statistics = brfs.get_algorithm_statistics();
 
@@ -792,7 +779,6 @@ TEST(MimirTests, SearchAlgorithmsBrFSGroundedMiconicTest)
     EXPECT_EQ(aag_statistics.get_num_nodes_in_action_match_tree(), 14);
 
     EXPECT_EQ(aag_statistics.get_num_ground_axioms(), 0);
-    EXPECT_EQ(aag_statistics.get_num_nodes_in_axiom_match_tree(), 1);
 
     const auto& brfs_statistics = brfs.get_algorithm_statistics();
 
@@ -844,7 +830,6 @@ TEST(MimirTests, SearchAlgorithmsBrFSGroundedMiconicFullAdlTest)
     EXPECT_EQ(aag_statistics.get_num_nodes_in_action_match_tree(), 12);
 
     EXPECT_EQ(aag_statistics.get_num_ground_axioms(), 16);
-    EXPECT_EQ(aag_statistics.get_num_nodes_in_axiom_match_tree(), 12);
 
     const auto& brfs_statistics = brfs.get_algorithm_statistics();
 
@@ -897,7 +882,6 @@ TEST(MimirTests, SearchAlgorithmsBrFSGroundedMiconicSimpleAdlTest)
     EXPECT_EQ(aag_statistics.get_num_nodes_in_action_match_tree(), 4);
 
     EXPECT_EQ(aag_statistics.get_num_ground_axioms(), 0);
-    EXPECT_EQ(aag_statistics.get_num_nodes_in_axiom_match_tree(), 1);
 
     const auto& brfs_statistics = brfs.get_algorithm_statistics();
 
@@ -950,7 +934,6 @@ TEST(MimirTests, SearchAlgorithmsBrFSGroundedPhilosophersTest)
     EXPECT_EQ(aag_statistics.get_num_nodes_in_action_match_tree(), 132);
 
     EXPECT_EQ(aag_statistics.get_num_ground_axioms(), 34);
-    EXPECT_EQ(aag_statistics.get_num_nodes_in_axiom_match_tree(), 94);
 
     const auto& brfs_statistics = brfs.get_algorithm_statistics();
 
@@ -1002,7 +985,6 @@ TEST(MimirTests, SearchAlgorithmsBrFSGroundedRewardTest)
     EXPECT_EQ(aag_statistics.get_num_nodes_in_action_match_tree(), 10);
 
     EXPECT_EQ(aag_statistics.get_num_ground_axioms(), 0);
-    EXPECT_EQ(aag_statistics.get_num_nodes_in_axiom_match_tree(), 1);
 
     const auto& brfs_statistics = brfs.get_algorithm_statistics();
 
@@ -1053,7 +1035,6 @@ TEST(MimirTests, SearchAlgorithmsBrFSGroundedRoversTest)
     EXPECT_EQ(aag_statistics.get_num_nodes_in_action_match_tree(), 17);
 
     EXPECT_EQ(aag_statistics.get_num_ground_axioms(), 0);
-    EXPECT_EQ(aag_statistics.get_num_nodes_in_axiom_match_tree(), 1);
 
     const auto& brfs_statistics = brfs.get_algorithm_statistics();
 
@@ -1104,7 +1085,6 @@ TEST(MimirTests, SearchAlgorithmsBrFSGroundedSatelliteTest)
     EXPECT_EQ(aag_statistics.get_num_nodes_in_action_match_tree(), 21);
 
     EXPECT_EQ(aag_statistics.get_num_ground_axioms(), 0);
-    EXPECT_EQ(aag_statistics.get_num_nodes_in_axiom_match_tree(), 1);
 
     const auto& brfs_statistics = brfs.get_algorithm_statistics();
 
@@ -1155,7 +1135,6 @@ TEST(MimirTests, SearchAlgorithmsBrFSGroundedScheduleTest)
     EXPECT_EQ(aag_statistics.get_num_nodes_in_action_match_tree(), 144);
 
     EXPECT_EQ(aag_statistics.get_num_ground_axioms(), 0);
-    EXPECT_EQ(aag_statistics.get_num_nodes_in_axiom_match_tree(), 1);
 
     const auto& brfs_statistics = brfs.get_algorithm_statistics();
 
@@ -1206,7 +1185,6 @@ TEST(MimirTests, SearchAlgorithmsBrFSGroundedSpannerTest)
     EXPECT_EQ(aag_statistics.get_num_nodes_in_action_match_tree(), 12);
 
     EXPECT_EQ(aag_statistics.get_num_ground_axioms(), 0);
-    EXPECT_EQ(aag_statistics.get_num_nodes_in_axiom_match_tree(), 1);
 
     const auto& brfs_statistics = brfs.get_algorithm_statistics();
 
@@ -1257,7 +1235,6 @@ TEST(MimirTests, SearchAlgorithmsBrFSGroundedTransportTest)
     EXPECT_EQ(aag_statistics.get_num_nodes_in_action_match_tree(), 246);
 
     EXPECT_EQ(aag_statistics.get_num_ground_axioms(), 0);
-    EXPECT_EQ(aag_statistics.get_num_nodes_in_axiom_match_tree(), 1);
 
     const auto& brfs_statistics = brfs.get_algorithm_statistics();
 
@@ -1308,7 +1285,6 @@ TEST(MimirTests, SearchAlgorithmsBrFSGroundedVisitallTest)
     EXPECT_EQ(aag_statistics.get_num_nodes_in_action_match_tree(), 14);
 
     EXPECT_EQ(aag_statistics.get_num_ground_axioms(), 0);
-    EXPECT_EQ(aag_statistics.get_num_nodes_in_axiom_match_tree(), 1);
 
     const auto& brfs_statistics = brfs.get_algorithm_statistics();
 
@@ -1360,7 +1336,6 @@ TEST(MimirTests, SearchAlgorithmsBrFSGroundedWoodworkingTest)
     EXPECT_EQ(aag_statistics.get_num_nodes_in_action_match_tree(), 112);
 
     EXPECT_EQ(aag_statistics.get_num_ground_axioms(), 0);
-    EXPECT_EQ(aag_statistics.get_num_nodes_in_axiom_match_tree(), 1);
 
     const auto& brfs_statistics = brfs.get_algorithm_statistics();
 
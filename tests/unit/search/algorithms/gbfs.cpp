@@ -0,0 +1,136 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "mimir/search/algorithms/gbfs.hpp"
+
+#include "mimir/formalism/parser.hpp"
+#include "mimir/search/algorithms/gbfs/event_handlers.hpp"
+#include "mimir/search/applicable_action_generators.hpp"
+#include "mimir/search/applicable_action_generators/grounded/event_handlers.hpp"
+#include "mimir/search/applicable_action_generators/lifted/event_handlers.hpp"
+#include "mimir/search/heuristics.hpp"
+#include "mimir/search/plan.hpp"
+#include "mimir/search/planners/single.hpp"
+#include "mimir/search/state_repository.hpp"
+
+#include <gtest/gtest.h>
+
+namespace mimir::tests
+{
+
+/**
+ * Gripper
+ */
+
+TEST(MimirTests, SearchAlgorithmsGBFSGroundedEagerHFFGripperTest)
+{
+    const auto domain_file = fs::path(std::string(DATA_DIR) + "gripper/domain.pddl");
+    const auto problem_file = fs::path(std::string(DATA_DIR) + "gripper/test_problem.pddl");
+    auto parser = PDDLParser(domain_file, problem_file);
+    auto aag_event_handler = std::make_shared<DefaultGroundedApplicableActionGeneratorEventHandler>();
+    auto aag = std::make_shared<GroundedApplicableActionGenerator>(parser.get_problem(), parser.get_pddl_factories(), aag_event_handler);
+    auto ssg = std::make_shared<StateRepository>(aag);
+    auto gbfs_event_handler = std::make_shared<DefaultGBFSAlgorithmEventHandler>();
+    auto hff = std::make_shared<HFFHeuristic>(aag);
+    auto gbfs = std::make_shared<GBFSAlgorithm>(aag, ssg, hff, gbfs_event_handler);
+    auto planner = SinglePlanner(gbfs);
+    auto [search_status, plan] = planner.find_solution();
+
+    EXPECT_EQ(search_status, SearchStatus::SOLVED);
+    // Greedy best-first search is not optimal in general.
+    EXPECT_GE(plan.get_actions().size(), 3);
+
+    const auto& gbfs_statistics = gbfs_event_handler->get_statistics();
+
+    // Eager evaluation evaluates the start state and each new generated state once.
+    EXPECT_GT(gbfs_statistics.get_num_evaluated(), 0);
+    EXPECT_LE(gbfs_statistics.get_num_evaluated(), gbfs_statistics.get_num_generated() + 1);
+    EXPECT_EQ(gbfs_statistics.get_h_values().front(), 3.);
+}
+
+TEST(MimirTests, SearchAlgorithmsGBFSGroundedLazyPreferredHFFGripperTest)
+{
+    const auto domain_file = fs::path(std::string(DATA_DIR) + "gripper/domain.pddl");
+    const auto problem_file = fs::path(std::string(DATA_DIR) + "gripper/test_problem.pddl");
+    auto parser = PDDLParser(domain_file, problem_file);
+    auto aag_event_handler = std::make_shared<DefaultGroundedApplicableActionGeneratorEventHandler>();
+    auto aag = std::make_shared<GroundedApplicableActionGenerator>(parser.get_problem(), parser.get_pddl_factories(), aag_event_handler);
+    auto ssg = std::make_shared<StateRepository>(aag);
+    auto gbfs_event_handler = std::make_shared<DefaultGBFSAlgorithmEventHandler>();
+    auto hff = std::make_shared<HFFHeuristic>(aag);
+    auto options = GBFSAlgorithmOptions();
+    options.evaluation = HeuristicEvaluation::LAZY;
+    options.use_preferred_actions = true;
+    auto gbfs = std::make_shared<GBFSAlgorithm>(aag, ssg, hff, gbfs_event_handler, options);
+    auto planner = SinglePlanner(gbfs);
+    auto [search_status, plan] = planner.find_solution();
+
+    EXPECT_EQ(search_status, SearchStatus::SOLVED);
+    // Greedy best-first search is not optimal in general.
+    EXPECT_GE(plan.get_actions().size(), 3);
+
+    const auto& gbfs_statistics = gbfs_event_handler->get_statistics();
+
+    // Lazy evaluation only generates and evaluates the successors that are removed from the open list.
+    EXPECT_LE(gbfs_statistics.get_num_evaluated(), gbfs_statistics.get_num_generated() + 1);
+    EXPECT_LE(gbfs_statistics.get_num_expanded(), gbfs_statistics.get_num_evaluated());
+}
+
+TEST(MimirTests, SearchAlgorithmsGBFSLiftedLazyHAddGripperTest)
+{
+    const auto domain_file = fs::path(std::string(DATA_DIR) + "gripper/domain.pddl");
+    const auto problem_file = fs::path(std::string(DATA_DIR) + "gripper/test_problem.pddl");
+    auto parser = PDDLParser(domain_file, problem_file);
+    auto aag_event_handler = std::make_shared<DefaultLiftedApplicableActionGeneratorEventHandler>();
+    auto aag = std::make_shared<LiftedApplicableActionGenerator>(parser.get_problem(), parser.get_pddl_factories(), aag_event_handler);
+    auto ssg = std::make_shared<StateRepository>(aag);
+    auto gbfs_event_handler = std::make_shared<DefaultGBFSAlgorithmEventHandler>();
+    auto hadd = std::make_shared<LiftedHAddHeuristic>(aag);
+    auto options = GBFSAlgorithmOptions();
+    options.evaluation = HeuristicEvaluation::LAZY;
+    auto gbfs = std::make_shared<GBFSAlgorithm>(aag, ssg, hadd, gbfs_event_handler, options);
+    auto planner = SinglePlanner(gbfs);
+    auto [search_status, plan] = planner.find_solution();
+
+    EXPECT_EQ(search_status, SearchStatus::SOLVED);
+    // Greedy best-first search is not optimal in general.
+    EXPECT_GE(plan.get_actions().size(), 3);
+}
+
+TEST(MimirTests, SearchAlgorithmsGBFSGroundedWeightedAStarBlindGripperTest)
+{
+    const auto domain_file = fs::path(std::string(DATA_DIR) + "gripper/domain.pddl");
+    const auto problem_file = fs::path(std::string(DATA_DIR) + "gripper/test_problem.pddl");
+    auto parser = PDDLParser(domain_file, problem_file);
+    auto aag_event_handler = std::make_shared<DefaultGroundedApplicableActionGeneratorEventHandler>();
+    auto aag = std::make_shared<GroundedApplicableActionGenerator>(parser.get_problem(), parser.get_pddl_factories(), aag_event_handler);
+    auto ssg = std::make_shared<StateRepository>(aag);
+    auto gbfs_event_handler = std::make_shared<DefaultGBFSAlgorithmEventHandler>();
+    auto blind = std::make_shared<BlindHeuristic>();
+    auto options = GBFSAlgorithmOptions();
+    options.g_weight = 1.;
+    options.h_weight = 2.;
+    auto gbfs = std::make_shared<GBFSAlgorithm>(aag, ssg, blind, gbfs_event_handler, options);
+    auto planner = SinglePlanner(gbfs);
+    auto [search_status, plan] = planner.find_solution();
+
+    // With the blind heuristic, weighted A* is uniform cost search and finds an optimal plan.
+    EXPECT_EQ(search_status, SearchStatus::SOLVED);
+    EXPECT_EQ(plan.get_actions().size(), 3);
+}
+
+}
@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "mimir/search/algorithms/hdastar.hpp"
+
+#include "mimir/formalism/parser.hpp"
+#include "mimir/search/algorithms/hdastar/event_handlers.hpp"
+#include "mimir/search/applicable_action_generators.hpp"
+#include "mimir/search/applicable_action_generators/grounded/event_handlers.hpp"
+#include "mimir/search/heuristics.hpp"
+#include "mimir/search/plan.hpp"
+#include "mimir/search/planners/single.hpp"
+#include "mimir/search/state_repository.hpp"
+
+#include <gtest/gtest.h>
+
+namespace mimir::tests
+{
+
+/**
+ * Gripper
+ */
+
+TEST(MimirTests, SearchAlgorithmsHDAStarGroundedBlindGripperTest)
+{
+    const auto domain_file = fs::path(std::string(DATA_DIR) + "gripper/domain.pddl");
+    const auto problem_file = fs::path(std::string(DATA_DIR) + "gripper/test_problem.pddl");
+    auto parser = PDDLParser(domain_file, problem_file);
+    auto aag_event_handler = std::make_shared<DefaultGroundedApplicableActionGeneratorEventHandler>();
+    auto aag = std::make_shared<GroundedApplicableActionGenerator>(parser.get_problem(), parser.get_pddl_factories(), aag_event_handler);
+    auto hdastar_event_handler = std::make_shared<DefaultHDAStarAlgorithmEventHandler>();
+    auto options = HDAStarAlgorithmOptions();
+    options.num_threads = 4;
+    auto hdastar = std::make_shared<HDAStarAlgorithm>(aag, [] { return std::make_shared<BlindHeuristic>(); }, hdastar_event_handler, options);
+    auto planner = SinglePlanner(hdastar);
+    auto [search_status, plan] = planner.find_solution();
+
+    EXPECT_EQ(search_status, SearchStatus::SOLVED);
+    EXPECT_EQ(plan.get_actions().size(), 3);
+
+    const auto& hdastar_statistics = hdastar_event_handler->get_statistics();
+
+    EXPECT_EQ(hdastar_statistics.get_worker_statistics().size(), 4);
+    EXPECT_GT(hdastar_statistics.get_num_expanded(), 0);
+}
+
+/**
+ * Driverlog
+ */
+
+TEST(MimirTests, SearchAlgorithmsHDAStarGroundedHMaxDriverlogTest)
+{
+    const auto domain_file = fs::path(std::string(DATA_DIR) + "driverlog/domain.pddl");
+    const auto problem_file = fs::path(std::string(DATA_DIR) + "driverlog/test_problem.pddl");
+    auto parser = PDDLParser(domain_file, problem_file);
+    auto aag_event_handler = std::make_shared<DefaultGroundedApplicableActionGeneratorEventHandler>();
+    auto aag = std::make_shared<GroundedApplicableActionGenerator>(parser.get_problem(), parser.get_pddl_factories(), aag_event_handler);
+
+    // The plan must be optimal for any number of workers.
+    for (const size_t num_threads : { 1, 2, 3, 8 })
+    {
+        auto options = HDAStarAlgorithmOptions();
+        options.num_threads = num_threads;
+        options.message_batch_size = 1;
+        auto hdastar = std::make_shared<HDAStarAlgorithm>(aag, [aag] { return std::make_shared<HMaxHeuristic>(aag); }, options);
+        auto planner = SinglePlanner(hdastar);
+        auto [search_status, plan] = planner.find_solution();
+
+        EXPECT_EQ(search_status, SearchStatus::SOLVED);
+        EXPECT_EQ(plan.get_actions().size(), 9);
+    }
+}
+
+}
@@ -21,6 +21,7 @@
 #include "mimir/formalism/parser.hpp"
 #include "mimir/search/algorithms/brfs/event_handlers.hpp"
 #include "mimir/search/algorithms/iw/event_handlers.hpp"
+#include "mimir/search/algorithms/iw/novelty_table_backends.hpp"
 #include "mimir/search/algorithms/iw/tuple_index_generators.hpp"
 #include "mimir/search/algorithms/iw/tuple_index_mapper.hpp"
 #include "mimir/search/applicable_action_generators.hpp"
@@ -29,7 +30,9 @@
 #include "mimir/search/plan.hpp"
 #include "mimir/search/state_repository.hpp"
 
+#include <algorithm>
 #include <gtest/gtest.h>
+#include <thread>
 
 namespace mimir::tests
 {
@@ -84,14 +87,14 @@ private:
     std::unique_ptr<IAlgorithm> m_algorithm;
 
 public:
-    GroundedIWPlanner(const fs::path& domain_file, const fs::path& problem_file, int arity) :
+    GroundedIWPlanner(const fs::path& domain_file, const fs::path& problem_file, int arity, IWAlgorithmOptions options = IWAlgorithmOptions()) :
         m_parser(PDDLParser(domain_file, problem_file)),
         m_aag_event_handler(std::make_shared<DefaultGroundedApplicableActionGeneratorEventHandler>()),
         m_aag(std::make_shared<GroundedApplicableActionGenerator>(m_parser.get_problem(), m_parser.get_pddl_factories(), m_aag_event_handler)),
         m_ssg(std::make_shared<StateRepository>(m_aag)),
         m_brfs_event_handler(std::make_shared<DefaultBrFSAlgorithmEventHandler>()),
         m_iw_event_handler(std::make_shared<DefaultIWAlgorithmEventHandler>()),
-        m_algorithm(std::make_unique<IWAlgorithm>(m_aag, arity, m_ssg, m_brfs_event_handler, m_iw_event_handler))
+        m_algorithm(std::make_unique<IWAlgorithm>(m_aag, arity, m_ssg, m_brfs_event_handler, m_iw_event_handler, options))
     {
     }
 
@@ -288,6 +291,137 @@ TEST(MimirTests, SearchAlgorithmsIWStatePairTupleIndexGeneratorWidth2Test3)
     EXPECT_EQ(++iter, generator.end());
 }
 
+TEST(MimirTests, SearchAlgorithmsIWNoveltyTableBackendsTest)
+{
+    const int arity = 3;
+    const int num_atoms = 100;
+
+    const auto tuple_index_mapper = std::make_shared<TupleIndexMapper>(arity, num_atoms);
+    const auto num_tuple_indices = static_cast<size_t>(tuple_index_mapper->get_max_tuple_index()) + 1;
+    auto generator = StateTupleIndexGenerator(tuple_index_mapper);
+
+    auto dense = DenseNoveltyTableBackend(num_tuple_indices);
+    auto blocked = BlockedNoveltyTableBackend(num_tuple_indices);
+    auto hashed = HashedNoveltyTableBackend(num_tuple_indices);
+
+    const auto states = std::vector<AtomIndexList>({
+        { 0, 1, 2, num_atoms },
+        { 1, 2, 50, 99, num_atoms },
+        { 0, 1, 2, num_atoms },
+        { 3, 50, 98, num_atoms },
+    });
+    for (const auto& atom_indices : states)
+    {
+        for (auto iter = generator.begin(atom_indices); iter != generator.end(); ++iter)
+        {
+            const auto is_novel = !dense.test(*iter);
+            EXPECT_EQ(!blocked.test(*iter), is_novel);
+            EXPECT_EQ(!hashed.test(*iter), is_novel);
+
+            EXPECT_EQ(dense.insert(*iter), is_novel);
+            EXPECT_EQ(blocked.insert(*iter), is_novel);
+            EXPECT_EQ(hashed.insert(*iter), is_novel);
+        }
+    }
+
+    auto dense_tuple_indices = TupleIndexList {};
+    auto hashed_tuple_indices = TupleIndexList {};
+    dense.for_each([&](TupleIndex tuple_index) { dense_tuple_indices.push_back(tuple_index); });
+    hashed.for_each([&](TupleIndex tuple_index) { hashed_tuple_indices.push_back(tuple_index); });
+    std::sort(hashed_tuple_indices.begin(), hashed_tuple_indices.end());
+    EXPECT_EQ(dense_tuple_indices, hashed_tuple_indices);
+    EXPECT_EQ(hashed.size(), dense_tuple_indices.size());
+
+    hashed.reset();
+    EXPECT_FALSE(hashed.test(tuple_index_mapper->get_empty_tuple_index()));
+
+    EXPECT_EQ(select_novelty_table_backend(2, 1000), NoveltyTableBackendType::DENSE);
+    EXPECT_EQ(select_novelty_table_backend(2, MAX_DENSE_NOVELTY_TABLE_SIZE + 1), NoveltyTableBackendType::BLOCKED);
+    EXPECT_EQ(select_novelty_table_backend(3, MAX_DENSE_NOVELTY_TABLE_SIZE + 1), NoveltyTableBackendType::HASHED);
+    EXPECT_EQ(select_novelty_table_backend(2, MAX_BLOCKED_NOVELTY_TABLE_SIZE + 1), NoveltyTableBackendType::HASHED);
+}
+
+TEST(MimirTests, SearchAlgorithmsIWNoveltyTableLargeAtomIndexTest)
+{
+    // The tuple indices of 2^17 atoms and arity 2 do not fit into 32 bits.
+    const int arity = 2;
+    const int num_atoms = 1 << 17;
+
+    const auto tuple_index_mapper = std::make_shared<TupleIndexMapper>(arity, num_atoms);
+    const auto num_tuple_indices = static_cast<size_t>(tuple_index_mapper->get_max_tuple_index()) + 1;
+    EXPECT_GT(num_tuple_indices, size_t(std::numeric_limits<uint32_t>::max()));
+    EXPECT_EQ(select_novelty_table_backend(arity, num_tuple_indices), NoveltyTableBackendType::BLOCKED);
+
+    auto generator = StateTupleIndexGenerator(tuple_index_mapper);
+    const auto atom_indices = AtomIndexList({ 5, 70000, num_atoms - 1, num_atoms });
+
+    auto iter = generator.begin(atom_indices);
+    EXPECT_EQ("(5,70000,)", tuple_index_mapper->tuple_index_to_string(*iter));
+    EXPECT_EQ("(5,131071,)", tuple_index_mapper->tuple_index_to_string(*(++iter)));
+    EXPECT_EQ("(5,)", tuple_index_mapper->tuple_index_to_string(*(++iter)));
+    EXPECT_EQ("(70000,131071,)", tuple_index_mapper->tuple_index_to_string(*(++iter)));
+    EXPECT_EQ("(70000,)", tuple_index_mapper->tuple_index_to_string(*(++iter)));
+    EXPECT_EQ("(131071,)", tuple_index_mapper->tuple_index_to_string(*(++iter)));
+    EXPECT_EQ("()", tuple_index_mapper->tuple_index_to_string(*(++iter)));
+    EXPECT_EQ(++iter, generator.end());
+
+    auto blocked = BlockedNoveltyTableBackend(num_tuple_indices);
+    auto hashed = HashedNoveltyTableBackend(num_tuple_indices);
+    for (auto iter = generator.begin(atom_indices); iter != generator.end(); ++iter)
+    {
+        EXPECT_TRUE(blocked.insert(*iter));
+        EXPECT_TRUE(hashed.insert(*iter));
+    }
+    EXPECT_TRUE(blocked.test(tuple_index_mapper->to_tuple_index(AtomIndexList({ 70000, num_atoms - 1 }))));
+    EXPECT_TRUE(hashed.test(tuple_index_mapper->to_tuple_index(AtomIndexList({ 70000, num_atoms - 1 }))));
+    EXPECT_FALSE(hashed.test(tuple_index_mapper->to_tuple_index(AtomIndexList({ 6, 70000 }))));
+    EXPECT_EQ(hashed.size(), 7);
+}
+
+TEST(MimirTests, SearchAlgorithmsIWNoveltyTableHashedConcurrentInsertTest)
+{
+    const auto num_threads = size_t(4);
+    const auto num_tuple_indices = TupleIndex(10000);
+
+    auto hashed = HashedNoveltyTableBackend(num_tuple_indices);
+    hashed.reserve(num_tuple_indices);
+
+    // Each thread inserts every tuple index, hence, each tuple index is inserted exactly once by some thread.
+    auto num_inserted = std::vector<size_t>(num_threads, 0);
+    auto threads = std::vector<std::thread> {};
+    for (size_t thread_index = 0; thread_index < num_threads; ++thread_index)
+    {
+        threads.emplace_back(
+            [&, thread_index]
+            {
+                for (TupleIndex i = 0; i < num_tuple_indices; ++i)
+                {
+                    if (hashed.insert_concurrent((i * 7919 + thread_index * 2503) % num_tuple_indices))
+                    {
+                        ++num_inserted[thread_index];
+                    }
+                }
+            });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    auto total_num_inserted = size_t(0);
+    for (const auto count : num_inserted)
+    {
+        total_num_inserted += count;
+    }
+    EXPECT_EQ(total_num_inserted, num_tuple_indices);
+    EXPECT_EQ(hashed.size(), num_tuple_indices);
+    for (TupleIndex tuple_index = 0; tuple_index < num_tuple_indices; ++tuple_index)
+    {
+        EXPECT_TRUE(hashed.test(tuple_index));
+    }
+    EXPECT_FALSE(hashed.insert(0));
+}
+
 /**
  * Delivery
  */
@@ -310,13 +444,44 @@ TEST(MimirTests, SearchAlgorithmsIWGroundedDeliveryTest)
     EXPECT_EQ(aag_statistics.get_num_nodes_in_action_match_tree(), 32);
 
     EXPECT_EQ(aag_statistics.get_num_ground_axioms(), 0);
-    EXPECT_EQ(aag_statistics.get_num_nodes_in_axiom_match_tree(), 1);
 
     const auto& iw_statistics = iw.get_iw_statistics();
 
     EXPECT_EQ(iw_statistics.get_brfs_statistics_by_arity().back().get_num_generated_until_g_value().back(), 18);
     EXPECT_EQ(iw_statistics.get_brfs_statistics_by_arity().back().get_num_expanded_until_g_value().back(), 7);
     EXPECT_EQ(iw_statistics.get_effective_width(), 2);
+    EXPECT_EQ(iw_statistics.get_novelty_table_statistics_by_arity().size(), 3);
+    EXPECT_EQ(iw_statistics.get_novelty_table_statistics_by_arity().back().get_backend_type(), NoveltyTableBackendType::DENSE);
+    EXPECT_GT(iw_statistics.get_novelty_table_statistics_by_arity().back().get_num_novel_tuple_indices(), 0);
+}
+
+TEST(MimirTests, SearchAlgorithmsIWGroundedIncrementalDeliveryTest)
+{
+    auto options = IWAlgorithmOptions();
+    options.incremental = true;
+    auto incremental_iw = GroundedIWPlanner(fs::path(std::string(DATA_DIR) + "delivery/domain.pddl"),
+                                            fs::path(std::string(DATA_DIR) + "delivery/test_problem.pddl"),
+                                            3,
+                                            options);
+    const auto [search_status, plan] = incremental_iw.find_solution();
+    EXPECT_EQ(search_status, SearchStatus::SOLVED);
+    EXPECT_GE(plan.get_actions().size(), 4);
+
+    auto iw = GroundedIWPlanner(fs::path(std::string(DATA_DIR) + "delivery/domain.pddl"), fs::path(std::string(DATA_DIR) + "delivery/test_problem.pddl"), 3);
+    iw.find_solution();
+
+    const auto count_expanded = [](const IWAlgorithmStatistics& statistics)
+    {
+        auto num_expanded = uint64_t(0);
+        for (const auto& brfs_statistics : statistics.get_brfs_statistics_by_arity())
+        {
+            num_expanded += brfs_statistics.get_num_expanded();
+        }
+        return num_expanded;
+    };
+
+    // The states in the search tree of a smaller arity are not expanded again.
+    EXPECT_LT(count_expanded(incremental_iw.get_iw_statistics()), count_expanded(iw.get_iw_statistics()));
 }
 
 TEST(MimirTests, SearchAlgorithmsIWLiftedDeliveryTest)
@@ -365,7 +530,6 @@ TEST(MimirTests, SearchAlgorithmsIWGroundedMiconicFullAdlTest)
     EXPECT_EQ(aag_statistics.get_num_nodes_in_action_match_tree(), 12);
 
     EXPECT_EQ(aag_statistics.get_num_ground_axioms(), 16);
-    EXPECT_EQ(aag_statistics.get_num_nodes_in_axiom_match_tree(), 12);
 
     const auto& iw_statistics = iw.get_iw_statistics();
 
@@ -131,7 +131,6 @@ TEST(MimirTests, SearchAlgorithmsSIWGroundedGripperTest)
     EXPECT_EQ(aag_statistics.get_num_nodes_in_action_match_tree(), 48);
 
     EXPECT_EQ(aag_statistics.get_num_ground_axioms(), 0);
-    EXPECT_EQ(aag_statistics.get_num_nodes_in_axiom_match_tree(), 1);
 
     const auto& siw_statistics = siw.get_iw_statistics();
 
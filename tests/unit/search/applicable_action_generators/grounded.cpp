@@ -18,9 +18,13 @@
 #include "mimir/formalism/parser.hpp"
 #include "mimir/search/algorithms.hpp"
 #include "mimir/search/applicable_action_generators.hpp"
+#include "mimir/search/applicable_action_generators/grounded/compact_match_tree.hpp"
 #include "mimir/search/state_repository.hpp"
 
+#include <algorithm>
 #include <gtest/gtest.h>
+#include <thread>
+#include <unordered_set>
 
 namespace mimir::tests
 {
@@ -49,7 +53,6 @@ TEST(MimirTests, SearchApplicableActionGeneratorsGroundedTest)
     EXPECT_EQ(aag_statistics.get_num_nodes_in_action_match_tree(), 12);
 
     EXPECT_EQ(aag_statistics.get_num_ground_axioms(), 16);
-    EXPECT_EQ(aag_statistics.get_num_nodes_in_axiom_match_tree(), 12);
 
     const auto& brfs_statistics = brfs_event_handler->get_statistics();
 
@@ -57,4 +60,259 @@ TEST(MimirTests, SearchApplicableActionGeneratorsGroundedTest)
     EXPECT_EQ(brfs_statistics.get_num_expanded_until_g_value().back(), 41);
 }
 
+TEST(MimirTests, SearchApplicableActionGeneratorsGroundedParallelTest)
+{
+    const auto domain_file = fs::path(std::string(DATA_DIR) + "miconic-fulladl/domain.pddl");
+    const auto problem_file = fs::path(std::string(DATA_DIR) + "miconic-fulladl/test_problem.pddl");
+    PDDLParser parser(domain_file, problem_file);
+    auto aag_event_handler = std::make_shared<DefaultGroundedApplicableActionGeneratorEventHandler>();
+    auto aag = std::make_shared<GroundedApplicableActionGenerator>(parser.get_problem(), parser.get_pddl_factories(), aag_event_handler, 4);
+    auto ssg = std::make_shared<StateRepository>(aag);
+    auto brfs_event_handler = std::make_shared<DefaultBrFSAlgorithmEventHandler>();
+    auto brfs = BrFSAlgorithm(aag, ssg, brfs_event_handler);
+    auto ground_actions = GroundActionList {};
+    const auto status = brfs.find_solution(ground_actions);
+    EXPECT_EQ(status, SearchStatus::SOLVED);
+
+    // Grounding with several threads must reach the same ground actions and axioms.
+    const auto& aag_statistics = aag_event_handler->get_statistics();
+    EXPECT_EQ(aag_statistics.get_num_delete_free_reachable_fluent_ground_atoms(), 9);
+    EXPECT_EQ(aag_statistics.get_num_delete_free_reachable_derived_ground_atoms(), 8);
+    EXPECT_EQ(aag_statistics.get_num_delete_free_actions(), 7);
+    EXPECT_EQ(aag_statistics.get_num_delete_free_axioms(), 20);
+
+    EXPECT_EQ(aag_statistics.get_num_ground_actions(), 10);
+    EXPECT_EQ(aag_statistics.get_num_ground_axioms(), 16);
+
+    const auto& brfs_statistics = brfs_event_handler->get_statistics();
+
+    EXPECT_EQ(brfs_statistics.get_num_generated_until_g_value().back(), 105);
+    EXPECT_EQ(brfs_statistics.get_num_expanded_until_g_value().back(), 41);
+}
+
+TEST(MimirTests, SearchApplicableActionGeneratorsGroundedCompactMatchTreeTest)
+{
+    const auto domain_file = fs::path(std::string(DATA_DIR) + "miconic-fulladl/domain.pddl");
+    const auto problem_file = fs::path(std::string(DATA_DIR) + "miconic-fulladl/test_problem.pddl");
+    PDDLParser parser(domain_file, problem_file);
+    auto aag = std::make_shared<GroundedApplicableActionGenerator>(parser.get_problem(), parser.get_pddl_factories());
+    auto ssg = std::make_shared<StateRepository>(aag);
+
+    auto ground_actions = GroundActionList {};
+    for (const auto& action : aag->get_ground_actions())
+    {
+        if (action.is_statically_applicable(parser.get_problem()->get_static_initial_positive_atoms()))
+        {
+            ground_actions.push_back(action);
+        }
+    }
+    auto compact_match_tree = CompactMatchTree<GroundAction>(ground_actions);
+
+    const auto to_indices = [](const GroundActionList& actions)
+    {
+        auto indices = IndexList {};
+        for (const auto& action : actions)
+        {
+            indices.push_back(action.get_index());
+        }
+        std::sort(indices.begin(), indices.end());
+        return indices;
+    };
+
+    const auto initial_state = ssg->get_or_create_initial_state();
+    auto applicable_actions = GroundActionList {};
+    aag->generate_applicable_actions(initial_state, applicable_actions);
+    auto compact_applicable_actions = GroundActionList {};
+    compact_match_tree.get_applicable_elements(initial_state.get_atoms<Fluent>(), initial_state.get_atoms<Derived>(), compact_applicable_actions);
+    EXPECT_EQ(to_indices(applicable_actions), to_indices(compact_applicable_actions));
+
+    for (const auto& action : GroundActionList(applicable_actions))
+    {
+        const auto successor_state = ssg->get_or_create_successor_state(initial_state, action);
+        aag->generate_applicable_actions(successor_state, applicable_actions);
+        compact_match_tree.get_applicable_elements(successor_state.get_atoms<Fluent>(),
+                                                   successor_state.get_atoms<Derived>(),
+                                                   compact_applicable_actions);
+        EXPECT_EQ(to_indices(applicable_actions), to_indices(compact_applicable_actions));
+    }
+}
+
+TEST(MimirTests, SearchApplicableActionGeneratorsGroundedCompactMatchTreeSearchTest)
+{
+    const auto domain_file = fs::path(std::string(DATA_DIR) + "miconic-fulladl/domain.pddl");
+    const auto problem_file = fs::path(std::string(DATA_DIR) + "miconic-fulladl/test_problem.pddl");
+
+    const auto find_plan = [&](bool use_compact_match_tree)
+    {
+        PDDLParser parser(domain_file, problem_file);
+        auto aag_event_handler = std::make_shared<DefaultGroundedApplicableActionGeneratorEventHandler>();
+        auto aag = std::make_shared<GroundedApplicableActionGenerator>(parser.get_problem(),
+                                                                       parser.get_pddl_factories(),
+                                                                       aag_event_handler,
+                                                                       1,
+                                                                       use_compact_match_tree);
+        auto brfs = BrFSAlgorithm(aag);
+        auto ground_actions = GroundActionList {};
+        const auto status = brfs.find_solution(ground_actions);
+        EXPECT_EQ(status, SearchStatus::SOLVED);
+        EXPECT_EQ(aag_event_handler->get_statistics().get_num_ground_actions(), 10);
+        EXPECT_GT(aag_event_handler->get_statistics().get_num_nodes_in_action_match_tree(), 0);
+        return ground_actions.size();
+    };
+
+    // Both match trees must yield the same optimal plan length.
+    EXPECT_EQ(find_plan(true), find_plan(false));
+}
+
+TEST(MimirTests, SearchApplicableActionGeneratorsGroundedBatchTest)
+{
+    const auto domain_file = fs::path(std::string(DATA_DIR) + "miconic-fulladl/domain.pddl");
+    const auto problem_file = fs::path(std::string(DATA_DIR) + "miconic-fulladl/test_problem.pddl");
+    PDDLParser parser(domain_file, problem_file);
+    auto aag = std::make_shared<GroundedApplicableActionGenerator>(parser.get_problem(), parser.get_pddl_factories());
+    auto ssg = std::make_shared<StateRepository>(aag);
+
+    const auto initial_state = ssg->get_or_create_initial_state();
+    auto applicable_actions = GroundActionList {};
+    aag->generate_applicable_actions(initial_state, applicable_actions);
+
+    auto states = StateList { initial_state };
+    for (const auto& action : applicable_actions)
+    {
+        states.push_back(ssg->get_or_create_successor_state(initial_state, action));
+    }
+
+    auto offsets = std::vector<size_t> {};
+    auto batch_applicable_actions = GroundActionList {};
+    aag->generate_applicable_actions(states, offsets, batch_applicable_actions);
+
+    ASSERT_EQ(offsets.size(), states.size() + 1);
+    for (size_t i = 0; i < states.size(); ++i)
+    {
+        aag->generate_applicable_actions(states[i], applicable_actions);
+        ASSERT_EQ(offsets[i + 1] - offsets[i], applicable_actions.size());
+        for (size_t j = 0; j < applicable_actions.size(); ++j)
+        {
+            EXPECT_EQ(batch_applicable_actions[offsets[i] + j].get_index(), applicable_actions[j].get_index());
+        }
+    }
+}
+
+TEST(MimirTests, SearchApplicableActionGeneratorsGroundedAxiomEvaluatorTest)
+{
+    for (const auto& domain_name : { "airport", "miconic-fulladl", "philosophers" })
+    {
+        const auto domain_file = fs::path(std::string(DATA_DIR) + domain_name + "/domain.pddl");
+        const auto problem_file = fs::path(std::string(DATA_DIR) + domain_name + "/test_problem.pddl");
+        PDDLParser parser(domain_file, problem_file);
+        // The lifted axiom evaluator serves as baseline for the derived atoms of the states.
+        auto lifted_aag = std::make_shared<LiftedApplicableActionGenerator>(parser.get_problem(), parser.get_pddl_factories());
+        auto ssg = std::make_shared<StateRepository>(lifted_aag);
+        // Alternating between two grounded generators in one thread resets the counters of the thread-local buffers.
+        auto grounded_aags = std::vector<std::shared_ptr<GroundedApplicableActionGenerator>> {
+            std::make_shared<GroundedApplicableActionGenerator>(parser.get_problem(), parser.get_pddl_factories()),
+            std::make_shared<GroundedApplicableActionGenerator>(parser.get_problem(), parser.get_pddl_factories())
+        };
+
+        auto states = StateList { ssg->get_or_create_initial_state() };
+        auto visited = std::unordered_set<Index> { states.front().get_index() };
+        auto num_states_with_derived_atoms = size_t(0);
+        for (size_t i = 0; i < states.size() && states.size() < 500; ++i)
+        {
+            for (const auto& grounded_aag : grounded_aags)
+            {
+                auto derived_atoms = FlatBitset();
+                grounded_aag->generate_and_apply_axioms(states[i].get_atoms<Fluent>(), derived_atoms);
+                EXPECT_TRUE(derived_atoms == states[i].get_atoms<Derived>()) << domain_name << ": state " << i;
+            }
+            if (states[i].get_atoms<Derived>().count() > 0)
+            {
+                ++num_states_with_derived_atoms;
+            }
+
+            auto applicable_actions = GroundActionList {};
+            lifted_aag->generate_applicable_actions(states[i], applicable_actions);
+            for (const auto& action : applicable_actions)
+            {
+                const auto successor_state = ssg->get_or_create_successor_state(states[i], action);
+                if (visited.insert(successor_state.get_index()).second)
+                {
+                    states.push_back(successor_state);
+                }
+            }
+        }
+
+        EXPECT_GT(num_states_with_derived_atoms, 0) << domain_name;
+    }
+}
+
+TEST(MimirTests, SearchApplicableActionGeneratorsGroundedConcurrentTest)
+{
+    const auto domain_file = fs::path(std::string(DATA_DIR) + "miconic-fulladl/domain.pddl");
+    const auto problem_file = fs::path(std::string(DATA_DIR) + "miconic-fulladl/test_problem.pddl");
+    PDDLParser parser(domain_file, problem_file);
+    auto aag = std::make_shared<GroundedApplicableActionGenerator>(parser.get_problem(), parser.get_pddl_factories());
+    auto ssg = std::make_shared<StateRepository>(aag);
+
+    // Enumerate the state space and the applicable actions sequentially.
+    auto states = StateList { ssg->get_or_create_initial_state() };
+    auto expected_applicable_actions = std::vector<GroundActionList> {};
+    auto visited = std::unordered_set<Index> { states.front().get_index() };
+    for (size_t i = 0; i < states.size(); ++i)
+    {
+        auto applicable_actions = GroundActionList {};
+        aag->generate_applicable_actions(states[i], applicable_actions);
+        for (const auto& action : applicable_actions)
+        {
+            const auto successor_state = ssg->get_or_create_successor_state(states[i], action);
+            if (visited.insert(successor_state.get_index()).second)
+            {
+                states.push_back(successor_state);
+            }
+        }
+        expected_applicable_actions.push_back(std::move(applicable_actions));
+    }
+
+    // Query the generator from several threads, which races under the thread sanitizer if the generator is not reentrant.
+    const auto num_threads = size_t(4);
+    auto num_mismatches = std::vector<size_t>(num_threads, 0);
+    auto threads = std::vector<std::thread> {};
+    for (size_t thread_index = 0; thread_index < num_threads; ++thread_index)
+    {
+        threads.emplace_back(
+            [&, thread_index]
+            {
+                auto applicable_actions = GroundActionList {};
+                for (size_t repetition = 0; repetition < 10; ++repetition)
+                {
+                    for (size_t i = 0; i < states.size(); ++i)
+                    {
+                        aag->generate_applicable_actions(states[i], applicable_actions);
+                        if (applicable_actions != expected_applicable_actions[i])
+                        {
+                            ++num_mismatches[thread_index];
+                        }
+
+                        auto derived_atoms = FlatBitset();
+                        aag->generate_and_apply_axioms(states[i].get_atoms<Fluent>(), derived_atoms);
+                        if (!(derived_atoms == states[i].get_atoms<Derived>()))
+                        {
+                            ++num_mismatches[thread_index];
+                        }
+                    }
+                }
+            });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_GT(states.size(), 1);
+    for (size_t thread_index = 0; thread_index < num_threads; ++thread_index)
+    {
+        EXPECT_EQ(num_mismatches[thread_index], 0);
+    }
+}
+
 }
@@ -18,6 +18,7 @@
 #include "mimir/formalism/parser.hpp"
 #include "mimir/search/algorithms.hpp"
 #include "mimir/search/applicable_action_generators.hpp"
+#include "mimir/search/applicable_action_generators/lifted/assignment_set.hpp"
 #include "mimir/search/state_repository.hpp"
 
 #include <gtest/gtest.h>
@@ -53,4 +54,97 @@ TEST(MimirTests, SearchApplicableActionGeneratorsLiftedTest)
     EXPECT_EQ(brfs_statistics.get_num_expanded_until_g_value().back(), 41);
 }
 
+TEST(MimirTests, SearchApplicableActionGeneratorsLiftedParallelTest)
+{
+    const auto domain_file = fs::path(std::string(DATA_DIR) + "miconic-fulladl/domain.pddl");
+    const auto problem_file = fs::path(std::string(DATA_DIR) + "miconic-fulladl/test_problem.pddl");
+    auto parser = PDDLParser(domain_file, problem_file);
+    auto aag_event_handler = std::make_shared<DefaultLiftedApplicableActionGeneratorEventHandler>();
+    auto aag = std::make_shared<LiftedApplicableActionGenerator>(parser.get_problem(), parser.get_pddl_factories(), aag_event_handler, 4);
+    auto ssg = std::make_shared<StateRepository>(aag);
+    auto brfs_event_handler = std::make_shared<DefaultBrFSAlgorithmEventHandler>();
+    auto brfs = BrFSAlgorithm(aag, ssg, brfs_event_handler);
+    auto ground_actions = GroundActionList {};
+    const auto status = brfs.find_solution(ground_actions);
+    EXPECT_EQ(status, SearchStatus::SOLVED);
+
+    // The parallel mode must generate the same actions in the same order as the sequential mode.
+    const auto& aag_statistics = aag_event_handler->get_statistics();
+
+    EXPECT_EQ(aag_statistics.get_num_ground_action_cache_hits_per_search_layer().back(), 95);
+    EXPECT_EQ(aag_statistics.get_num_ground_action_cache_misses_per_search_layer().back(), 10);
+
+    const auto& brfs_statistics = brfs_event_handler->get_statistics();
+
+    EXPECT_EQ(brfs_statistics.get_num_generated_until_g_value().back(), 105);
+    EXPECT_EQ(brfs_statistics.get_num_expanded_until_g_value().back(), 41);
+}
+
+TEST(MimirTests, SearchApplicableActionGeneratorsLiftedAssignmentSetTest)
+{
+    const auto domain_file = fs::path(std::string(DATA_DIR) + "gripper/domain.pddl");
+    const auto problem_file = fs::path(std::string(DATA_DIR) + "gripper/test_problem.pddl");
+    auto parser = PDDLParser(domain_file, problem_file);
+    const auto problem = parser.get_problem();
+    const auto& predicates = problem->get_domain()->get_predicates<Fluent>();
+    const auto& objects = problem->get_objects();
+
+    auto atoms = GroundAtomList<Fluent> {};
+    for (const auto& literal : problem->get_fluent_initial_literals())
+    {
+        atoms.push_back(literal->get_atom());
+    }
+
+    // Compare the incrementally updated assignment set against one that is built from scratch
+    // on all vertices and edges of the consistency graphs of the actions.
+    const auto expect_consistent_literals_equal = [&](const AssignmentSet<Fluent>& assignment_set, const GroundAtomList<Fluent>& current_atoms)
+    {
+        const auto expected_assignment_set = AssignmentSet<Fluent>(problem, predicates, current_atoms);
+        for (const auto& action : problem->get_domain()->get_actions())
+        {
+            const auto& literals = action->get_conditions<Fluent>();
+            const auto num_parameters = action->get_parameters().size();
+            auto vertices = std::vector<consistency_graph::Vertex> {};
+            for (size_t parameter = 0; parameter < num_parameters; ++parameter)
+            {
+                for (const auto& object : objects)
+                {
+                    vertices.emplace_back(vertices.size(), parameter, object->get_index());
+                }
+            }
+            for (const auto& vertex : vertices)
+            {
+                EXPECT_EQ(assignment_set.consistent_literals(literals, vertex), expected_assignment_set.consistent_literals(literals, vertex));
+                for (const auto& other_vertex : vertices)
+                {
+                    if (vertex.get_parameter_index() < other_vertex.get_parameter_index())
+                    {
+                        const auto edge = consistency_graph::Edge(vertex, other_vertex);
+                        EXPECT_EQ(assignment_set.consistent_literals(literals, edge), expected_assignment_set.consistent_literals(literals, edge));
+                    }
+                }
+            }
+        }
+    };
+
+    auto assignment_set = AssignmentSet<Fluent>(problem, predicates);
+    auto current_atoms = GroundAtomList<Fluent> {};
+    for (const auto& atom : atoms)
+    {
+        assignment_set.insert_ground_atom(atom);
+        current_atoms.push_back(atom);
+        expect_consistent_literals_equal(assignment_set, current_atoms);
+    }
+    for (const auto& atom : atoms)
+    {
+        assignment_set.erase_ground_atom(atom);
+        current_atoms.erase(current_atoms.begin());
+        expect_consistent_literals_equal(assignment_set, current_atoms);
+    }
+
+    // The empty assignment set is inconsistent with every positive literal.
+    const auto& move_action = problem->get_domain()->get_actions().front();
+    EXPECT_FALSE(assignment_set.consistent_literals(move_action->get_conditions<Fluent>(), consistency_graph::Vertex(0, 0, objects.front()->get_index())));
+}
+
 }
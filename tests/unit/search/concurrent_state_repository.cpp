@@ -0,0 +1,117 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "mimir/search/concurrent_state_repository.hpp"
+
+#include "mimir/formalism/parser.hpp"
+#include "mimir/search/applicable_action_generators.hpp"
+#include "mimir/search/applicable_action_generators/grounded/event_handlers.hpp"
+#include "mimir/search/state_repository.hpp"
+
+#include <gtest/gtest.h>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+
+namespace mimir::tests
+{
+
+TEST(MimirTests, SearchConcurrentStateRepositoryTest)
+{
+    const auto domain_file = fs::path(std::string(DATA_DIR) + "gripper/domain.pddl");
+    const auto problem_file = fs::path(std::string(DATA_DIR) + "gripper/test_problem.pddl");
+    auto parser = PDDLParser(domain_file, problem_file);
+    auto aag_event_handler = std::make_shared<DefaultGroundedApplicableActionGeneratorEventHandler>();
+    auto aag = std::make_shared<GroundedApplicableActionGenerator>(parser.get_problem(), parser.get_pddl_factories(), aag_event_handler);
+
+    // Enumerate the state space sequentially.
+    auto ssg = StateRepository(aag);
+    {
+        auto layer = StateList { ssg.get_or_create_initial_state() };
+        auto visited = std::unordered_set<Index> { layer.front().get_index() };
+        auto applicable_actions = GroundActionList {};
+        while (!layer.empty())
+        {
+            auto next_layer = StateList {};
+            for (const auto& state : layer)
+            {
+                aag->generate_applicable_actions(state, applicable_actions);
+                for (const auto& action : applicable_actions)
+                {
+                    const auto successor_state = ssg.get_or_create_successor_state(state, action);
+                    if (visited.insert(successor_state.get_index()).second)
+                    {
+                        next_layer.push_back(successor_state);
+                    }
+                }
+            }
+            layer = std::move(next_layer);
+        }
+    }
+
+    // Enumerate the state space layer by layer with several threads.
+    auto concurrent_ssg = ConcurrentStateRepository(aag, 8);
+    const auto num_threads = size_t(4);
+    {
+        auto layer = StateList { concurrent_ssg.get_or_create_initial_state() };
+        auto visited = std::unordered_set<Index> { layer.front().get_index() };
+        auto mutex = std::mutex();
+        while (!layer.empty())
+        {
+            auto next_layer = StateList {};
+            auto threads = std::vector<std::thread> {};
+            for (size_t thread_index = 0; thread_index < num_threads; ++thread_index)
+            {
+                threads.emplace_back(
+                    [&, thread_index]
+                    {
+                        auto applicable_actions = GroundActionList {};
+                        for (size_t i = thread_index; i < layer.size(); i += num_threads)
+                        {
+                            aag->generate_applicable_actions(layer[i], applicable_actions);
+                            for (const auto& action : applicable_actions)
+                            {
+                                const auto successor_state = concurrent_ssg.get_or_create_successor_state(layer[i], action);
+
+                                auto lock = std::lock_guard<std::mutex>(mutex);
+                                if (visited.insert(successor_state.get_index()).second)
+                                {
+                                    next_layer.push_back(successor_state);
+                                }
+                            }
+                        }
+                    });
+            }
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+            layer = std::move(next_layer);
+        }
+    }
+
+    EXPECT_EQ(concurrent_ssg.get_state_count(), ssg.get_state_count());
+    EXPECT_EQ(concurrent_ssg.get_reached_fluent_ground_atoms(), ssg.get_reached_fluent_ground_atoms());
+    EXPECT_EQ(concurrent_ssg.get_num_shards(), 8);
+
+    // States are unique across threads.
+    const auto initial_state = concurrent_ssg.get_or_create_initial_state();
+    EXPECT_EQ(initial_state.get_index(), concurrent_ssg.get_or_create_state(initial_state.get_atoms<Fluent>()).get_index());
+    EXPECT_EQ(concurrent_ssg.get_state_count(), ssg.get_state_count());
+}
+
+}
@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "mimir/search/delta_state_repository.hpp"
+
+#include "mimir/formalism/parser.hpp"
+#include "mimir/search/algorithms.hpp"
+#include "mimir/search/applicable_action_generators.hpp"
+#include "mimir/search/state_repository.hpp"
+
+#include <gtest/gtest.h>
+
+namespace mimir::tests
+{
+
+TEST(MimirTests, SearchDeltaStateRepositoryTest)
+{
+    const auto domain_file = fs::path(std::string(DATA_DIR) + "gripper/domain.pddl");
+    const auto problem_file = fs::path(std::string(DATA_DIR) + "gripper/test_problem.pddl");
+    auto parser = PDDLParser(domain_file, problem_file);
+    auto aag = std::make_shared<LiftedApplicableActionGenerator>(parser.get_problem(), parser.get_pddl_factories());
+
+    // Use a short checkpoint interval and a tiny cache to exercise decoding long chains.
+    auto options = DeltaStateRepositoryOptions();
+    options.checkpoint_interval = 3;
+    options.cache_size = 2;
+    auto delta_ssg = DeltaStateRepository(aag, options);
+    auto ssg = StateRepository(aag);
+
+    // Breadth-first enumeration of the delta states where each unpacked state is checked against the full representation.
+    auto state_builder = StateBuilder();
+    auto applicable_actions = GroundActionList {};
+    auto queue = IndexList { delta_ssg.get_or_create_initial_state() };
+    EXPECT_EQ(queue.front(), ssg.get_or_create_initial_state().get_index());
+
+    for (size_t i = 0; i < queue.size(); ++i)
+    {
+        const auto state = delta_ssg.unpack_state(queue[i], state_builder);
+        EXPECT_EQ(state.get_index(), queue[i]);
+        EXPECT_EQ(ssg.get_or_create_state(state.get_atoms<Fluent>()).get_index(), state.get_index());
+
+        auto hash = uint64_t(0);
+        for (const auto atom_index : state.get_atoms<Fluent>())
+        {
+            hash ^= DeltaStateRepository::get_zobrist_key(atom_index);
+        }
+        EXPECT_EQ(delta_ssg.get_hash(state.get_index()), hash);
+
+        aag->generate_applicable_actions(state, applicable_actions);
+        for (const auto& action : applicable_actions)
+        {
+            const auto num_states = delta_ssg.get_state_count();
+            const auto successor_state_index = delta_ssg.get_or_create_successor_state(state, action);
+            if (successor_state_index == num_states)
+            {
+                queue.push_back(successor_state_index);
+            }
+        }
+    }
+
+    EXPECT_EQ(delta_ssg.get_state_count(), 28);
+    EXPECT_EQ(delta_ssg.get_state_count(), ssg.get_state_count());
+    EXPECT_EQ(delta_ssg.get_reached_fluent_ground_atoms(), ssg.get_reached_fluent_ground_atoms());
+}
+
+TEST(MimirTests, SearchDeltaStateRepositoryBrFSTest)
+{
+    const auto domain_file = fs::path(std::string(DATA_DIR) + "miconic-fulladl/domain.pddl");
+    const auto problem_file = fs::path(std::string(DATA_DIR) + "miconic-fulladl/test_problem.pddl");
+    auto parser = PDDLParser(domain_file, problem_file);
+    auto aag = std::make_shared<GroundedApplicableActionGenerator>(parser.get_problem(), parser.get_pddl_factories());
+
+    auto ssg = std::make_shared<StateRepository>(aag);
+    auto brfs_event_handler = std::make_shared<DefaultBrFSAlgorithmEventHandler>();
+    auto brfs = BrFSAlgorithm(aag, ssg, brfs_event_handler);
+    auto plan = GroundActionList {};
+    EXPECT_EQ(brfs.find_solution(plan), SearchStatus::SOLVED);
+
+    // A small checkpoint interval and cache force decoding along chains of deltas.
+    auto delta_ssg = std::make_shared<DeltaStateRepository>(aag, DeltaStateRepositoryOptions { 4, 8 });
+    auto delta_brfs_event_handler = std::make_shared<DefaultBrFSAlgorithmEventHandler>();
+    auto delta_brfs = BrFSAlgorithm(aag, delta_ssg, delta_brfs_event_handler);
+    auto delta_plan = GroundActionList {};
+    EXPECT_EQ(delta_brfs.find_solution(delta_plan), SearchStatus::SOLVED);
+
+    // Both searches visit the states in the same order.
+    EXPECT_EQ(delta_plan.size(), plan.size());
+    EXPECT_EQ(delta_brfs_event_handler->get_statistics().get_num_generated(), brfs_event_handler->get_statistics().get_num_generated());
+    EXPECT_EQ(delta_brfs_event_handler->get_statistics().get_num_expanded(), brfs_event_handler->get_statistics().get_num_expanded());
+    EXPECT_EQ(delta_ssg->get_state_count(), ssg->get_state_count());
+}
+
+}
@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "mimir/search/heuristics/lmcut.hpp"
+
+#include "mimir/formalism/parser.hpp"
+#include "mimir/search/algorithms/astar.hpp"
+#include "mimir/search/algorithms/astar/event_handlers.hpp"
+#include "mimir/search/applicable_action_generators.hpp"
+#include "mimir/search/applicable_action_generators/grounded/event_handlers.hpp"
+#include "mimir/search/heuristics/hmax.hpp"
+#include "mimir/search/plan.hpp"
+#include "mimir/search/planners/single.hpp"
+#include "mimir/search/state_repository.hpp"
+
+#include <gtest/gtest.h>
+
+namespace mimir::tests
+{
+
+/**
+ * Gripper
+ */
+
+TEST(MimirTests, SearchHeuristicsLMCutGripperInitialStateTest)
+{
+    const auto domain_file = fs::path(std::string(DATA_DIR) + "gripper/domain.pddl");
+    const auto problem_file = fs::path(std::string(DATA_DIR) + "gripper/test_problem.pddl");
+    auto parser = PDDLParser(domain_file, problem_file);
+    auto aag_event_handler = std::make_shared<DefaultGroundedApplicableActionGeneratorEventHandler>();
+    auto aag = std::make_shared<GroundedApplicableActionGenerator>(parser.get_problem(), parser.get_pddl_factories(), aag_event_handler);
+    auto ssg = std::make_shared<StateRepository>(aag);
+    auto initial_state = ssg->get_or_create_initial_state();
+    auto lmcut_event_handler = std::make_shared<DefaultLMCutHeuristicEventHandler>();
+    auto lmcut = LMCutHeuristic(aag, lmcut_event_handler);
+
+    // The landmarks are pick ball2, move to roomb, and drop ball2 in roomb.
+    EXPECT_EQ(lmcut.compute_heuristic(initial_state), 3.);
+    EXPECT_EQ(lmcut.compute_heuristic(initial_state), 3.);
+
+    const auto& statistics = lmcut_event_handler->get_statistics();
+    EXPECT_EQ(statistics.get_num_evaluations(), 2);
+    EXPECT_EQ(statistics.get_num_landmarks(), 6);
+    EXPECT_EQ(statistics.get_num_deadends(), 0);
+}
+
+TEST(MimirTests, SearchHeuristicsLMCutGripperAStarTest)
+{
+    const auto domain_file = fs::path(std::string(DATA_DIR) + "gripper/domain.pddl");
+    const auto problem_file = fs::path(std::string(DATA_DIR) + "gripper/test_problem.pddl");
+    auto parser = PDDLParser(domain_file, problem_file);
+    auto aag_event_handler = std::make_shared<DefaultGroundedApplicableActionGeneratorEventHandler>();
+    auto aag = std::make_shared<GroundedApplicableActionGenerator>(parser.get_problem(), parser.get_pddl_factories(), aag_event_handler);
+    auto ssg = std::make_shared<StateRepository>(aag);
+    auto lmcut_event_handler = std::make_shared<DefaultLMCutHeuristicEventHandler>();
+    auto lmcut = std::make_shared<LMCutHeuristic>(aag, lmcut_event_handler);
+    auto astar_event_handler = std::make_shared<DefaultAStarAlgorithmEventHandler>();
+    auto astar = std::make_shared<AStarAlgorithm>(aag, ssg, lmcut, astar_event_handler);
+    auto planner = SinglePlanner(astar);
+    auto [search_status, plan] = planner.find_solution();
+
+    EXPECT_EQ(search_status, SearchStatus::SOLVED);
+    EXPECT_EQ(plan.get_actions().size(), 3);
+    EXPECT_GT(lmcut_event_handler->get_statistics().get_num_evaluations(), 0);
+}
+
+/**
+ * Miconic-fulladl
+ */
+
+TEST(MimirTests, SearchHeuristicsLMCutDominatesHMaxMiconicFullAdlTest)
+{
+    const auto domain_file = fs::path(std::string(DATA_DIR) + "miconic-fulladl/domain.pddl");
+    const auto problem_file = fs::path(std::string(DATA_DIR) + "miconic-fulladl/test_problem.pddl");
+    auto parser = PDDLParser(domain_file, problem_file);
+    auto aag = std::make_shared<GroundedApplicableActionGenerator>(parser.get_problem(), parser.get_pddl_factories());
+    auto ssg = std::make_shared<StateRepository>(aag);
+    auto initial_state = ssg->get_or_create_initial_state();
+    auto graph = std::make_shared<RelaxedOperatorGraph>(aag);
+    auto lmcut = LMCutHeuristic(graph, std::make_shared<DefaultLMCutHeuristicEventHandler>());
+    auto hmax = HMaxHeuristic(graph);
+
+    EXPECT_GE(lmcut.compute_heuristic(initial_state), hmax.compute_heuristic(initial_state));
+}
+
+}
@@ -0,0 +1,119 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "mimir/search/heuristics/pdb.hpp"
+
+#include "mimir/formalism/ground_atom.hpp"
+#include "mimir/formalism/ground_literal.hpp"
+#include "mimir/formalism/parser.hpp"
+#include "mimir/formalism/problem.hpp"
+#include "mimir/search/algorithms/astar.hpp"
+#include "mimir/search/algorithms/astar/event_handlers.hpp"
+#include "mimir/search/applicable_action_generators.hpp"
+#include "mimir/search/applicable_action_generators/grounded/event_handlers.hpp"
+#include "mimir/search/heuristics/canonical_pdb.hpp"
+#include "mimir/search/heuristics/pdb/pattern_selection.hpp"
+#include "mimir/search/plan.hpp"
+#include "mimir/search/planners/single.hpp"
+#include "mimir/search/state_repository.hpp"
+
+#include <gtest/gtest.h>
+
+namespace mimir::tests
+{
+
+/**
+ * Gripper
+ */
+
+TEST(MimirTests, SearchHeuristicsPDBGripperGoalPatternTest)
+{
+    const auto domain_file = fs::path(std::string(DATA_DIR) + "gripper/domain.pddl");
+    const auto problem_file = fs::path(std::string(DATA_DIR) + "gripper/test_problem.pddl");
+    auto parser = PDDLParser(domain_file, problem_file);
+    auto aag_event_handler = std::make_shared<DefaultGroundedApplicableActionGeneratorEventHandler>();
+    auto aag = std::make_shared<GroundedApplicableActionGenerator>(parser.get_problem(), parser.get_pddl_factories(), aag_event_handler);
+    auto ssg = std::make_shared<StateRepository>(aag);
+    auto initial_state = ssg->get_or_create_initial_state();
+
+    auto pattern = Pattern {};
+    for (const auto& literal : parser.get_problem()->get_goal_condition<Fluent>())
+    {
+        pattern.push_back(literal->get_atom()->get_index());
+    }
+    auto pdb = PDBHeuristic(aag, pattern);
+
+    // The projection onto the goal atoms only knows that a drop action achieves each goal atom.
+    const auto value = pdb.compute_heuristic(initial_state);
+    EXPECT_GT(value, 0.);
+    EXPECT_LE(value, 3.);
+    EXPECT_EQ(pdb.get_pattern_database().get_num_abstract_states(), size_t(1) << pattern.size());
+}
+
+TEST(MimirTests, SearchHeuristicsPDBGripperSaveLoadTest)
+{
+    const auto domain_file = fs::path(std::string(DATA_DIR) + "gripper/domain.pddl");
+    const auto problem_file = fs::path(std::string(DATA_DIR) + "gripper/test_problem.pddl");
+    auto parser = PDDLParser(domain_file, problem_file);
+    auto aag_event_handler = std::make_shared<DefaultGroundedApplicableActionGeneratorEventHandler>();
+    auto aag = std::make_shared<GroundedApplicableActionGenerator>(parser.get_problem(), parser.get_pddl_factories(), aag_event_handler);
+    auto ssg = std::make_shared<StateRepository>(aag);
+    auto initial_state = ssg->get_or_create_initial_state();
+
+    const auto patterns = GreedyPatternSelector(aag).compute_patterns();
+    ASSERT_FALSE(patterns.empty());
+
+    const auto file_path = fs::temp_directory_path() / "mimir_search_heuristics_pdb_gripper.pdb";
+    fs::remove(file_path);
+
+    const auto created_pdb = PatternDatabase::load_or_create(aag, patterns.front(), file_path);
+    EXPECT_FALSE(created_pdb.is_memory_mapped());
+    const auto loaded_pdb = PatternDatabase::load_or_create(aag, patterns.front(), file_path);
+    EXPECT_TRUE(loaded_pdb.is_memory_mapped());
+
+    EXPECT_EQ(created_pdb.get_fingerprint(), loaded_pdb.get_fingerprint());
+    EXPECT_EQ(created_pdb.get_num_abstract_states(), loaded_pdb.get_num_abstract_states());
+    EXPECT_EQ(created_pdb.get_distance(initial_state), loaded_pdb.get_distance(initial_state));
+
+    fs::remove(file_path);
+}
+
+TEST(MimirTests, SearchHeuristicsCanonicalPDBGripperAStarTest)
+{
+    const auto domain_file = fs::path(std::string(DATA_DIR) + "gripper/domain.pddl");
+    const auto problem_file = fs::path(std::string(DATA_DIR) + "gripper/test_problem.pddl");
+    auto parser = PDDLParser(domain_file, problem_file);
+    auto aag_event_handler = std::make_shared<DefaultGroundedApplicableActionGeneratorEventHandler>();
+    auto aag = std::make_shared<GroundedApplicableActionGenerator>(parser.get_problem(), parser.get_pddl_factories(), aag_event_handler);
+    auto ssg = std::make_shared<StateRepository>(aag);
+    auto cpdb = std::make_shared<CanonicalPDBHeuristic>(aag);
+    auto initial_state = ssg->get_or_create_initial_state();
+
+    EXPECT_FALSE(cpdb->get_pattern_databases().empty());
+    EXPECT_FALSE(cpdb->get_additive_subsets().empty());
+    EXPECT_LE(cpdb->compute_heuristic(initial_state), 3.);
+
+    auto astar_event_handler = std::make_shared<DefaultAStarAlgorithmEventHandler>();
+    auto astar = std::make_shared<AStarAlgorithm>(aag, ssg, cpdb, astar_event_handler);
+    auto planner = SinglePlanner(astar);
+    auto [search_status, plan] = planner.find_solution();
+
+    EXPECT_EQ(search_status, SearchStatus::SOLVED);
+    EXPECT_EQ(plan.get_actions().size(), 3);
+}
+
+}
@@ -0,0 +1,150 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "mimir/formalism/parser.hpp"
+#include "mimir/search/algorithms/astar.hpp"
+#include "mimir/search/algorithms/astar/event_handlers.hpp"
+#include "mimir/search/applicable_action_generators.hpp"
+#include "mimir/search/applicable_action_generators/grounded/event_handlers.hpp"
+#include "mimir/search/applicable_action_generators/lifted/event_handlers.hpp"
+#include "mimir/search/heuristics.hpp"
+#include "mimir/search/plan.hpp"
+#include "mimir/search/planners/single.hpp"
+#include "mimir/search/state_repository.hpp"
+
+#include <gtest/gtest.h>
+
+namespace mimir::tests
+{
+
+/**
+ * Gripper
+ */
+
+TEST(MimirTests, SearchHeuristicsRelaxedExplorationGripperInitialStateTest)
+{
+    const auto domain_file = fs::path(std::string(DATA_DIR) + "gripper/domain.pddl");
+    const auto problem_file = fs::path(std::string(DATA_DIR) + "gripper/test_problem.pddl");
+    auto parser = PDDLParser(domain_file, problem_file);
+    auto aag_event_handler = std::make_shared<DefaultGroundedApplicableActionGeneratorEventHandler>();
+    auto aag = std::make_shared<GroundedApplicableActionGenerator>(parser.get_problem(), parser.get_pddl_factories(), aag_event_handler);
+    auto ssg = std::make_shared<StateRepository>(aag);
+    auto graph = std::make_shared<RelaxedOperatorGraph>(aag);
+    auto initial_state = ssg->get_or_create_initial_state();
+
+    auto hmax = HMaxHeuristic(graph);
+    auto hadd = HAddHeuristic(graph);
+    auto hff = HFFHeuristic(graph);
+
+    // The goal (at ball2 roomb) requires pick, move, and drop.
+    EXPECT_EQ(hmax.compute_heuristic(initial_state), 2.);
+    EXPECT_EQ(hadd.compute_heuristic(initial_state), 3.);
+    EXPECT_EQ(hff.compute_heuristic(initial_state), 3.);
+    EXPECT_EQ(hff.get_relaxed_plan().size(), 3);
+
+    // Calling the heuristics again must produce the same values because buffers are reset.
+    EXPECT_EQ(hmax.compute_heuristic(initial_state), 2.);
+    EXPECT_EQ(hadd.compute_heuristic(initial_state), 3.);
+    EXPECT_EQ(hff.compute_heuristic(initial_state), 3.);
+}
+
+TEST(MimirTests, SearchHeuristicsRelaxedExplorationGripperAStarTest)
+{
+    const auto domain_file = fs::path(std::string(DATA_DIR) + "gripper/domain.pddl");
+    const auto problem_file = fs::path(std::string(DATA_DIR) + "gripper/test_problem.pddl");
+    auto parser = PDDLParser(domain_file, problem_file);
+    auto aag_event_handler = std::make_shared<DefaultGroundedApplicableActionGeneratorEventHandler>();
+    auto aag = std::make_shared<GroundedApplicableActionGenerator>(parser.get_problem(), parser.get_pddl_factories(), aag_event_handler);
+    auto ssg = std::make_shared<StateRepository>(aag);
+
+    for (const auto& heuristic : std::vector<std::shared_ptr<IHeuristic>> { std::make_shared<HMaxHeuristic>(aag),
+                                                                            std::make_shared<HAddHeuristic>(aag),
+                                                                            std::make_shared<HFFHeuristic>(aag) })
+    {
+        auto astar_event_handler = std::make_shared<DefaultAStarAlgorithmEventHandler>();
+        auto astar = std::make_shared<AStarAlgorithm>(aag, ssg, heuristic, astar_event_handler);
+        auto planner = SinglePlanner(astar);
+        auto [search_status, plan] = planner.find_solution();
+
+        EXPECT_EQ(search_status, SearchStatus::SOLVED);
+        EXPECT_EQ(plan.get_actions().size(), 3);
+    }
+}
+
+TEST(MimirTests, SearchHeuristicsLiftedRelaxedExplorationGripperInitialStateTest)
+{
+    const auto domain_file = fs::path(std::string(DATA_DIR) + "gripper/domain.pddl");
+    const auto problem_file = fs::path(std::string(DATA_DIR) + "gripper/test_problem.pddl");
+    auto parser = PDDLParser(domain_file, problem_file);
+    auto aag_event_handler = std::make_shared<DefaultLiftedApplicableActionGeneratorEventHandler>();
+    auto aag = std::make_shared<LiftedApplicableActionGenerator>(parser.get_problem(), parser.get_pddl_factories(), aag_event_handler);
+    auto ssg = std::make_shared<StateRepository>(aag);
+    auto initial_state = ssg->get_or_create_initial_state();
+
+    auto hadd = LiftedHAddHeuristic(aag);
+    auto hff = LiftedHFFHeuristic(aag);
+
+    EXPECT_EQ(hadd.compute_heuristic(initial_state), 3.);
+    EXPECT_EQ(hff.compute_heuristic(initial_state), 3.);
+    EXPECT_EQ(hff.get_relaxed_plan().size(), 3);
+
+    // The second call reuses the groundings of the first call.
+    EXPECT_EQ(hadd.compute_heuristic(initial_state), 3.);
+    EXPECT_EQ(hff.compute_heuristic(initial_state), 3.);
+}
+
+TEST(MimirTests, SearchHeuristicsLiftedRelaxedExplorationMatchesGroundedTest)
+{
+    for (const auto& domain : std::vector<std::string> { "miconic-fulladl", "philosophers" })
+    {
+        const auto domain_file = fs::path(std::string(DATA_DIR) + domain + "/domain.pddl");
+        const auto problem_file = fs::path(std::string(DATA_DIR) + domain + "/test_problem.pddl");
+        auto parser = PDDLParser(domain_file, problem_file);
+        auto grounded_aag = std::make_shared<GroundedApplicableActionGenerator>(parser.get_problem(), parser.get_pddl_factories());
+        auto lifted_aag = std::make_shared<LiftedApplicableActionGenerator>(parser.get_problem(), parser.get_pddl_factories());
+        auto ssg = std::make_shared<StateRepository>(grounded_aag);
+        auto initial_state = ssg->get_or_create_initial_state();
+
+        auto grounded_hadd = HAddHeuristic(grounded_aag);
+        auto lifted_hadd = LiftedHAddHeuristic(lifted_aag);
+
+        EXPECT_EQ(grounded_hadd.compute_heuristic(initial_state), lifted_hadd.compute_heuristic(initial_state));
+    }
+}
+
+TEST(MimirTests, SearchHeuristicsLiftedRelaxedExplorationGripperAStarTest)
+{
+    const auto domain_file = fs::path(std::string(DATA_DIR) + "gripper/domain.pddl");
+    const auto problem_file = fs::path(std::string(DATA_DIR) + "gripper/test_problem.pddl");
+    auto parser = PDDLParser(domain_file, problem_file);
+    auto aag_event_handler = std::make_shared<DefaultLiftedApplicableActionGeneratorEventHandler>();
+    auto aag = std::make_shared<LiftedApplicableActionGenerator>(parser.get_problem(), parser.get_pddl_factories(), aag_event_handler);
+    auto ssg = std::make_shared<StateRepository>(aag);
+
+    for (const auto& heuristic : std::vector<std::shared_ptr<IHeuristic>> { std::make_shared<LiftedHAddHeuristic>(aag), std::make_shared<LiftedHFFHeuristic>(aag) })
+    {
+        auto astar_event_handler = std::make_shared<DefaultAStarAlgorithmEventHandler>();
+        auto astar = std::make_shared<AStarAlgorithm>(aag, ssg, heuristic, astar_event_handler);
+        auto planner = SinglePlanner(astar);
+        auto [search_status, plan] = planner.find_solution();
+
+        EXPECT_EQ(search_status, SearchStatus::SOLVED);
+        EXPECT_EQ(plan.get_actions().size(), 3);
+    }
+}
+
+}
@@ -0,0 +1,50 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "mimir/search/openlists.hpp"
+
+#include <gtest/gtest.h>
+
+namespace mimir::tests
+{
+
+TEST(MimirTests, SearchOpenListsAlternatingTest)
+{
+    auto open_list = AlternatingOpenList<int>();
+    open_list.insert(1., 1);
+    open_list.insert(2., 2);
+    open_list.insert_preferred(3., 3);
+    EXPECT_EQ(open_list.size(), 4);
+
+    // Ties are broken in favor of the preferred queue.
+    EXPECT_EQ(open_list.top(), 3);
+    open_list.pop();
+    EXPECT_EQ(open_list.top(), 1);
+    open_list.pop();
+
+    // Boosting selects the preferred queue until its counter exceeds the counter of the regular queue.
+    open_list.insert_preferred(4., 4);
+    open_list.insert_preferred(5., 5);
+    open_list.boost_preferred(1);
+    EXPECT_EQ(open_list.top(), 4);
+    open_list.pop();
+    EXPECT_EQ(open_list.top(), 5);
+    open_list.pop();
+    EXPECT_EQ(open_list.top(), 2);
+}
+
+}
@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "mimir/search/openlists.hpp"
+
+#include <gtest/gtest.h>
+
+namespace mimir::tests
+{
+
+TEST(MimirTests, SearchOpenListsBucketFifoTest)
+{
+    auto open_list = BucketOpenList<int>(BucketTieBreaking::FIFO);
+    open_list.insert(2., 1);
+    open_list.insert(1.5, 2);
+    open_list.insert(1., 3);
+    open_list.insert(0., 4);
+    EXPECT_EQ(open_list.size(), 4);
+
+    EXPECT_EQ(open_list.top(), 4);
+    open_list.pop();
+    // Priorities are rounded down, hence, 1.5 and 1 share a bucket.
+    EXPECT_EQ(open_list.top(), 2);
+    open_list.pop();
+    EXPECT_EQ(open_list.top(), 3);
+    open_list.pop();
+
+    // Inserting below the smallest non-empty bucket.
+    open_list.insert(0., 5);
+    EXPECT_EQ(open_list.top(), 5);
+    open_list.pop();
+    EXPECT_EQ(open_list.top(), 1);
+    open_list.pop();
+    EXPECT_TRUE(open_list.empty());
+}
+
+TEST(MimirTests, SearchOpenListsBucketLifoTest)
+{
+    auto open_list = BucketOpenList<int>(BucketTieBreaking::LIFO);
+    open_list.insert(1., 1);
+    open_list.insert(1., 2);
+    open_list.insert(3., 3);
+
+    EXPECT_EQ(open_list.top(), 2);
+    open_list.pop();
+    EXPECT_EQ(open_list.top(), 1);
+    open_list.pop();
+    EXPECT_EQ(open_list.top(), 3);
+    open_list.pop();
+    EXPECT_TRUE(open_list.empty());
+}
+
+TEST(MimirTests, SearchOpenListsBucketMinSecondaryTest)
+{
+    auto open_list = BucketOpenList<int>(BucketTieBreaking::MIN_SECONDARY);
+    open_list.insert(5., 3., 1);
+    open_list.insert(5., 1., 2);
+    open_list.insert(5., 1., 3);
+    open_list.insert(6., 0., 4);
+
+    EXPECT_EQ(open_list.top(), 2);
+    open_list.pop();
+    EXPECT_EQ(open_list.top(), 3);
+    open_list.pop();
+    EXPECT_EQ(open_list.top(), 1);
+    open_list.pop();
+    EXPECT_EQ(open_list.top(), 4);
+    open_list.pop();
+    EXPECT_TRUE(open_list.empty());
+
+    // Secondary priorities are not restricted to a small range.
+    open_list.insert(1., 1e12, 7);
+    open_list.insert(1., 0.5, 8);
+    EXPECT_EQ(open_list.top(), 8);
+    open_list.pop();
+    EXPECT_EQ(open_list.top(), 7);
+    open_list.pop();
+    EXPECT_TRUE(open_list.empty());
+
+    // Clearing keeps the buckets but removes all items.
+    open_list.insert(2., 0., 5);
+    open_list.clear();
+    EXPECT_TRUE(open_list.empty());
+    open_list.insert(1., 0., 6);
+    EXPECT_EQ(open_list.top(), 6);
+}
+
+TEST(MimirTests, SearchOpenListsBucketLargeKeyTest)
+{
+    // Keys are offset by the smallest key, hence, large priorities do not allocate buckets for all smaller keys.
+    auto open_list = BucketOpenList<int>(BucketTieBreaking::MIN_SECONDARY);
+    open_list.insert(1e9, 0., 1);
+    open_list.insert(1e9 + 2, 0., 2);
+    EXPECT_EQ(open_list.get_num_buckets(), 3);
+    EXPECT_EQ(open_list.top(), 1);
+    open_list.pop();
+    EXPECT_EQ(open_list.top(), 2);
+    open_list.pop();
+    EXPECT_TRUE(open_list.empty());
+
+    // Keys beyond the window are kept in far buckets and keys below the window shift it down.
+    auto small_open_list = BucketOpenList<int>(BucketTieBreaking::FIFO, 4);
+    small_open_list.insert(1e6, 3);
+    small_open_list.insert(1e6 + 3, 4);
+    small_open_list.insert(2e6, 5);
+    small_open_list.insert(1e6 + 3, 6);
+    small_open_list.insert(1e6 - 1, 7);
+    EXPECT_EQ(small_open_list.size(), 5);
+    EXPECT_LE(small_open_list.get_num_buckets(), 4);
+
+    auto popped = std::vector<int> {};
+    while (!small_open_list.empty())
+    {
+        popped.push_back(small_open_list.top());
+        small_open_list.pop();
+    }
+    EXPECT_EQ(popped, (std::vector<int> { 7, 3, 4, 6, 5 }));
+}
+
+}
@@ -0,0 +1,120 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "mimir/search/packed_state_repository.hpp"
+
+#include "mimir/formalism/factories.hpp"
+#include "mimir/formalism/ground_atom.hpp"
+#include "mimir/formalism/parser.hpp"
+#include "mimir/formalism/predicate.hpp"
+#include "mimir/formalism/problem.hpp"
+#include "mimir/search/algorithms.hpp"
+#include "mimir/search/applicable_action_generators.hpp"
+#include "mimir/search/mutex_groups.hpp"
+#include "mimir/search/state_repository.hpp"
+
+#include <gtest/gtest.h>
+
+namespace mimir::tests
+{
+
+TEST(MimirTests, SearchPackedStateRepositoryTest)
+{
+    const auto domain_file = fs::path(std::string(DATA_DIR) + "gripper/domain.pddl");
+    const auto problem_file = fs::path(std::string(DATA_DIR) + "gripper/test_problem.pddl");
+    auto parser = PDDLParser(domain_file, problem_file);
+    auto aag = std::make_shared<GroundedApplicableActionGenerator>(parser.get_problem(), parser.get_pddl_factories());
+    auto packed_ssg = PackedStateRepository(aag);
+    auto ssg = StateRepository(aag);
+
+    // One group per ball, one group for the robot, and singletons for free grippers.
+    const auto& mutex_groups = packed_ssg.get_encoder().get_mutex_groups();
+    EXPECT_EQ(mutex_groups.size(), 5);
+    EXPECT_EQ(mutex_groups.at(0).size(), 4);
+    EXPECT_EQ(mutex_groups.at(1).size(), 4);
+    EXPECT_EQ(mutex_groups.at(2).size(), 2);
+    for (const auto atom_index : mutex_groups.at(2))
+    {
+        EXPECT_EQ(parser.get_pddl_factories()->get_ground_atom<Fluent>(atom_index)->get_predicate()->get_name(), "at-robby");
+    }
+    EXPECT_EQ(packed_ssg.get_num_bytes_per_state(), sizeof(PackedBlock));
+
+    // Breadth-first enumeration of the packed states where each unpacked state is checked against the unpacked representation.
+    auto state_builder = StateBuilder();
+    auto applicable_actions = GroundActionList {};
+    auto queue = IndexList { packed_ssg.get_or_create_initial_state() };
+    EXPECT_EQ(queue.front(), ssg.get_or_create_initial_state().get_index());
+
+    for (size_t i = 0; i < queue.size(); ++i)
+    {
+        const auto state = packed_ssg.unpack_state(queue[i], state_builder);
+        EXPECT_EQ(state.get_index(), queue[i]);
+        EXPECT_EQ(ssg.get_or_create_state(state.get_atoms<Fluent>()).get_index(), state.get_index());
+
+        aag->generate_applicable_actions(state, applicable_actions);
+        for (const auto& action : applicable_actions)
+        {
+            const auto num_states = packed_ssg.get_state_count();
+            const auto successor_state_index = packed_ssg.get_or_create_successor_state(state, action);
+            if (successor_state_index == num_states)
+            {
+                queue.push_back(successor_state_index);
+            }
+        }
+    }
+
+    EXPECT_EQ(packed_ssg.get_state_count(), 28);
+    EXPECT_EQ(packed_ssg.get_state_count(), ssg.get_state_count());
+    EXPECT_EQ(packed_ssg.get_reached_fluent_ground_atoms(), ssg.get_reached_fluent_ground_atoms());
+
+    // The packed states need less memory than the unpacked states.
+    EXPECT_EQ(packed_ssg.get_num_bytes(), packed_ssg.get_state_count() * packed_ssg.get_num_bytes_per_state());
+    EXPECT_LT(packed_ssg.get_num_bytes(), ssg.get_num_bytes());
+}
+
+TEST(MimirTests, SearchPackedStateRepositoryBrFSTest)
+{
+    const auto domain_file = fs::path(std::string(DATA_DIR) + "gripper/domain.pddl");
+    const auto problem_file = fs::path(std::string(DATA_DIR) + "gripper/test_problem.pddl");
+    auto parser = PDDLParser(domain_file, problem_file);
+    auto aag = std::make_shared<GroundedApplicableActionGenerator>(parser.get_problem(), parser.get_pddl_factories());
+
+    auto ssg = std::make_shared<StateRepository>(aag);
+    auto brfs_event_handler = std::make_shared<DefaultBrFSAlgorithmEventHandler>();
+    auto brfs = BrFSAlgorithm(aag, ssg, brfs_event_handler);
+    auto plan = GroundActionList {};
+    EXPECT_EQ(brfs.find_solution(plan), SearchStatus::SOLVED);
+
+    auto packed_ssg = std::make_shared<PackedStateRepository>(aag);
+    auto packed_brfs_event_handler = std::make_shared<DefaultBrFSAlgorithmEventHandler>();
+    auto packed_brfs = BrFSAlgorithm(aag, packed_ssg, packed_brfs_event_handler);
+    auto packed_plan = GroundActionList {};
+    auto goal_state = std::optional<State> {};
+    EXPECT_EQ(packed_brfs.find_solution(ssg->get_or_create_initial_state(), packed_plan, goal_state), SearchStatus::SOLVED);
+
+    // Both searches visit the states in the same order.
+    EXPECT_EQ(packed_plan.size(), plan.size());
+    EXPECT_EQ(packed_brfs_event_handler->get_statistics().get_num_generated(), brfs_event_handler->get_statistics().get_num_generated());
+    EXPECT_EQ(packed_brfs_event_handler->get_statistics().get_num_expanded(), brfs_event_handler->get_statistics().get_num_expanded());
+    ASSERT_TRUE(goal_state.has_value());
+    EXPECT_TRUE(goal_state->literals_hold(parser.get_problem()->get_goal_condition<Fluent>()));
+
+    EXPECT_EQ(packed_ssg->get_state_count(), ssg->get_state_count());
+    EXPECT_LT(packed_ssg->get_num_bytes(), ssg->get_num_bytes());
+}
+
+}